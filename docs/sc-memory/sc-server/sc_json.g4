@@ -1,5 +1,9 @@
 grammar sc_json;
 
+// Texts are sent in text websocket frames. The same commands and answers can be sent in binary websocket frames encoded
+// by MessagePack, then answers and sc-events of these commands are sent in binary frames too, and contents of sc-links
+// can be specified by MessagePack bin values.
+
 sc_json_text
   : sc_json_command
   | sc_json_command_answer
@@ -21,6 +25,7 @@ sc_json_command_type_and_payload
   | sc_json_command_handle_keynodes
   | sc_json_command_handle_link_contents
   | sc_json_command_search_template
+  | sc_json_command_search_template_page
   | sc_json_command_generate_template
   | sc_json_command_handle_events
   | sc_json_command_answer_init_event
@@ -43,6 +48,7 @@ sc_json_command_answer_payload
   | sc_json_command_answer_handle_keynodes
   | sc_json_command_answer_handle_link_contents
   | sc_json_command_answer_search_template
+  | sc_json_command_answer_search_template_page
   | sc_json_command_answer_generate_template
   | sc_json_command_answer_handle_events
   ;
@@ -288,6 +294,8 @@ sc_json_command_template_payload
         '{'
             (SC_ALIAS ':' (SC_ADDR_HASH | SC_ALIAS) ',')*
         '}' ','
+        // only for search_template: found sc-constructions are returned by pages of this size
+        ('"page_size"' ':' NUMBER ',')?
     '}' ','
   ;
 
@@ -308,6 +316,32 @@ sc_json_command_answer_search_template
         '{'
             (SC_ALIAS ':' NUMBER ',')*
         '}' ','
+        // if page_size is specified
+        ('"finished"' ':' BOOL ',')?
+        ('"cursor"' ':' NUMBER ',')?
+    '}' ','
+  ;
+
+sc_json_command_search_template_page
+  : '"type"' ':' '"search_template_page"' ','
+    '"payload"' ':'
+    '{'
+        '"cursor"' ':' NUMBER ','
+        ('"page_size"' ':' NUMBER ',' | '"close"' ':' BOOL ',')
+    '}' ','
+  ;
+
+sc_json_command_answer_search_template_page
+  : '"payload"' ':'
+    '{'
+        '"cursor"' ':' NUMBER ','
+        '"addrs"' ':'
+        '['
+            ('['
+                (SC_ADDR_HASH ',')*
+            ']' ',')*
+        ']' ','
+        '"finished"' ':' BOOL ','
     '}' ','
   ;
 
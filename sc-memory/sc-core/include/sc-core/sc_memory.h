@@ -98,6 +98,23 @@ _SC_EXTERN sc_result sc_memory_shutdown(sc_bool save_state);
  */
 _SC_EXTERN void sc_memory_shutdown_extensions();
 
+/*!
+ * @brief Writes bundle of saved sc-memory binaries.
+ *
+ * This function writes sc-memory segments, sc-links contents and their terms index saved in `params->storage`
+ * directory into one versioned bundle file. Sections of the bundle are checksummed and aligned to memory pages.
+ * The bundle is extracted on sc-memory initialization, if it is specified in `params->bundle` and the storage
+ * directory doesn't contain saved sc-memory.
+ *
+ * @param params Pointer to sc-memory parameters with path to binaries directory and sc-memory version.
+ * @param bundle_path Path to bundle file to write.
+ *
+ * @return Returns SC_RESULT_OK if the bundle is written; otherwise, SC_RESULT_ERROR is returned.
+ *
+ * @note Sc-memory should be saved and shut down before this function is called.
+ */
+_SC_EXTERN sc_result sc_memory_write_bundle(sc_memory_params const * params, sc_char const * bundle_path);
+
 /*!
  * Generates a new sc-memory context for a specified user.
  *
@@ -417,6 +434,91 @@ _SC_EXTERN sc_addr sc_memory_arc_new_ext(
     sc_addr end_addr,
     sc_result * result);
 
+/*!
+ * @brief Generates sc-nodes with the specified types.
+ *
+ * This function creates `count` sc-nodes in one call. The sc-memory context is checked once for all of them.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Array of `count` types of the new sc-nodes.
+ * @param count Count of the new sc-nodes.
+ * @param addrs Array of `count` sc-addrs where sc-addrs of the generated sc-nodes are stored. sc-addr of sc-node that
+ *              wasn't generated is empty.
+ *
+ * @return Returns SC_RESULT_OK if all sc-nodes were generated, otherwise the result of the last failed generation.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE One of the specified sc-types is not valid for a sc-node.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Unable to allocate memory for the new sc-nodes.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ */
+_SC_EXTERN sc_result
+sc_memory_nodes_new_batch(sc_memory_context const * ctx, sc_type const * types, sc_uint32 count, sc_addr * addrs);
+
+/*!
+ * @brief Generates sc-links with the specified types.
+ *
+ * This function creates `count` sc-links in one call. The sc-memory context is checked once for all of them.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Array of `count` types of the new sc-links.
+ * @param count Count of the new sc-links.
+ * @param addrs Array of `count` sc-addrs where sc-addrs of the generated sc-links are stored. sc-addr of sc-link that
+ *              wasn't generated is empty.
+ *
+ * @return Returns SC_RESULT_OK if all sc-links were generated, otherwise the result of the last failed generation.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK One of the specified sc-types is not valid for a sc-link.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Unable to allocate memory for the new sc-links.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ */
+_SC_EXTERN sc_result
+sc_memory_links_new_batch(sc_memory_context const * ctx, sc_type const * types, sc_uint32 count, sc_addr * addrs);
+
+/*!
+ * @brief Generates sc-connectors with the specified types between the specified sc-elements.
+ *
+ * This function creates `count` sc-connectors in one call. The i-th sc-connector has type `types[i]` and goes from
+ * `beg_addrs[i]` to `end_addrs[i]`. Sc-connectors are grouped by monitors of their begin and end sc-elements, and
+ * each group is generated under one lock of these monitors. Sc-connectors of one group are generated in order of the
+ * arrays, groups are generated in order of their monitors. Events of the generated sc-connectors are emitted after all
+ * of them are generated, as if they were generated between `sc_memory_context_pending_begin` and
+ * `sc_memory_context_pending_end`.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Array of `count` types of the new sc-connectors.
+ * @param beg_addrs Array of `count` sc-addrs of the begin sc-elements.
+ * @param end_addrs Array of `count` sc-addrs of the end sc-elements.
+ * @param count Count of the new sc-connectors.
+ * @param connector_addrs Array of `count` sc-addrs where sc-addrs of the generated sc-connectors are stored. sc-addr
+ *                        of sc-connector that wasn't generated is empty.
+ *
+ * @return Returns SC_RESULT_OK if all sc-connectors were generated, otherwise the result of the last failed
+ *         generation.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR One of the specified types is not a valid sc-connector type.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID One of the begin or end sc-addrs is not valid.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Memory allocation for the new sc-connectors failed.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context does not have
+ * write permissions.
+ */
+_SC_EXTERN sc_result sc_memory_arcs_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_addr const * beg_addrs,
+    sc_addr const * end_addrs,
+    sc_uint32 count,
+    sc_addr * connector_addrs);
+
 /*!
  * @brief Retrieves the count of output connectors for the specified sc-element.
  *
@@ -14,10 +14,14 @@
 #define DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES SC_TRUE
 #define DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS 32
 #define DEFAULT_MIN_EVENTS_AND_AGENTS_THREADS 1
+#define DEFAULT_EVENTS_QUEUE_SIZE 16384
+#define DEFAULT_EVENTS_THREADS_AFFINITY SC_FALSE
 #define DEFAULT_DUMP_MEMORY SC_TRUE
 #define DEFAULT_DUMP_MEMORY_PERIOD 32000
 #define DEFAULT_DUMP_MEMORY_STATISTICS SC_TRUE
 #define DEFAULT_DUMP_MEMORY_STATISTICS_PERIOD 16000
+#define DEFAULT_WAL SC_FALSE
+#define DEFAULT_WAL_SYNC_PERIOD 100
 #define DEFAULT_LOG_TYPE "Console"
 #define DEFAULT_LOG_FILE ""
 #define DEFAULT_LOG_LEVEL "Info"
@@ -26,6 +30,7 @@
 #define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
 #define DEFAULT_TERM_SEPARATORS " _"
 #define DEFAULT_SEARCH_BY_SUBSTRING SC_TRUE
+#define DEFAULT_LINK_CONTENTS_CACHE_SIZE 16777216
 
 /*! Structure representing parameters for configuring the sc-memory.
  * @note This structure holds various configuration parameters that control the behavior of the sc-memory.
@@ -37,6 +42,9 @@ typedef struct
   ///< Boolean indicating whether to clear existing data during initialization. By default, it is SC_FALSE.
   sc_bool clear;
   sc_char const * storage;                  ///< Path to the binaries directory.
+  ///< Path to the bundle of binaries written by sc-builder. It is extracted into the binaries directory if this
+  ///< directory doesn't contain saved sc-memory. By default, it is null_ptr.
+  sc_char const * bundle;
   sc_char const ** extensions_directories;  ///< Array of extensions directories.
   sc_uint32 extensions_directories_count;   ///< Size of extensions directories array.
   sc_char const ** enabled_extensions;      ///< Array of enabled extensions.
@@ -46,6 +54,12 @@ typedef struct
   ///< Boolean indicating whether sc-memory limit `max_events_and_agents_threads` by maximum physical core number.
   sc_bool limit_max_threads_by_max_physical_cores;
   sc_uint32 max_events_and_agents_threads;  ///< Maximum number of threads for events and agents processing.
+  ///< Number of sc-events that can wait for processing without memory allocations. It is rounded up to a power of two.
+  ///< By default, it is 16384.
+  sc_uint32 events_queue_size;
+  ///< Boolean indicating whether threads processing events and agents are bound to processor cores. By default, it is
+  ///< SC_FALSE.
+  sc_bool events_threads_affinity;
 
   ///< Boolean indicating whether automatic saving of sc-memory state. By default, it is SC_TRUE.
   sc_bool dump_memory;
@@ -55,6 +69,12 @@ typedef struct
   sc_bool dump_memory_statistics;
   sc_uint32 dump_memory_statistics_period;  ///< Period (in seconds) for dumping statistics of sc-memory state.
 
+  ///< Boolean indicating whether sc-memory changes are written to write-ahead log. By default, it is SC_FALSE.
+  sc_bool wal;
+  ///< Period (in milliseconds) for writing write-ahead log records to disk. If it is 0, records are written on each
+  ///< change. By default, it is 100.
+  sc_uint32 wal_sync_period;
+
   sc_char const * log_type;   ///< Type of logging (e.g., "Console", "File").
   sc_char const * log_file;   ///< Path to the log file (if log_type is "File").
   sc_char const * log_level;  ///< Log level (e.g., "Error", "Warning", "Info", "Debug").
@@ -69,6 +89,9 @@ typedef struct
   sc_uint32 max_searchable_string_size;  ///< Maximum size of a searchable string.
   sc_char const * term_separators;       ///< String containing term separators used in string operations.
   sc_bool search_by_substring;           ///< Boolean indicating whether to allow searching by substring.
+  ///< Maximum size (in bytes) of cache of read sc-links contents. If it is 0, sc-links contents aren't cached. By
+  ///< default, it is 16777216.
+  sc_uint32 link_contents_cache_size;
 } sc_memory_params;
 
 _SC_EXTERN void sc_memory_params_clear(sc_memory_params * params);
@@ -24,9 +24,9 @@ void sc_monitor_init(sc_monitor * monitor)
   sc_mutex_init(&monitor->rw_mutex);
   monitor->id = 1;
   monitor->active_readers = 0;
+  monitor->writers = 0;
   monitor->active_writer = 0;
   sc_queue_init(&monitor->queue);
-  sc_mutex_init(&monitor->ref_count_mutex);
   monitor->ref_count = 0;
 }
 
@@ -35,37 +35,45 @@ void sc_monitor_destroy(sc_monitor * monitor)
   if (monitor == null_ptr || monitor->id == 0)
     return;
 
-  sc_mutex_lock(&monitor->ref_count_mutex);
-  while (monitor->ref_count > 0)
-  {
-    sc_mutex_unlock(&monitor->ref_count_mutex);
+  while (g_atomic_int_get(&monitor->ref_count) > 0 || g_atomic_int_get(&monitor->active_readers) > 0)
     g_usleep(SC_MONITOR_FREE_PERIOD_CHECK);
-    sc_mutex_lock(&monitor->ref_count_mutex);
-  }
-  sc_mutex_unlock(&monitor->ref_count_mutex);
 
   sc_mutex_destroy(&monitor->rw_mutex);
   monitor->active_readers = 0;
+  monitor->writers = 0;
   monitor->active_writer = 0;
   monitor->id = 0;
   sc_queue_destroy(&monitor->queue);
-  sc_mutex_destroy(&monitor->ref_count_mutex);
   monitor->ref_count = 0;
 }
 
 void sc_monitor_acquire(sc_monitor * monitor)
 {
-  sc_mutex_lock(&monitor->ref_count_mutex);
-  monitor->ref_count++;
-  sc_mutex_unlock(&monitor->ref_count_mutex);
+  g_atomic_int_inc(&monitor->ref_count);
 }
 
 void sc_monitor_release(sc_monitor * monitor)
 {
-  sc_mutex_lock(&monitor->ref_count_mutex);
-  if (monitor->ref_count > 0)
-    monitor->ref_count--;
-  sc_mutex_unlock(&monitor->ref_count_mutex);
+  g_atomic_int_add(&monitor->ref_count, -1);
+}
+
+// Wakes up the first waiting request, if it is not woken up by the last releasing reader.
+void _sc_monitor_signal_front(sc_monitor * monitor)
+{
+  if (!sc_queue_empty(&monitor->queue))
+    sc_cond_signal(&((sc_request *)sc_queue_front(&monitor->queue))->condition);
+}
+
+void _sc_monitor_release_reader(sc_monitor * monitor)
+{
+  // The last reader wakes up a waiting writer. The writer counts itself before it checks readers, so either it sees
+  // no readers or the reader sees it.
+  if (g_atomic_int_dec_and_test(&monitor->active_readers) && g_atomic_int_get(&monitor->writers) > 0)
+  {
+    sc_mutex_lock(&monitor->rw_mutex);
+    _sc_monitor_signal_front(monitor);
+    sc_mutex_unlock(&monitor->rw_mutex);
+  }
 }
 
 void sc_monitor_acquire_read(sc_monitor * monitor)
@@ -73,6 +81,17 @@ void sc_monitor_acquire_read(sc_monitor * monitor)
   if (monitor == null_ptr || monitor->id == 0)
     return;
 
+  // Fast path: while there are no waiting or writing writers, readers only count themselves. Readers coming after a
+  // writer wait in queue behind it, so writers are not starved.
+  if (g_atomic_int_get(&monitor->writers) == 0)
+  {
+    g_atomic_int_inc(&monitor->active_readers);
+    if (g_atomic_int_get(&monitor->writers) == 0)
+      return;
+
+    _sc_monitor_release_reader(monitor);
+  }
+
   sc_monitor_acquire(monitor);
 
   sc_mutex_lock(&monitor->rw_mutex);
@@ -86,28 +105,38 @@ void sc_monitor_acquire_read(sc_monitor * monitor)
 
   sc_request * popped_request = sc_queue_pop(&monitor->queue);
   sc_cond_destroy(&popped_request->condition);
-  ++monitor->active_readers;
+  g_atomic_int_inc(&monitor->active_readers);
+
+  // readers waiting behind this reader can read together with it
+  _sc_monitor_signal_front(monitor);
 
   sc_mutex_unlock(&monitor->rw_mutex);
+
+  sc_monitor_release(monitor);
 }
 
-void sc_monitor_release_read(sc_monitor * monitor)
+sc_bool sc_monitor_try_acquire_read(sc_monitor * monitor)
 {
   if (monitor == null_ptr || monitor->id == 0)
-    return;
+    return SC_TRUE;
 
-  sc_mutex_lock(&monitor->rw_mutex);
+  if (g_atomic_int_get(&monitor->writers) != 0)
+    return SC_FALSE;
 
-  --monitor->active_readers;
-  if (monitor->active_readers == 0)
-  {
-    if (!sc_queue_empty(&monitor->queue))
-      sc_cond_signal(&((sc_request *)sc_queue_front(&monitor->queue))->condition);
-  }
+  g_atomic_int_inc(&monitor->active_readers);
+  if (g_atomic_int_get(&monitor->writers) == 0)
+    return SC_TRUE;
 
-  sc_mutex_unlock(&monitor->rw_mutex);
+  _sc_monitor_release_reader(monitor);
+  return SC_FALSE;
+}
 
-  sc_monitor_release(monitor);
+void sc_monitor_release_read(sc_monitor * monitor)
+{
+  if (monitor == null_ptr || monitor->id == 0)
+    return;
+
+  _sc_monitor_release_reader(monitor);
 }
 
 void sc_monitor_acquire_write(sc_monitor * monitor)
@@ -119,11 +148,14 @@ void sc_monitor_acquire_write(sc_monitor * monitor)
 
   sc_mutex_lock(&monitor->rw_mutex);
 
+  g_atomic_int_inc(&monitor->writers);
+
   sc_request current_request = (sc_request){.thread = sc_thread_self()};
   sc_cond_init(&current_request.condition);
   sc_queue_push(&monitor->queue, &current_request);
 
-  while (sc_queue_front(&monitor->queue) != &current_request || monitor->active_writer || monitor->active_readers > 0)
+  while (sc_queue_front(&monitor->queue) != &current_request || monitor->active_writer
+         || g_atomic_int_get(&monitor->active_readers) > 0)
     sc_cond_wait(&current_request.condition, &monitor->rw_mutex);
 
   sc_request * popped_request = sc_queue_pop(&monitor->queue);
@@ -133,6 +165,40 @@ void sc_monitor_acquire_write(sc_monitor * monitor)
   sc_mutex_unlock(&monitor->rw_mutex);
 }
 
+sc_bool sc_monitor_try_acquire_write(sc_monitor * monitor)
+{
+  if (monitor == null_ptr || monitor->id == 0)
+    return SC_TRUE;
+
+  if (g_atomic_int_get(&monitor->writers) != 0 || g_atomic_int_get(&monitor->active_readers) > 0)
+    return SC_FALSE;
+
+  sc_monitor_acquire(monitor);
+
+  sc_mutex_lock(&monitor->rw_mutex);
+
+  if (!sc_queue_empty(&monitor->queue) || monitor->active_writer)
+    goto error;
+
+  // the writer counts itself before it checks readers, as waiting writers do
+  g_atomic_int_inc(&monitor->writers);
+  if (g_atomic_int_get(&monitor->active_readers) > 0)
+  {
+    g_atomic_int_add(&monitor->writers, -1);
+    goto error;
+  }
+
+  monitor->active_writer = 1;
+
+  sc_mutex_unlock(&monitor->rw_mutex);
+  return SC_TRUE;
+
+error:
+  sc_mutex_unlock(&monitor->rw_mutex);
+  sc_monitor_release(monitor);
+  return SC_FALSE;
+}
+
 void sc_monitor_release_write(sc_monitor * monitor)
 {
   if (monitor == null_ptr || monitor->id == 0)
@@ -141,9 +207,9 @@ void sc_monitor_release_write(sc_monitor * monitor)
   sc_mutex_lock(&monitor->rw_mutex);
 
   monitor->active_writer = 0;
+  g_atomic_int_add(&monitor->writers, -1);
 
-  if (!sc_queue_empty(&monitor->queue))
-    sc_cond_signal(&((sc_request *)sc_queue_front(&monitor->queue))->condition);
+  _sc_monitor_signal_front(monitor);
 
   sc_mutex_unlock(&monitor->rw_mutex);
 
@@ -15,13 +15,27 @@
 
 struct _sc_monitor
 {
-  sc_mutex rw_mutex;         // Mutex for data protection
-  sc_queue queue;            // Queue of writers and readers
-  sc_uint32 active_readers;  // Number of readers currently accessing the data
-  sc_uint32 active_writer;   // Flag to indicate if a writer is writing
-  sc_uint32 id;              // Unique identifier of monitor
-  sc_mutex ref_count_mutex;
-  sc_uint32 ref_count;
+  sc_mutex rw_mutex;        // Mutex for data protection
+  sc_queue queue;           // Queue of writers and readers waiting for access
+  sc_int32 active_readers;  // Number of readers currently accessing the data, changed atomically
+  sc_int32 writers;         // Number of writers waiting for access or writing, changed atomically
+  sc_uint32 active_writer;  // Flag to indicate if a writer is writing
+  sc_uint32 id;             // Unique identifier of monitor
+  sc_int32 ref_count;       // Number of threads waiting in queue or writing, changed atomically
 };
 
+/*! Acquires monitor for reading, if there are no waiting or writing writers.
+ * @param monitor Pointer to monitor
+ * @returns SC_FALSE, if monitor isn't acquired, because it can't be acquired without waiting.
+ * @remarks It doesn't wait, so it can be used to acquire monitors out of order of their identifiers.
+ */
+sc_bool sc_monitor_try_acquire_read(sc_monitor * monitor);
+
+/*! Acquires monitor for writing, if there are no readers and no waiting or writing writers.
+ * @param monitor Pointer to monitor
+ * @returns SC_FALSE, if monitor isn't acquired, because it can't be acquired without waiting.
+ * @remarks It doesn't wait, so it can be used to acquire monitors out of order of their identifiers.
+ */
+sc_bool sc_monitor_try_acquire_write(sc_monitor * monitor);
+
 #endif
@@ -13,4 +13,11 @@ typedef GThread sc_thread;
 
 #define sc_thread_self g_thread_self
 
+typedef GPrivate sc_thread_local;
+
+//! Initializes thread local pointer, `destroy` is called with its not null value on exit of thread
+#define SC_THREAD_LOCAL_INIT(destroy) G_PRIVATE_INIT(destroy)
+#define sc_thread_local_get g_private_get
+#define sc_thread_local_set g_private_set
+
 #endif
@@ -0,0 +1,200 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_number_hash_map.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#define SC_NUMBER_HASH_MAP_MIN_CAPACITY_POWER 4
+// entries array is reallocated by sc_mem_new, so its size in bytes must fit into sc_uint32
+#define SC_NUMBER_HASH_MAP_MAX_CAPACITY_POWER 27
+// golden ratio multiplier of Fibonacci hashing
+#define SC_NUMBER_HASH_MAP_MULTIPLIER 11400714819323198485ULL
+
+#define SC_NUMBER_HASH_MAP_IS_OVERLOADED(map, size) ((size) * 4 > (map)->capacity * 3)
+
+sc_uint64 _sc_number_hash_map_get_home_index(sc_number_hash_map const * map, sc_uint64 const key)
+{
+  return (key * SC_NUMBER_HASH_MAP_MULTIPLIER) >> (64 - map->capacity_power);
+}
+
+sc_number_hash_map_entry * _sc_number_hash_map_entries_new(sc_uint64 const capacity)
+{
+  sc_number_hash_map_entry * entries = sc_mem_new(sc_number_hash_map_entry, capacity);
+  if (entries == null_ptr)
+    return null_ptr;
+
+  // all bytes of SC_NUMBER_HASH_MAP_EMPTY_KEY are 0xff
+  sc_mem_set(entries, 0xff, sizeof(sc_number_hash_map_entry) * capacity);
+  return entries;
+}
+
+sc_number_hash_map_entry * _sc_number_hash_map_find(sc_number_hash_map const * map, sc_uint64 const key)
+{
+  sc_uint64 const mask = map->capacity - 1;
+  for (sc_uint64 i = _sc_number_hash_map_get_home_index(map, key);; i = (i + 1) & mask)
+  {
+    sc_number_hash_map_entry * entry = &map->entries[i];
+    if (entry->key == key)
+      return entry;
+    if (entry->key == SC_NUMBER_HASH_MAP_EMPTY_KEY)
+      return null_ptr;
+  }
+}
+
+void _sc_number_hash_map_put(sc_number_hash_map * map, sc_uint64 const key, sc_uint64 const value)
+{
+  sc_uint64 const mask = map->capacity - 1;
+  sc_uint64 i = _sc_number_hash_map_get_home_index(map, key);
+  while (map->entries[i].key != SC_NUMBER_HASH_MAP_EMPTY_KEY && map->entries[i].key != key)
+    i = (i + 1) & mask;
+
+  if (map->entries[i].key == SC_NUMBER_HASH_MAP_EMPTY_KEY)
+    ++map->size;
+
+  map->entries[i].key = key;
+  map->entries[i].value = value;
+}
+
+sc_bool _sc_number_hash_map_resize(sc_number_hash_map * map, sc_uint8 const capacity_power)
+{
+  if (capacity_power > SC_NUMBER_HASH_MAP_MAX_CAPACITY_POWER)
+    return SC_FALSE;
+
+  sc_uint64 const capacity = 1ULL << capacity_power;
+  sc_number_hash_map_entry * entries = _sc_number_hash_map_entries_new(capacity);
+  if (entries == null_ptr)
+    return SC_FALSE;
+
+  sc_number_hash_map_entry * old_entries = map->entries;
+  sc_uint64 const old_capacity = map->capacity;
+
+  map->entries = entries;
+  map->capacity = capacity;
+  map->capacity_power = capacity_power;
+  map->size = 0;
+
+  for (sc_uint64 i = 0; i < old_capacity; ++i)
+  {
+    if (old_entries[i].key != SC_NUMBER_HASH_MAP_EMPTY_KEY)
+      _sc_number_hash_map_put(map, old_entries[i].key, old_entries[i].value);
+  }
+
+  sc_mem_free(old_entries);
+  return SC_TRUE;
+}
+
+sc_bool sc_number_hash_map_initialize(sc_number_hash_map ** map, sc_uint64 capacity)
+{
+  if (map == null_ptr)
+    return SC_FALSE;
+
+  sc_uint8 capacity_power = SC_NUMBER_HASH_MAP_MIN_CAPACITY_POWER;
+  while (capacity_power < SC_NUMBER_HASH_MAP_MAX_CAPACITY_POWER && capacity * 4 > (1ULL << capacity_power) * 3)
+    ++capacity_power;
+
+  *map = sc_mem_new(sc_number_hash_map, 1);
+  (*map)->capacity_power = capacity_power;
+  (*map)->capacity = 1ULL << capacity_power;
+  (*map)->size = 0;
+  (*map)->entries = _sc_number_hash_map_entries_new((*map)->capacity);
+  if ((*map)->entries == null_ptr)
+  {
+    sc_mem_free(*map);
+    *map = null_ptr;
+    return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
+sc_bool sc_number_hash_map_destroy(sc_number_hash_map * map)
+{
+  if (map == null_ptr)
+    return SC_FALSE;
+
+  sc_mem_free(map->entries);
+  sc_mem_free(map);
+  return SC_TRUE;
+}
+
+sc_bool sc_number_hash_map_insert(sc_number_hash_map * map, sc_uint64 key, sc_uint64 value)
+{
+  if (map == null_ptr || key == SC_NUMBER_HASH_MAP_EMPTY_KEY)
+    return SC_FALSE;
+
+  if (SC_NUMBER_HASH_MAP_IS_OVERLOADED(map, map->size + 1) && _sc_number_hash_map_find(map, key) == null_ptr)
+  {
+    // at least one entry must stay empty to end probe sequences
+    if (!_sc_number_hash_map_resize(map, map->capacity_power + 1) && map->size + 1 == map->capacity)
+      return SC_FALSE;
+  }
+
+  _sc_number_hash_map_put(map, key, value);
+  return SC_TRUE;
+}
+
+sc_bool sc_number_hash_map_get(sc_number_hash_map const * map, sc_uint64 key, sc_uint64 * value)
+{
+  if (map == null_ptr || key == SC_NUMBER_HASH_MAP_EMPTY_KEY)
+    return SC_FALSE;
+
+  sc_number_hash_map_entry const * entry = _sc_number_hash_map_find(map, key);
+  if (entry == null_ptr)
+    return SC_FALSE;
+
+  if (value != null_ptr)
+    *value = entry->value;
+  return SC_TRUE;
+}
+
+sc_bool sc_number_hash_map_remove(sc_number_hash_map * map, sc_uint64 key, sc_uint64 * value)
+{
+  if (map == null_ptr || key == SC_NUMBER_HASH_MAP_EMPTY_KEY)
+    return SC_FALSE;
+
+  sc_number_hash_map_entry * entry = _sc_number_hash_map_find(map, key);
+  if (entry == null_ptr)
+    return SC_FALSE;
+
+  if (value != null_ptr)
+    *value = entry->value;
+
+  // shift back entries of the probe sequence which home indices don't lie between the hole and them
+  sc_uint64 const mask = map->capacity - 1;
+  sc_uint64 hole = entry - map->entries;
+  for (sc_uint64 i = (hole + 1) & mask; map->entries[i].key != SC_NUMBER_HASH_MAP_EMPTY_KEY; i = (i + 1) & mask)
+  {
+    sc_uint64 const home = _sc_number_hash_map_get_home_index(map, map->entries[i].key);
+    if (((i - home) & mask) >= ((i - hole) & mask))
+    {
+      map->entries[hole] = map->entries[i];
+      hole = i;
+    }
+  }
+
+  map->entries[hole].key = SC_NUMBER_HASH_MAP_EMPTY_KEY;
+  --map->size;
+  return SC_TRUE;
+}
+
+sc_bool sc_number_hash_map_visit(
+    sc_number_hash_map const * map,
+    sc_bool (*callable)(sc_uint64, sc_uint64, void **),
+    void ** dest)
+{
+  if (map == null_ptr)
+    return SC_FALSE;
+
+  for (sc_uint64 i = 0; i < map->capacity; ++i)
+  {
+    sc_number_hash_map_entry const * entry = &map->entries[i];
+    if (entry->key != SC_NUMBER_HASH_MAP_EMPTY_KEY && !callable(entry->key, entry->value, dest))
+      return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
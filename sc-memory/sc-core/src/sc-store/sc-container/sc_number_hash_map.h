@@ -0,0 +1,83 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_number_hash_map_h_
+#define _sc_number_hash_map_h_
+
+#include "sc-core/sc_types.h"
+
+//! Key that marks empty entries of sc-number-hash-map, it can't be stored in sc-number-hash-map
+#define SC_NUMBER_HASH_MAP_EMPTY_KEY ((sc_uint64)0xffffffffffffffffULL)
+
+//! A sc-number-hash-map structure entry to store pairs of <number, number> type
+typedef struct _sc_number_hash_map_entry
+{
+  sc_uint64 key;    // entry key or SC_NUMBER_HASH_MAP_EMPTY_KEY, if entry is empty
+  sc_uint64 value;  // entry value
+} sc_number_hash_map_entry;
+
+/*! A sc-number-hash-map structure to store pairs of <number, number> type in one array of entries. Collisions are
+ * resolved by linear probing, removed entries are filled by shifting back next entries of the same probe sequence, so
+ * entries don't leave tombstones.
+ * @note Sc-number-hash-map isn't thread-safe, access to it must be synchronized by its owner.
+ */
+typedef struct _sc_number_hash_map
+{
+  sc_number_hash_map_entry * entries;  // entries array with size equal to capacity
+  sc_uint64 capacity;                  // entries array size, it is a power of two
+  sc_uint64 size;                      // number of not empty entries
+  sc_uint8 capacity_power;             // binary logarithm of capacity
+} sc_number_hash_map;
+
+/*! Initializes a sc-number-hash-map.
+ * @param[out] map Pointer to a sc-number-hash-map pointer to initialize
+ * @param[in] capacity Expected number of entries, sc-number-hash-map grows when it's exceeded
+ * @returns Returns SC_TRUE, if sc-number-hash-map is initialized; otherwise return SC_FALSE.
+ */
+sc_bool sc_number_hash_map_initialize(sc_number_hash_map ** map, sc_uint64 capacity);
+
+/*! Destroys a sc-number-hash-map.
+ * @param map A sc-number-hash-map pointer to destroy
+ * @returns Returns SC_TRUE, if a sc-number-hash-map exists; otherwise return SC_FALSE.
+ */
+sc_bool sc_number_hash_map_destroy(sc_number_hash_map * map);
+
+/*! Inserts a value by key into a sc-number-hash-map or replaces value stored by this key.
+ * @param map A sc-number-hash-map pointer
+ * @param key A key, it mustn't be equal to SC_NUMBER_HASH_MAP_EMPTY_KEY
+ * @param value A value to store by key
+ * @returns Returns SC_TRUE, if value is inserted or replaced; otherwise return SC_FALSE.
+ */
+sc_bool sc_number_hash_map_insert(sc_number_hash_map * map, sc_uint64 key, sc_uint64 value);
+
+/*! Gets a value by key from a sc-number-hash-map.
+ * @param map A sc-number-hash-map pointer
+ * @param key A key to retrieve value by it
+ * @param[out] value Pointer to value stored by key, it isn't changed if there is no such key
+ * @returns Returns SC_TRUE, if value is stored by key; otherwise return SC_FALSE.
+ */
+sc_bool sc_number_hash_map_get(sc_number_hash_map const * map, sc_uint64 key, sc_uint64 * value);
+
+/*! Removes a value by key from a sc-number-hash-map.
+ * @param map A sc-number-hash-map pointer
+ * @param key A key to remove value by it
+ * @param[out] value Pointer to removed value, it may be null_ptr
+ * @returns Returns SC_TRUE, if value was stored by key; otherwise return SC_FALSE.
+ */
+sc_bool sc_number_hash_map_remove(sc_number_hash_map * map, sc_uint64 key, sc_uint64 * value);
+
+/*! Visits all entries of a sc-number-hash-map in order of their entries array.
+ * @param map A sc-number-hash-map pointer
+ * @param callable A function that is called for each pair of <key, value> and stops visiting if returns SC_FALSE
+ * @param dest Arguments passed to callable
+ * @returns Returns SC_TRUE, if all entries are visited; otherwise return SC_FALSE.
+ */
+sc_bool sc_number_hash_map_visit(
+    sc_number_hash_map const * map,
+    sc_bool (*callable)(sc_uint64, sc_uint64, void **),
+    void ** dest);
+
+#endif
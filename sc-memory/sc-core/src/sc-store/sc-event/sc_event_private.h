@@ -12,6 +12,8 @@
 #include "sc-core/sc_event_subscription.h"
 #include "sc-core/sc_types.h"
 
+#include "sc_memory_context_manager.h"
+
 #define SC_EVENT_REQUEST_DESTROY (sc_uint32)(1 << 31)
 
 //! Structure that contains information about event
@@ -80,4 +82,14 @@ sc_result sc_event_emit_impl(
     sc_event_do_after_callback callback,
     sc_addr event_addr);
 
+/*! Emits pending events immediately. Read section of sc-event subscriptions index is entered once for all of them.
+ * @param ctx A pointer to context, that emits events
+ * @param params An array of parameters of emitting events
+ * @param params_count A number of emitting events
+ */
+void sc_event_emit_batch_impl(
+    sc_memory_context const * ctx,
+    sc_event_emit_params const * params,
+    sc_uint32 params_count);
+
 #endif
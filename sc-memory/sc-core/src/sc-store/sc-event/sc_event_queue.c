@@ -4,8 +4,17 @@
  * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#  define _GNU_SOURCE  // for binding threads to processor cores
+#endif
+
 #include "sc_event_queue.h"
 
+#include <pthread.h>
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+
 #include "sc-core/sc_event_subscription.h"
 #include "sc_event_private.h"
 
@@ -16,6 +25,11 @@
 
 #include "sc-core/sc-base/sc_allocator.h"
 
+#define SC_EVENT_QUEUE_MIN_SIZE 16
+#define SC_EVENT_EMISSION_BATCH_SIZE 32
+//! Time (in microseconds) after which worker thread hands the rest of its batch back, if other worker threads sleep
+#define SC_EVENT_EMISSION_BATCH_TIME 10000
+
 /*! Structure representing elementary sc-event.
  * @note This structure holds information required for processing events in a worker thread.
  */
@@ -29,50 +43,57 @@ typedef struct
   sc_event_do_after_callback callback;  ///< A pointer to function that is executed after the execution of a function
                                         ///< that was called on the initiated event.
   sc_addr event_addr;                   ///< An argument of callback.
+  sc_int64 emit_time;                   ///< Monotonic time (in microseconds) when the event was added to queue.
 } sc_event;
 
-sc_event * _sc_event_new(
-    sc_event_subscription * event_subscription,
-    sc_addr user_addr,
-    sc_addr connector_addr,
-    sc_type connector_type,
-    sc_addr other_addr,
-    sc_event_do_after_callback callback,
-    sc_addr event_addr)
+/*! Structure representing a slot of ring buffer of sc-event emission manager.
+ * @note Slot at position `p` can be written, when its sequence is equal to `p`, and it can be read, when its sequence
+ * is equal to `p + 1`. Reader sets sequence to `p + slots count`, so slot can be written at the next lap.
+ */
+struct _sc_event_queue_slot
+{
+  sc_uint32 sequence;  ///< Sequence number of the slot, changed atomically.
+  sc_event event;      ///< sc-event stored in the slot.
+};
+
+//! Structure representing a worker thread of sc-event emission manager.
+struct _sc_event_emission_worker
 {
-  sc_event * event = sc_mem_new(sc_event, 1);
-  event->event_subscription = event_subscription;
-  event->user_addr = user_addr;
-  event->connector_addr = connector_addr;
-  event->connector_type = connector_type;
-  event->other_addr = other_addr;
-  event->callback = callback;
-  event->event_addr = event_addr;
+  pthread_t thread;                         ///< Thread processing sc-events.
+  sc_uint32 index;                          ///< Index of the worker thread.
+  sc_event_emission_manager * manager;      ///< Pointer to the sc-event emission manager of the worker thread.
+  sc_mutex statistics_mutex;                ///< Mutex for synchronizing access to statistics of the worker thread.
+  sc_event_emission_statistics statistics;  ///< Statistics of sc-events taken by the worker thread.
+};
+
+sc_uint32 _sc_event_queue_atomic_get(sc_uint32 * value)
+{
+  return (sc_uint32)g_atomic_int_get((sc_int32 *)value);
+}
 
-  return event;
+void _sc_event_queue_atomic_set(sc_uint32 * value, sc_uint32 new_value)
+{
+  g_atomic_int_set((sc_int32 *)value, (sc_int32)new_value);
 }
 
-void _sc_event_emission_pool_worker_data_destroy(sc_event * data)
+sc_bool _sc_event_queue_atomic_compare_and_exchange(sc_uint32 * value, sc_uint32 old_value, sc_uint32 new_value)
 {
-  sc_mem_free(data);
+  return g_atomic_int_compare_and_exchange((sc_int32 *)value, (sc_int32)old_value, (sc_int32)new_value);
 }
 
-/*! Function that represents the work performed by a worker in the sc-event emission pool.
- * @param data Pointer to the sc_event containing information about the work.
- * @param user_data Pointer to the sc_event_emission_manager managing the sc-event emission.
+/*! Function that processes an sc-event in a worker thread of the sc-event emission manager.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param event Pointer to the sc_event containing information about the work.
  */
-void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
+void _sc_event_emission_manager_process(sc_event_emission_manager * manager, sc_event * event)
 {
-  sc_event * event = (sc_event *)data;
-  sc_event_emission_manager * queue = user_data;
-
   sc_event_subscription * event_subscription = event->event_subscription;
   if (event_subscription == null_ptr)
     goto destroy;
 
-  sc_monitor_acquire_read(&queue->destroy_monitor);
+  sc_monitor_acquire_read(&manager->destroy_monitor);
 
-  if (queue->running == SC_FALSE)
+  if (manager->running == SC_FALSE)
     goto end;
 
   sc_monitor_acquire_read(&event_subscription->monitor);
@@ -98,21 +119,252 @@ void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
   sc_monitor_release_read(&event_subscription->monitor);
 
 end:
-  sc_monitor_release_read(&queue->destroy_monitor);
+  sc_monitor_release_read(&manager->destroy_monitor);
 destroy:
-{
   if (event->callback != null_ptr)
   {
     sc_memory_context * ctx = sc_memory_context_new_ext(event->user_addr);
     event->callback(ctx, event->event_addr);
     sc_memory_context_free(ctx);
   }
+}
+
+/*! Function that writes an sc-event into free slot of ring buffer of the sc-event emission manager.
+ * @returns SC_FALSE, if ring buffer is full.
+ */
+sc_bool _sc_event_queue_push(sc_event_emission_manager * manager, sc_event const * event)
+{
+  sc_event_queue_slot * slot;
+  sc_uint32 position = _sc_event_queue_atomic_get(&manager->enqueue_position);
+  while (SC_TRUE)
+  {
+    slot = &manager->slots[position & manager->slots_mask];
+    sc_int32 const difference = (sc_int32)(_sc_event_queue_atomic_get(&slot->sequence) - position);
+    if (difference == 0)
+    {
+      if (_sc_event_queue_atomic_compare_and_exchange(&manager->enqueue_position, position, position + 1))
+        break;
+    }
+    else if (difference < 0)
+      return SC_FALSE;
+
+    position = _sc_event_queue_atomic_get(&manager->enqueue_position);
+  }
+
+  slot->event = *event;
+  _sc_event_queue_atomic_set(&slot->sequence, position + 1);
+  return SC_TRUE;
+}
+
+/*! Function that adds an sc-event into ring buffer of the sc-event emission manager, or into its overflow list, if ring
+ * buffer is full.
+ */
+void _sc_event_emission_manager_push(sc_event_emission_manager * manager, sc_event const * event)
+{
+  if (_sc_event_queue_push(manager, event))
+    return;
+
+  // worker threads can emit sc-events too, so emitting thread doesn't wait for free slots
+  sc_event * overflow_event = sc_mem_new(sc_event, 1);
+  *overflow_event = *event;
+
+  sc_mutex_lock(&manager->overflow_mutex);
+  sc_queue_push(&manager->overflow_events, overflow_event);
+  g_atomic_int_inc((sc_int32 *)&manager->overflow_events_count);
+  sc_mutex_unlock(&manager->overflow_mutex);
+  g_atomic_int_inc((sc_int32 *)&manager->overflowed_events_count);
+}
+
+/*! Function that reads a batch of sc-events written into adjacent slots of ring buffer of the sc-event emission
+ * manager. Slots of batch are taken by one compare-and-exchange of dequeue position.
+ * @returns Number of read sc-events.
+ */
+sc_uint32 _sc_event_queue_pop_batch(sc_event_emission_manager * manager, sc_event * events, sc_uint32 max_count)
+{
+  sc_uint32 position = _sc_event_queue_atomic_get(&manager->dequeue_position);
+  while (SC_TRUE)
+  {
+    sc_uint32 count = 0;
+    while (count < max_count)
+    {
+      sc_event_queue_slot * slot = &manager->slots[(position + count) & manager->slots_mask];
+      if (_sc_event_queue_atomic_get(&slot->sequence) != position + count + 1)
+        break;
+      ++count;
+    }
+
+    if (count != 0
+        && _sc_event_queue_atomic_compare_and_exchange(&manager->dequeue_position, position, position + count))
+    {
+      for (sc_uint32 i = 0; i < count; ++i)
+      {
+        sc_event_queue_slot * slot = &manager->slots[(position + i) & manager->slots_mask];
+        events[i] = slot->event;
+        _sc_event_queue_atomic_set(&slot->sequence, position + i + manager->slots_mask + 1);
+      }
+      return count;
+    }
+
+    sc_uint32 const current_position = _sc_event_queue_atomic_get(&manager->dequeue_position);
+    // there are no written slots, or the next slot is being written now
+    if (count == 0 && current_position == position)
+      return 0;
+    position = current_position;
+  }
+}
+
+sc_uint32 _sc_event_overflow_pop_batch(sc_event_emission_manager * manager, sc_event * events, sc_uint32 max_count)
+{
+  if (_sc_event_queue_atomic_get(&manager->overflow_events_count) == 0)
+    return 0;
+
+  sc_uint32 count = 0;
+  sc_mutex_lock(&manager->overflow_mutex);
+  while (count < max_count && !sc_queue_empty(&manager->overflow_events))
+  {
+    sc_event * event = sc_queue_pop(&manager->overflow_events);
+    events[count++] = *event;
+    sc_mem_free(event);
+  }
+  g_atomic_int_add((sc_int32 *)&manager->overflow_events_count, -(sc_int32)count);
+  sc_mutex_unlock(&manager->overflow_mutex);
+
+  return count;
+}
+
+sc_uint32 _sc_event_emission_manager_get_queue_depth(sc_event_emission_manager * manager)
+{
+  // dequeue position is read first, so it can't be greater than enqueue position
+  sc_uint32 const dequeue_position = _sc_event_queue_atomic_get(&manager->dequeue_position);
+  sc_uint32 const enqueue_position = _sc_event_queue_atomic_get(&manager->enqueue_position);
+  return enqueue_position - dequeue_position + _sc_event_queue_atomic_get(&manager->overflow_events_count);
+}
+
+void _sc_event_emission_manager_notify(sc_event_emission_manager * manager)
+{
+  if (_sc_event_queue_atomic_get(&manager->sleeping_workers_count) == 0)
+    return;
+
+  sc_mutex_lock(&manager->workers_mutex);
+  sc_cond_signal(&manager->workers_condition);
+  sc_mutex_unlock(&manager->workers_mutex);
+}
+
+/*! Function that waits until sc-events are added to the sc-event emission manager.
+ * @returns SC_FALSE, if the sc-event emission manager is stopping and there are no waiting sc-events.
+ */
+sc_bool _sc_event_emission_worker_wait(sc_event_emission_manager * manager)
+{
+  sc_bool is_working = SC_TRUE;
+
+  sc_mutex_lock(&manager->workers_mutex);
+  // emitting threads check sleeping workers after adding sc-event, so it is counted before checking queue
+  g_atomic_int_inc((sc_int32 *)&manager->sleeping_workers_count);
+  if (_sc_event_emission_manager_get_queue_depth(manager) == 0)
+  {
+    if (_sc_event_queue_atomic_get(&manager->is_stopping))
+      is_working = SC_FALSE;
+    else
+      sc_cond_wait(&manager->workers_condition, &manager->workers_mutex);
+  }
+  g_atomic_int_add((sc_int32 *)&manager->sleeping_workers_count, -1);
+  sc_mutex_unlock(&manager->workers_mutex);
+
+  return is_working;
+}
 
-  _sc_event_emission_pool_worker_data_destroy(event);
+void _sc_event_emission_worker_bind_to_core(sc_event_emission_worker * worker)
+{
+#if defined(__linux__)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(worker->index % g_get_num_processors(), &cpu_set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) != 0)
+    sc_memory_warning("Events and agents thread %d can't be bound to processor core", worker->index);
+#else
+  sc_memory_warning("Events and agents thread %d can't be bound to processor core on this platform", worker->index);
+#endif
 }
+
+void _sc_event_emission_worker_update_statistics(
+    sc_event_emission_worker * worker,
+    sc_event const * events,
+    sc_uint32 events_count,
+    sc_uint32 queue_depth,
+    sc_int64 time)
+{
+  sc_mutex_lock(&worker->statistics_mutex);
+  sc_event_emission_statistics * statistics = &worker->statistics;
+  statistics->processed_events_count += events_count;
+  ++statistics->batches_count;
+  statistics->max_queue_depth = sc_max(statistics->max_queue_depth, queue_depth);
+  for (sc_uint32 i = 0; i < events_count; ++i)
+  {
+    sc_uint64 const wait_time = time > events[i].emit_time ? (sc_uint64)(time - events[i].emit_time) : 0;
+    statistics->total_wait_time += wait_time;
+    statistics->max_wait_time = sc_max(statistics->max_wait_time, wait_time);
+  }
+  sc_mutex_unlock(&worker->statistics_mutex);
 }
 
-void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params)
+/*! Function that represents the work performed by a worker thread of the sc-event emission manager.
+ * @param data Pointer to the sc_event_emission_worker.
+ */
+void * _sc_event_emission_worker_run(void * data)
+{
+  sc_event_emission_worker * worker = data;
+  sc_event_emission_manager * manager = worker->manager;
+
+  if (manager->events_threads_affinity)
+    _sc_event_emission_worker_bind_to_core(worker);
+
+  sc_event events[SC_EVENT_EMISSION_BATCH_SIZE];
+  while (SC_TRUE)
+  {
+    // batch is limited by share of waiting sc-events, so one worker doesn't take all of them while others sleep
+    sc_uint32 const queue_depth = _sc_event_emission_manager_get_queue_depth(manager);
+    sc_uint32 const batch_size =
+        sc_boundary(queue_depth / manager->max_events_and_agents_threads, 1, SC_EVENT_EMISSION_BATCH_SIZE);
+
+    sc_uint32 events_count = _sc_event_queue_pop_batch(manager, events, batch_size);
+    if (events_count < batch_size)
+      events_count += _sc_event_overflow_pop_batch(manager, events + events_count, batch_size - events_count);
+
+    if (events_count == 0)
+    {
+      if (_sc_event_emission_worker_wait(manager) == SC_FALSE)
+        break;
+      continue;
+    }
+
+    if (events_count < queue_depth)
+      _sc_event_emission_manager_notify(manager);
+
+    sc_int64 const take_time = g_get_monotonic_time();
+    sc_uint32 processed_events_count = 0;
+    while (processed_events_count < events_count)
+    {
+      _sc_event_emission_manager_process(manager, &events[processed_events_count++]);
+
+      // sc-events of batch aren't processed serially behind long callbacks, while other worker threads sleep
+      if (processed_events_count < events_count && g_get_monotonic_time() - take_time > SC_EVENT_EMISSION_BATCH_TIME
+          && _sc_event_queue_atomic_get(&manager->sleeping_workers_count) != 0)
+      {
+        for (sc_uint32 i = processed_events_count; i < events_count; ++i)
+          _sc_event_emission_manager_push(manager, &events[i]);
+        _sc_event_emission_manager_notify(manager);
+        break;
+      }
+    }
+
+    // handed back sc-events are counted by worker thread that processes them
+    _sc_event_emission_worker_update_statistics(worker, events, processed_events_count, queue_depth, take_time);
+  }
+
+  pthread_exit(null_ptr);
+}
+
+sc_result sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params)
 {
   *manager = sc_mem_new(sc_event_emission_manager, 1);
   sc_queue_init(&(*manager)->deletable_events_subscriptions);
@@ -122,24 +374,70 @@ void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager,
       (*manager)->limit_max_threads_by_max_physical_cores
           ? sc_boundary(params->max_events_and_agents_threads, 1, g_get_num_processors())
           : sc_max(1, params->max_events_and_agents_threads);
+  (*manager)->events_threads_affinity = params->events_threads_affinity;
+
+  sc_uint32 slots_count = SC_EVENT_QUEUE_MIN_SIZE;
+  while (slots_count < params->events_queue_size && slots_count < (1u << 30))
+    slots_count <<= 1;
   {
     sc_memory_info("Sc-event managers configuration:");
     sc_message(
         "\tLimit max threads by max physical cores: %s",
         (*manager)->limit_max_threads_by_max_physical_cores ? "On" : "Off");
     sc_message("\tMax events and agents threads: %d", (*manager)->max_events_and_agents_threads);
+    sc_message("\tEvents queue size: %d", slots_count);
+    sc_message("\tEvents and agents threads affinity: %s", (*manager)->events_threads_affinity ? "On" : "Off");
   }
 
   (*manager)->running = SC_TRUE;
   sc_monitor_init(&(*manager)->destroy_monitor);
+  sc_monitor_init(&(*manager)->deletable_events_subscriptions_monitor);
+
+  (*manager)->slots = sc_mem_new(sc_event_queue_slot, slots_count);
+  (*manager)->slots_mask = slots_count - 1;
+  for (sc_uint32 i = 0; i < slots_count; ++i)
+    (*manager)->slots[i].sequence = i;
+  (*manager)->enqueue_position = 0;
+  (*manager)->dequeue_position = 0;
+
+  sc_queue_init(&(*manager)->overflow_events);
+  (*manager)->overflow_events_count = 0;
+  (*manager)->overflowed_events_count = 0;
+  sc_mutex_init(&(*manager)->overflow_mutex);
+
+  (*manager)->sleeping_workers_count = 0;
+  (*manager)->is_stopping = SC_FALSE;
+  sc_mutex_init(&(*manager)->workers_mutex);
+  sc_cond_init(&(*manager)->workers_condition);
+
+  sc_uint32 const max_workers_count = (*manager)->max_events_and_agents_threads;
+  (*manager)->workers = sc_mem_new(sc_event_emission_worker, max_workers_count);
+  sc_uint32 workers_count = 0;
+  for (; workers_count < max_workers_count; ++workers_count)
+  {
+    sc_event_emission_worker * worker = &(*manager)->workers[workers_count];
+    worker->index = workers_count;
+    worker->manager = *manager;
+    sc_mutex_init(&worker->statistics_mutex);
+    worker->statistics = (sc_event_emission_statistics){0};
+    if (pthread_create(&worker->thread, null_ptr, _sc_event_emission_worker_run, worker) != 0)
+    {
+      sc_mutex_destroy(&worker->statistics_mutex);
+      break;
+    }
+  }
+
+  // pool is shrunk to started worker threads, they are read by other threads only after initialization
+  (*manager)->max_events_and_agents_threads = workers_count;
+  if (workers_count == 0)
+  {
+    sc_memory_error("Events and agents threads can't be started");
+    return SC_RESULT_ERROR;
+  }
+  if (workers_count < max_workers_count)
+    sc_memory_warning("Only %d of %d events and agents threads are started", workers_count, max_workers_count);
 
-  sc_monitor_init(&(*manager)->pool_monitor);
-  (*manager)->thread_pool = g_thread_pool_new(
-      _sc_event_emission_pool_worker,
-      *manager,
-      (sc_int32)(*manager)->max_events_and_agents_threads,
-      SC_FALSE,
-      null_ptr);
+  return SC_RESULT_OK;
 }
 
 void sc_event_emission_manager_stop(sc_event_emission_manager * manager)
@@ -161,18 +459,71 @@ void sc_event_emission_manager_stop(sc_event_emission_manager * manager)
   }
 }
 
+void sc_event_emission_manager_get_statistics(
+    sc_event_emission_manager * manager,
+    sc_event_emission_statistics * statistics)
+{
+  *statistics = (sc_event_emission_statistics){0};
+  if (manager == null_ptr)
+    return;
+
+  for (sc_uint32 i = 0; i < manager->max_events_and_agents_threads; ++i)
+  {
+    sc_event_emission_worker * worker = &manager->workers[i];
+    sc_mutex_lock(&worker->statistics_mutex);
+    statistics->processed_events_count += worker->statistics.processed_events_count;
+    statistics->batches_count += worker->statistics.batches_count;
+    statistics->max_queue_depth = sc_max(statistics->max_queue_depth, worker->statistics.max_queue_depth);
+    statistics->total_wait_time += worker->statistics.total_wait_time;
+    statistics->max_wait_time = sc_max(statistics->max_wait_time, worker->statistics.max_wait_time);
+    sc_mutex_unlock(&worker->statistics_mutex);
+  }
+
+  statistics->overflowed_events_count = _sc_event_queue_atomic_get(&manager->overflowed_events_count);
+  statistics->queue_depth = _sc_event_emission_manager_get_queue_depth(manager);
+}
+
 void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
 {
   if (manager == null_ptr)
     return;
 
-  sc_monitor_acquire_write(&manager->pool_monitor);
-  if (manager->thread_pool)
+  // worker threads exit after taking all waiting sc-events
+  sc_mutex_lock(&manager->workers_mutex);
+  _sc_event_queue_atomic_set(&manager->is_stopping, SC_TRUE);
+  sc_cond_broadcast(&manager->workers_condition);
+  sc_mutex_unlock(&manager->workers_mutex);
+
+  for (sc_uint32 i = 0; i < manager->max_events_and_agents_threads; ++i)
+    pthread_join(manager->workers[i].thread, null_ptr);
+
   {
-    g_thread_pool_free(manager->thread_pool, SC_FALSE, SC_TRUE);
-    manager->thread_pool = null_ptr;
+    sc_event_emission_statistics statistics;
+    sc_event_emission_manager_get_statistics(manager, &statistics);
+    sc_memory_info("Sc-event managers statistics:");
+    sc_message(
+        "\tProcessed events: %" PRIu64 " in %" PRIu64 " batches",
+        statistics.processed_events_count,
+        statistics.batches_count);
+    sc_message("\tOverflowed events: %" PRIu64, statistics.overflowed_events_count);
+    sc_message("\tMax events queue depth: %d", statistics.max_queue_depth);
+    sc_message(
+        "\tAverage events wait time: %" PRIu64 " microseconds",
+        statistics.processed_events_count == 0 ? 0 : statistics.total_wait_time / statistics.processed_events_count);
+    sc_message("\tMax events wait time: %" PRIu64 " microseconds", statistics.max_wait_time);
   }
 
+  for (sc_uint32 i = 0; i < manager->max_events_and_agents_threads; ++i)
+    sc_mutex_destroy(&manager->workers[i].statistics_mutex);
+  sc_mem_free(manager->workers);
+  sc_cond_destroy(&manager->workers_condition);
+  sc_mutex_destroy(&manager->workers_mutex);
+
+  sc_queue_destroy(&manager->overflow_events);
+  sc_mutex_destroy(&manager->overflow_mutex);
+  sc_mem_free(manager->slots);
+
+  sc_monitor_acquire_write(&manager->deletable_events_subscriptions_monitor);
   while (!sc_queue_empty(&manager->deletable_events_subscriptions))
   {
     sc_event_subscription * event_subscription = sc_queue_pop(&manager->deletable_events_subscriptions);
@@ -180,10 +531,9 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
     sc_mem_free(event_subscription);
   }
   sc_queue_destroy(&manager->deletable_events_subscriptions);
+  sc_monitor_release_write(&manager->deletable_events_subscriptions_monitor);
 
-  sc_monitor_release_write(&manager->pool_monitor);
-
-  sc_monitor_destroy(&manager->pool_monitor);
+  sc_monitor_destroy(&manager->deletable_events_subscriptions_monitor);
   sc_monitor_destroy(&manager->destroy_monitor);
   sc_mem_free(manager);
 }
@@ -201,10 +551,17 @@ void _sc_event_emission_manager_add(
   if (manager == null_ptr)
     return;
 
-  sc_event * event =
-      _sc_event_new(event_subscription, user_addr, connector_addr, connector_type, other_addr, callback, event_addr);
-
-  sc_monitor_acquire_write(&manager->pool_monitor);
-  g_thread_pool_push(manager->thread_pool, event, null_ptr);
-  sc_monitor_release_write(&manager->pool_monitor);
+  sc_event const event = {
+      .event_subscription = event_subscription,
+      .user_addr = user_addr,
+      .connector_addr = connector_addr,
+      .connector_type = connector_type,
+      .other_addr = other_addr,
+      .callback = callback,
+      .event_addr = event_addr,
+      .emit_time = g_get_monotonic_time(),
+  };
+
+  _sc_event_emission_manager_push(manager, &event);
+  _sc_event_emission_manager_notify(manager);
 }
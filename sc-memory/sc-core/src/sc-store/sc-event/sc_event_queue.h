@@ -15,31 +15,70 @@
 
 #include "sc-store/sc-container/sc_hash_table.h"
 #include "sc-store/sc-base/sc_monitor_private.h"
+#include "sc-store/sc-base/sc_condition_private.h"
 
 typedef sc_result (*sc_event_do_after_callback)(sc_memory_context const * ctx, sc_addr addr);
 
+typedef struct _sc_event_queue_slot sc_event_queue_slot;
+typedef struct _sc_event_emission_worker sc_event_emission_worker;
+
+/*! Structure representing statistics of an sc-event emission manager.
+ * @note Counters are collected by worker threads per batch of sc-events, so they don't slow down emitting threads.
+ */
+typedef struct
+{
+  sc_uint64 processed_events_count;   ///< Number of sc-events taken from queue by worker threads.
+  sc_uint64 batches_count;            ///< Number of batches of sc-events taken from queue by worker threads.
+  sc_uint64 overflowed_events_count;  ///< Number of sc-events added to overflow list, because queue was full.
+  sc_uint32 queue_depth;              ///< Number of sc-events waiting in queue and overflow list now.
+  sc_uint32 max_queue_depth;          ///< Maximum number of waiting sc-events seen by worker threads.
+  sc_uint64 total_wait_time;          ///< Total time (in microseconds) that sc-events waited in queue.
+  sc_uint64 max_wait_time;            ///< Maximum time (in microseconds) that an sc-event waited in queue.
+} sc_event_emission_statistics;
+
 /*! Structure representing an sc-event emission manager.
- * @note This structure manages the asynchronous processing of sc-events using a thread pool.
+ * @note This structure manages the asynchronous processing of sc-events by a fixed set of worker threads. Emitted
+ * sc-events are copied into pre-allocated slots of a bounded lock-free multi-producer multi-consumer ring buffer,
+ * and worker threads take them in batches. sc-events that don't fit into full ring buffer are added to overflow list.
  */
 typedef struct
 {
   ///< Boolean indicating whether sc-memory limit `max_events_and_agents_threads` by maximum physical core number.
   sc_bool limit_max_threads_by_max_physical_cores;
   sc_uint32 max_events_and_agents_threads;  ///< Maximum number of threads for processing events and agents.
+  sc_bool events_threads_affinity;          ///< Boolean indicating whether worker threads are bound to cores.
   sc_queue deletable_events_subscriptions;  ///< Queue of sc-events subscriptions that need to be deleted after
                                             ///< sc-memory shutdown.
+  ///< Monitor for synchronizing access to the queue of sc-events subscriptions that need to be deleted.
+  sc_monitor deletable_events_subscriptions_monitor;
   sc_bool running;                          ///< Flag indicating whether the event emission manager is running.
   sc_monitor destroy_monitor;               ///< Monitor for synchronizing access to the destruction process.
-  GThreadPool * thread_pool;                ///< Thread pool used for worker threads processing events.
-  sc_monitor pool_monitor;                  ///< Monitor for synchronizing access to the thread pool.
+
+  sc_event_queue_slot * slots;  ///< Ring buffer of sc-events waiting for processing.
+  sc_uint32 slots_mask;         ///< Number of slots minus one, number of slots is a power of two.
+  sc_uint32 enqueue_position;   ///< Position of the next slot to be written, changed atomically.
+  sc_uint32 dequeue_position;   ///< Position of the next slot to be read, changed atomically.
+
+  sc_queue overflow_events;           ///< sc-events added when ring buffer was full.
+  sc_uint32 overflow_events_count;    ///< Number of sc-events in overflow list, changed atomically.
+  sc_uint32 overflowed_events_count;  ///< Number of sc-events ever added to overflow list, changed atomically.
+  sc_mutex overflow_mutex;            ///< Mutex for synchronizing access to overflow list.
+
+  sc_event_emission_worker * workers;  ///< Worker threads processing sc-events.
+  sc_uint32 sleeping_workers_count;    ///< Number of worker threads waiting for sc-events, changed atomically.
+  sc_uint32 is_stopping;               ///< Flag indicating whether worker threads should exit, changed atomically.
+  sc_mutex workers_mutex;              ///< Mutex for waiting of worker threads.
+  sc_condition workers_condition;      ///< Condition for waking up worker threads.
 } sc_event_emission_manager;
 
 /*! Function that initializes an sc-event emission manager.
  * @param manager Pointer to the sc_event_emission_manager to be initialized.
  * @param params Pointer to the sc-memory params.
- * @note This function initializes the event emission manager, creating a thread pool and necessary monitors.
+ * @returns SC_RESULT_ERROR, if no worker thread can be started.
+ * @note This function initializes the event emission manager, allocating queue of sc-events and starting worker
+ * threads. If not all worker threads can be started, then the manager works with started ones.
  */
-void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params);
+sc_result sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params);
 
 /*! Function that stops an sc-event emission manager.
  * @param manager Pointer to the sc_event_emission_manager to be stopped.
@@ -49,10 +88,19 @@ void sc_event_emission_manager_stop(sc_event_emission_manager * manager);
 
 /*! Function that shuts down and frees resources associated with an sc-event emission manager.
  * @param manager Pointer to the sc_event_emission_manager to be shut down.
- * @note This function shuts down and frees resources associated with the event emission manager.
+ * @note This function waits until worker threads take all waiting sc-events and frees resources associated with the
+ * event emission manager.
  */
 void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager);
 
+/*! Function that collects statistics of an sc-event emission manager.
+ * @param manager Pointer to the sc_event_emission_manager.
+ * @param statistics Pointer to the statistics to be filled.
+ */
+void sc_event_emission_manager_get_statistics(
+    sc_event_emission_manager * manager,
+    sc_event_emission_statistics * statistics);
+
 /*! Function that adds an sc-event to the event emission manager for processing.
  * @param manager Pointer to the sc_event_emission_manager managing event emission.
  * @param event_subscription A pointer to sc-event subscription.
@@ -63,7 +111,8 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager);
  * @param callback A pointer function that is executed after the execution of a function that was called on the
  * initiated event (it is used for events of erasing sc-connectors and sc-elements and event of changing link content).
  * @param event_addr An argument of callback.
- * @note This function adds an sc-event to the event emission manager for asynchronous processing.
+ * @note This function adds an sc-event to the event emission manager for asynchronous processing. It doesn't take
+ * locks and doesn't allocate memory, unless queue of sc-events is full.
  */
 void _sc_event_emission_manager_add(
     sc_event_emission_manager * manager,
@@ -0,0 +1,310 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_event_subscriptions_index.h"
+
+#include "sc_event_private.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+//! Stripe of readers counters of the current thread plus one, zero means that the stripe isn't assigned yet
+static _Thread_local sc_uint32 thread_readers_stripe = 0;
+//! Number of threads that have got stripes of readers counters
+static sc_uint32 readers_stripes_counter = 0;
+
+sc_uint32 _sc_event_subscriptions_index_get_bucket_index(sc_addr subscription_addr)
+{
+  return SC_ADDR_LOCAL_TO_INT(subscription_addr) & (SC_EVENT_SUBSCRIPTIONS_INDEX_BUCKETS_COUNT - 1);
+}
+
+sc_uint32 * _sc_event_subscriptions_index_get_readers_count(sc_event_subscriptions_index * index, sc_uint32 epoch)
+{
+  if (thread_readers_stripe == 0)
+    thread_readers_stripe = (sc_uint32)g_atomic_int_add((sc_int32 *)&readers_stripes_counter, 1) + 1;
+
+  return &index->readers[epoch & 1][thread_readers_stripe % SC_EVENT_SUBSCRIPTIONS_INDEX_READERS_STRIPES_COUNT].count;
+}
+
+/*! Function that allocates a bucket with arrays of groups and sc-event subscriptions in one block of memory.
+ * @returns Pointer to the allocated bucket or null_ptr, if bucket is empty.
+ */
+sc_event_subscriptions_bucket * _sc_event_subscriptions_bucket_new(
+    sc_uint32 groups_count,
+    sc_uint32 subscriptions_count)
+{
+  if (subscriptions_count == 0)
+    return null_ptr;
+
+  // sc-event subscriptions are placed before groups, so pointers are aligned
+  sc_event_subscriptions_bucket * bucket = _sc_mem_new(
+      sizeof(sc_event_subscriptions_bucket) + sizeof(sc_event_subscription *) * subscriptions_count
+      + sizeof(sc_event_subscriptions_group) * groups_count);
+  bucket->groups_count = groups_count;
+  bucket->subscriptions_count = subscriptions_count;
+  bucket->subscriptions = (sc_event_subscription **)(bucket + 1);
+  bucket->groups = (sc_event_subscriptions_group *)(bucket->subscriptions + subscriptions_count);
+  return bucket;
+}
+
+sc_bool _sc_event_subscriptions_group_is_of(
+    sc_event_subscriptions_group const * group,
+    sc_event_subscription const * event_subscription)
+{
+  return SC_ADDR_IS_EQUAL(group->subscription_addr, event_subscription->subscription_addr)
+         && SC_ADDR_IS_EQUAL(group->event_type_addr, event_subscription->event_type_addr)
+         && group->event_element_type == event_subscription->event_element_type;
+}
+
+/*! Function that waits until all readers, that could read replaced buckets, leave read sections.
+ * @note Readers entered after switching of epoch are counted in counters of the other epoch, so writer doesn't wait
+ * for them.
+ */
+void _sc_event_subscriptions_index_wait_readers(sc_event_subscriptions_index * index)
+{
+  sc_uint32 const epoch = (sc_uint32)g_atomic_int_get((sc_int32 *)&index->epoch);
+  g_atomic_int_set((sc_int32 *)&index->epoch, (sc_int32)(epoch + 1));
+
+  for (sc_uint32 i = 0; i < SC_EVENT_SUBSCRIPTIONS_INDEX_READERS_STRIPES_COUNT; ++i)
+  {
+    while (g_atomic_int_get((sc_int32 *)&index->readers[epoch & 1][i].count) != 0)
+      g_thread_yield();
+  }
+}
+
+/*! Function that publishes a new bucket and frees the replaced one after its readers leave it.
+ * @note The caller must hold `writers_mutex` of \p index.
+ */
+void _sc_event_subscriptions_index_replace_bucket(
+    sc_event_subscriptions_index * index,
+    sc_uint32 bucket_index,
+    sc_event_subscriptions_bucket * bucket)
+{
+  sc_event_subscriptions_bucket * replaced_bucket = index->buckets[bucket_index];
+  g_atomic_pointer_set(&index->buckets[bucket_index], bucket);
+
+  _sc_event_subscriptions_index_wait_readers(index);
+  sc_mem_free(replaced_bucket);
+}
+
+/*! Function that removes sc-event subscription \p event_subscription or, if it is null_ptr, all sc-event
+ * subscriptions of sc-element \p subscription_addr from the index.
+ * @param removed_subscriptions Pointer to array of removed sc-event subscriptions to be allocated, or null_ptr.
+ * @returns Number of removed sc-event subscriptions.
+ * @note The caller must hold `writers_mutex` of \p index.
+ */
+sc_uint32 _sc_event_subscriptions_index_remove(
+    sc_event_subscriptions_index * index,
+    sc_addr subscription_addr,
+    sc_event_subscription const * event_subscription,
+    sc_event_subscription *** removed_subscriptions)
+{
+  sc_uint32 const bucket_index = _sc_event_subscriptions_index_get_bucket_index(subscription_addr);
+  sc_event_subscriptions_bucket const * bucket = index->buckets[bucket_index];
+  if (bucket == null_ptr)
+    return 0;
+
+  sc_uint32 removed_groups_count = 0;
+  sc_uint32 removed_subscriptions_count = 0;
+  for (sc_uint32 i = 0; i < bucket->groups_count; ++i)
+  {
+    sc_event_subscriptions_group const * group = &bucket->groups[i];
+    if (!SC_ADDR_IS_EQUAL(group->subscription_addr, subscription_addr))
+      continue;
+
+    if (event_subscription == null_ptr)
+    {
+      ++removed_groups_count;
+      removed_subscriptions_count += group->count;
+    }
+    else if (_sc_event_subscriptions_group_is_of(group, event_subscription))
+    {
+      for (sc_uint32 j = group->begin; j < group->begin + group->count; ++j)
+      {
+        if (bucket->subscriptions[j] == event_subscription)
+        {
+          removed_groups_count += group->count == 1;
+          removed_subscriptions_count = 1;
+          break;
+        }
+      }
+      break;
+    }
+  }
+
+  if (removed_subscriptions_count == 0)
+    return 0;
+
+  sc_event_subscriptions_bucket * new_bucket = _sc_event_subscriptions_bucket_new(
+      bucket->groups_count - removed_groups_count, bucket->subscriptions_count - removed_subscriptions_count);
+  if (removed_subscriptions != null_ptr)
+    *removed_subscriptions = sc_mem_new(sc_event_subscription *, removed_subscriptions_count);
+
+  sc_uint32 groups_count = 0;
+  sc_uint32 subscriptions_count = 0;
+  sc_uint32 removed_count = 0;
+  for (sc_uint32 i = 0; i < bucket->groups_count; ++i)
+  {
+    sc_event_subscriptions_group const * group = &bucket->groups[i];
+    sc_event_subscriptions_group new_group = *group;
+    new_group.begin = subscriptions_count;
+    new_group.count = 0;
+
+    for (sc_uint32 j = group->begin; j < group->begin + group->count; ++j)
+    {
+      sc_event_subscription * subscription = bucket->subscriptions[j];
+      sc_bool const is_removed = event_subscription == null_ptr
+                                     ? SC_ADDR_IS_EQUAL(group->subscription_addr, subscription_addr)
+                                     : subscription == event_subscription;
+      if (is_removed)
+      {
+        if (removed_subscriptions != null_ptr)
+          (*removed_subscriptions)[removed_count] = subscription;
+        ++removed_count;
+        continue;
+      }
+
+      new_bucket->subscriptions[subscriptions_count++] = subscription;
+      ++new_group.count;
+    }
+
+    if (new_group.count != 0)
+      new_bucket->groups[groups_count++] = new_group;
+  }
+
+  _sc_event_subscriptions_index_replace_bucket(index, bucket_index, new_bucket);
+  return removed_subscriptions_count;
+}
+
+void sc_event_subscriptions_index_initialize(sc_event_subscriptions_index ** index)
+{
+  *index = sc_mem_new(sc_event_subscriptions_index, 1);
+  sc_mutex_init(&(*index)->writers_mutex);
+}
+
+void sc_event_subscriptions_index_shutdown(sc_event_subscriptions_index * index)
+{
+  for (sc_uint32 i = 0; i < SC_EVENT_SUBSCRIPTIONS_INDEX_BUCKETS_COUNT; ++i)
+    sc_mem_free(index->buckets[i]);
+
+  sc_mutex_destroy(&index->writers_mutex);
+  sc_mem_free(index);
+}
+
+void sc_event_subscriptions_index_add(
+    sc_event_subscriptions_index * index,
+    sc_event_subscription * event_subscription)
+{
+  sc_mutex_lock(&index->writers_mutex);
+
+  sc_uint32 const bucket_index = _sc_event_subscriptions_index_get_bucket_index(event_subscription->subscription_addr);
+  sc_event_subscriptions_bucket const * bucket = index->buckets[bucket_index];
+  sc_uint32 const groups_count = bucket == null_ptr ? 0 : bucket->groups_count;
+  sc_uint32 const subscriptions_count = bucket == null_ptr ? 0 : bucket->subscriptions_count;
+
+  sc_uint32 group_index = groups_count;
+  for (sc_uint32 i = 0; i < groups_count; ++i)
+  {
+    if (_sc_event_subscriptions_group_is_of(&bucket->groups[i], event_subscription))
+    {
+      group_index = i;
+      break;
+    }
+  }
+
+  sc_event_subscriptions_bucket * new_bucket = _sc_event_subscriptions_bucket_new(
+      group_index == groups_count ? groups_count + 1 : groups_count, subscriptions_count + 1);
+
+  // sc-event subscription is appended to its group, so sc-events are emitted in order of registration in group
+  sc_uint32 position = 0;
+  for (sc_uint32 i = 0; i < groups_count; ++i)
+  {
+    sc_event_subscriptions_group const * group = &bucket->groups[i];
+    sc_event_subscriptions_group * new_group = &new_bucket->groups[i];
+    *new_group = *group;
+    new_group->begin = position;
+
+    sc_mem_cpy(
+        new_bucket->subscriptions + position,
+        bucket->subscriptions + group->begin,
+        sizeof(sc_event_subscription *) * group->count);
+    position += group->count;
+
+    if (i == group_index)
+    {
+      new_bucket->subscriptions[position++] = event_subscription;
+      ++new_group->count;
+    }
+  }
+
+  if (group_index == groups_count)
+  {
+    sc_event_subscriptions_group * new_group = &new_bucket->groups[groups_count];
+    new_group->subscription_addr = event_subscription->subscription_addr;
+    new_group->event_type_addr = event_subscription->event_type_addr;
+    new_group->event_element_type = event_subscription->event_element_type;
+    new_group->begin = position;
+    new_group->count = 1;
+    new_bucket->subscriptions[position] = event_subscription;
+  }
+
+  _sc_event_subscriptions_index_replace_bucket(index, bucket_index, new_bucket);
+
+  sc_mutex_unlock(&index->writers_mutex);
+}
+
+sc_bool sc_event_subscriptions_index_remove(
+    sc_event_subscriptions_index * index,
+    sc_event_subscription * event_subscription)
+{
+  sc_mutex_lock(&index->writers_mutex);
+  sc_uint32 const removed_count =
+      _sc_event_subscriptions_index_remove(index, event_subscription->subscription_addr, event_subscription, null_ptr);
+  sc_mutex_unlock(&index->writers_mutex);
+
+  return removed_count != 0;
+}
+
+sc_event_subscription ** sc_event_subscriptions_index_remove_element(
+    sc_event_subscriptions_index * index,
+    sc_addr subscription_addr,
+    sc_uint32 * subscriptions_count)
+{
+  sc_event_subscription ** removed_subscriptions = null_ptr;
+
+  sc_mutex_lock(&index->writers_mutex);
+  *subscriptions_count = _sc_event_subscriptions_index_remove(index, subscription_addr, null_ptr, &removed_subscriptions);
+  sc_mutex_unlock(&index->writers_mutex);
+
+  return removed_subscriptions;
+}
+
+sc_uint32 sc_event_subscriptions_index_read_begin(sc_event_subscriptions_index * index)
+{
+  while (SC_TRUE)
+  {
+    sc_uint32 const epoch = (sc_uint32)g_atomic_int_get((sc_int32 *)&index->epoch);
+    sc_uint32 * readers_count = _sc_event_subscriptions_index_get_readers_count(index, epoch);
+    g_atomic_int_inc((sc_int32 *)readers_count);
+
+    // if writer switched epoch before the reader was counted, then the writer could have not waited for it
+    if ((sc_uint32)g_atomic_int_get((sc_int32 *)&index->epoch) == epoch)
+      return epoch;
+
+    g_atomic_int_add((sc_int32 *)readers_count, -1);
+  }
+}
+
+void sc_event_subscriptions_index_read_end(sc_event_subscriptions_index * index, sc_uint32 epoch)
+{
+  g_atomic_int_add((sc_int32 *)_sc_event_subscriptions_index_get_readers_count(index, epoch), -1);
+}
+
+sc_event_subscriptions_bucket const * sc_event_subscriptions_index_get_bucket(
+    sc_event_subscriptions_index * index,
+    sc_addr subscription_addr)
+{
+  return g_atomic_pointer_get(&index->buckets[_sc_event_subscriptions_index_get_bucket_index(subscription_addr)]);
+}
@@ -0,0 +1,131 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_event_subscriptions_index_h_
+#define _sc_event_subscriptions_index_h_
+
+#include "sc-core/sc_types.h"
+#include "sc-core/sc_event_subscription.h"
+#include "sc-core/sc-base/sc_mutex.h"
+
+#include "sc-store/sc-base/sc_mutex_private.h"
+
+//! Number of buckets of sc-event subscriptions index, it must be a power of two.
+#define SC_EVENT_SUBSCRIPTIONS_INDEX_BUCKETS_COUNT (1 << 12)
+//! Number of stripes of readers counters of sc-event subscriptions index.
+#define SC_EVENT_SUBSCRIPTIONS_INDEX_READERS_STRIPES_COUNT 16
+
+/*! Structure representing a group of sc-event subscriptions with the same subscription sc-element, sc-event type and
+ * sc-type of sc-connector required to trigger sc-event.
+ */
+typedef struct
+{
+  sc_addr subscription_addr;      ///< A sc-address of listened sc-element.
+  sc_event_type event_type_addr;  ///< A sc-address of sc-event type.
+  sc_type event_element_type;     ///< A sc-type mask of sc-connector required to trigger sc-event.
+  sc_uint32 begin;                ///< Index of the first sc-event subscription of the group in bucket.
+  sc_uint32 count;                ///< Number of sc-event subscriptions in the group.
+} sc_event_subscriptions_group;
+
+/*! Structure representing a bucket of sc-event subscriptions index.
+ * @note Bucket isn't changed after it is published. Writers replace the whole bucket, so readers can read it without
+ * locks. sc-event subscriptions of each group are stored contiguously in order of their registration.
+ */
+typedef struct
+{
+  sc_uint32 groups_count;                  ///< Number of groups in the bucket.
+  sc_uint32 subscriptions_count;           ///< Number of sc-event subscriptions in the bucket.
+  sc_event_subscriptions_group * groups;   ///< Groups of sc-event subscriptions.
+  sc_event_subscription ** subscriptions;  ///< sc-event subscriptions of all groups.
+} sc_event_subscriptions_bucket;
+
+//! Structure representing a counter of readers of sc-event subscriptions index placed in its own cache line.
+typedef struct
+{
+  sc_uint32 count;       ///< Number of readers, changed atomically.
+  sc_uint8 padding[60];  ///< Padding to cache line size.
+} sc_event_subscriptions_index_readers;
+
+/*! Structure representing an index of sc-event subscriptions by subscription sc-element, sc-event type and sc-type of
+ * sc-connector.
+ * @note Reads are protected in the RCU style: readers increment counter of the current epoch and don't take locks.
+ * Writers are serialized by mutex, they publish new bucket, switch epoch and wait until readers of the previous epoch
+ * leave before freeing the replaced bucket.
+ */
+typedef struct
+{
+  ///< Buckets of sc-event subscriptions, set atomically.
+  sc_event_subscriptions_bucket * buckets[SC_EVENT_SUBSCRIPTIONS_INDEX_BUCKETS_COUNT];
+  sc_uint32 epoch;  ///< Current epoch of readers, changed atomically.
+  ///< Counters of readers of even and odd epochs striped over reading threads.
+  sc_event_subscriptions_index_readers readers[2][SC_EVENT_SUBSCRIPTIONS_INDEX_READERS_STRIPES_COUNT];
+  sc_mutex writers_mutex;  ///< Mutex for serializing writers.
+} sc_event_subscriptions_index;
+
+/*! Function that initializes an sc-event subscriptions index.
+ * @param index Pointer to the sc_event_subscriptions_index to be initialized.
+ */
+void sc_event_subscriptions_index_initialize(sc_event_subscriptions_index ** index);
+
+/*! Function that frees resources associated with an sc-event subscriptions index.
+ * @param index Pointer to the sc_event_subscriptions_index to be shut down.
+ * @note sc-event subscriptions aren't freed, they are freed by sc-event emission manager.
+ */
+void sc_event_subscriptions_index_shutdown(sc_event_subscriptions_index * index);
+
+/*! Function that adds an sc-event subscription to the index.
+ * @param index Pointer to the sc_event_subscriptions_index.
+ * @param event_subscription Pointer to the sc-event subscription to be added.
+ * @note This function waits until readers of replaced bucket leave it, it must not be called by readers.
+ */
+void sc_event_subscriptions_index_add(
+    sc_event_subscriptions_index * index,
+    sc_event_subscription * event_subscription);
+
+/*! Function that removes an sc-event subscription from the index.
+ * @param index Pointer to the sc_event_subscriptions_index.
+ * @param event_subscription Pointer to the sc-event subscription to be removed.
+ * @returns SC_TRUE, if the sc-event subscription was found and removed.
+ * @note This function waits until readers of replaced bucket leave it, it must not be called by readers.
+ */
+sc_bool sc_event_subscriptions_index_remove(
+    sc_event_subscriptions_index * index,
+    sc_event_subscription * event_subscription);
+
+/*! Function that removes all sc-event subscriptions of sc-element from the index.
+ * @param index Pointer to the sc_event_subscriptions_index.
+ * @param subscription_addr A sc-address of sc-element.
+ * @param subscriptions_count Pointer to the number of removed sc-event subscriptions.
+ * @returns Array of removed sc-event subscriptions, it must be freed by `sc_mem_free`, or null_ptr, if there are no
+ * sc-event subscriptions of sc-element.
+ */
+sc_event_subscription ** sc_event_subscriptions_index_remove_element(
+    sc_event_subscriptions_index * index,
+    sc_addr subscription_addr,
+    sc_uint32 * subscriptions_count);
+
+/*! Function that enters read section of the index.
+ * @param index Pointer to the sc_event_subscriptions_index.
+ * @returns Epoch of read section, it must be passed to `sc_event_subscriptions_index_read_end`.
+ */
+sc_uint32 sc_event_subscriptions_index_read_begin(sc_event_subscriptions_index * index);
+
+/*! Function that leaves read section of the index.
+ * @param index Pointer to the sc_event_subscriptions_index.
+ * @param epoch Epoch returned by `sc_event_subscriptions_index_read_begin`.
+ */
+void sc_event_subscriptions_index_read_end(sc_event_subscriptions_index * index, sc_uint32 epoch);
+
+/*! Function that gets bucket of the index containing sc-event subscriptions of sc-element.
+ * @param index Pointer to the sc_event_subscriptions_index.
+ * @param subscription_addr A sc-address of sc-element.
+ * @returns Pointer to the bucket or null_ptr, if bucket is empty. Bucket is valid until the end of read section.
+ */
+sc_event_subscriptions_bucket const * sc_event_subscriptions_index_get_bucket(
+    sc_event_subscriptions_index * index,
+    sc_addr subscription_addr);
+
+#endif
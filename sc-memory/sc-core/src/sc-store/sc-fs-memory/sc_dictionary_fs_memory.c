@@ -16,24 +16,25 @@
 #  include "sc-store/sc-container/sc_dictionary_private.h"
 #  include "sc-store/sc-container/sc_struct_node.h"
 
+#  include "sc-core/sc_stream_file.h"
+#  include "sc-store/sc_stream_private.h"
+
 #  include "sc_file_system.h"
 #  include "sc_io.h"
 
+#  include <errno.h>
+#  include <stdlib.h>
+
 #  define DEFAULT_STRING_INT_SIZE 20
 #  define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
 
-typedef struct
-{
-  sc_list * link_hashes;
-  sc_uint64 string_offset;
-} sc_link_hash_content;
-
 sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
     sc_dictionary_fs_memory * memory,
     sc_uint64 strings_offset,
     sc_monitor ** channel_monitor)
 {
-  *channel_monitor = null_ptr;
+  if (channel_monitor != null_ptr)
+    *channel_monitor = null_ptr;
 
   sc_uint64 const idx = strings_offset / memory->max_strings_channel_size;
   if (idx >= memory->max_strings_channels)
@@ -49,8 +50,9 @@ sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
   sc_monitor_release_read(&memory->monitor);
   if (channel != null_ptr)
   {
-    *channel_monitor =
-        sc_monitor_table_get_monitor_from_table(&memory->strings_channels_monitors_table, (sc_pointer)idx);
+    if (channel_monitor != null_ptr)
+      *channel_monitor =
+          sc_monitor_table_get_monitor_from_table(&memory->strings_channels_monitors_table, (sc_pointer)idx);
     return channel;
   }
 
@@ -85,7 +87,9 @@ sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
   sc_io_channel_set_encoding(memory->strings_channels[idx], null_ptr, null_ptr);
 
   sc_monitor_release_write(&memory->monitor);
-  *channel_monitor = sc_monitor_table_get_monitor_from_table(&memory->strings_channels_monitors_table, (sc_pointer)idx);
+  if (channel_monitor != null_ptr)
+    *channel_monitor =
+        sc_monitor_table_get_monitor_from_table(&memory->strings_channels_monitors_table, (sc_pointer)idx);
 
   sc_mem_free(strings_path);
 
@@ -102,6 +106,32 @@ sc_uint64 _sc_dictionary_fs_memory_normalize_offset(sc_dictionary_fs_memory cons
   return strings_offset - memory->max_strings_channel_size * channel_idx;
 }
 
+/*! Reads \p size bytes of strings channel from \p offset. Reads don't change position of strings channel, so strings
+ * are read in parallel without locks while writers append new strings.
+ * @returns SC_TRUE, if all bytes are read.
+ */
+sc_bool _sc_dictionary_fs_memory_read_strings_channel(
+    sc_io_channel * strings_channel,
+    sc_uint64 offset,
+    sc_char * chars,
+    sc_uint64 size)
+{
+  sc_uint64 read_bytes = 0;
+  while (read_bytes < size)
+  {
+    ssize_t const result =
+        sc_io_channel_pread(strings_channel, chars + read_bytes, size - read_bytes, (off_t)(offset + read_bytes));
+    if (result < 0 && errno == EINTR)
+      continue;
+    if (result <= 0)
+      return SC_FALSE;
+
+    read_bytes += (sc_uint64)result;
+  }
+
+  return SC_TRUE;
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
     sc_dictionary_fs_memory ** memory,
     sc_memory_params const * params)
@@ -152,10 +182,16 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
       sc_monitor_init(&(*memory)->resolve_string_offset_monitor);
     }
 
-    _sc_number_dictionary_initialize(&(*memory)->link_hashes_string_offsets_dictionary);
-    _sc_number_dictionary_initialize(&(*memory)->string_offsets_link_hashes_dictionary);
+    sc_monitor_init(&(*memory)->link_hashes_monitor);
+    sc_number_hash_map_initialize(&(*memory)->link_hashes_string_offsets_map, 0);
+    sc_number_hash_map_initialize(&(*memory)->string_offsets_link_hashes_map, 0);
+    sc_number_hash_map_initialize(&(*memory)->link_hashes_next_link_hashes_map, 0);
     static sc_char const * string_offsets_link_hashes = "string_offsets_link_hashes" SC_FS_EXT;
     sc_fs_concat_path((*memory)->path, string_offsets_link_hashes, &(*memory)->string_offsets_link_hashes_path);
+
+    sc_trigrams_index_initialize(&(*memory)->trigrams_index);
+    static sc_char const * trigrams_string_offsets = "trigrams_string_offsets" SC_FS_EXT;
+    sc_fs_concat_path((*memory)->path, trigrams_string_offsets, &(*memory)->trigrams_string_offsets_path);
   }
   sc_fs_memory_info("Configuration:");
   sc_message("\tSc-dictionary node size: %zd", sizeof(sc_dictionary_node));
@@ -219,9 +255,14 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
       sc_monitor_destroy(&memory->resolve_string_offset_monitor);
     }
 
-    sc_dictionary_destroy(memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_string_node_clear);
-    sc_dictionary_destroy(memory->string_offsets_link_hashes_dictionary, _sc_dictionary_fs_memory_link_node_clear);
+    sc_monitor_destroy(&memory->link_hashes_monitor);
+    sc_number_hash_map_destroy(memory->link_hashes_string_offsets_map);
+    sc_number_hash_map_destroy(memory->string_offsets_link_hashes_map);
+    sc_number_hash_map_destroy(memory->link_hashes_next_link_hashes_map);
     sc_mem_free(memory->string_offsets_link_hashes_path);
+
+    sc_trigrams_index_destroy(memory->trigrams_index);
+    sc_mem_free(memory->trigrams_string_offsets_path);
   }
   sc_mem_free(memory);
 
@@ -229,6 +270,13 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
   return SC_FS_MEMORY_OK;
 }
 
+// Dictionaries are marked after they are changed, so a save running concurrently either writes the changes or finds
+// dictionaries changed on the next save
+void _sc_dictionary_fs_memory_mark_changed(sc_dictionary_fs_memory * memory)
+{
+  g_atomic_int_set(&memory->is_changed, SC_TRUE);
+}
+
 void _sc_dictionary_fs_memory_append(
     sc_dictionary * dictionary,
     sc_char const * key,
@@ -249,58 +297,109 @@ void _sc_dictionary_fs_memory_append(
   sc_list_push_back(list, data);
 }
 
-sc_bool _sc_addr_hash_compare(void * addr_hash, void * other_addr_hash)
+/*! Appends \p link_hash to circular list of link hashes linked with string by \p string_offset. Strings offsets map
+ * stores the last appended link hash, next link hash of it is the first appended one.
+ * @note Monitor of link hashes must be acquired for writing.
+ */
+void _sc_dictionary_fs_memory_append_string_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_addr_hash const link_hash)
 {
-  return addr_hash == other_addr_hash;
+  sc_uint64 last_link_hash;
+  if (sc_number_hash_map_get(memory->string_offsets_link_hashes_map, string_offset, &last_link_hash))
+  {
+    sc_uint64 first_link_hash;
+    sc_number_hash_map_get(memory->link_hashes_next_link_hashes_map, last_link_hash, &first_link_hash);
+    sc_number_hash_map_insert(memory->link_hashes_next_link_hashes_map, link_hash, first_link_hash);
+    sc_number_hash_map_insert(memory->link_hashes_next_link_hashes_map, last_link_hash, link_hash);
+  }
+  else
+    sc_number_hash_map_insert(memory->link_hashes_next_link_hashes_map, link_hash, link_hash);
+
+  sc_number_hash_map_insert(memory->string_offsets_link_hashes_map, string_offset, link_hash);
 }
 
-void _sc_dictionary_fs_memory_append_link_string_unique(
+/*! Removes \p link_hash from circular list of link hashes linked with string by \p string_offset.
+ * @note Monitor of link hashes must be acquired for writing.
+ */
+void _sc_dictionary_fs_memory_remove_string_link_hash(
     sc_dictionary_fs_memory * memory,
-    sc_addr_hash const link_hash,
-    sc_uint64 const string_offset)
+    sc_uint64 const string_offset,
+    sc_addr_hash const link_hash)
 {
-  sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
-  sc_uint64 link_hash_str_size;
-  sc_bool is_content_new;
-  sc_link_hash_content * content;
+  sc_uint64 next_link_hash;
+  if (!sc_number_hash_map_remove(memory->link_hashes_next_link_hashes_map, link_hash, &next_link_hash))
+    return;
+
+  if (next_link_hash == link_hash)
   {
-    sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
-    content =
-        sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
-    is_content_new = (content == null_ptr);
-    if (is_content_new)
-    {
-      content = sc_mem_new(sc_link_hash_content, 1);
-      sc_dictionary_append(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size, content);
-    }
+    sc_number_hash_map_remove(memory->string_offsets_link_hashes_map, string_offset, null_ptr);
+    return;
   }
 
-  sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
-  sc_uint64 string_offset_str_size;
-  sc_list * link_hashes;
+  // find previous link hash to link it with next one
+  sc_uint64 previous_link_hash = next_link_hash;
+  sc_uint64 current_link_hash;
+  while (sc_number_hash_map_get(memory->link_hashes_next_link_hashes_map, previous_link_hash, &current_link_hash)
+         && current_link_hash != link_hash)
+    previous_link_hash = current_link_hash;
+  sc_number_hash_map_insert(memory->link_hashes_next_link_hashes_map, previous_link_hash, next_link_hash);
+
+  sc_uint64 last_link_hash;
+  if (sc_number_hash_map_get(memory->string_offsets_link_hashes_map, string_offset, &last_link_hash)
+      && last_link_hash == link_hash)
+    sc_number_hash_map_insert(memory->string_offsets_link_hashes_map, string_offset, previous_link_hash);
+}
+
+/*! Appends link hashes linked with string by \p string_offset to \p link_hashes in order of their linking.
+ * @returns Number of appended link hashes.
+ */
+sc_uint64 _sc_dictionary_fs_memory_get_string_link_hashes(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_list * link_hashes)
+{
+  sc_uint64 count = 0;
+  sc_monitor_acquire_read(&memory->link_hashes_monitor);
+
+  sc_uint64 last_link_hash;
+  if (sc_number_hash_map_get(memory->string_offsets_link_hashes_map, string_offset, &last_link_hash))
   {
-    sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
-    link_hashes = sc_dictionary_get_by_key(
-        memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
-    if (link_hashes == null_ptr)
+    sc_uint64 link_hash = last_link_hash;
+    do
     {
-      sc_list_init(&link_hashes);
-      sc_dictionary_append(
-          memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size, link_hashes);
-    }
+      sc_number_hash_map_get(memory->link_hashes_next_link_hashes_map, link_hash, &link_hash);
+      sc_list_push_back(link_hashes, (sc_addr_hash_to_sc_pointer)link_hash);
+      ++count;
+    } while (link_hash != last_link_hash);
   }
 
+  sc_monitor_release_read(&memory->link_hashes_monitor);
+  return count;
+}
+
+void _sc_dictionary_fs_memory_append_link_string_unique(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 const string_offset)
+{
+  sc_monitor_acquire_write(&memory->link_hashes_monitor);
+
+  sc_uint64 previous_string_offset;
+  if (sc_number_hash_map_get(memory->link_hashes_string_offsets_map, link_hash, &previous_string_offset))
   {
-    if (!is_content_new && content->link_hashes != link_hashes)
-      sc_list_remove_if(content->link_hashes, (sc_addr_hash_to_sc_pointer)link_hash, _sc_addr_hash_compare);
+    if (previous_string_offset == string_offset)
+      goto result;
 
-    if (content->link_hashes != link_hashes)
-    {
-      content->string_offset = string_offset + 1;
-      content->link_hashes = link_hashes;
-      sc_list_push_back(content->link_hashes, (sc_addr_hash_to_sc_pointer)link_hash);
-    }
+    _sc_dictionary_fs_memory_remove_string_link_hash(memory, previous_string_offset, link_hash);
   }
+
+  sc_number_hash_map_insert(memory->link_hashes_string_offsets_map, link_hash, string_offset);
+  _sc_dictionary_fs_memory_append_string_link_hash(memory, string_offset, link_hash);
+
+result:
+  sc_monitor_release_write(&memory->link_hashes_monitor);
 }
 
 sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term(
@@ -330,49 +429,32 @@ sc_dictionary_fs_memory_status _sc_dictionary_node_fs_memory_get_string_offset_b
     sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(string_offset_it);
 
     // read string with size from fs-memory
-    sc_uint64 read_bytes;
-    sc_monitor * channel_monitor;
     sc_io_channel * strings_channel =
-        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
-    sc_monitor_acquire_read(channel_monitor);
+        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, null_ptr);
+    if (strings_channel == null_ptr)
+      goto error;
+
     sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
-    sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
     {
       sc_uint64 other_string_size;
-      if (sc_io_channel_read_chars(
-              strings_channel, (sc_char *)&other_string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != read_bytes)
-      {
-        sc_monitor_release_read(channel_monitor);
+      if (!_sc_dictionary_fs_memory_read_strings_channel(
+              strings_channel, normalized_string_offset, (sc_char *)&other_string_size, sizeof(sc_uint64)))
         goto error;
-      }
 
       if (other_string_size != string_size)
-      {
-        sc_monitor_release_read(channel_monitor);
         continue;
-      }
 
       sc_char other_string[other_string_size + 1];
-      if (sc_io_channel_read_chars(strings_channel, other_string, other_string_size, &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || other_string_size != read_bytes)
-      {
-        sc_monitor_release_read(channel_monitor);
+      if (!_sc_dictionary_fs_memory_read_strings_channel(
+              strings_channel, normalized_string_offset + sizeof(sc_uint64), other_string, other_string_size))
         goto error;
-      }
       other_string[other_string_size] = '\0';
 
       if (sc_str_cmp(string, other_string) == SC_FALSE)
-      {
-        sc_monitor_release_read(channel_monitor);
         continue;
-      }
     }
 
     *found_string_offset = string_offset;
-    sc_monitor_release_read(channel_monitor);
     break;
   }
 
@@ -454,6 +536,17 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     }
 
     memory->last_string_offset += written_bytes;
+
+    // strings are read by file descriptor of strings channel, so written string mustn't stay in buffer of channel
+    if (sc_io_channel_flush(strings_channel, null_ptr) != SC_FS_IO_STATUS_NORMAL)
+    {
+      sc_fs_memory_error("Error while string flushing");
+      goto write_error;
+    }
+
+    // strings are written under the same monitor, so their offsets are appended to trigrams index in ascending order
+    if (is_searchable_string && memory->search_by_substring)
+      sc_trigrams_index_append_string(memory->trigrams_index, *string_offset, string, string_size);
   }
 
   sc_monitor_release_write(channel_monitor);
@@ -538,44 +631,196 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
     status = _sc_dictionary_fs_memory_write_string_terms_string_offset(memory, string_offset, string_terms);
 
 exit:
+  _sc_dictionary_fs_memory_mark_changed(memory);
   sc_list_clear(string_terms);
   sc_list_destroy(string_terms);
 
   return status;
 }
 
-sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_stream(
     sc_dictionary_fs_memory * memory,
-    sc_addr_hash const link_hash)
+    sc_stream const * stream,
+    sc_uint64 const string_size,
+    sc_uint64 * string_offset)
+{
+  sc_monitor * channel_monitor;
+  sc_monitor_acquire_write(&memory->resolve_string_offset_monitor);
+  sc_io_channel * strings_channel =
+      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, memory->last_string_offset, &channel_monitor);
+  *string_offset = INVALID_STRING_OFFSET;
+  if (strings_channel == null_ptr)
+    goto no_last_channel_error;
+
+  sc_char * chunk = sc_mem_new(sc_char, SC_STREAM_CHUNK_SIZE);
+
+  // monitors are held while the whole string is copied, because strings after last string offset must be written
+  // completely before they are read or saved, so big strings block other fs-memory writes for copying time
+  sc_monitor_acquire_write(&memory->monitor);
+  sc_monitor_acquire_write(channel_monitor);
+
+  *string_offset = memory->last_string_offset;
+
+  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, *string_offset);
+  sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
+
+  sc_uint64 written_bytes = 0;
+  if (sc_io_channel_write_chars(strings_channel, &string_size, sizeof(string_size), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(string_size) != written_bytes)
+  {
+    sc_fs_memory_error("Error while attribute `size` writing");
+    goto write_error;
+  }
+
+  memory->last_string_offset += written_bytes;
+
+  // string is copied by chunks, so only one chunk of it is stored in memory
+  for (sc_uint64 copied_size = 0; copied_size < string_size; copied_size += written_bytes)
+  {
+    sc_uint32 chunk_size = SC_STREAM_CHUNK_SIZE;
+    if (chunk_size > string_size - copied_size)
+      chunk_size = string_size - copied_size;
+
+    if (sc_stream_read_data_full(stream, chunk, chunk_size) == SC_FALSE)
+    {
+      sc_fs_memory_error("Error while attribute `string` reading from stream");
+      goto write_error;
+    }
+
+    if (sc_io_channel_write_chars(strings_channel, chunk, chunk_size, &written_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || chunk_size != written_bytes)
+    {
+      sc_fs_memory_error("Error while attribute `string` writing");
+      goto write_error;
+    }
+
+    memory->last_string_offset += written_bytes;
+  }
+
+  // strings are read by file descriptor of strings channel, so written string mustn't stay in buffer of channel
+  if (sc_io_channel_flush(strings_channel, null_ptr) != SC_FS_IO_STATUS_NORMAL)
+  {
+    sc_fs_memory_error("Error while string flushing");
+    goto write_error;
+  }
+
+  sc_monitor_release_write(channel_monitor);
+  sc_monitor_release_write(&memory->monitor);
+  sc_monitor_release_write(&memory->resolve_string_offset_monitor);
+  sc_mem_free(chunk);
+  return SC_FS_MEMORY_OK;
+
+write_error:
+  sc_monitor_release_write(channel_monitor);
+  sc_monitor_release_write(&memory->monitor);
+  sc_mem_free(chunk);
+
+no_last_channel_error:
+  sc_monitor_release_write(&memory->resolve_string_offset_monitor);
+  return SC_FS_MEMORY_WRITE_ERROR;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_stream(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_stream const * stream,
+    sc_bool is_searchable_string)
 {
   if (memory == null_ptr)
   {
-    sc_fs_memory_info("Memory is empty to unlink string");
+    sc_fs_memory_info("Memory is empty to link stream");
     return SC_FS_MEMORY_NO;
   }
 
-  sc_monitor_acquire_write(&memory->monitor);
+  sc_uint32 string_size;
+  if (sc_stream_seek(stream, SC_STREAM_SEEK_SET, 0) != SC_RESULT_OK
+      || sc_stream_get_length(stream, &string_size) != SC_RESULT_OK)
+    return SC_FS_MEMORY_READ_ERROR;
 
-  sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
-  sc_uint64 link_hash_str_size;
-  sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
+  // small strings and strings divided into terms are read into memory
+  if (string_size < SC_STREAM_CHUNK_SIZE || (is_searchable_string && string_size < memory->max_searchable_string_size))
+  {
+    sc_char * string = null_ptr;
+    if (sc_stream_get_data(stream, &string, &string_size) == SC_FALSE)
+    {
+      sc_mem_free(string);
+      return SC_FS_MEMORY_READ_ERROR;
+    }
 
-  // remove link for current string
+    if (string == null_ptr)
+      sc_string_empty(string);
+
+    sc_dictionary_fs_memory_status const status =
+        sc_dictionary_fs_memory_link_string_ext(memory, link_hash, string, string_size, is_searchable_string);
+    sc_mem_free(string);
+    return status;
+  }
+
+  sc_uint64 string_offset;
+  sc_dictionary_fs_memory_status const status =
+      _sc_dictionary_fs_memory_write_stream(memory, stream, string_size, &string_offset);
+  if (status == SC_FS_MEMORY_OK)
+    _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+  _sc_dictionary_fs_memory_mark_changed(memory);
+
+  return status;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_offset_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 * string_offset)
+{
+  if (memory == null_ptr)
   {
-    sc_link_hash_content * link_hash_content =
-        sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
-    if (link_hash_content == null_ptr)
-      goto result;
+    sc_fs_memory_info("Memory is empty to get string offset by link hash");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_monitor_acquire_read(&memory->link_hashes_monitor);
+  sc_bool const is_linked = sc_number_hash_map_get(memory->link_hashes_string_offsets_map, link_hash, string_offset);
+  sc_monitor_release_read(&memory->link_hashes_monitor);
+
+  return is_linked ? SC_FS_MEMORY_OK : SC_FS_MEMORY_NO_STRING;
+}
 
-    sc_list_remove_if(link_hash_content->link_hashes, (sc_addr_hash_to_sc_pointer)link_hash, _sc_addr_hash_compare);
-    sc_mem_free(link_hash_content);
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 const string_offset)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to link string offset");
+    return SC_FS_MEMORY_NO;
   }
 
-  // set empty link
-  sc_dictionary_append(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size, null_ptr);
+  _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+  _sc_dictionary_fs_memory_mark_changed(memory);
+  return SC_FS_MEMORY_OK;
+}
 
-result:
-  sc_monitor_release_write(&memory->monitor);
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to unlink string");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_monitor_acquire_write(&memory->link_hashes_monitor);
+
+  // remove link for current string
+  sc_uint64 string_offset;
+  if (sc_number_hash_map_remove(memory->link_hashes_string_offsets_map, link_hash, &string_offset))
+    _sc_dictionary_fs_memory_remove_string_link_hash(memory, string_offset, link_hash);
+
+  sc_monitor_release_write(&memory->link_hashes_monitor);
+  _sc_dictionary_fs_memory_mark_changed(memory);
 
   return SC_FS_MEMORY_OK;
 }
@@ -585,9 +830,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
     sc_uint64 const string_offset,
     sc_char ** string)
 {
-  sc_monitor * channel_monitor;
   sc_io_channel * strings_channel =
-      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
+      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, null_ptr);
   if (strings_channel == null_ptr)
   {
     sc_fs_memory_error("Path `%s` doesn't exist", "path");
@@ -595,36 +839,32 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
   }
 
   // read string with size from fs-memory
-  sc_uint64 read_bytes;
   sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
-  sc_monitor_acquire_write(channel_monitor);
-  sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
   {
     sc_uint64 string_size;
-    if (sc_io_channel_read_chars(strings_channel, (sc_char *)&string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
+    if (!_sc_dictionary_fs_memory_read_strings_channel(
+            strings_channel, normalized_string_offset, (sc_char *)&string_size, sizeof(sc_uint64)))
     {
       *string = null_ptr;
-      goto error;
+      return SC_FS_MEMORY_READ_ERROR;
     }
 
     *string = sc_mem_new(sc_char, string_size + 1);
-    if (sc_io_channel_read_chars(strings_channel, *string, string_size, &read_bytes, null_ptr) != SC_FS_IO_STATUS_NORMAL
-        || string_size != read_bytes)
+    if (!_sc_dictionary_fs_memory_read_strings_channel(
+            strings_channel, normalized_string_offset + sizeof(sc_uint64), *string, string_size))
     {
       sc_mem_free(*string);
       *string = null_ptr;
-      goto error;
+      return SC_FS_MEMORY_READ_ERROR;
     }
   }
 
-  sc_monitor_release_write(channel_monitor);
   return SC_FS_MEMORY_OK;
+}
 
-error:
-  sc_monitor_release_write(channel_monitor);
-  return SC_FS_MEMORY_READ_ERROR;
+sc_bool _sc_dictionary_fs_memory_is_file_path(sc_char const * string)
+{
+  return (sc_str_find(string, ".") || sc_str_find(string, "/")) && sc_fs_is_file(string);
 }
 
 void _sc_dictionary_fs_memory_read_file(sc_char * file_path, sc_char ** content, sc_uint32 * size)
@@ -652,20 +892,18 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     return SC_FS_MEMORY_NO;
   }
 
-  sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
-  sc_uint64 link_hash_str_size;
-  sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
-  sc_link_hash_content * content =
-      sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
+  sc_uint64 string_offset;
+  sc_monitor_acquire_read(&memory->link_hashes_monitor);
+  sc_bool const is_linked = sc_number_hash_map_get(memory->link_hashes_string_offsets_map, link_hash, &string_offset);
+  sc_monitor_release_read(&memory->link_hashes_monitor);
 
-  if (content == null_ptr)
+  if (is_linked == SC_FALSE)
   {
     *string = null_ptr;
     *string_size = 0;
     return SC_FS_MEMORY_NO_STRING;
   }
 
-  sc_uint64 const string_offset = (sc_uint64)content->string_offset - 1;
   sc_dictionary_fs_memory_status const status =
       _sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, string);
   if (status != SC_FS_MEMORY_OK)
@@ -675,7 +913,7 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     return SC_FS_MEMORY_READ_ERROR;
   }
 
-  if ((sc_str_find(*string, ".") || sc_str_find(*string, "/")) && sc_fs_is_file(*string))
+  if (_sc_dictionary_fs_memory_is_file_path(*string))
   {
     sc_char * file_path = *string;
     sc_uint32 size;
@@ -689,6 +927,75 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
   return SC_FS_MEMORY_OK;
 }
 
+sc_stream * _sc_dictionary_fs_memory_new_file_stream(sc_char const * file_path)
+{
+  sc_stream * stream = sc_stream_file_new(file_path, SC_STREAM_FLAG_READ);
+  // contents of binary files are encoded by chunks while they are read
+  if (stream != null_ptr && sc_fs_is_binary_file(file_path))
+    stream = sc_stream_base64_new(stream);
+  return stream;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_stream_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_char ** string,
+    sc_uint64 * string_size,
+    sc_stream ** stream)
+{
+  *string = null_ptr;
+  *string_size = 0;
+  *stream = null_ptr;
+
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to get stream by link hash");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_uint64 string_offset;
+  sc_monitor_acquire_read(&memory->link_hashes_monitor);
+  sc_bool const is_linked = sc_number_hash_map_get(memory->link_hashes_string_offsets_map, link_hash, &string_offset);
+  sc_monitor_release_read(&memory->link_hashes_monitor);
+
+  if (is_linked == SC_FALSE)
+    return SC_FS_MEMORY_NO_STRING;
+
+  sc_io_channel * strings_channel =
+      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, null_ptr);
+  if (strings_channel == null_ptr)
+    return SC_FS_MEMORY_READ_ERROR;
+
+  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
+  sc_uint64 size;
+  if (!_sc_dictionary_fs_memory_read_strings_channel(
+          strings_channel, normalized_string_offset, (sc_char *)&size, sizeof(sc_uint64)))
+    return SC_FS_MEMORY_READ_ERROR;
+
+  // written strings aren't changed, so stream reads string from strings channel after sc-link content is changed
+  if (size >= SC_STREAM_CHUNK_SIZE)
+  {
+    *stream = sc_stream_file_region_new(
+        sc_io_channel_get_file_descriptor(strings_channel), normalized_string_offset + sizeof(sc_uint64), size);
+    return *stream == null_ptr ? SC_FS_MEMORY_READ_ERROR : SC_FS_MEMORY_OK;
+  }
+
+  if (_sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, string) != SC_FS_MEMORY_OK)
+    return SC_FS_MEMORY_READ_ERROR;
+
+  if (_sc_dictionary_fs_memory_is_file_path(*string))
+  {
+    *stream = _sc_dictionary_fs_memory_new_file_stream(*string);
+    sc_mem_free(*string);
+    *string = null_ptr;
+    return *stream == null_ptr ? SC_FS_MEMORY_READ_ERROR : SC_FS_MEMORY_OK;
+  }
+
+  *string_size = sc_str_len(*string);
+
+  return SC_FS_MEMORY_OK;
+}
+
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
     sc_dictionary_fs_memory * memory,
     sc_char const * string,
@@ -702,7 +1009,6 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
   if (!sc_iterator_next(string_offset_it))
     return SC_FS_MEMORY_NO_STRING;
 
-  sc_monitor * channel_monitor;
   while (sc_iterator_next(string_offset_it))
   {
     sc_pair * pair;
@@ -716,7 +1022,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
       string_offset = (sc_uint64)sc_iterator_get(string_offset_it);
 
     sc_io_channel * strings_channel =
-        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
+        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, null_ptr);
     if (strings_channel == null_ptr)
     {
       sc_fs_memory_error("Path `%s` doesn't exist", "path");
@@ -724,31 +1030,20 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
     }
 
     // read string with size from fs-memory
-    sc_uint64 read_bytes;
     sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
-
-    sc_bool go_to_next = SC_FALSE;
-    sc_monitor_acquire_write(channel_monitor);
-    sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
     {
       sc_uint64 other_string_size;
-      if (sc_io_channel_read_chars(
-              strings_channel, (sc_char *)&other_string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != read_bytes)
+      if (!_sc_dictionary_fs_memory_read_strings_channel(
+              strings_channel, normalized_string_offset, (sc_char *)&other_string_size, sizeof(sc_uint64)))
         goto error;
 
       // optimize needed string search
       if ((is_substring && other_string_size < string_size) || (!is_substring && other_string_size != string_size))
-      {
-        go_to_next = SC_TRUE;
-        goto cont;
-      }
+        continue;
 
       sc_char other_string[other_string_size + 1];
-      if (sc_io_channel_read_chars(strings_channel, other_string, other_string_size, &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || other_string_size != read_bytes)
+      if (!_sc_dictionary_fs_memory_read_strings_channel(
+              strings_channel, normalized_string_offset + sizeof(sc_uint64), other_string, other_string_size))
         goto error;
 
       other_string[other_string_size] = '\0';
@@ -757,27 +1052,17 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
            && ((to_search_as_prefix && sc_str_has_prefix(other_string, string) == SC_FALSE)
                || (!to_search_as_prefix && sc_str_find(other_string, string) == SC_FALSE)))
           || (!is_substring && sc_str_cmp(string, other_string) == SC_FALSE))
-      {
-        go_to_next = SC_TRUE;
-        goto cont;
-      }
+        continue;
     }
 
-  cont:
-    sc_monitor_release_write(channel_monitor);
-    if (go_to_next)
-      continue;
-
-    sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
-    sc_uint64 string_offset_str_size;
-    sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
-
     sc_list * link_hashes_list;
     if (is_substring)
       link_hashes_list = pair->second;
     else
-      link_hashes_list = sc_dictionary_get_by_key(
-          memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
+    {
+      sc_list_init(&link_hashes_list);
+      _sc_dictionary_fs_memory_get_string_link_hashes(memory, string_offset, link_hashes_list);
+    }
 
     sc_iterator * data_it = sc_list_iterator(link_hashes_list);
     while (sc_iterator_next(data_it))
@@ -789,17 +1074,82 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
         link_handler->push_link_callback(link_handler->push_link_callback_data, link_addr);
     }
     sc_iterator_destroy(data_it);
+
+    if (!is_substring)
+      sc_list_destroy(link_hashes_list);
   }
   sc_iterator_destroy(string_offset_it);
 
   return SC_FS_MEMORY_OK;
 
 error:
-  sc_monitor_release_write(channel_monitor);
   sc_iterator_destroy(string_offset_it);
   return SC_FS_MEMORY_READ_ERROR;
 }
 
+/*! Appends a string offset with its filtered link hashes to list of found strings offsets.
+ * @returns Returns SC_TRUE, if link handler requests to stop search; otherwise return SC_FALSE.
+ */
+sc_bool _sc_dictionary_fs_memory_push_string_offset_link_hashes(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_list * string_offsets,
+    sc_link_handler * link_handler)
+{
+  // skip strings without links
+  sc_list * link_hashes;
+  sc_list_init(&link_hashes);
+  if (_sc_dictionary_fs_memory_get_string_link_hashes(memory, string_offset, link_hashes) == 0)
+  {
+    sc_list_destroy(link_hashes);
+    return SC_FALSE;
+  }
+
+  sc_bool is_stopped_to_search_link = SC_FALSE;
+  sc_list * filtered_link_hashes;
+  if (link_handler != null_ptr && link_handler->check_link_callback != null_ptr)
+  {
+    sc_list_init(&filtered_link_hashes);
+    sc_iterator * link_hashes_it = sc_list_iterator(link_hashes);
+    while (sc_iterator_next(link_hashes_it))
+    {
+      sc_addr_hash link_addr_hash = (sc_pointer_to_sc_addr_hash)sc_iterator_get(link_hashes_it);
+      sc_addr link_addr;
+      SC_ADDR_LOCAL_FROM_INT(link_addr_hash, link_addr);
+
+      if (link_handler->check_link_callback(link_handler->check_link_callback_data, link_addr) == SC_FALSE)
+        continue;
+
+      if (link_handler->request_link_callback != null_ptr)
+      {
+        sc_bool const link_filter_request_status =
+            link_handler->request_link_callback(link_handler->request_link_callback_data, link_addr);
+        if (link_filter_request_status == SC_LINK_FILTER_REQUEST_CONTINUE)
+          is_stopped_to_search_link = SC_FALSE;
+        else if (link_filter_request_status == SC_LINK_FILTER_REQUEST_STOP)
+          is_stopped_to_search_link = SC_TRUE;
+      }
+
+      sc_list_push_back(filtered_link_hashes, (sc_addr_hash_to_sc_pointer)link_addr_hash);
+
+      if (is_stopped_to_search_link)
+        break;
+    }
+    sc_iterator_destroy(link_hashes_it);
+    sc_list_destroy(link_hashes);
+  }
+  else
+    filtered_link_hashes = link_hashes;
+
+  if (filtered_link_hashes->size == 0)
+  {
+    sc_list_destroy(filtered_link_hashes);
+    return SC_FALSE;
+  }
+  sc_list_push_back(string_offsets, sc_make_pair((void *)string_offset, (void *)filtered_link_hashes));
+  return is_stopped_to_search_link;
+}
+
 sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictionary_node * node, void ** arguments)
 {
   if (node->data == null_ptr)
@@ -815,69 +1165,10 @@ sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictiona
     return SC_TRUE;
   }
 
-  sc_bool is_stopped_to_search_link = SC_FALSE;
   while (sc_iterator_next(it))
   {
     sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(it);
-    sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
-    sc_uint64 string_offset_str_size;
-    sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
-
-    // skip strings without links
-    sc_list * link_hashes = sc_dictionary_get_by_key(
-        memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
-
-    if (link_hashes == null_ptr || link_hashes->size == 0)
-      continue;
-
-    sc_list * filtered_link_hashes;
-    sc_list_init(&filtered_link_hashes);
-    if (link_handler != null_ptr && link_handler->check_link_callback != null_ptr)
-    {
-      sc_iterator * link_hashes_it = sc_list_iterator(link_hashes);
-      while (sc_iterator_next(link_hashes_it))
-      {
-        sc_addr_hash link_addr_hash = (sc_pointer_to_sc_addr_hash)sc_iterator_get(link_hashes_it);
-        sc_addr link_addr;
-        SC_ADDR_LOCAL_FROM_INT(link_addr_hash, link_addr);
-
-        if (link_handler->check_link_callback(link_handler->check_link_callback_data, link_addr) == SC_FALSE)
-          continue;
-
-        if (link_handler->request_link_callback != null_ptr)
-        {
-          sc_bool const link_filter_request_status =
-              link_handler->request_link_callback(link_handler->request_link_callback_data, link_addr);
-          if (link_filter_request_status == SC_LINK_FILTER_REQUEST_CONTINUE)
-            is_stopped_to_search_link = SC_FALSE;
-          else if (link_filter_request_status == SC_LINK_FILTER_REQUEST_STOP)
-            is_stopped_to_search_link = SC_TRUE;
-        }
-
-        sc_list_push_back(filtered_link_hashes, (sc_addr_hash_to_sc_pointer)link_addr_hash);
-
-        if (is_stopped_to_search_link)
-          break;
-      }
-      sc_iterator_destroy(link_hashes_it);
-    }
-    else
-    {
-      sc_iterator * link_hashes_it = sc_list_iterator(link_hashes);
-      while (sc_iterator_next(link_hashes_it))
-      {
-        void * link_addr_hash = sc_iterator_get(link_hashes_it);
-        sc_list_push_back(filtered_link_hashes, link_addr_hash);
-      }
-      sc_iterator_destroy(link_hashes_it);
-    }
-    if (filtered_link_hashes->size == 0)
-    {
-      sc_list_destroy(filtered_link_hashes);
-      continue;
-    }
-    sc_list_push_back(string_offsets, sc_make_pair((void *)string_offset, (void *)filtered_link_hashes));
-    if (is_stopped_to_search_link)
+    if (_sc_dictionary_fs_memory_push_string_offset_link_hashes(memory, string_offset, string_offsets, link_handler))
       break;
   }
   sc_iterator_destroy(it);
@@ -910,6 +1201,43 @@ sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(
   return string_offsets;
 }
 
+/*! Gets offsets of strings which may contain substring. Strings containing all trigrams of substring are found by
+ * trigrams index, so substring can start in the middle of string term. Substrings shorter than trigram and memories
+ * without search by substring are searched by prefix of the first substring term.
+ */
+sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_substring(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * substring,
+    sc_uint64 const substring_size,
+    sc_link_handler * link_handler)
+{
+  sc_uint64 * found_string_offsets;
+  sc_uint64 found_string_offsets_count;
+  if (!memory->search_by_substring
+      || !sc_trigrams_index_get_string_offsets(
+          memory->trigrams_index, substring, substring_size, &found_string_offsets, &found_string_offsets_count))
+  {
+    sc_char * term = _sc_dictionary_fs_memory_get_first_term(substring, memory->term_separators);
+    sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term, link_handler);
+    sc_mem_free(term);
+    return string_offsets;
+  }
+
+  sc_list * string_offsets;
+  sc_list_init(&string_offsets);
+  sc_list_push_back(string_offsets, null_ptr);
+
+  for (sc_uint64 i = 0; i < found_string_offsets_count; ++i)
+  {
+    if (_sc_dictionary_fs_memory_push_string_offset_link_hashes(
+            memory, found_string_offsets[i], string_offsets, link_handler))
+      break;
+  }
+  sc_mem_free(found_string_offsets);
+
+  return string_offsets;
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string_ext(
     sc_dictionary_fs_memory * memory,
     sc_char const * string,
@@ -924,13 +1252,16 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string
     return SC_FS_MEMORY_NO;
   }
 
-  sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
   sc_list * string_offsets = null_ptr;
   if (is_substring)
-    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term, link_handler);
+    string_offsets =
+        _sc_dictionary_fs_memory_get_string_offsets_by_substring(memory, string, string_size, link_handler);
   else
+  {
+    sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
     string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
-  sc_mem_free(term);
+    sc_mem_free(term);
+  }
 
   sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
       memory, string, string_size, is_substring, to_search_as_prefix, string_offsets, link_handler);
@@ -998,14 +1329,13 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
   if (!sc_iterator_next(string_offset_it))
     return SC_FS_MEMORY_READ_ERROR;
 
-  sc_monitor * channel_monitor;
   while (sc_iterator_next(string_offset_it))
   {
     sc_pair * pair = (sc_pair *)sc_iterator_get(string_offset_it);
     sc_uint64 const string_offset = (sc_uint64)pair->first;
 
     sc_io_channel * strings_channel =
-        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
+        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, null_ptr);
     if (strings_channel == null_ptr)
     {
       sc_fs_memory_error("Path `%s` doesn't exist", "path");
@@ -1013,30 +1343,19 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
     }
 
     // read string with size from fs-memory
-    sc_uint64 read_bytes;
     sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
-
-    sc_bool go_to_next = SC_FALSE;
-    sc_monitor_acquire_write(channel_monitor);
-    sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
     {
       sc_uint64 other_string_size;
-      if (sc_io_channel_read_chars(
-              strings_channel, (sc_char *)&other_string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != read_bytes)
+      if (!_sc_dictionary_fs_memory_read_strings_channel(
+              strings_channel, normalized_string_offset, (sc_char *)&other_string_size, sizeof(sc_uint64)))
         goto error;
 
       if (other_string_size < string_size)
-      {
-        go_to_next = SC_TRUE;
-        goto cont;
-      }
+        continue;
 
       sc_char * other_string = sc_mem_new(sc_char, other_string_size + 1);
-      if (sc_io_channel_read_chars(strings_channel, other_string, other_string_size, &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || other_string_size != read_bytes)
+      if (!_sc_dictionary_fs_memory_read_strings_channel(
+              strings_channel, normalized_string_offset + sizeof(sc_uint64), other_string, other_string_size))
       {
         sc_mem_free(other_string);
         goto error;
@@ -1046,14 +1365,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
           || (!to_search_as_prefix && sc_str_find(other_string, string) == SC_FALSE))
       {
         sc_mem_free(other_string);
-        go_to_next = SC_TRUE;
-        goto cont;
-      }
-
-    cont:
-      sc_monitor_release_write(channel_monitor);
-      if (go_to_next)
         continue;
+      }
 
       if (link_handler->push_link_content_callback != null_ptr)
         link_handler->push_link_content_callback(
@@ -1066,7 +1379,6 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
   return SC_FS_MEMORY_OK;
 
 error:
-  sc_monitor_release_write(channel_monitor);
   sc_iterator_destroy(string_offset_it);
   return SC_FS_MEMORY_READ_ERROR;
 }
@@ -1084,9 +1396,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
     return SC_FS_MEMORY_NO;
   }
 
-  sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
-  sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term, link_handler);
-  sc_mem_free(term);
+  sc_list * string_offsets =
+      _sc_dictionary_fs_memory_get_string_offsets_by_substring(memory, string, string_size, link_handler);
 
   sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_get_strings_by_substring_term(
       memory, string, string_size, to_search_as_prefix, string_offsets, link_handler);
@@ -1141,16 +1452,9 @@ sc_bool _sc_dictionary_fs_memory_get_link_hashes_by_string_offsets(sc_dictionary
   if (size == 0 || list->size == size + 1)
   {
     sc_char const * string_offset_str = list->begin->data;
+    sc_uint64 const string_offset = strtoull(string_offset_str, null_ptr, 10);
 
-    sc_list * data = sc_dictionary_get_by_key(
-        memory->string_offsets_link_hashes_dictionary, string_offset_str, sc_str_len(string_offset_str));
-    sc_iterator * data_it = sc_list_iterator(data);
-    while (sc_iterator_next(data_it))
-    {
-      void * hash = sc_iterator_get(data_it);
-      sc_list_push_back(link_hashes, hash);
-    }
-    sc_iterator_destroy(data_it);
+    _sc_dictionary_fs_memory_get_string_link_hashes(memory, string_offset, link_hashes);
   }
 
   return SC_TRUE;
@@ -1429,6 +1733,118 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_string_offsets_link
   return SC_FS_MEMORY_OK;
 }
 
+sc_bool _sc_dictionary_fs_memory_collect_term_string_offsets(sc_dictionary_node * node, void ** arguments)
+{
+  if (node->data == null_ptr)
+    return SC_TRUE;
+
+  sc_number_hash_map * string_offsets = arguments[0];
+  sc_iterator * it = sc_list_iterator(node->data);
+  if (sc_iterator_next(it))
+  {
+    while (sc_iterator_next(it))
+      sc_number_hash_map_insert(string_offsets, (sc_uint64)sc_iterator_get(it), 0);
+  }
+  sc_iterator_destroy(it);
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_dictionary_fs_memory_push_string_offset(sc_uint64 string_offset, sc_uint64 value, void ** arguments)
+{
+  (void)value;
+  sc_uint64 * string_offsets = arguments[0];
+  sc_uint64 * string_offsets_count = arguments[1];
+  string_offsets[(*string_offsets_count)++] = string_offset;
+  return SC_TRUE;
+}
+
+int _sc_dictionary_fs_memory_compare_string_offsets(void const * string_offset, void const * other_string_offset)
+{
+  sc_uint64 const offset = *(sc_uint64 const *)string_offset;
+  sc_uint64 const other_offset = *(sc_uint64 const *)other_string_offset;
+  return (offset > other_offset) - (offset < other_offset);
+}
+
+//! Appends all searchable strings to trigrams index in ascending order of their offsets.
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_build_trigrams_index(sc_dictionary_fs_memory * memory)
+{
+  sc_number_hash_map * unique_string_offsets;
+  sc_number_hash_map_initialize(&unique_string_offsets, 0);
+  void * arguments[2];
+  arguments[0] = unique_string_offsets;
+  sc_dictionary_visit_down_nodes(
+      memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_collect_term_string_offsets, arguments);
+
+  sc_uint64 string_offsets_count = 0;
+  sc_uint64 * string_offsets = sc_mem_new(sc_uint64, unique_string_offsets->size);
+  arguments[0] = string_offsets;
+  arguments[1] = &string_offsets_count;
+  sc_number_hash_map_visit(unique_string_offsets, _sc_dictionary_fs_memory_push_string_offset, arguments);
+  sc_number_hash_map_destroy(unique_string_offsets);
+  qsort(string_offsets, string_offsets_count, sizeof(sc_uint64), _sc_dictionary_fs_memory_compare_string_offsets);
+
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+  {
+    sc_io_channel * strings_channel =
+        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offsets[i], null_ptr);
+    if (strings_channel == null_ptr)
+    {
+      status = SC_FS_MEMORY_READ_ERROR;
+      break;
+    }
+
+    sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offsets[i]);
+    sc_uint64 string_size;
+    if (!_sc_dictionary_fs_memory_read_strings_channel(
+            strings_channel, normalized_string_offset, (sc_char *)&string_size, sizeof(sc_uint64)))
+    {
+      status = SC_FS_MEMORY_READ_ERROR;
+      break;
+    }
+
+    sc_char * string = sc_mem_new(sc_char, string_size + 1);
+    if (!_sc_dictionary_fs_memory_read_strings_channel(
+            strings_channel, normalized_string_offset + sizeof(sc_uint64), string, string_size))
+    {
+      sc_mem_free(string);
+      status = SC_FS_MEMORY_READ_ERROR;
+      break;
+    }
+
+    sc_trigrams_index_append_string(memory->trigrams_index, string_offsets[i], string, string_size);
+    sc_mem_free(string);
+  }
+  sc_mem_free(string_offsets);
+
+  return status;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_trigrams_string_offsets(sc_dictionary_fs_memory * memory)
+{
+  if (!memory->search_by_substring)
+    return SC_FS_MEMORY_NO;
+
+  sc_fs_memory_info("Load `trigram - offsets` index from %s", memory->trigrams_string_offsets_path);
+  if (sc_trigrams_index_load(memory->trigrams_index, memory->trigrams_string_offsets_path))
+  {
+    sc_fs_memory_info("Index `trigram - offsets` loaded");
+    return SC_FS_MEMORY_OK;
+  }
+
+  sc_fs_memory_info("Path `%s` doesn't exist. Build index by loaded strings", memory->trigrams_string_offsets_path);
+  sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_build_trigrams_index(memory);
+  if (status != SC_FS_MEMORY_OK)
+  {
+    sc_fs_memory_error("Error while index `trigram - offsets` building");
+    return status;
+  }
+
+  sc_fs_memory_info("Index `trigram - offsets` built");
+  return SC_FS_MEMORY_OK;
+}
+
 sc_fs_memory_status _sc_dictionary_fs_memory_load_deprecated_dictionaries(sc_dictionary_fs_memory * memory)
 {
   sc_char * strings_path;
@@ -1515,6 +1931,8 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_mem
 
   _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
 
+  _sc_dictionary_fs_memory_load_trigrams_string_offsets(memory);
+
   sc_fs_memory_info("All sc-fs-memory dictionaries loaded");
 
   return SC_FS_MEMORY_OK;
@@ -1618,55 +2036,54 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_term_string_offsets
   return SC_FS_MEMORY_OK;
 }
 
-sc_bool _sc_dictionary_fs_memory_write_string_offsets_link_hashes(sc_dictionary_node * node, void ** arguments)
+sc_bool _sc_dictionary_fs_memory_write_string_offsets_link_hashes(
+    sc_uint64 string_offset,
+    sc_uint64 last_link_hash,
+    void ** arguments)
 {
-  if (node->data == null_ptr)
-    return SC_TRUE;
-
-  sc_io_channel * channel = arguments[0];
-
-  sc_link_hash_content * content = node->data;
-  sc_iterator * data_it = sc_list_iterator(content->link_hashes);
+  sc_dictionary_fs_memory const * memory = arguments[0];
+  sc_io_channel * channel = arguments[1];
 
   sc_uint64 written_bytes = 0;
-  sc_uint64 const string_offset = content->string_offset - 1;
   if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
           != SC_FS_IO_STATUS_NORMAL
       || sizeof(sc_uint64) != written_bytes)
   {
     sc_fs_memory_error("Error while attribute `string_offset` writing");
-    goto error;
+    return SC_FALSE;
   }
 
-  sc_uint64 const link_hashes_count = content->link_hashes->size;
+  sc_uint64 link_hashes_count = 0;
+  sc_uint64 link_hash = last_link_hash;
+  do
+  {
+    sc_number_hash_map_get(memory->link_hashes_next_link_hashes_map, link_hash, &link_hash);
+    ++link_hashes_count;
+  } while (link_hash != last_link_hash);
+
   if (sc_io_channel_write_chars(channel, (sc_char *)&link_hashes_count, sizeof(sc_uint64), &written_bytes, null_ptr)
           != SC_FS_IO_STATUS_NORMAL
       || sizeof(sc_uint64) != written_bytes)
   {
     sc_fs_memory_error("Error while attribute `link_hashes_count` writing");
-    goto error;
+    return SC_FALSE;
   }
 
-  while (sc_iterator_next(data_it))
+  do
   {
-    sc_addr_hash const link_hash = (sc_uint64)sc_iterator_get(data_it);
-    if (sc_io_channel_write_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &written_bytes, null_ptr)
+    sc_number_hash_map_get(memory->link_hashes_next_link_hashes_map, link_hash, &link_hash);
+    sc_addr_hash const written_link_hash = (sc_addr_hash)link_hash;
+    if (sc_io_channel_write_chars(
+            channel, (sc_char *)&written_link_hash, sizeof(sc_addr_hash), &written_bytes, null_ptr)
             != SC_FS_IO_STATUS_NORMAL
         || sizeof(sc_addr_hash) != written_bytes)
     {
       sc_fs_memory_error("Error while attribute `link_hash` writing");
-      goto error;
+      return SC_FALSE;
     }
-  }
+  } while (link_hash != last_link_hash);
 
-  sc_iterator_destroy(data_it);
   return SC_TRUE;
-
-error:
-{
-  sc_iterator_destroy(data_it);
-  return SC_FALSE;
-}
 }
 
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_offsets_link_hashes(
@@ -1675,10 +2092,17 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_offsets_link
   sc_io_channel * channel = sc_io_new_write_channel(memory->string_offsets_link_hashes_path, null_ptr);
   sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
 
-  if (!sc_dictionary_visit_down_nodes(
-          memory->link_hashes_string_offsets_dictionary,
-          _sc_dictionary_fs_memory_write_string_offsets_link_hashes,
-          (void **)&channel))
+  void * arguments[2];
+  arguments[0] = (void *)memory;
+  arguments[1] = channel;
+
+  sc_monitor * link_hashes_monitor = (sc_monitor *)&memory->link_hashes_monitor;
+  sc_monitor_acquire_read(link_hashes_monitor);
+  sc_bool const is_written = sc_number_hash_map_visit(
+      memory->string_offsets_link_hashes_map, _sc_dictionary_fs_memory_write_string_offsets_link_hashes, arguments);
+  sc_monitor_release_read(link_hashes_monitor);
+
+  if (!is_written)
   {
     sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
     return SC_FS_MEMORY_WRITE_ERROR;
@@ -1697,19 +2121,47 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_mem
     return SC_FS_MEMORY_NO;
   }
 
+  // dictionaries are written entirely, so they are written only if they changed or their files are absent, for
+  // example, after loading of deprecated dictionaries
+  sc_int32 * is_changed = (sc_int32 *)&memory->is_changed;
+  if (g_atomic_int_get(is_changed) == SC_FALSE && sc_fs_is_file(memory->terms_string_offsets_path)
+      && sc_fs_is_file(memory->string_offsets_link_hashes_path)
+      && (!memory->search_by_substring || sc_fs_is_file(memory->trigrams_string_offsets_path)))
+  {
+    sc_fs_memory_info("There are no changed sc-fs-memory dictionaries to save");
+    return SC_FS_MEMORY_OK;
+  }
+
   sc_fs_memory_info("Save sc-fs-memory dictionaries");
+  // changes made after the mark reset are written or left for the next save
+  g_atomic_int_set(is_changed, SC_FALSE);
   sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_save_term_string_offsets(memory);
   if (status != SC_FS_MEMORY_OK)
-    return status;
+    goto error;
 
   status = _sc_dictionary_fs_memory_save_string_offsets_link_hashes(memory);
   if (status != SC_FS_MEMORY_OK)
-    return status;
+    goto error;
+
+  if (memory->search_by_substring)
+  {
+    if (!sc_trigrams_index_save(memory->trigrams_index, memory->trigrams_string_offsets_path))
+    {
+      sc_fs_memory_error("Error while index `trigram - offsets` writing");
+      status = SC_FS_MEMORY_WRITE_ERROR;
+      goto error;
+    }
+    sc_fs_memory_info("Index `trigram - offsets` written");
+  }
 
   sc_message("\tLast string offset: %" PRIu64, memory->last_string_offset);
 
   sc_fs_memory_info("All sc-fs-memory dictionaries saved");
   return status;
+
+error:
+  g_atomic_int_set(is_changed, SC_TRUE);
+  return status;
 }
 
 #endif
@@ -74,6 +74,20 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
     sc_uint64 string_size,
     sc_bool is_searchable_string);
 
+/*! Appends sc-link hash to file system memory with content read from stream. Big contents that can't be found by
+ * string are copied into file system memory by chunks without reading them into memory.
+ * @param memory A pointer to file memory
+ * @param link_hash An appendable sc-link hash
+ * @param stream A seekable stream with sc-link content
+ * @param is_searchable_string Ability to search for sc-links on this content string
+ * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_stream(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_stream const * stream,
+    sc_bool is_searchable_string);
+
 /*! Removes sc-link content string from file system memory.
  * @param memory A pointer to file memory
  * @param link_hash A sc-link hash
@@ -83,6 +97,28 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
     sc_dictionary_fs_memory * memory,
     sc_addr_hash link_hash);
 
+/*! Gets offset of string linked with sc-link.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param[out] string_offset Offset of sc-link content string
+ * @returns SC_FS_MEMORY_NO_STRING, if sc-link has no content.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_offset_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_uint64 * string_offset);
+
+/*! Links sc-link with string written before by its offset.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param string_offset Offset of written string
+ * @returns SC_FS_MEMORY_OK, if sc-link is linked.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_uint64 string_offset);
+
 /*! Gets sc-link content string with its size by sc-link hash.
  * @param memory A pointer to file memory
  * @param link_hash A sc-link hash
@@ -96,6 +132,22 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     sc_char ** string,
     sc_uint64 * string_size);
 
+/*! Gets sc-link content by sc-link hash without reading big contents into memory.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param[out] string A sc-link content string, if it is smaller than SC_STREAM_CHUNK_SIZE, otherwise null_ptr
+ * @param[out] string_size A sc-link content string size
+ * @param[out] stream A stream reading big sc-link content or content of file referred by sc-link by chunks, otherwise
+ * null_ptr
+ * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_stream_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_char ** string,
+    sc_uint64 * string_size,
+    sc_stream ** stream);
+
 /*! Function that retrieves sc-link hashes by a full string term from the file memory.
  * @param memory Pointer to the file memory.
  * @param string Pointer to the full string term.
@@ -206,6 +258,7 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_mem
 /*! Save file system memory to file system
  * @param memory A pointer to file memory
  * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
+ * @remarks Dictionaries are rewritten entirely, but only if they changed since the last save.
  */
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_memory const * memory);
 
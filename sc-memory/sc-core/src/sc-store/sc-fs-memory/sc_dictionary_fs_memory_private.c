@@ -32,25 +32,6 @@ sc_bool _sc_uchar_dictionary_initialize(sc_dictionary ** dictionary)
       dictionary, _sc_uchar_dictionary_children_size(), _sc_uchar_dictionary_sc_char_to_sc_int);
 }
 
-sc_uint8 _sc_number_dictionary_children_size()
-{
-  sc_uint8 const max_sc_char = 9;
-  sc_uint8 const min_sc_char = 0;
-
-  return max_sc_char - min_sc_char + 1;
-}
-
-void _sc_number_dictionary_sc_char_to_sc_int(sc_char ch, sc_uint8 * ch_num, sc_uint8 const * mask)
-{
-  *ch_num = (sc_uint8)ch - '0';
-}
-
-sc_bool _sc_number_dictionary_initialize(sc_dictionary ** dictionary)
-{
-  return sc_dictionary_initialize(
-      dictionary, _sc_number_dictionary_children_size(), _sc_number_dictionary_sc_char_to_sc_int);
-}
-
 void _sc_dictionary_fs_memory_node_clear(sc_dictionary_node * node)
 {
   if (node->data == null_ptr)
@@ -60,28 +41,11 @@ void _sc_dictionary_fs_memory_node_clear(sc_dictionary_node * node)
   sc_list_destroy(node->data);
 }
 
-void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node)
-{
-  sc_list * link_hashes = node->data;
-  if (link_hashes == null_ptr)
-    return;
-
-  sc_list_destroy(link_hashes);
-}
-
-void _sc_dictionary_fs_memory_string_node_clear(sc_dictionary_node * node)
-{
-  void * content = node->data;
-  if (content == null_ptr)
-    return;
-
-  sc_mem_free(content);
-}
-
 sc_memory_params * _sc_dictionary_fs_memory_get_default_params(sc_char const * path, sc_bool clear)
 {
   sc_memory_params * params = sc_mem_new(sc_memory_params, 1);
   params->storage = path;
+  params->bundle = null_ptr;
   params->clear = clear;
   params->max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
   params->max_strings_channel_size = DEFAULT_MAX_STRINGS_CHANNEL_SIZE;
@@ -18,6 +18,10 @@
 #include "sc-store/sc-base/sc_monitor_table_private.h"
 #include "sc-store/sc-base/sc_message.h"
 
+#include "sc-store/sc-container/sc_number_hash_map.h"
+
+#include "sc_trigrams_index.h"
+
 #define SC_FS_EXT ".scdb"
 #define INVALID_STRING_OFFSET LONG_MAX
 
@@ -46,23 +50,24 @@ struct _sc_dictionary_fs_memory
   sc_char * terms_string_offsets_path;              // path to dictionary file with terms and its strings offsets
   sc_dictionary * terms_string_offsets_dictionary;  // dictionary instance with terms and its strings offsets
 
-  sc_char * string_offsets_link_hashes_path;  // path to dictionary file with strings offsets and its link hashes
-  sc_dictionary *
-      string_offsets_link_hashes_dictionary;  // dictionary instance with strings offsets and its link hashes
-  sc_dictionary *
-      link_hashes_string_offsets_dictionary;  // dictionary instance with link hashes and its strings offsets
+  sc_char * string_offsets_link_hashes_path;            // path to file with strings offsets and its link hashes
+  sc_monitor link_hashes_monitor;                       // monitor for maps of link hashes and strings offsets
+  sc_number_hash_map * link_hashes_string_offsets_map;  // map with link hashes and its strings offsets
+  // map with strings offsets and last link hashes linked with them
+  sc_number_hash_map * string_offsets_link_hashes_map;
+  // map with link hashes and next link hashes linked with the same strings, it links them in circular lists
+  sc_number_hash_map * link_hashes_next_link_hashes_map;
+
+  sc_char * trigrams_string_offsets_path;  // path to file with trigrams and its strings offsets
+  sc_trigrams_index * trigrams_index;      // index of searchable strings trigrams to find strings by substring
+
+  sc_int32 is_changed;  // non-zero, if dictionaries changed since the last save
 };
 
 sc_bool _sc_uchar_dictionary_initialize(sc_dictionary ** dictionary);
 
-sc_bool _sc_number_dictionary_initialize(sc_dictionary ** dictionary);
-
 void _sc_dictionary_fs_memory_node_clear(sc_dictionary_node * node);
 
-void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node);
-
-void _sc_dictionary_fs_memory_string_node_clear(sc_dictionary_node * node);
-
 sc_memory_params * _sc_dictionary_fs_memory_get_default_params(sc_char const * path, sc_bool clear);
 
 sc_char * _sc_dictionary_fs_memory_get_first_term(sc_char const * string, sc_char const * term_separators);
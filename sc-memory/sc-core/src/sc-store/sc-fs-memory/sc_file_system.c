@@ -9,7 +9,12 @@
 #include <glib.h>
 #include <glib/gstdio.h>
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "sc_io.h"
+#include "sc_dictionary_fs_memory_private.h"
 
 #include "sc-core/sc_stream.h"
 #include "sc-core/sc_stream_file.h"
@@ -87,6 +92,17 @@ sc_bool sc_fs_is_file(sc_char const * path)
   return g_file_test(path, G_FILE_TEST_IS_REGULAR);
 }
 
+sc_bool sc_fs_truncate_file(sc_char const * path, sc_uint64 size)
+{
+  return truncate(path, size) == 0;
+}
+
+sc_bool sc_fs_is_empty_file(sc_char const * path)
+{
+  struct stat file_stat;
+  return stat(path, &file_stat) == 0 && file_stat.st_size == 0;
+}
+
 sc_bool sc_fs_is_binary_file(sc_char const * file_path)
 {
   sc_char command_prefix[] = SC_FS_FILE_COMMAND;
@@ -184,6 +200,35 @@ sc_bool sc_fs_is_directory(sc_char const * path)
   return g_file_test(path, G_FILE_TEST_IS_DIR);
 }
 
+sc_fs_mapped_file * sc_fs_map_file(sc_char const * path)
+{
+  // file is opened only for reading, writable private mapping doesn't change it
+  sc_int32 const descriptor = g_open(path, O_RDONLY, 0);
+  if (descriptor == -1)
+  {
+    sc_fs_memory_error("Can't open file `%s` to map it", path);
+    return null_ptr;
+  }
+
+  // the mapping holds the file inode, so the file can be safely replaced by renaming while it is mapped
+  GError * error = null_ptr;
+  sc_fs_mapped_file * file = g_mapped_file_new_from_fd(descriptor, SC_TRUE, &error);
+  g_close(descriptor, null_ptr);
+  if (file == null_ptr)
+  {
+    sc_fs_memory_error("Can't map file `%s`: %s", path, error->message);
+    g_error_free(error);
+  }
+
+  return file;
+}
+
+void sc_fs_unmap_file(sc_fs_mapped_file * file)
+{
+  if (file != null_ptr)
+    g_mapped_file_unref(file);
+}
+
 void * sc_fs_new_tmp_write_channel(sc_char const * path, sc_char ** tmp_file_name, sc_char * prefix)
 {
   *tmp_file_name = g_strdup_printf("%s/%s_%lu", path, prefix, (sc_ulong)g_get_real_time());
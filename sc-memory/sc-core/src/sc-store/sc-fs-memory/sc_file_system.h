@@ -9,6 +9,8 @@
 
 #include "sc-core/sc_types.h"
 
+#include "sc_io.h"
+
 sc_bool sc_fs_create_file(sc_char const * path);
 
 sc_bool sc_fs_copy_file(sc_char const * path, sc_char const * target_path);
@@ -19,6 +21,10 @@ sc_bool sc_fs_rename_file(sc_char const * old_path, sc_char const * new_path);
 
 sc_bool sc_fs_is_file(sc_char const * path);
 
+sc_bool sc_fs_truncate_file(sc_char const * path, sc_uint64 size);
+
+sc_bool sc_fs_is_empty_file(sc_char const * path);
+
 sc_bool sc_fs_is_binary_file(sc_char const * file_path);
 
 void sc_fs_get_file_content(sc_char const * file_path, sc_char ** content, sc_uint32 * content_size);
@@ -35,6 +41,15 @@ sc_bool sc_fs_remove_directory(sc_char const * path);
 
 sc_bool sc_fs_is_directory(sc_char const * path);
 
+/*! Maps file into memory privately: pages are read on first access and changes aren't written back to file.
+ * @param path Path to mapped file
+ * @returns Pointer to the mapped file, or null_ptr if file can't be mapped. Its data and size are got by
+ * sc_fs_mapped_file_get_data and sc_fs_mapped_file_get_size, data of empty file is null_ptr.
+ */
+sc_fs_mapped_file * sc_fs_map_file(sc_char const * path);
+
+void sc_fs_unmap_file(sc_fs_mapped_file * file);
+
 void * sc_fs_new_tmp_write_channel(sc_char const * path, sc_char ** tmp_file_name, sc_char * prefix);
 
 sc_char * sc_fs_execute(sc_char const * command);
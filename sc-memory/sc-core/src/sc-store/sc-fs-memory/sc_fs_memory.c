@@ -6,6 +6,7 @@
 
 #include "sc_fs_memory.h"
 #include "sc_fs_memory_builder.h"
+#include "sc_fs_memory_bundle.h"
 
 #include "sc_file_system.h"
 #include "sc_dictionary_fs_memory_private.h"
@@ -31,18 +32,44 @@ sc_fs_memory_status sc_fs_memory_initialize_ext(sc_memory_params const * params)
 
   static sc_char const * segments_postfix = "segments" SC_FS_EXT;
   sc_fs_concat_path(manager->path, segments_postfix, &manager->segments_path);
+  static sc_char const * segments_changes_postfix = "segments_changes" SC_FS_EXT;
+  sc_fs_concat_path(manager->path, segments_changes_postfix, &manager->segments_changes_path);
 
-  if (manager->initialize(&manager->fs_memory, params) != SC_FS_MEMORY_OK)
-    return SC_FS_MEMORY_NO;
+  // clear repository if it needs, before bundle is extracted into it
+  if (sc_fs_is_directory(manager->path) == SC_FALSE)
+  {
+    if (sc_fs_create_directory(manager->path) == SC_FALSE)
+    {
+      sc_fs_memory_error("Path `%s` is not correct", manager->path);
+      return SC_FS_MEMORY_NO;
+    }
+  }
+  else if (params->clear == SC_TRUE)
+  {
+    sc_fs_memory_info("Clear sc-memory repo");
+    sc_fs_remove_directory_ext(manager->path, SC_FALSE);
+  }
 
-  // clear repository if it needs
-  if (params->clear == SC_TRUE)
+  // bundle replaces only empty repository, sc-elements of bundle can't be merged with saved ones, because they have
+  // the same sc-addrs and their system identifiers aren't unique in common
+  if (params->bundle != null_ptr)
   {
-    sc_fs_memory_info("Clear sc-memory segments");
-    if (sc_fs_remove_file(manager->segments_path) == SC_FALSE)
-      sc_fs_memory_info("Can't remove segments file: %s", manager->segments_path);
+    if (sc_fs_is_file(manager->segments_path))
+      sc_fs_memory_warning("Bundle %s isn't extracted, because repo %s isn't empty", params->bundle, manager->path);
+    else
+    {
+      sc_fs_memory_info("Extract bundle %s", params->bundle);
+      if (sc_fs_memory_bundle_extract(&manager->version, params->bundle, manager->path) != SC_FS_MEMORY_OK)
+        return SC_FS_MEMORY_READ_ERROR;
+    }
   }
 
+  // repository is already cleared, so strings dictionary opens it as it is together with extracted strings
+  sc_memory_params fs_memory_params = *params;
+  fs_memory_params.clear = SC_FALSE;
+  if (manager->initialize(&manager->fs_memory, &fs_memory_params) != SC_FS_MEMORY_OK)
+    return SC_FS_MEMORY_NO;
+
   return SC_FS_MEMORY_OK;
 }
 
@@ -57,6 +84,9 @@ sc_fs_memory_status sc_fs_memory_initialize(sc_char const * path, sc_bool clear)
 sc_fs_memory_status sc_fs_memory_shutdown()
 {
   sc_fs_memory_status const result = manager->shutdown(manager->fs_memory);
+  sc_fs_unmap_file(manager->segments_mapping);
+  sc_fs_unmap_file(manager->segments_changes_mapping);
+  sc_mem_free(manager->segments_changes_path);
   sc_mem_free(manager->segments_path);
   sc_mem_free(manager);
   return result;
@@ -79,6 +109,14 @@ sc_fs_memory_status sc_fs_memory_link_string_ext(
   return manager->link_string(manager->fs_memory, link_hash, string, string_size, is_searchable_string);
 }
 
+sc_fs_memory_status sc_fs_memory_link_stream(
+    sc_addr_hash const link_hash,
+    sc_stream const * stream,
+    sc_bool is_searchable_string)
+{
+  return manager->link_stream(manager->fs_memory, link_hash, stream, is_searchable_string);
+}
+
 sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
     sc_addr_hash const link_hash,
     sc_char ** string,
@@ -90,6 +128,18 @@ sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
   return result;
 }
 
+sc_fs_memory_status sc_fs_memory_get_stream_by_link_hash(
+    sc_addr_hash const link_hash,
+    sc_char ** string,
+    sc_uint32 * string_size,
+    sc_stream ** stream)
+{
+  sc_uint64 size;
+  sc_fs_memory_status result = manager->get_stream_by_link_hash(manager->fs_memory, link_hash, string, &size, stream);
+  *string_size = size;
+  return result;
+}
+
 sc_fs_memory_status sc_fs_memory_get_link_hashes_by_string(
     sc_char const * string,
     sc_uint32 const string_size,
@@ -123,7 +173,286 @@ sc_fs_memory_status sc_fs_memory_unlink_string(sc_addr_hash link_hash)
   return manager->unlink_string(manager->fs_memory, link_hash);
 }
 
+sc_fs_memory_status sc_fs_memory_get_string_offset_by_link_hash(sc_addr_hash link_hash, sc_uint64 * string_offset)
+{
+  return manager->get_string_offset_by_link_hash(manager->fs_memory, link_hash, string_offset);
+}
+
+sc_fs_memory_status sc_fs_memory_link_string_offset(sc_addr_hash link_hash, sc_uint64 string_offset)
+{
+  return manager->link_string_offset(manager->fs_memory, link_hash, string_offset);
+}
+
 // read, write and save methods
+
+// Segments files saved in one of the layouts described below have `header.magic` equal to SC_FS_MEMORY_SEGMENTS_MAGIC and
+// `header.layout` equal to the layout identifier, while their `header.size` is zero. Segments files of previous versions
+// have zero `header.magic`, so they are read as files of the streamed layout.
+#define SC_FS_MEMORY_SEGMENTS_MAGIC 0x4753435fu  // "_SCG"
+#define SC_FS_MEMORY_SEGMENTS_STREAMED_LAYOUT 0
+#define _sc_fs_memory_segments_layout(header) \
+  ((header).magic == SC_FS_MEMORY_SEGMENTS_MAGIC ? (header).layout : SC_FS_MEMORY_SEGMENTS_STREAMED_LAYOUT)
+
+// Segments file layout, in which `header.layout` equals SC_FS_MEMORY_SEGMENTS_MAPPED_LAYOUT:
+// [header][storage attributes][padding][sc-segment 1 elements][padding]...[sc-segment N elements][padding]
+// [sc-segments offsets: last engaged and last released offsets of each sc-segment].
+// Images of sc-segments elements are aligned, so the file can be mapped into memory and sc-elements can be accessed
+// directly without reading the whole file at startup.
+#define SC_FS_MEMORY_SEGMENTS_MAPPED_LAYOUT 1
+#define SC_FS_MEMORY_SEGMENTS_ALIGNMENT 0x10000
+#define _sc_fs_memory_segments_align(size) \
+  (((size) + SC_FS_MEMORY_SEGMENTS_ALIGNMENT - 1) & ~((sc_uint64)SC_FS_MEMORY_SEGMENTS_ALIGNMENT - 1))
+#define SC_FS_MEMORY_SEGMENTS_DATA_OFFSET \
+  _sc_fs_memory_segments_align(sizeof(sc_uint32) + sizeof(sc_fs_memory_header) + 3 * sizeof(sc_addr_seg))
+#define SC_FS_MEMORY_FULL_SEGMENT_IMAGE_SIZE \
+  _sc_fs_memory_segments_align(sizeof(sc_full_element) * SC_SEGMENT_ELEMENTS_COUNT)
+
+// Segments changes file layout, in which `header.layout` equals SC_FS_MEMORY_SEGMENTS_CHANGES_LAYOUT:
+// [header][storage attributes][timestamp of the segments file][changed sc-segments count][padding]
+// [changed sc-segment 1 elements][padding]...[changed sc-segment M elements][padding]
+// [changed sc-segments numbers][sc-segments offsets of changed sc-segments].
+// The file contains sc-segments changed since the segments file was saved and is applied over it on load, if their
+// timestamps match.
+#define SC_FS_MEMORY_SEGMENTS_CHANGES_LAYOUT 2
+
+// Segments files of compact sc-elements layout, in which `header.layout` equals SC_FS_MEMORY_SEGMENTS_COMPACT_LAYOUT or
+// SC_FS_MEMORY_SEGMENTS_COMPACT_CHANGES_LAYOUT, differ from the ones described above in images of sc-segments, in which
+// sc-connectors records follow sc-elements headers: [sc-elements][padding][sc-connectors records][padding], and in
+// sc-segments offsets, in which indices of the last engaged and the last released sc-connectors records follow offsets
+// of sc-elements. Segments files of default layout are converted on load by sc-machine built with compact layout.
+#define SC_FS_MEMORY_SEGMENTS_COMPACT_LAYOUT 3
+#define SC_FS_MEMORY_SEGMENTS_COMPACT_CHANGES_LAYOUT 4
+#define SC_FS_MEMORY_COMPACT_SEGMENT_IMAGE_SIZE \
+  (_sc_fs_memory_segments_align(SC_SEG_ELEMENTS_SIZE_BYTE) + _sc_fs_memory_segments_align(SC_SEG_ARCS_SIZE_BYTE))
+
+#define SC_FS_MEMORY_SEGMENT_IMAGE_SIZE(is_compact_layout) \
+  ((is_compact_layout) ? SC_FS_MEMORY_COMPACT_SEGMENT_IMAGE_SIZE : SC_FS_MEMORY_FULL_SEGMENT_IMAGE_SIZE)
+#define SC_FS_MEMORY_SEGMENT_OFFSETS_COUNT(is_compact_layout) ((is_compact_layout) ? 4 : 2)
+#define SC_FS_MEMORY_SEGMENTS_OFFSETS_SIZE(segments_count, is_compact_layout) \
+  ((segments_count) * SC_FS_MEMORY_SEGMENT_OFFSETS_COUNT(is_compact_layout) * sizeof(sc_addr_offset))
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+#  define SC_FS_MEMORY_IS_COMPACT_LAYOUT SC_TRUE
+#  define SC_FS_MEMORY_SEGMENTS_SAVED_LAYOUT SC_FS_MEMORY_SEGMENTS_COMPACT_LAYOUT
+#  define SC_FS_MEMORY_SEGMENTS_SAVED_CHANGES_LAYOUT SC_FS_MEMORY_SEGMENTS_COMPACT_CHANGES_LAYOUT
+#else
+#  define SC_FS_MEMORY_IS_COMPACT_LAYOUT SC_FALSE
+#  define SC_FS_MEMORY_SEGMENTS_SAVED_LAYOUT SC_FS_MEMORY_SEGMENTS_MAPPED_LAYOUT
+#  define SC_FS_MEMORY_SEGMENTS_SAVED_CHANGES_LAYOUT SC_FS_MEMORY_SEGMENTS_CHANGES_LAYOUT
+#endif
+#define SC_FS_MEMORY_SEGMENTS_CHANGES_ATTRIBUTES_SIZE \
+  (sizeof(sc_uint32) + sizeof(sc_fs_memory_header) + 4 * sizeof(sc_addr_seg) + sizeof(sc_uint64))
+
+// Sc-element of default layout is copied into sc-element header and, if it is sc-connector, into sc-connector record
+// of segment in compact sc-elements layout.
+void _sc_fs_memory_set_segment_element(sc_segment * segment, sc_addr_offset offset, sc_full_element const * element)
+{
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  sc_element * element_header = &segment->elements[offset];
+  element_header->flags = element->flags;
+  element_header->first_out_arc = element->first_out_arc;
+  element_header->first_in_arc = element->first_in_arc;
+#  ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
+  element_header->first_in_arc_from_structure = element->first_in_arc_from_structure;
+#  endif
+  element_header->incoming_arcs_count = element->incoming_arcs_count;
+  element_header->outgoing_arcs_count = element->outgoing_arcs_count;
+
+  if ((element->flags.states & SC_STATE_ELEMENT_EXIST) == SC_STATE_ELEMENT_EXIST
+      && sc_type_has_subtype_in_mask(element->flags.type, sc_type_connector_mask))
+  {
+    element_header->arc_index = sc_segment_allocate_arc(segment);
+    segment->arcs[element_header->arc_index] = element->arc;
+  }
+#else
+  segment->elements[offset] = *element;
+#endif
+}
+
+sc_segment * _sc_fs_memory_new_segment_from_image(
+    sc_addr_seg num,
+    sc_char * image,
+    sc_addr_offset const * segment_offsets,
+    sc_bool is_compact_layout)
+{
+  sc_segment * segment;
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  if (is_compact_layout)
+  {
+    segment = sc_segment_new_mapped(num, (sc_element *)image);
+    segment->arcs = (sc_arc_info *)(image + _sc_fs_memory_segments_align(SC_SEG_ELEMENTS_SIZE_BYTE));
+    segment->last_engaged_arc_index = segment_offsets[2];
+    segment->last_released_arc_index = segment_offsets[3];
+  }
+  else
+  {
+    // converted sc-segment differs from its image until the next save
+    segment = sc_segment_new(num);
+    sc_full_element const * elements = (sc_full_element const *)image;
+    for (sc_uint32 i = 0; i < SC_SEGMENT_ELEMENTS_COUNT; ++i)
+      _sc_fs_memory_set_segment_element(segment, i, &elements[i]);
+  }
+#else
+  segment = sc_segment_new_mapped(num, (sc_element *)image);
+#endif
+  segment->last_engaged_offset = segment_offsets[0];
+  segment->last_released_offset = segment_offsets[1];
+  return segment;
+}
+
+void _sc_fs_memory_unmap_sc_memory_segments_changes()
+{
+  sc_fs_unmap_file(manager->segments_changes_mapping);
+  manager->segments_changes_mapping = null_ptr;
+}
+
+void _sc_fs_memory_unmap_sc_memory_segments()
+{
+  sc_fs_unmap_file(manager->segments_mapping);
+  manager->segments_mapping = null_ptr;
+  _sc_fs_memory_unmap_sc_memory_segments_changes();
+}
+
+sc_fs_memory_status _sc_fs_memory_map_sc_memory_segments(sc_storage * storage, sc_bool is_compact_layout)
+{
+  _sc_fs_memory_unmap_sc_memory_segments();
+
+  sc_uint64 const segment_image_size = SC_FS_MEMORY_SEGMENT_IMAGE_SIZE(is_compact_layout);
+  sc_uint64 const segments_offsets_position =
+      SC_FS_MEMORY_SEGMENTS_DATA_OFFSET + storage->segments_count * segment_image_size;
+
+  manager->segments_mapping = sc_fs_map_file(manager->segments_path);
+  if (manager->segments_mapping == null_ptr
+      || sc_fs_mapped_file_get_size(manager->segments_mapping)
+             < segments_offsets_position
+                   + SC_FS_MEMORY_SEGMENTS_OFFSETS_SIZE(storage->segments_count, is_compact_layout))
+  {
+    sc_fs_memory_error("Error while sc-memory segments mapping from %s", manager->segments_path);
+    _sc_fs_memory_unmap_sc_memory_segments();
+    storage->segments_count = 0;
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  sc_char * segments_data = sc_fs_mapped_file_get_data(manager->segments_mapping);
+  sc_addr_offset const * segments_offsets = (sc_addr_offset *)(segments_data + segments_offsets_position);
+  sc_uint32 const segment_offsets_count = SC_FS_MEMORY_SEGMENT_OFFSETS_COUNT(is_compact_layout);
+  for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+  {
+    storage->segments[i] = _sc_fs_memory_new_segment_from_image(
+        i + 1,
+        segments_data + SC_FS_MEMORY_SEGMENTS_DATA_OFFSET + i * segment_image_size,
+        &segments_offsets[segment_offsets_count * i],
+        is_compact_layout);
+  }
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_fs_memory_status _sc_fs_memory_map_sc_memory_segments_changes(sc_storage * storage)
+{
+  if (sc_fs_is_file(manager->segments_changes_path) == SC_FALSE)
+    return SC_FS_MEMORY_OK;
+
+  manager->segments_changes_mapping = sc_fs_map_file(manager->segments_changes_path);
+  if (manager->segments_changes_mapping == null_ptr)
+    goto error;
+
+  sc_char const * changes_data = sc_fs_mapped_file_get_data(manager->segments_changes_mapping);
+  sc_uint64 const changes_size = sc_fs_mapped_file_get_size(manager->segments_changes_mapping);
+  if (changes_size < SC_FS_MEMORY_SEGMENTS_DATA_OFFSET)
+    goto error;
+
+  sc_uint32 header_size;
+  sc_fs_memory_header header;
+  sc_mem_cpy(&header_size, changes_data, sizeof(header_size));
+  changes_data += sizeof(header_size);
+  sc_mem_cpy(&header, changes_data, sizeof(header));
+  changes_data += sizeof(header);
+  if (header_size != sizeof(sc_fs_memory_header))
+    goto error;
+  sc_uint32 const layout = _sc_fs_memory_segments_layout(header);
+  if (layout != SC_FS_MEMORY_SEGMENTS_CHANGES_LAYOUT && layout != SC_FS_MEMORY_SEGMENTS_COMPACT_CHANGES_LAYOUT)
+    goto error;
+
+  sc_bool const is_compact_layout = layout == SC_FS_MEMORY_SEGMENTS_COMPACT_CHANGES_LAYOUT;
+  if (is_compact_layout && !SC_FS_MEMORY_IS_COMPACT_LAYOUT)
+    goto error;
+  sc_uint64 const segment_image_size = SC_FS_MEMORY_SEGMENT_IMAGE_SIZE(is_compact_layout);
+
+  sc_addr_seg storage_attributes[3];
+  sc_uint64 segments_timestamp;
+  sc_addr_seg changed_segments_count;
+  sc_mem_cpy(storage_attributes, changes_data, sizeof(storage_attributes));
+  changes_data += sizeof(storage_attributes);
+  sc_mem_cpy(&segments_timestamp, changes_data, sizeof(segments_timestamp));
+  changes_data += sizeof(segments_timestamp);
+  sc_mem_cpy(&changed_segments_count, changes_data, sizeof(changed_segments_count));
+
+  // changes file is left by interrupted full save of segments and must not be applied to other segments file
+  if (segments_timestamp != manager->header.timestamp)
+  {
+    sc_fs_memory_warning("Skip segments changes file %s saved for other segments file", manager->segments_changes_path);
+    _sc_fs_memory_unmap_sc_memory_segments_changes();
+    return SC_FS_MEMORY_OK;
+  }
+
+  sc_addr_seg const segments_count = storage_attributes[0];
+  sc_uint64 const segments_nums_position =
+      SC_FS_MEMORY_SEGMENTS_DATA_OFFSET + changed_segments_count * segment_image_size;
+  sc_uint64 const segments_offsets_size = SC_FS_MEMORY_SEGMENTS_OFFSETS_SIZE(changed_segments_count, is_compact_layout);
+  if (segments_count < storage->segments_count || segments_count > storage->max_segments_count
+      || changes_size < segments_nums_position + changed_segments_count * sizeof(sc_addr_seg) + segments_offsets_size)
+    goto error;
+
+  sc_char * segments_data = sc_fs_mapped_file_get_data(manager->segments_changes_mapping);
+  sc_addr_seg const * changed_segments_nums = (sc_addr_seg *)(segments_data + segments_nums_position);
+  sc_addr_offset const * segments_offsets =
+      (sc_addr_offset *)(segments_data + segments_nums_position + changed_segments_count * sizeof(sc_addr_seg));
+
+  // every sc-segment absent in the segments file has been changed after its save
+  sc_addr_seg covered_segments_count = storage->segments_count;
+  for (sc_addr_seg i = 0; i < changed_segments_count; ++i)
+  {
+    sc_addr_seg const num = changed_segments_nums[i];
+    if (num == 0 || num > segments_count)
+      goto error;
+    if (num > storage->segments_count)
+      ++covered_segments_count;
+  }
+  if (covered_segments_count != segments_count)
+    goto error;
+
+  for (sc_addr_seg i = 0; i < changed_segments_count; ++i)
+  {
+    sc_addr_seg const num = changed_segments_nums[i];
+    if (num <= storage->segments_count)
+      sc_segment_free(storage->segments[num - 1]);
+
+    sc_segment * seg = _sc_fs_memory_new_segment_from_image(
+        num,
+        segments_data + SC_FS_MEMORY_SEGMENTS_DATA_OFFSET + i * segment_image_size,
+        &segments_offsets[SC_FS_MEMORY_SEGMENT_OFFSETS_COUNT(is_compact_layout) * i],
+        is_compact_layout);
+    // sc-segment differs from its image in the segments file until the next full save
+    sc_segment_mark_changed(seg);
+    storage->segments[num - 1] = seg;
+  }
+
+  storage->segments_count = segments_count;
+  storage->last_not_engaged_segment_num = storage_attributes[1];
+  storage->last_released_segment_num = storage_attributes[2];
+
+  sc_message("\tApplied changes of segments count: %d", changed_segments_count);
+  return SC_FS_MEMORY_OK;
+
+error:
+{
+  sc_fs_memory_error("Error while sc-memory segments changes mapping from %s", manager->segments_changes_path);
+  _sc_fs_memory_unmap_sc_memory_segments_changes();
+  return SC_FS_MEMORY_READ_ERROR;
+}
+}
+
 sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
 {
   if (sc_fs_is_file(manager->segments_path) == SC_FALSE)
@@ -139,7 +468,25 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
 
   if (sc_fs_memory_header_read(segments_channel, &manager->header) != SC_FS_MEMORY_OK)
     goto error;
-  storage->segments_count = manager->header.size;
+  sc_uint32 const layout = _sc_fs_memory_segments_layout(manager->header);
+  if (layout != SC_FS_MEMORY_SEGMENTS_STREAMED_LAYOUT && layout != SC_FS_MEMORY_SEGMENTS_MAPPED_LAYOUT
+      && layout != SC_FS_MEMORY_SEGMENTS_COMPACT_LAYOUT)
+  {
+    sc_fs_memory_error("Sc-memory segments %s are saved in unknown layout %u", manager->segments_path, layout);
+    goto error;
+  }
+  sc_bool const is_compact_layout = layout == SC_FS_MEMORY_SEGMENTS_COMPACT_LAYOUT;
+  sc_bool const is_mapped_layout = layout == SC_FS_MEMORY_SEGMENTS_MAPPED_LAYOUT || is_compact_layout;
+  storage->segments_count = is_mapped_layout ? 0 : manager->header.size;
+
+  if (is_compact_layout && !SC_FS_MEMORY_IS_COMPACT_LAYOUT)
+  {
+    sc_fs_memory_error(
+        "Sc-memory segments %s are saved in compact sc-elements layout, build sc-machine with "
+        "SC_COMPACT_ELEMENTS_LAYOUT flag to load them",
+        manager->segments_path);
+    goto error;
+  }
 
   // backward compatibility with version 0.7.0
   sc_uint64 read_bytes = 0;
@@ -150,7 +497,7 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
     sc_fs_memory_warning("Load deprecated sc-memory segments from %s", manager->segments_path);
 
   static sc_uint32 const OLD_SC_ELEMENT_SIZE = 36;
-  sc_uint32 element_size = is_no_deprecated_segments ? sizeof(sc_element) : OLD_SC_ELEMENT_SIZE;
+  sc_uint32 element_size = is_no_deprecated_segments ? sizeof(sc_full_element) : OLD_SC_ELEMENT_SIZE;
   if (is_no_deprecated_segments)
   {
     if (sc_io_channel_read_chars(
@@ -202,63 +549,79 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
     goto error;
   }
 
-  for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+  if (is_mapped_layout)
   {
-    sc_addr_seg const num = i;
-    sc_segment * seg = sc_segment_new(i + 1);
-    storage->segments[i] = seg;
-
-    for (sc_addr_seg j = 0; j < SC_SEGMENT_ELEMENTS_COUNT; ++j)
+    if (_sc_fs_memory_map_sc_memory_segments(storage, is_compact_layout) != SC_FS_MEMORY_OK
+        || _sc_fs_memory_map_sc_memory_segments_changes(storage) != SC_FS_MEMORY_OK)
+      goto error;
+  }
+  else
+  {
+    for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
     {
-      if (sc_io_channel_read_chars(segments_channel, (sc_char *)&seg->elements[j], element_size, &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || read_bytes != element_size)
-      {
-        storage->segments_count = num;
-        sc_fs_memory_error("Error while sc-element %d in sc-segment %d reading", j, i);
-        goto error;
-      }
+      sc_addr_seg const num = i;
+      sc_segment * seg = sc_segment_new(i + 1);
+      storage->segments[i] = seg;
 
-      // needed for sc-template search
-      if (!is_no_deprecated_segments)
+      for (sc_addr_seg j = 0; j < SC_SEGMENT_ELEMENTS_COUNT; ++j)
       {
-        seg->elements[j].incoming_arcs_count = 1;
-        seg->elements[j].outgoing_arcs_count = 1;
+        sc_full_element element = {0};
+        if (sc_io_channel_read_chars(segments_channel, (sc_char *)&element, element_size, &read_bytes, null_ptr)
+                != SC_FS_IO_STATUS_NORMAL
+            || read_bytes != element_size)
+        {
+          storage->segments_count = num;
+          sc_fs_memory_error("Error while sc-element %d in sc-segment %d reading", j, i);
+          goto error;
+        }
+
+        // needed for sc-template search
+        if (!is_no_deprecated_segments)
+        {
+          element.incoming_arcs_count = 1;
+          element.outgoing_arcs_count = 1;
+        }
+
+        _sc_fs_memory_set_segment_element(seg, j, &element);
       }
-    }
 
-    if (is_no_deprecated_segments)
-    {
-      if (sc_io_channel_read_chars(
-              segments_channel, (sc_char *)&seg->last_engaged_offset, sizeof(sc_addr_offset), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || read_bytes != sizeof(sc_addr_offset))
+      if (is_no_deprecated_segments)
       {
-        sc_fs_memory_error("Error while sc-segment %d reading", i);
-        goto error;
+        if (sc_io_channel_read_chars(
+                segments_channel, (sc_char *)&seg->last_engaged_offset, sizeof(sc_addr_offset), &read_bytes, null_ptr)
+                != SC_FS_IO_STATUS_NORMAL
+            || read_bytes != sizeof(sc_addr_offset))
+        {
+          sc_fs_memory_error("Error while sc-segment %d reading", i);
+          goto error;
+        }
+
+        if (sc_io_channel_read_chars(
+                segments_channel, (sc_char *)&seg->last_released_offset, sizeof(sc_addr_offset), &read_bytes, null_ptr)
+                != SC_FS_IO_STATUS_NORMAL
+            || read_bytes != sizeof(sc_addr_offset))
+        {
+          sc_fs_memory_error("Error while sc-segment %d reading", i);
+          goto error;
+        }
       }
 
-      if (sc_io_channel_read_chars(
-              segments_channel, (sc_char *)&seg->last_released_offset, sizeof(sc_addr_offset), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || read_bytes != sizeof(sc_addr_offset))
-      {
-        sc_fs_memory_error("Error while sc-segment %d reading", i);
-        goto error;
-      }
+      i = num;
     }
-
-    i = num;
   }
 
   sc_io_channel_shutdown(segments_channel, SC_FALSE, null_ptr);
 
   sc_message("\tLoaded segments count: %d", storage->segments_count);
-  sc_message("\tSc-segments size: %ld", storage->segments_count * sizeof(sc_segment));
+  sc_message("\tSc-segments size: %ld", storage->segments_count * SC_SEG_ELEMENTS_SIZE_BYTE);
   sc_message("\tLast not engaged segment num: %d", storage->last_not_engaged_segment_num);
   sc_message("\tLast released segment num: %d", storage->last_released_segment_num);
 
-  if (is_no_deprecated_segments)
+  if (is_mapped_layout && is_compact_layout != SC_FS_MEMORY_IS_COMPACT_LAYOUT)
+    sc_fs_memory_info("Sc-memory segments converted into compact sc-elements layout");
+  else if (is_mapped_layout)
+    sc_fs_memory_info("Sc-memory segments mapped");
+  else if (is_no_deprecated_segments)
     sc_fs_memory_info("Sc-memory segments loaded");
   else
     sc_fs_memory_warning("Deprecated sc-memory segments loaded");
@@ -282,58 +645,143 @@ sc_fs_memory_status sc_fs_memory_load(sc_storage * storage)
   return SC_FS_MEMORY_OK;
 }
 
+sc_bool _sc_fs_memory_write_sc_memory_segments_chars(
+    sc_io_channel * segments_channel,
+    void const * data,
+    sc_uint64 size)
+{
+  sc_uint64 written_bytes = 0;
+  return size == 0
+         || (sc_io_channel_write_chars(segments_channel, (sc_char *)data, size, &written_bytes, null_ptr)
+                 == SC_FS_IO_STATUS_NORMAL
+             && written_bytes == size);
+}
+
+sc_bool _sc_fs_memory_write_sc_memory_segments_padding(sc_io_channel * segments_channel, sc_uint64 size)
+{
+  static sc_char const padding[SC_FS_MEMORY_SEGMENTS_ALIGNMENT];
+  return _sc_fs_memory_write_sc_memory_segments_chars(segments_channel, padding, size);
+}
+
+// Skipped chars aren't written and remain a hole of the file, which is read as zeros.
+sc_bool _sc_fs_memory_skip_sc_memory_segments_chars(sc_io_channel * segments_channel, sc_uint64 size)
+{
+  return size == 0 || sc_io_channel_seek(segments_channel, size, SC_FS_IO_SEEK_CUR, null_ptr) == SC_FS_IO_STATUS_NORMAL;
+}
+
+sc_bool _sc_fs_memory_write_sc_memory_storage_attributes(
+    sc_io_channel * segments_channel,
+    sc_addr_seg const * storage_attributes)
+{
+  if (_sc_fs_memory_write_sc_memory_segments_chars(segments_channel, &storage_attributes[0], sizeof(sc_addr_seg))
+      == SC_FALSE)
+  {
+    sc_fs_memory_error("Error while attribute `storage->segments_count` writing");
+    return SC_FALSE;
+  }
+
+  if (_sc_fs_memory_write_sc_memory_segments_chars(segments_channel, &storage_attributes[1], sizeof(sc_addr_seg))
+      == SC_FALSE)
+  {
+    sc_fs_memory_error("Error while attribute `storage->last_not_engaged_segment_num` writing");
+    return SC_FALSE;
+  }
+
+  if (_sc_fs_memory_write_sc_memory_segments_chars(segments_channel, &storage_attributes[2], sizeof(sc_addr_seg))
+      == SC_FALSE)
+  {
+    sc_fs_memory_error("Error while attribute `storage->last_released_segment_num` writing");
+    return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
+void _sc_fs_memory_get_sc_memory_storage_attributes(sc_storage * storage, sc_addr_seg * storage_attributes)
+{
+  sc_monitor_acquire_read(&storage->segments_monitor);
+  storage_attributes[0] = storage->segments_count;
+  storage_attributes[1] = storage->last_not_engaged_segment_num;
+  storage_attributes[2] = storage->last_released_segment_num;
+  sc_monitor_release_read(&storage->segments_monitor);
+}
+
+// Sc-elements of sc-segment are copied under its monitor and the copy is written after the monitor release, so
+// sc-elements allocation in the sc-segment waits for the copying only, but not for the writing.
+sc_bool _sc_fs_memory_write_sc_memory_segment(
+    sc_io_channel * segments_channel,
+    sc_segment * segment,
+    sc_char * segment_image_copy,
+    sc_addr_offset * segment_offsets)
+{
+  sc_monitor_acquire_read(&segment->monitor);
+  sc_mem_cpy(segment_image_copy, segment->elements, SC_SEG_ELEMENTS_SIZE_BYTE);
+  segment_offsets[0] = segment->last_engaged_offset;
+  segment_offsets[1] = segment->last_released_offset;
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  // only engaged sc-connectors records are saved, the rest of sc-segment image is skipped
+  sc_uint64 const arcs_size = (segment->last_engaged_arc_index + 1) * sizeof(sc_arc_info);
+  sc_uint64 const image_size = _sc_fs_memory_segments_align(SC_SEG_ELEMENTS_SIZE_BYTE) + arcs_size;
+  sc_mem_cpy(
+      segment_image_copy + _sc_fs_memory_segments_align(SC_SEG_ELEMENTS_SIZE_BYTE), segment->arcs, arcs_size);
+  segment_offsets[2] = segment->last_engaged_arc_index;
+  segment_offsets[3] = segment->last_released_arc_index;
+#endif
+  sc_monitor_release_read(&segment->monitor);
+
+  // offsets reserved by threads caches are saved as free, sc-elements aren't generated in them yet
+  sc_segment_restore_free_offsets((sc_element *)segment_image_copy, &segment_offsets[0], &segment_offsets[1]);
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  return _sc_fs_memory_write_sc_memory_segments_chars(segments_channel, segment_image_copy, image_size)
+         && _sc_fs_memory_skip_sc_memory_segments_chars(
+             segments_channel, SC_FS_MEMORY_COMPACT_SEGMENT_IMAGE_SIZE - image_size);
+#else
+  return _sc_fs_memory_write_sc_memory_segments_chars(
+      segments_channel, segment_image_copy, SC_FS_MEMORY_FULL_SEGMENT_IMAGE_SIZE);
+#endif
+}
+
 sc_fs_memory_status _sc_fs_memory_save_sc_memory_segments(sc_storage * storage)
 {
   sc_fs_memory_info("Save sc-memory segments");
 
   // create temporary file
   sc_char * tmp_filename;
+  sc_addr_offset * segments_offsets = null_ptr;
+  sc_char * segment_image_copy = null_ptr;
   sc_io_channel * segments_channel = sc_fs_new_tmp_write_channel(manager->fs_memory->path, &tmp_filename, "segments");
   sc_io_channel_set_encoding(segments_channel, null_ptr, null_ptr);
 
+  sc_addr_seg storage_attributes[3];
+  _sc_fs_memory_get_sc_memory_storage_attributes(storage, storage_attributes);
+  sc_addr_seg const segments_count = storage_attributes[0];
+
   manager->header.size = 0;
+  manager->header.magic = SC_FS_MEMORY_SEGMENTS_MAGIC;
+  manager->header.layout = SC_FS_MEMORY_SEGMENTS_SAVED_LAYOUT;
   manager->header.version = sc_version_to_int(&manager->version);
   manager->header.timestamp = g_get_real_time();
   if (sc_fs_memory_header_write(segments_channel, manager->header) != SC_FS_MEMORY_OK)
     goto error;
 
-  sc_uint64 written_bytes;
-  if (sc_io_channel_write_chars(
-          segments_channel, (sc_char *)&storage->segments_count, sizeof(sc_addr_seg), &written_bytes, null_ptr)
-          != SC_FS_IO_STATUS_NORMAL
-      || written_bytes != sizeof(sc_addr_seg))
-  {
-    sc_fs_memory_error("Error while attribute `storage->segments_count` writing");
-    goto error;
-  }
-
-  if (sc_io_channel_write_chars(
-          segments_channel,
-          (sc_char *)&storage->last_not_engaged_segment_num,
-          sizeof(sc_addr_seg),
-          &written_bytes,
-          null_ptr)
-          != SC_FS_IO_STATUS_NORMAL
-      || written_bytes != sizeof(sc_addr_seg))
-  {
-    sc_fs_memory_error("Error while attribute `storage->last_not_engaged_segment_num` writing");
+  if (_sc_fs_memory_write_sc_memory_storage_attributes(segments_channel, storage_attributes) == SC_FALSE)
     goto error;
-  }
 
-  if (sc_io_channel_write_chars(
-          segments_channel,
-          (sc_char *)&storage->last_released_segment_num,
-          sizeof(sc_addr_seg),
-          &written_bytes,
-          null_ptr)
-          != SC_FS_IO_STATUS_NORMAL
-      || written_bytes != sizeof(sc_addr_seg))
+  sc_uint64 const attributes_size = sizeof(sc_uint32) + sizeof(sc_fs_memory_header) + 3 * sizeof(sc_addr_seg);
+  if (_sc_fs_memory_write_sc_memory_segments_padding(
+          segments_channel, SC_FS_MEMORY_SEGMENTS_DATA_OFFSET - attributes_size)
+      == SC_FALSE)
   {
-    sc_fs_memory_error("Error while attribute `storage->last_released_segment_num` writing");
+    sc_fs_memory_error("Error while sc-memory segments padding writing");
     goto error;
   }
 
-  for (sc_addr_seg idx = 0; idx < storage->segments_count; ++idx)
+  sc_uint32 const segment_offsets_count = SC_FS_MEMORY_SEGMENT_OFFSETS_COUNT(SC_FS_MEMORY_IS_COMPACT_LAYOUT);
+  segments_offsets = sc_mem_new(sc_addr_offset, segment_offsets_count * segments_count);
+  // paddings of the image copy remain zeroed
+  segment_image_copy = sc_mem_new(sc_char, SC_FS_MEMORY_SEGMENT_IMAGE_SIZE(SC_FS_MEMORY_IS_COMPACT_LAYOUT));
+  for (sc_addr_seg idx = 0; idx < segments_count; ++idx)
   {
     sc_segment * segment = storage->segments[idx];
     if (segment == null_ptr)
@@ -342,69 +790,197 @@ sc_fs_memory_status _sc_fs_memory_save_sc_memory_segments(sc_storage * storage)
       goto error;
     }
 
-    sc_monitor_acquire_read(&segment->monitor);
-
-    if (sc_io_channel_write_chars(
-            segments_channel, (sc_char *)segment->elements, SC_SEG_ELEMENTS_SIZE_BYTE, &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || written_bytes != SC_SEG_ELEMENTS_SIZE_BYTE)
+    // changes made after the mark reset are copied or left for the next save
+    sc_segment_reset_changed(segment);
+    if (_sc_fs_memory_write_sc_memory_segment(
+            segments_channel, segment, segment_image_copy, &segments_offsets[segment_offsets_count * idx])
+        == SC_FALSE)
     {
       sc_fs_memory_error("Error while attribute `segment->elements` writing");
-      goto segment_save_error;
+      goto error;
     }
+  }
 
-    if (sc_io_channel_write_chars(
-            segments_channel,
-            (sc_char *)&segment->last_engaged_offset,
-            sizeof(sc_addr_offset),
-            &written_bytes,
-            null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || written_bytes != sizeof(sc_addr_offset))
+  if (_sc_fs_memory_write_sc_memory_segments_chars(
+          segments_channel, segments_offsets, segment_offsets_count * segments_count * sizeof(sc_addr_offset))
+      == SC_FALSE)
+  {
+    sc_fs_memory_error("Error while sc-segments offsets writing");
+    goto error;
+  }
+
+  // rename main file
+  if (sc_fs_is_file(tmp_filename))
+  {
+    if (sc_fs_rename_file(tmp_filename, manager->segments_path) == SC_FALSE)
     {
-      sc_fs_memory_error("Error while attribute `segment->last_engaged_offset` writing");
-      goto segment_save_error;
+      sc_fs_memory_error("Can't rename %s -> %s", tmp_filename, manager->segments_path);
+      goto error;
     }
+  }
 
-    if (sc_io_channel_write_chars(
-            segments_channel,
-            (sc_char *)&segment->last_released_offset,
-            sizeof(sc_addr_offset),
-            &written_bytes,
-            null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || written_bytes != sizeof(sc_addr_offset))
+  // changes of sc-segments are saved into the segments file, an old segments changes file can't be applied to it
+  if (sc_fs_is_file(manager->segments_changes_path) && sc_fs_remove_file(manager->segments_changes_path) == SC_FALSE)
+    sc_fs_memory_warning("Can't remove segments changes file: %s", manager->segments_changes_path);
+
+  sc_message("\tLoaded segments count: %d", segments_count);
+  sc_message("\tSc-segments size: %ld", segments_count * SC_SEG_ELEMENTS_SIZE_BYTE);
+  sc_message("\tLast not engaged segment num: %d", storage_attributes[1]);
+  sc_message("\tLast released segment num: %d", storage_attributes[2]);
+
+  sc_mem_free(segment_image_copy);
+  sc_mem_free(segments_offsets);
+  sc_mem_free(tmp_filename);
+  sc_io_channel_shutdown(segments_channel, SC_TRUE, null_ptr);
+  sc_fs_memory_info("Sc-memory segments saved");
+  return SC_FS_MEMORY_OK;
+
+error:
+{
+  // the segments file isn't replaced, so all sc-segments remain changed relative to it and the next save is full
+  manager->header.magic = 0;
+  for (sc_addr_seg idx = 0; idx < segments_count; ++idx)
+  {
+    if (storage->segments[idx] != null_ptr)
+      sc_segment_mark_changed(storage->segments[idx]);
+  }
+
+  sc_mem_free(segment_image_copy);
+  sc_mem_free(segments_offsets);
+  sc_mem_free(tmp_filename);
+  sc_io_channel_shutdown(segments_channel, SC_TRUE, null_ptr);
+  return SC_FS_MEMORY_WRITE_ERROR;
+}
+}
+
+sc_fs_memory_status _sc_fs_memory_save_sc_memory_segments_changes(sc_storage * storage)
+{
+  // changes can be saved only relative to the segments file saved in the current layout
+  if (_sc_fs_memory_segments_layout(manager->header) != SC_FS_MEMORY_SEGMENTS_SAVED_LAYOUT
+      || sc_fs_is_file(manager->segments_path) == SC_FALSE)
+    return _sc_fs_memory_save_sc_memory_segments(storage);
+
+  sc_addr_seg storage_attributes[3];
+  _sc_fs_memory_get_sc_memory_storage_attributes(storage, storage_attributes);
+  sc_addr_seg const segments_count = storage_attributes[0];
+
+  sc_addr_seg * changed_segments_nums = sc_mem_new(sc_addr_seg, segments_count);
+  sc_addr_seg changed_segments_count = 0;
+  for (sc_addr_seg idx = 0; idx < segments_count; ++idx)
+  {
+    sc_segment * segment = storage->segments[idx];
+    if (segment != null_ptr && sc_segment_is_changed(segment))
+      changed_segments_nums[changed_segments_count++] = idx + 1;
+  }
+
+  if (changed_segments_count == 0)
+  {
+    sc_mem_free(changed_segments_nums);
+    sc_fs_memory_info("There are no changed sc-memory segments to save");
+    return SC_FS_MEMORY_OK;
+  }
+
+  // writing of changes costs as much as the full save does, so the full save is made to reset changes
+  if (changed_segments_count > segments_count / 2)
+  {
+    sc_mem_free(changed_segments_nums);
+    return _sc_fs_memory_save_sc_memory_segments(storage);
+  }
+
+  sc_fs_memory_info("Save changes of %d sc-memory segments", changed_segments_count);
+
+  // create temporary file
+  sc_char * tmp_filename;
+  sc_addr_offset * segments_offsets = null_ptr;
+  sc_char * segment_image_copy = null_ptr;
+  sc_io_channel * segments_channel =
+      sc_fs_new_tmp_write_channel(manager->fs_memory->path, &tmp_filename, "segments_changes");
+  sc_io_channel_set_encoding(segments_channel, null_ptr, null_ptr);
+
+  sc_fs_memory_header header = manager->header;
+  header.layout = SC_FS_MEMORY_SEGMENTS_SAVED_CHANGES_LAYOUT;
+  header.timestamp = g_get_real_time();
+  if (sc_fs_memory_header_write(segments_channel, header) != SC_FS_MEMORY_OK)
+    goto error;
+
+  if (_sc_fs_memory_write_sc_memory_storage_attributes(segments_channel, storage_attributes) == SC_FALSE)
+    goto error;
+
+  if (_sc_fs_memory_write_sc_memory_segments_chars(
+          segments_channel, &manager->header.timestamp, sizeof(manager->header.timestamp))
+          == SC_FALSE
+      || _sc_fs_memory_write_sc_memory_segments_chars(
+             segments_channel, &changed_segments_count, sizeof(changed_segments_count))
+             == SC_FALSE)
+  {
+    sc_fs_memory_error("Error while sc-memory segments changes attributes writing");
+    goto error;
+  }
+
+  if (_sc_fs_memory_write_sc_memory_segments_padding(
+          segments_channel, SC_FS_MEMORY_SEGMENTS_DATA_OFFSET - SC_FS_MEMORY_SEGMENTS_CHANGES_ATTRIBUTES_SIZE)
+      == SC_FALSE)
+  {
+    sc_fs_memory_error("Error while sc-memory segments padding writing");
+    goto error;
+  }
+
+  sc_uint32 const segment_offsets_count = SC_FS_MEMORY_SEGMENT_OFFSETS_COUNT(SC_FS_MEMORY_IS_COMPACT_LAYOUT);
+  segments_offsets = sc_mem_new(sc_addr_offset, segment_offsets_count * changed_segments_count);
+  // paddings of the image copy remain zeroed
+  segment_image_copy = sc_mem_new(sc_char, SC_FS_MEMORY_SEGMENT_IMAGE_SIZE(SC_FS_MEMORY_IS_COMPACT_LAYOUT));
+  for (sc_addr_seg i = 0; i < changed_segments_count; ++i)
+  {
+    // changed segments remain marked until the next full save, because changes are saved relative to it
+    sc_segment * segment = storage->segments[changed_segments_nums[i] - 1];
+    if (_sc_fs_memory_write_sc_memory_segment(
+            segments_channel, segment, segment_image_copy, &segments_offsets[segment_offsets_count * i])
+        == SC_FALSE)
     {
-      sc_fs_memory_error("Error while attribute `segment->last_released_offset` writing");
-      goto segment_save_error;
+      sc_fs_memory_error("Error while attribute `segment->elements` writing");
+      goto error;
     }
+  }
 
-  segment_save_error:
-    sc_monitor_release_read(&segment->monitor);
+  if (_sc_fs_memory_write_sc_memory_segments_chars(
+          segments_channel, changed_segments_nums, changed_segments_count * sizeof(sc_addr_seg))
+          == SC_FALSE
+      || _sc_fs_memory_write_sc_memory_segments_chars(
+             segments_channel,
+             segments_offsets,
+             segment_offsets_count * changed_segments_count * sizeof(sc_addr_offset))
+             == SC_FALSE)
+  {
+    sc_fs_memory_error("Error while sc-segments offsets writing");
+    goto error;
   }
 
-  // rename main file
+  // rename changes file
   if (sc_fs_is_file(tmp_filename))
   {
-    if (sc_fs_rename_file(tmp_filename, manager->segments_path) == SC_FALSE)
+    if (sc_fs_rename_file(tmp_filename, manager->segments_changes_path) == SC_FALSE)
     {
-      sc_fs_memory_error("Can't rename %s -> %s", tmp_filename, manager->segments_path);
+      sc_fs_memory_error("Can't rename %s -> %s", tmp_filename, manager->segments_changes_path);
       goto error;
     }
   }
 
-  sc_message("\tLoaded segments count: %d", storage->segments_count);
-  sc_message("\tSc-segments size: %ld", storage->segments_count * sizeof(sc_segment));
-  sc_message("\tLast not engaged segment num: %d", storage->last_not_engaged_segment_num);
-  sc_message("\tLast released segment num: %d", storage->last_released_segment_num);
+  sc_message("\tChanged segments count: %d", changed_segments_count);
+  sc_message("\tChanged sc-segments size: %ld", changed_segments_count * SC_SEG_ELEMENTS_SIZE_BYTE);
 
+  sc_mem_free(segment_image_copy);
+  sc_mem_free(segments_offsets);
+  sc_mem_free(changed_segments_nums);
   sc_mem_free(tmp_filename);
   sc_io_channel_shutdown(segments_channel, SC_TRUE, null_ptr);
-  sc_fs_memory_info("Sc-memory segments saved");
+  sc_fs_memory_info("Sc-memory segments changes saved");
   return SC_FS_MEMORY_OK;
 
 error:
 {
+  sc_mem_free(segment_image_copy);
+  sc_mem_free(segments_offsets);
+  sc_mem_free(changed_segments_nums);
   sc_mem_free(tmp_filename);
   sc_io_channel_shutdown(segments_channel, SC_TRUE, null_ptr);
   return SC_FS_MEMORY_WRITE_ERROR;
@@ -426,3 +1002,19 @@ sc_fs_memory_status sc_fs_memory_save(sc_storage * storage)
 
   return SC_FS_MEMORY_OK;
 }
+
+sc_fs_memory_status sc_fs_memory_save_changes(sc_storage * storage)
+{
+  if (manager->path == null_ptr)
+  {
+    sc_fs_memory_error("Repo path is empty to save memory");
+    return SC_FS_MEMORY_NO;
+  }
+
+  if (_sc_fs_memory_save_sc_memory_segments_changes(storage) != SC_FS_MEMORY_OK)
+    return SC_FS_MEMORY_WRITE_ERROR;
+  if (manager->save(manager->fs_memory) != SC_FS_MEMORY_OK)
+    return SC_FS_MEMORY_WRITE_ERROR;
+
+  return SC_FS_MEMORY_OK;
+}
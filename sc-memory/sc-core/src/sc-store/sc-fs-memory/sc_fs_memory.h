@@ -9,6 +9,7 @@
 
 #include "sc_fs_memory_status.h"
 #include "sc_fs_memory_header.h"
+#include "sc_io.h"
 
 #include "sc-core/sc_types.h"
 #include "sc-core/sc_defines.h"
@@ -27,6 +28,11 @@ typedef struct _sc_fs_memory_manager
   sc_char const * path;      // repo path
   sc_char * segments_path;   // file path to sc-memory segments
 
+  sc_char * segments_changes_path;  // file path to sc-memory segments changed since the last full save
+
+  sc_fs_mapped_file * segments_mapping;          // memory-mapped segments file, sc-segments elements point into it
+  sc_fs_mapped_file * segments_changes_mapping;  // memory-mapped segments changes file
+
   sc_version version;
   sc_fs_memory_header header;
 
@@ -40,11 +46,22 @@ typedef struct _sc_fs_memory_manager
       sc_char const * string,
       sc_uint64 const string_size,
       sc_bool is_searchable_string);
+  sc_fs_memory_status (*link_stream)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_stream const * stream,
+      sc_bool is_searchable_string);
   sc_fs_memory_status (*get_string_by_link_hash)(
       sc_fs_memory * memory,
       sc_addr_hash const link_hash,
       sc_char ** string,
       sc_uint64 * string_size);
+  sc_fs_memory_status (*get_stream_by_link_hash)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_char ** string,
+      sc_uint64 * string_size,
+      sc_stream ** stream);
   sc_fs_memory_status (*get_link_hashes_by_string)(
       sc_fs_memory * memory,
       sc_char const * string,
@@ -63,6 +80,14 @@ typedef struct _sc_fs_memory_manager
       sc_uint32 const max_length_to_search_as_prefix,
       sc_link_handler * link_handler);
   sc_fs_memory_status (*unlink_string)(sc_fs_memory * memory, sc_addr_hash const link_hash);
+  sc_fs_memory_status (*get_string_offset_by_link_hash)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_uint64 * string_offset);
+  sc_fs_memory_status (*link_string_offset)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_uint64 const string_offset);
 } sc_fs_memory_manager;
 
 /*! Initialize file system memory in specified path.
@@ -104,12 +129,38 @@ sc_fs_memory_status sc_fs_memory_link_string_ext(
     sc_uint32 string_size,
     sc_bool is_searchable_string);
 
+/*! Appends sc-link hash to file system memory with content read from stream. Big contents are copied by chunks.
+ * @param link_hash An appendable sc-link hash
+ * @param stream A seekable stream with sc-link content
+ * @param is_searchable_string Ability to search for sc-links on this content string
+ * @returns SC_TRUE, if are no reading and writing errors.
+ */
+sc_fs_memory_status sc_fs_memory_link_stream(
+    sc_addr_hash link_hash,
+    sc_stream const * stream,
+    sc_bool is_searchable_string);
+
 /*! Removes sc-link content string from file system memory.
  * @param link_hash A sc-link hash
  * @returns SC_TRUE, if such sc-string content exists.
  */
 sc_fs_memory_status sc_fs_memory_unlink_string(sc_addr_hash link_hash);
 
+/*! Gets offset of string linked with sc-link. Written strings aren't changed, so the offset can be used to restore
+ * previous content of sc-link.
+ * @param link_hash A sc-link hash
+ * @param[out] string_offset Offset of sc-link content string
+ * @returns SC_FS_MEMORY_NO_STRING, if sc-link has no content.
+ */
+sc_fs_memory_status sc_fs_memory_get_string_offset_by_link_hash(sc_addr_hash link_hash, sc_uint64 * string_offset);
+
+/*! Links sc-link with string written before by its offset.
+ * @param link_hash A sc-link hash
+ * @param string_offset Offset of written string got by sc_fs_memory_get_string_offset_by_link_hash
+ * @returns SC_FS_MEMORY_OK, if sc-link is linked.
+ */
+sc_fs_memory_status sc_fs_memory_link_string_offset(sc_addr_hash link_hash, sc_uint64 string_offset);
+
 /*! Gets sc-link content string with its size by sc-link hash.
  * @param link_hash A sc-link hash
  * @param[out] string A sc-link content string
@@ -121,6 +172,20 @@ sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
     sc_char ** string,
     sc_uint32 * string_size);
 
+/*! Gets sc-link content by sc-link hash without reading big contents into memory.
+ * @param link_hash A sc-link hash
+ * @param[out] string A sc-link content string, if it is small, otherwise null_ptr
+ * @param[out] string_size A sc-link content string size
+ * @param[out] stream A stream reading big sc-link content or content of file referred by sc-link by chunks, otherwise
+ * null_ptr
+ * @returns SC_TRUE, if sc-link content exists.
+ */
+sc_fs_memory_status sc_fs_memory_get_stream_by_link_hash(
+    sc_addr_hash link_hash,
+    sc_char ** string,
+    sc_uint32 * string_size,
+    sc_stream ** stream);
+
 /*! Gets sc-link hashes from file system memory by its string content.
  * @param string A sc-links content string
  * @param string_size A sc-links content string size
@@ -168,4 +233,12 @@ sc_fs_memory_status sc_fs_memory_load(sc_storage * storage);
  */
 sc_fs_memory_status sc_fs_memory_save(sc_storage * storage);
 
+/*! Save sc-segments changed since the last full save of file system memory
+ * @returns SC_TRUE, if file system saved.
+ * @remarks Changed sc-segments are written to the segments changes file, which is applied over the segments file
+ * on load and removed by the next full save. If most of sc-segments are changed, file system memory is fully saved.
+ * Strings dictionaries aren't saved by changes, they are rewritten entirely if they changed since the last save.
+ */
+sc_fs_memory_status sc_fs_memory_save_changes(sc_storage * storage);
+
 #endif
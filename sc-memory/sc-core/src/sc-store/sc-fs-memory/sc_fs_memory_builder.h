@@ -21,11 +21,15 @@ sc_fs_memory_manager * sc_fs_memory_build()
   manager->load = sc_dictionary_fs_memory_load;
   manager->save = sc_dictionary_fs_memory_save;
   manager->link_string = sc_dictionary_fs_memory_link_string_ext;
+  manager->link_stream = sc_dictionary_fs_memory_link_stream;
   manager->get_link_hashes_by_string = sc_dictionary_fs_memory_get_link_hashes_by_string;
   manager->get_link_hashes_by_substring = sc_dictionary_fs_memory_get_link_hashes_by_substring_ext;
   manager->get_strings_by_substring = sc_dictionary_fs_memory_get_strings_by_substring_ext;
   manager->get_string_by_link_hash = sc_dictionary_fs_memory_get_string_by_link_hash;
+  manager->get_stream_by_link_hash = sc_dictionary_fs_memory_get_stream_by_link_hash;
   manager->unlink_string = sc_dictionary_fs_memory_unlink_string;
+  manager->get_string_offset_by_link_hash = sc_dictionary_fs_memory_get_string_offset_by_link_hash;
+  manager->link_string_offset = sc_dictionary_fs_memory_link_string_offset;
 #endif
 
   return manager;
@@ -0,0 +1,331 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_fs_memory_bundle.h"
+
+#include <stdlib.h>
+
+#include "sc_file_system.h"
+#include "sc_dictionary_fs_memory_private.h"
+#include "sc_io.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc-container/sc_string.h"
+
+// Bundle file layout:
+// [header: magic, format version, sc-memory version, sections count, checksum of sections table]
+// [sections table: name, offset, size and checksum of each section][padding]
+// [section 1 data][padding]...[section N data][padding].
+// Each section contains one of sc-memory binaries saved in storage directory. Offsets of sections are relative to the
+// bundle beginning and are aligned as images of sc-segments in segments file, so the bundle can be mapped into memory
+// and its sections can be accessed directly.
+#define SC_FS_MEMORY_BUNDLE_MAGIC "SCBUNDLE"
+#define SC_FS_MEMORY_BUNDLE_MAGIC_SIZE 8
+#define SC_FS_MEMORY_BUNDLE_FORMAT_VERSION 1
+#define SC_FS_MEMORY_BUNDLE_SECTION_NAME_SIZE 64
+#define SC_FS_MEMORY_BUNDLE_ALIGNMENT 0x10000
+#define _sc_fs_memory_bundle_align(size) \
+  (((size) + SC_FS_MEMORY_BUNDLE_ALIGNMENT - 1) & ~((sc_uint64)SC_FS_MEMORY_BUNDLE_ALIGNMENT - 1))
+
+typedef struct _sc_fs_memory_bundle_header
+{
+  sc_char magic[SC_FS_MEMORY_BUNDLE_MAGIC_SIZE];
+  sc_uint32 format_version;
+  sc_uint32 memory_version;
+  sc_uint64 sections_count;
+  sc_uint64 sections_table_checksum;
+} sc_fs_memory_bundle_header;
+
+typedef struct _sc_fs_memory_bundle_section
+{
+  sc_char name[SC_FS_MEMORY_BUNDLE_SECTION_NAME_SIZE];
+  sc_uint64 offset;
+  sc_uint64 size;
+  sc_uint64 checksum;
+} sc_fs_memory_bundle_section;
+
+sc_uint64 _sc_fs_memory_bundle_checksum(sc_uint8 const * data, sc_uint64 size)
+{
+  // FNV-1a hash
+  sc_uint64 checksum = 14695981039346656037ull;
+  for (sc_uint64 i = 0; i < size; ++i)
+  {
+    checksum ^= data[i];
+    checksum *= 1099511628211ull;
+  }
+  return checksum;
+}
+
+sc_bool _sc_fs_memory_bundle_is_storage_file(sc_char const * name)
+{
+  sc_uint64 const name_size = sc_str_len(name);
+  sc_uint64 const ext_size = sc_str_len(SC_FS_EXT);
+  if (name_size <= ext_size || name_size >= SC_FS_MEMORY_BUNDLE_SECTION_NAME_SIZE)
+    return SC_FALSE;
+
+  // write-ahead log isn't needed for saved sc-memory
+  return sc_str_cmp(name + name_size - ext_size, SC_FS_EXT) && !sc_str_has_prefix(name, "wal");
+}
+
+sc_bool _sc_fs_memory_bundle_is_valid_section_name(sc_char const * name)
+{
+  // section is extracted only into file of storage directory
+  sc_uint64 const name_size = strnlen(name, SC_FS_MEMORY_BUNDLE_SECTION_NAME_SIZE);
+  return name_size != 0 && name_size != SC_FS_MEMORY_BUNDLE_SECTION_NAME_SIZE && name[0] != '.'
+         && !sc_str_find(name, "/") && _sc_fs_memory_bundle_is_storage_file(name);
+}
+
+int _sc_fs_memory_bundle_compare_sections(void const * a, void const * b)
+{
+  return strcmp(
+      ((sc_fs_memory_bundle_section const *)a)->name, ((sc_fs_memory_bundle_section const *)b)->name);
+}
+
+sc_bool _sc_fs_memory_bundle_write_chars(sc_io_channel * channel, sc_pointer data, sc_uint64 size)
+{
+  sc_uint64 written_bytes = 0;
+  return size == 0
+         || (sc_io_channel_write_chars(channel, data, size, &written_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+             && written_bytes == size);
+}
+
+sc_bool _sc_fs_memory_bundle_write_padding(sc_io_channel * channel, sc_uint64 size)
+{
+  static sc_char const padding[SC_FS_MEMORY_BUNDLE_ALIGNMENT] = {0};
+  return _sc_fs_memory_bundle_write_chars(channel, (sc_pointer)padding, size);
+}
+
+sc_fs_memory_status sc_fs_memory_bundle_write(
+    sc_version const * version,
+    sc_char const * storage_path,
+    sc_char const * bundle_path)
+{
+  sc_fs_memory_status status = SC_FS_MEMORY_WRITE_ERROR;
+  sc_fs_memory_bundle_section * sections = null_ptr;
+  sc_fs_mapped_file ** sections_files = null_ptr;
+  sc_uint64 sections_count = 0;
+  sc_io_channel * channel = null_ptr;
+
+  if (storage_path == null_ptr || bundle_path == null_ptr || sc_fs_is_directory(storage_path) == SC_FALSE)
+  {
+    sc_fs_memory_error("Path to sc-memory binaries `%s` isn't a directory", storage_path);
+    return SC_FS_MEMORY_WRONG_PATH;
+  }
+
+  GDir * directory = g_dir_open(storage_path, 0, null_ptr);
+  if (directory == null_ptr)
+    return SC_FS_MEMORY_WRONG_PATH;
+
+  sc_uint64 files_count = 0;
+  while (g_dir_read_name(directory) != null_ptr)
+    ++files_count;
+  g_dir_close(directory);
+
+  directory = g_dir_open(storage_path, 0, null_ptr);
+  if (directory == null_ptr)
+    return SC_FS_MEMORY_WRONG_PATH;
+
+  sections = sc_mem_new(sc_fs_memory_bundle_section, files_count + 1);
+  sc_char const * file = g_dir_read_name(directory);
+  while (file != null_ptr && sections_count < files_count)
+  {
+    if (_sc_fs_memory_bundle_is_storage_file(file))
+      sc_str_printf(sections[sections_count++].name, SC_FS_MEMORY_BUNDLE_SECTION_NAME_SIZE, "%s", file);
+    file = g_dir_read_name(directory);
+  }
+  g_dir_close(directory);
+
+  // sections are written in the same order on each run
+  qsort(sections, sections_count, sizeof(sc_fs_memory_bundle_section), _sc_fs_memory_bundle_compare_sections);
+
+  sc_char path[MAX_PATH_LENGTH];
+  sections_files = sc_mem_new(sc_fs_mapped_file *, sections_count + 1);
+  sc_uint64 const sections_table_size = sizeof(sc_fs_memory_bundle_section) * sections_count;
+  sc_uint64 const table_size = sizeof(sc_fs_memory_bundle_header) + sections_table_size;
+  sc_uint64 offset = _sc_fs_memory_bundle_align(table_size);
+  for (sc_uint64 i = 0; i < sections_count; ++i)
+  {
+    sc_fs_memory_bundle_section * section = &sections[i];
+    sc_str_printf(path, MAX_PATH_LENGTH, "%s/%s", storage_path, section->name);
+    sections_files[i] = sc_fs_map_file(path);
+    if (sections_files[i] == null_ptr)
+    {
+      sc_fs_memory_error("Can't read file `%s` to write it into bundle", path);
+      status = SC_FS_MEMORY_READ_ERROR;
+      goto error;
+    }
+    section->size = sc_fs_mapped_file_get_size(sections_files[i]);
+    section->offset = offset;
+    section->checksum = _sc_fs_memory_bundle_checksum(sc_fs_mapped_file_get_data(sections_files[i]), section->size);
+    offset += _sc_fs_memory_bundle_align(section->size);
+  }
+
+  sc_fs_memory_bundle_header header;
+  sc_mem_set(&header, 0, sizeof(sc_fs_memory_bundle_header));
+  sc_mem_cpy(header.magic, SC_FS_MEMORY_BUNDLE_MAGIC, SC_FS_MEMORY_BUNDLE_MAGIC_SIZE);
+  header.format_version = SC_FS_MEMORY_BUNDLE_FORMAT_VERSION;
+  header.memory_version = sc_version_to_int(version);
+  header.sections_count = sections_count;
+  header.sections_table_checksum = _sc_fs_memory_bundle_checksum((sc_uint8 const *)sections, sections_table_size);
+
+  channel = sc_io_new_write_channel(bundle_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_fs_memory_error("Can't open bundle file `%s` to write", bundle_path);
+    status = SC_FS_MEMORY_WRONG_PATH;
+    goto error;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  if (_sc_fs_memory_bundle_write_chars(channel, &header, sizeof(sc_fs_memory_bundle_header)) == SC_FALSE
+      || _sc_fs_memory_bundle_write_chars(channel, sections, sections_table_size) == SC_FALSE
+      || _sc_fs_memory_bundle_write_padding(channel, _sc_fs_memory_bundle_align(table_size) - table_size) == SC_FALSE)
+    goto error;
+
+  for (sc_uint64 i = 0; i < sections_count; ++i)
+  {
+    sc_fs_memory_bundle_section const * section = &sections[i];
+    if (_sc_fs_memory_bundle_write_chars(channel, sc_fs_mapped_file_get_data(sections_files[i]), section->size)
+            == SC_FALSE
+        || _sc_fs_memory_bundle_write_padding(channel, _sc_fs_memory_bundle_align(section->size) - section->size)
+               == SC_FALSE)
+      goto error;
+  }
+
+  if (sc_io_channel_flush(channel, null_ptr) != SC_FS_IO_STATUS_NORMAL)
+    goto error;
+
+  sc_fs_memory_info("Bundle `%s` with %lu sections is written", bundle_path, (sc_ulong)sections_count);
+  status = SC_FS_MEMORY_OK;
+
+error:
+  if (status != SC_FS_MEMORY_OK && status != SC_FS_MEMORY_WRONG_PATH)
+    sc_fs_memory_error("Can't write bundle file `%s`", bundle_path);
+  if (channel != null_ptr)
+  {
+    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  }
+  for (sc_uint64 i = 0; i < sections_count; ++i)
+    sc_fs_unmap_file(sections_files[i]);
+  sc_mem_free(sections_files);
+  sc_mem_free(sections);
+  return status;
+}
+
+sc_fs_memory_status _sc_fs_memory_bundle_check(
+    sc_version const * version,
+    sc_uint8 const * bundle,
+    sc_uint64 bundle_size,
+    sc_char const * bundle_path)
+{
+  sc_fs_memory_bundle_header const * header = (sc_fs_memory_bundle_header const *)bundle;
+  if (bundle_size < sizeof(sc_fs_memory_bundle_header)
+      || memcmp(header->magic, SC_FS_MEMORY_BUNDLE_MAGIC, SC_FS_MEMORY_BUNDLE_MAGIC_SIZE) != 0)
+  {
+    sc_fs_memory_error("File `%s` isn't a sc-memory bundle", bundle_path);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  if (header->format_version != SC_FS_MEMORY_BUNDLE_FORMAT_VERSION)
+  {
+    sc_fs_memory_error("Bundle `%s` has unsupported format version %u", bundle_path, header->format_version);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  sc_version read_version = {0, 0, 0, null_ptr};
+  sc_version_from_int(header->memory_version, &read_version);
+  if (sc_version_compare(version, &read_version) == -1)
+  {
+    sc_char * read_version_string = sc_version_string_new(&read_version);
+    sc_fs_memory_error("Bundle `%s` has incompatible version %s", bundle_path, read_version_string);
+    sc_version_string_free(read_version_string);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  sc_fs_memory_bundle_section const * sections =
+      (sc_fs_memory_bundle_section const *)(bundle + sizeof(sc_fs_memory_bundle_header));
+  if (header->sections_count > (bundle_size - sizeof(sc_fs_memory_bundle_header)) / sizeof(sc_fs_memory_bundle_section)
+      || _sc_fs_memory_bundle_checksum(
+             (sc_uint8 const *)sections, sizeof(sc_fs_memory_bundle_section) * header->sections_count)
+             != header->sections_table_checksum)
+  {
+    sc_fs_memory_error("Bundle `%s` has corrupted sections table", bundle_path);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  for (sc_uint64 i = 0; i < header->sections_count; ++i)
+  {
+    sc_fs_memory_bundle_section const * section = &sections[i];
+    if (_sc_fs_memory_bundle_is_valid_section_name(section->name) == SC_FALSE || section->offset > bundle_size
+        || section->size > bundle_size - section->offset
+        || _sc_fs_memory_bundle_checksum(bundle + section->offset, section->size) != section->checksum)
+    {
+      sc_fs_memory_error("Bundle `%s` has corrupted section %lu", bundle_path, (sc_ulong)i);
+      return SC_FS_MEMORY_READ_ERROR;
+    }
+  }
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_fs_memory_status sc_fs_memory_bundle_extract(
+    sc_version const * version,
+    sc_char const * bundle_path,
+    sc_char const * storage_path)
+{
+  if (bundle_path == null_ptr || sc_fs_is_file(bundle_path) == SC_FALSE)
+  {
+    sc_fs_memory_error("Bundle file `%s` doesn't exist", bundle_path);
+    return SC_FS_MEMORY_WRONG_PATH;
+  }
+
+  sc_fs_mapped_file * bundle_file = sc_fs_map_file(bundle_path);
+  if (bundle_file == null_ptr)
+    return SC_FS_MEMORY_READ_ERROR;
+
+  sc_uint8 const * bundle = sc_fs_mapped_file_get_data(bundle_file);
+  sc_uint64 const bundle_size = sc_fs_mapped_file_get_size(bundle_file);
+
+  sc_fs_memory_status status = _sc_fs_memory_bundle_check(version, bundle, bundle_size, bundle_path);
+  if (status != SC_FS_MEMORY_OK)
+    goto error;
+
+  sc_fs_memory_bundle_header const * header = (sc_fs_memory_bundle_header const *)bundle;
+  sc_fs_memory_bundle_section const * sections =
+      (sc_fs_memory_bundle_section const *)(bundle + sizeof(sc_fs_memory_bundle_header));
+  sc_char path[MAX_PATH_LENGTH];
+  for (sc_uint64 i = 0; i < header->sections_count; ++i)
+  {
+    sc_fs_memory_bundle_section const * section = &sections[i];
+    sc_str_printf(path, MAX_PATH_LENGTH, "%s/%s", storage_path, section->name);
+
+    sc_io_channel * channel = sc_io_new_write_channel(path, null_ptr);
+    if (channel == null_ptr)
+    {
+      sc_fs_memory_error("Can't open file `%s` to extract bundle section", path);
+      status = SC_FS_MEMORY_WRITE_ERROR;
+      goto error;
+    }
+    sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+    sc_bool const is_written =
+        _sc_fs_memory_bundle_write_chars(channel, (sc_pointer)(bundle + section->offset), section->size)
+        && sc_io_channel_flush(channel, null_ptr) == SC_FS_IO_STATUS_NORMAL;
+    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+    if (is_written == SC_FALSE)
+    {
+      sc_fs_memory_error("Can't extract bundle section into file `%s`", path);
+      status = SC_FS_MEMORY_WRITE_ERROR;
+      goto error;
+    }
+  }
+
+  sc_fs_memory_info("Bundle `%s` with %lu sections is extracted", bundle_path, (sc_ulong)header->sections_count);
+
+error:
+  sc_fs_unmap_file(bundle_file);
+  return status;
+}
@@ -0,0 +1,41 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_fs_memory_bundle_h_
+#define _sc_fs_memory_bundle_h_
+
+#include "sc_fs_memory_status.h"
+
+#include "sc-core/sc_types.h"
+#include "sc-core/sc_memory_version.h"
+
+/*! Writes sc-memory binaries saved in storage directory into one bundle file.
+ * @param version Version of sc-memory that saved binaries
+ * @param storage_path Path to directory with saved sc-memory binaries
+ * @param bundle_path Path to bundle file to write
+ * @returns SC_FS_MEMORY_OK, if bundle is written.
+ * @remarks Sc-memory segments, sc-links contents and their terms index are written to bundle as checksummed sections
+ * aligned to memory pages, write-ahead log files aren't written. Sc-memory should be saved before.
+ */
+sc_fs_memory_status sc_fs_memory_bundle_write(
+    sc_version const * version,
+    sc_char const * storage_path,
+    sc_char const * bundle_path);
+
+/*! Extracts sc-memory binaries from bundle file into storage directory.
+ * @param version Version of sc-memory that loads binaries
+ * @param bundle_path Path to bundle file to extract
+ * @param storage_path Path to directory to extract sc-memory binaries into
+ * @returns SC_FS_MEMORY_OK, if bundle is extracted.
+ * @remarks Checksums of all bundle sections are checked before extraction, so corrupted bundle doesn't change
+ * storage directory. Bundles written by later versions of sc-memory aren't extracted.
+ */
+sc_fs_memory_status sc_fs_memory_bundle_extract(
+    sc_version const * version,
+    sc_char const * bundle_path,
+    sc_char const * storage_path);
+
+#endif
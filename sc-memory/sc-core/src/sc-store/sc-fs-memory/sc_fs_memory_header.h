@@ -18,7 +18,9 @@ typedef struct _sc_fs_memory_header
   sc_uint32 version;
   sc_uint16 size;  // deprecated in 0.8.0
   sc_uint64 timestamp;
-  sc_uint8 checksum[DEFAULT_CHECKSUM_SIZE];
+  sc_uint32 magic;   // taken from unused checksum bytes in 0.10.0, zero in files of previous versions
+  sc_uint32 layout;  // valid only if `magic` is set
+  sc_uint8 checksum[DEFAULT_CHECKSUM_SIZE - 2 * sizeof(sc_uint32)];
 } sc_fs_memory_header;
 
 sc_fs_memory_status sc_fs_memory_header_read(sc_io_channel * channel, sc_fs_memory_header * header);
@@ -8,16 +8,20 @@
 #define _sc_io_h_
 
 #include <glib.h>
+#include <unistd.h>
 
 #include "sc-core/sc_types.h"
 
 typedef GIOChannel sc_io_channel;
 
+typedef GMappedFile sc_fs_mapped_file;
+
 /// io statuses
 #define SC_FS_IO_STATUS_NORMAL G_IO_STATUS_NORMAL
 
 /// seek types
 #define SC_FS_IO_SEEK_SET G_SEEK_SET
+#define SC_FS_IO_SEEK_CUR G_SEEK_CUR
 
 #define sc_io_new_channel(file_path, mode, errors) g_io_channel_new_file(file_path, mode, errors)
 
@@ -31,6 +35,12 @@ typedef GIOChannel sc_io_channel;
 
 #define sc_io_channel_flush(channel, errors) g_io_channel_flush(channel, errors)
 
+#define sc_io_channel_sync(channel) fdatasync(g_io_channel_unix_get_fd(channel))
+
+#define sc_io_channel_get_end_position(channel) lseek(g_io_channel_unix_get_fd(channel), 0, SEEK_END)
+
+#define sc_io_channel_truncate(channel, size) ftruncate(g_io_channel_unix_get_fd(channel), size)
+
 #define sc_io_channel_shutdown(channel, flush, errors) \
   g_io_channel_shutdown(channel, flush, errors); \
   g_io_channel_unref(channel)
@@ -43,4 +53,12 @@ typedef GIOChannel sc_io_channel;
 
 #define sc_io_channel_seek(channel, offset, type, errors) g_io_channel_seek_position(channel, offset, type, errors)
 
+#define sc_io_channel_pread(channel, chars, count, offset) pread(g_io_channel_unix_get_fd(channel), chars, count, offset)
+
+#define sc_io_channel_get_file_descriptor(channel) g_io_channel_unix_get_fd(channel)
+
+#define sc_fs_mapped_file_get_data(file) ((sc_pointer)g_mapped_file_get_contents(file))
+
+#define sc_fs_mapped_file_get_size(file) ((sc_uint64)g_mapped_file_get_length(file))
+
 #endif
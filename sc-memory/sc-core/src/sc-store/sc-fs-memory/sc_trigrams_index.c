@@ -0,0 +1,350 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_trigrams_index.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#include "sc_io.h"
+
+#include <stdlib.h>
+
+#define SC_TRIGRAM_STRING_OFFSETS_MIN_CAPACITY 8
+
+#define SC_TRIGRAM_FROM_STRING(string) \
+  (((sc_uint64)(sc_uint8)(string)[0] << 16) | ((sc_uint64)(sc_uint8)(string)[1] << 8) | (sc_uint8)(string)[2])
+
+void _sc_trigram_string_offsets_reserve(sc_trigram_string_offsets * offsets, sc_uint32 const size)
+{
+  if (offsets->capacity >= size)
+    return;
+
+  sc_uint32 capacity = offsets->capacity == 0 ? SC_TRIGRAM_STRING_OFFSETS_MIN_CAPACITY : offsets->capacity;
+  while (capacity < size)
+    capacity *= 2;
+
+  sc_uint8 * bytes = sc_mem_new(sc_uint8, capacity);
+  if (offsets->bytes != null_ptr)
+  {
+    sc_mem_cpy(bytes, offsets->bytes, offsets->size);
+    sc_mem_free(offsets->bytes);
+  }
+  offsets->bytes = bytes;
+  offsets->capacity = capacity;
+}
+
+void _sc_trigram_string_offsets_append(sc_trigram_string_offsets * offsets, sc_uint64 const string_offset)
+{
+  // string is appended once for all its equal trigrams
+  if (offsets->count != 0 && offsets->last_string_offset >= string_offset)
+    return;
+
+  sc_uint64 difference = string_offset - offsets->last_string_offset;
+  _sc_trigram_string_offsets_reserve(offsets, offsets->size + 10);
+  while (difference >= 0x80)
+  {
+    offsets->bytes[offsets->size++] = (sc_uint8)(difference | 0x80);
+    difference >>= 7;
+  }
+  offsets->bytes[offsets->size++] = (sc_uint8)difference;
+
+  offsets->last_string_offset = string_offset;
+  ++offsets->count;
+}
+
+//! Decodes the next string offset from position of bytes, the previous string offset is passed by \p string_offset.
+sc_uint64 _sc_trigram_string_offsets_next(
+    sc_trigram_string_offsets const * offsets,
+    sc_uint32 * position,
+    sc_uint64 const string_offset)
+{
+  sc_uint64 difference = 0;
+  for (sc_uint8 shift = 0; *position < offsets->size; shift += 7)
+  {
+    sc_uint8 const byte = offsets->bytes[(*position)++];
+    difference |= (sc_uint64)(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0)
+      break;
+  }
+
+  return string_offset + difference;
+}
+
+void _sc_trigram_string_offsets_destroy(sc_trigram_string_offsets * offsets)
+{
+  sc_mem_free(offsets->bytes);
+  sc_mem_free(offsets);
+}
+
+sc_bool _sc_trigrams_index_destroy_string_offsets(sc_uint64 trigram, sc_uint64 offsets, void ** arguments)
+{
+  (void)trigram;
+  (void)arguments;
+  _sc_trigram_string_offsets_destroy((sc_trigram_string_offsets *)offsets);
+  return SC_TRUE;
+}
+
+sc_bool sc_trigrams_index_initialize(sc_trigrams_index ** index)
+{
+  if (index == null_ptr)
+    return SC_FALSE;
+
+  *index = sc_mem_new(sc_trigrams_index, 1);
+  sc_number_hash_map_initialize(&(*index)->trigrams_string_offsets, 0);
+  sc_monitor_init(&(*index)->monitor);
+  return SC_TRUE;
+}
+
+sc_bool sc_trigrams_index_destroy(sc_trigrams_index * index)
+{
+  if (index == null_ptr)
+    return SC_FALSE;
+
+  sc_number_hash_map_visit(index->trigrams_string_offsets, _sc_trigrams_index_destroy_string_offsets, null_ptr);
+  sc_number_hash_map_destroy(index->trigrams_string_offsets);
+  sc_monitor_destroy(&index->monitor);
+  sc_mem_free(index);
+  return SC_TRUE;
+}
+
+sc_trigram_string_offsets * _sc_trigrams_index_resolve_string_offsets(
+    sc_trigrams_index * index,
+    sc_uint64 const trigram)
+{
+  sc_uint64 offsets;
+  if (sc_number_hash_map_get(index->trigrams_string_offsets, trigram, &offsets))
+    return (sc_trigram_string_offsets *)offsets;
+
+  sc_trigram_string_offsets * new_offsets = sc_mem_new(sc_trigram_string_offsets, 1);
+  sc_number_hash_map_insert(index->trigrams_string_offsets, trigram, (sc_uint64)new_offsets);
+  return new_offsets;
+}
+
+void sc_trigrams_index_append_string(
+    sc_trigrams_index * index,
+    sc_uint64 string_offset,
+    sc_char const * string,
+    sc_uint64 string_size)
+{
+  if (index == null_ptr || string_size < SC_TRIGRAM_SIZE)
+    return;
+
+  sc_monitor_acquire_write(&index->monitor);
+  for (sc_uint64 i = 0; i + SC_TRIGRAM_SIZE <= string_size; ++i)
+  {
+    sc_trigram_string_offsets * offsets =
+        _sc_trigrams_index_resolve_string_offsets(index, SC_TRIGRAM_FROM_STRING(string + i));
+    _sc_trigram_string_offsets_append(offsets, string_offset);
+  }
+  sc_monitor_release_write(&index->monitor);
+}
+
+int _sc_trigram_string_offsets_compare_by_count(void const * offsets, void const * other_offsets)
+{
+  sc_uint32 const count = (*(sc_trigram_string_offsets * const *)offsets)->count;
+  sc_uint32 const other_count = (*(sc_trigram_string_offsets * const *)other_offsets)->count;
+  return (count > other_count) - (count < other_count);
+}
+
+sc_bool sc_trigrams_index_get_string_offsets(
+    sc_trigrams_index * index,
+    sc_char const * substring,
+    sc_uint64 substring_size,
+    sc_uint64 ** string_offsets,
+    sc_uint64 * string_offsets_count)
+{
+  *string_offsets = null_ptr;
+  *string_offsets_count = 0;
+  if (index == null_ptr || substring_size < SC_TRIGRAM_SIZE)
+    return SC_FALSE;
+
+  sc_uint64 const trigrams_count = substring_size - SC_TRIGRAM_SIZE + 1;
+  sc_trigram_string_offsets ** trigrams_offsets = sc_mem_new(sc_trigram_string_offsets *, trigrams_count);
+  sc_uint64 offsets_count = 0;
+
+  sc_monitor_acquire_read(&index->monitor);
+
+  for (sc_uint64 i = 0; i < trigrams_count; ++i)
+  {
+    sc_uint64 offsets;
+    // strings can't contain substring if one of its trigrams isn't found
+    if (!sc_number_hash_map_get(index->trigrams_string_offsets, SC_TRIGRAM_FROM_STRING(substring + i), &offsets))
+      goto result;
+
+    sc_uint64 j = 0;
+    while (j < offsets_count && trigrams_offsets[j] != (sc_trigram_string_offsets *)offsets)
+      ++j;
+    if (j == offsets_count)
+      trigrams_offsets[offsets_count++] = (sc_trigram_string_offsets *)offsets;
+  }
+
+  // intersect lists starting from the shortest one
+  qsort(
+      trigrams_offsets,
+      offsets_count,
+      sizeof(sc_trigram_string_offsets *),
+      _sc_trigram_string_offsets_compare_by_count);
+
+  sc_trigram_string_offsets const * shortest_offsets = trigrams_offsets[0];
+  sc_uint64 * found_offsets = sc_mem_new(sc_uint64, shortest_offsets->count);
+  sc_uint64 found_count = 0;
+  {
+    sc_uint32 position = 0;
+    sc_uint64 string_offset = 0;
+    for (sc_uint32 i = 0; i < shortest_offsets->count; ++i)
+    {
+      string_offset = _sc_trigram_string_offsets_next(shortest_offsets, &position, string_offset);
+      found_offsets[found_count++] = string_offset;
+    }
+  }
+
+  for (sc_uint64 i = 1; i < offsets_count && found_count != 0; ++i)
+  {
+    sc_trigram_string_offsets const * offsets = trigrams_offsets[i];
+    sc_uint32 position = 0;
+    sc_uint32 decoded_count = 0;
+    sc_uint64 string_offset = 0;
+    sc_uint64 intersected_count = 0;
+    for (sc_uint64 j = 0; j < found_count; ++j)
+    {
+      while (decoded_count < offsets->count && (decoded_count == 0 || string_offset < found_offsets[j]))
+      {
+        string_offset = _sc_trigram_string_offsets_next(offsets, &position, string_offset);
+        ++decoded_count;
+      }
+
+      if (decoded_count != 0 && string_offset == found_offsets[j])
+        found_offsets[intersected_count++] = found_offsets[j];
+      else if (decoded_count == offsets->count && string_offset < found_offsets[j])
+        break;
+    }
+    found_count = intersected_count;
+  }
+
+  *string_offsets = found_offsets;
+  *string_offsets_count = found_count;
+
+result:
+  sc_monitor_release_read(&index->monitor);
+  sc_mem_free(trigrams_offsets);
+  return SC_TRUE;
+}
+
+sc_bool _sc_trigrams_index_write_string_offsets(sc_uint64 trigram, sc_uint64 offsets_pointer, void ** arguments)
+{
+  sc_io_channel * channel = arguments[0];
+  sc_trigram_string_offsets const * offsets = (sc_trigram_string_offsets *)offsets_pointer;
+
+  sc_uint32 const written_trigram = (sc_uint32)trigram;
+  sc_uint64 written_bytes = 0;
+  if (sc_io_channel_write_chars(channel, &written_trigram, sizeof(sc_uint32), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint32) != written_bytes)
+    return SC_FALSE;
+
+  if (sc_io_channel_write_chars(channel, &offsets->count, sizeof(sc_uint32), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint32) != written_bytes)
+    return SC_FALSE;
+
+  if (sc_io_channel_write_chars(channel, &offsets->last_string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint64) != written_bytes)
+    return SC_FALSE;
+
+  if (sc_io_channel_write_chars(channel, &offsets->size, sizeof(sc_uint32), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint32) != written_bytes)
+    return SC_FALSE;
+
+  if (sc_io_channel_write_chars(channel, offsets->bytes, offsets->size, &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || offsets->size != written_bytes)
+    return SC_FALSE;
+
+  return SC_TRUE;
+}
+
+sc_bool sc_trigrams_index_save(sc_trigrams_index * index, sc_char const * path)
+{
+  if (index == null_ptr)
+    return SC_FALSE;
+
+  sc_io_channel * channel = sc_io_new_write_channel(path, null_ptr);
+  if (channel == null_ptr)
+    return SC_FALSE;
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_monitor_acquire_read(&index->monitor);
+  sc_bool const is_saved = sc_number_hash_map_visit(
+      index->trigrams_string_offsets, _sc_trigrams_index_write_string_offsets, (void **)&channel);
+  sc_monitor_release_read(&index->monitor);
+
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  return is_saved;
+}
+
+sc_bool sc_trigrams_index_load(sc_trigrams_index * index, sc_char const * path)
+{
+  if (index == null_ptr)
+    return SC_FALSE;
+
+  sc_io_channel * channel = sc_io_new_read_channel(path, null_ptr);
+  if (channel == null_ptr)
+    return SC_FALSE;
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_monitor_acquire_write(&index->monitor);
+
+  sc_uint64 read_bytes = 0;
+  while (SC_TRUE)
+  {
+    sc_uint32 trigram;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&trigram, sizeof(sc_uint32), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint32) != read_bytes)
+      break;
+
+    sc_trigram_string_offsets loaded_offsets = {null_ptr, 0, 0, 0, 0};
+    if (sc_io_channel_read_chars(channel, (sc_char *)&loaded_offsets.count, sizeof(sc_uint32), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint32) != read_bytes)
+      break;
+
+    if (sc_io_channel_read_chars(
+            channel, (sc_char *)&loaded_offsets.last_string_offset, sizeof(sc_uint64), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != read_bytes)
+      break;
+
+    if (sc_io_channel_read_chars(channel, (sc_char *)&loaded_offsets.size, sizeof(sc_uint32), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint32) != read_bytes)
+      break;
+
+    _sc_trigram_string_offsets_reserve(&loaded_offsets, loaded_offsets.size);
+    if (sc_io_channel_read_chars(channel, (sc_char *)loaded_offsets.bytes, loaded_offsets.size, &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || loaded_offsets.size != read_bytes)
+    {
+      sc_mem_free(loaded_offsets.bytes);
+      break;
+    }
+
+    sc_trigram_string_offsets * offsets = sc_mem_new(sc_trigram_string_offsets, 1);
+    *offsets = loaded_offsets;
+
+    sc_uint64 previous_offsets;
+    if (sc_number_hash_map_get(index->trigrams_string_offsets, trigram, &previous_offsets))
+      _sc_trigram_string_offsets_destroy((sc_trigram_string_offsets *)previous_offsets);
+    sc_number_hash_map_insert(index->trigrams_string_offsets, trigram, (sc_uint64)offsets);
+  }
+
+  sc_monitor_release_write(&index->monitor);
+
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  return SC_TRUE;
+}
@@ -0,0 +1,93 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_trigrams_index_h_
+#define _sc_trigrams_index_h_
+
+#include "sc-core/sc_types.h"
+
+#include "sc-store/sc-base/sc_monitor_private.h"
+#include "sc-store/sc-container/sc_number_hash_map.h"
+
+//! Size of n-grams indexed by sc-trigrams-index
+#define SC_TRIGRAM_SIZE 3
+
+//! A structure to store ascending strings offsets of trigram
+typedef struct _sc_trigram_string_offsets
+{
+  sc_uint8 * bytes;              // differences of ascending strings offsets encoded by varints
+  sc_uint32 size;                // number of encoded bytes
+  sc_uint32 capacity;            // size of allocated bytes
+  sc_uint32 count;               // number of strings offsets
+  sc_uint64 last_string_offset;  // the last appended string offset
+} sc_trigram_string_offsets;
+
+/*! A sc-trigrams-index structure to find strings containing substring. Each trigram of indexed strings is mapped
+ * to compressed list of offsets of strings containing it, candidates for substring are found by intersection of lists
+ * of all its trigrams.
+ */
+typedef struct _sc_trigrams_index
+{
+  sc_number_hash_map * trigrams_string_offsets;  // map with trigrams and pointers to their strings offsets
+  sc_monitor monitor;                            // monitor for trigrams and their strings offsets
+} sc_trigrams_index;
+
+/*! Initializes a sc-trigrams-index.
+ * @param[out] index Pointer to a sc-trigrams-index pointer to initialize
+ * @returns Returns SC_TRUE, if sc-trigrams-index is initialized; otherwise return SC_FALSE.
+ */
+sc_bool sc_trigrams_index_initialize(sc_trigrams_index ** index);
+
+/*! Destroys a sc-trigrams-index.
+ * @param index A sc-trigrams-index pointer to destroy
+ * @returns Returns SC_TRUE, if a sc-trigrams-index exists; otherwise return SC_FALSE.
+ */
+sc_bool sc_trigrams_index_destroy(sc_trigrams_index * index);
+
+/*! Appends trigrams of a string to a sc-trigrams-index.
+ * @param index A sc-trigrams-index pointer
+ * @param string_offset An offset of string, offsets of appended strings must ascend
+ * @param string An appendable string
+ * @param string_size An appendable string size
+ */
+void sc_trigrams_index_append_string(
+    sc_trigrams_index * index,
+    sc_uint64 string_offset,
+    sc_char const * string,
+    sc_uint64 string_size);
+
+/*! Gets ascending offsets of strings which contain all trigrams of substring. Found strings must be checked to
+ * contain substring.
+ * @param index A sc-trigrams-index pointer
+ * @param substring A substring to find strings by it
+ * @param substring_size A substring size, it must be not less than SC_TRIGRAM_SIZE
+ * @param[out] string_offsets Pointer to found strings offsets, they must be freed by sc_mem_free
+ * @param[out] string_offsets_count Pointer to number of found strings offsets
+ * @returns Returns SC_TRUE, if strings offsets are found by trigrams; otherwise return SC_FALSE, if substring is too
+ * short to find strings by trigrams.
+ */
+sc_bool sc_trigrams_index_get_string_offsets(
+    sc_trigrams_index * index,
+    sc_char const * substring,
+    sc_uint64 substring_size,
+    sc_uint64 ** string_offsets,
+    sc_uint64 * string_offsets_count);
+
+/*! Saves a sc-trigrams-index to file.
+ * @param index A sc-trigrams-index pointer
+ * @param path A path to file
+ * @returns Returns SC_TRUE, if sc-trigrams-index is saved; otherwise return SC_FALSE.
+ */
+sc_bool sc_trigrams_index_save(sc_trigrams_index * index, sc_char const * path);
+
+/*! Loads a sc-trigrams-index from file.
+ * @param index A sc-trigrams-index pointer
+ * @param path A path to file
+ * @returns Returns SC_TRUE, if file exists and sc-trigrams-index is loaded; otherwise return SC_FALSE.
+ */
+sc_bool sc_trigrams_index_load(sc_trigrams_index * index, sc_char const * path);
+
+#endif
@@ -61,10 +61,37 @@ struct _sc_element
   sc_addr first_in_arc_from_structure;
 #endif
 
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  sc_addr_offset arc_index;  // index of sc-connector record in segment, it is 0 for sc-nodes
+#else
   sc_arc_info arc;
+#endif
 
   sc_uint32 incoming_arcs_count;
   sc_uint32 outgoing_arcs_count;
 };
 
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+/* Structure of sc-element in default layout, in which sc-connector record is stored in sc-element.
+ * It used to convert sc-memory segments saved in default layout into compact one.
+ */
+typedef struct _sc_full_element
+{
+  sc_element_flags flags;
+
+  sc_addr first_out_arc;
+  sc_addr first_in_arc;
+#  ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
+  sc_addr first_in_arc_from_structure;
+#  endif
+
+  sc_arc_info arc;
+
+  sc_uint32 incoming_arcs_count;
+  sc_uint32 outgoing_arcs_count;
+} sc_full_element;
+#else
+typedef sc_element sc_full_element;
+#endif
+
 #endif
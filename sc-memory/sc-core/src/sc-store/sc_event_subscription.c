@@ -12,6 +12,7 @@
 
 #include "sc-event/sc_event_private.h"
 #include "sc-event/sc_event_queue.h"
+#include "sc-event/sc_event_subscriptions_index.h"
 
 #include "sc_storage.h"
 #include "sc_storage_private.h"
@@ -24,25 +25,10 @@
  */
 struct _sc_event_subscription_manager
 {
-  sc_hash_table * events_table;     ///< Hash table containing registered events.
-  sc_monitor events_table_monitor;  ///< Monitor for synchronizing access to the events table.
+  sc_event_subscriptions_index * events_index;  ///< Index of registered sc-event subscriptions.
 };
 
-#define TABLE_KEY(__Addr) GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(__Addr))
-
-// Pointer to hash table that contains events
-
-guint events_table_hash_func(gconstpointer pointer)
-{
-  return GPOINTER_TO_UINT(pointer);
-}
-
-gboolean events_table_equal_func(gconstpointer a, gconstpointer b)
-{
-  return (a == b);
-}
-
-/*! Adds the specified sc-event_subscription to the registration manager's events table.
+/*! Adds the specified sc-event_subscription to the registration manager's events index.
  * @param manager Pointer to the sc-event_subscription registration manager.
  * @param event_subscription Pointer to the sc-event_subscription to be added.
  * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_NO otherwise.
@@ -51,33 +37,15 @@ sc_result _sc_event_subscription_manager_add(
     sc_event_subscription_manager * manager,
     sc_event_subscription * event_subscription)
 {
-  sc_hash_table_list * element_events_list = null_ptr;
-
-  // the first, if table doesn't exist, then return error
-  if (manager == null_ptr)
+  // the first, if index doesn't exist, then return error
+  if (manager == null_ptr || manager->events_index == null_ptr)
     return SC_RESULT_NO;
 
-  sc_monitor_acquire_write(&manager->events_table_monitor);
-
-  if (manager->events_table == null_ptr)
-  {
-    sc_monitor_release_write(&manager->events_table_monitor);
-    return SC_RESULT_NO;
-  }
-
-  // if there are no events for specified sc-element, then generate new events list
-  element_events_list =
-      (sc_hash_table_list *)sc_hash_table_get(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
-  element_events_list = sc_hash_table_list_append(element_events_list, (sc_pointer)event_subscription);
-  sc_hash_table_insert(
-      manager->events_table, TABLE_KEY(event_subscription->subscription_addr), (sc_pointer)element_events_list);
-
-  sc_monitor_release_write(&manager->events_table_monitor);
-
+  sc_event_subscriptions_index_add(manager->events_index, event_subscription);
   return SC_RESULT_OK;
 }
 
-/*! Removes the specified sc-event_subscription from the registration manager's events table.
+/*! Removes the specified sc-event_subscription from the registration manager's events index.
  * @param manager Pointer to the sc-event_subscription registration manager.
  * @param event_subscription Pointer to the sc-event_subscription to be removed.
  * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_ERROR_INVALID_PARAMS otherwise.
@@ -86,47 +54,29 @@ sc_result _sc_event_subscription_manager_remove(
     sc_event_subscription_manager * manager,
     sc_event_subscription * event_subscription)
 {
-  sc_hash_table_list * element_events_list = null_ptr;
-
-  // the first, if table doesn't exist, then return error
+  // the first, if index doesn't exist, then return error
   if (manager == null_ptr)
     return SC_RESULT_NO;
 
-  sc_monitor_acquire_write(&manager->events_table_monitor);
-  element_events_list =
-      (sc_hash_table_list *)sc_hash_table_get(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
-  if (element_events_list == null_ptr)
-    goto error;
+  if (manager->events_index == null_ptr)
+    return SC_RESULT_ERROR_INVALID_PARAMS;
 
-  if (manager->events_table == null_ptr)
-    goto error;
+  // after removing, sc-events of the sc-event_subscription aren't added to emission queue anymore
+  if (sc_event_subscriptions_index_remove(manager->events_index, event_subscription) == SC_FALSE)
+    return SC_RESULT_ERROR_INVALID_PARAMS;
 
-  // remove event_subscription from list of events for specified sc-element
-  element_events_list = sc_hash_table_list_remove(element_events_list, (sc_const_pointer)event_subscription);
-  if (element_events_list == null_ptr)
-    sc_hash_table_remove(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
-  else
-    sc_hash_table_insert(
-        manager->events_table, TABLE_KEY(event_subscription->subscription_addr), (sc_pointer)element_events_list);
-
-  sc_monitor_release_write(&manager->events_table_monitor);
   return SC_RESULT_OK;
-error:
-  sc_monitor_release_write(&manager->events_table_monitor);
-  return SC_RESULT_ERROR_INVALID_PARAMS;
 }
 
 void sc_event_subscription_manager_initialize(sc_event_subscription_manager ** manager)
 {
   (*manager) = sc_mem_new(sc_event_subscription_manager, 1);
-  (*manager)->events_table = sc_hash_table_init(events_table_hash_func, events_table_equal_func, null_ptr, null_ptr);
-  sc_monitor_init(&(*manager)->events_table_monitor);
+  sc_event_subscriptions_index_initialize(&(*manager)->events_index);
 }
 
 void sc_event_subscription_manager_shutdown(sc_event_subscription_manager * manager)
 {
-  sc_monitor_destroy(&manager->events_table_monitor);
-  sc_hash_table_destroy(manager->events_table);
+  sc_event_subscriptions_index_shutdown(manager->events_index);
   sc_mem_free(manager);
 }
 
@@ -229,9 +179,9 @@ sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscripti
   sc_storage * storage = sc_storage_get();
   if (storage != null_ptr)
   {
-    sc_monitor_acquire_write(&emission_manager->pool_monitor);
+    sc_monitor_acquire_write(&emission_manager->deletable_events_subscriptions_monitor);
     sc_queue_push(&emission_manager->deletable_events_subscriptions, event_subscription);
-    sc_monitor_release_write(&emission_manager->pool_monitor);
+    sc_monitor_release_write(&emission_manager->deletable_events_subscriptions_monitor);
   }
   sc_monitor_release_write(&event_subscription->monitor);
 
@@ -240,47 +190,33 @@ sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscripti
 
 sc_result sc_event_notify_element_deleted(sc_addr element)
 {
-  sc_hash_table_list * element_events_list = null_ptr;
-  sc_event_subscription * event_subscription = null_ptr;
-
   sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
   sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
 
   // do nothing, if there are no registered events
-  if (subscription_manager == null_ptr || subscription_manager->events_table == null_ptr)
+  if (subscription_manager == null_ptr || subscription_manager->events_index == null_ptr)
     goto result;
 
   // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
-  // lookup for all registered to specified sc-element events
-  sc_monitor_acquire_write(&subscription_manager->events_table_monitor);
-  if (subscription_manager != null_ptr)
-  {
-    element_events_list =
-        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(element));
-    if (element_events_list != null_ptr)
-      sc_hash_table_remove(subscription_manager->events_table, TABLE_KEY(element));
-  }
+  // remove all registered to specified sc-element events
+  sc_uint32 subscriptions_count = 0;
+  sc_event_subscription ** subscriptions =
+      sc_event_subscriptions_index_remove_element(subscription_manager->events_index, element, &subscriptions_count);
 
-  if (element_events_list != null_ptr)
+  for (sc_uint32 i = 0; i < subscriptions_count; ++i)
   {
-    while (element_events_list != null_ptr)
-    {
-      event_subscription = (sc_event_subscription *)element_events_list->data;
+    sc_event_subscription * event_subscription = subscriptions[i];
 
-      // mark event_subscription for deletion
-      sc_monitor_acquire_write(&event_subscription->monitor);
+    // mark event_subscription for deletion
+    sc_monitor_acquire_write(&event_subscription->monitor);
 
-      sc_monitor_acquire_write(&emission_manager->pool_monitor);
-      sc_queue_push(&emission_manager->deletable_events_subscriptions, event_subscription);
-      sc_monitor_release_write(&emission_manager->pool_monitor);
-
-      sc_monitor_release_write(&event_subscription->monitor);
+    sc_monitor_acquire_write(&emission_manager->deletable_events_subscriptions_monitor);
+    sc_queue_push(&emission_manager->deletable_events_subscriptions, event_subscription);
+    sc_monitor_release_write(&emission_manager->deletable_events_subscriptions_monitor);
 
-      element_events_list = sc_hash_table_list_remove_sublist(element_events_list, element_events_list);
-    }
-    sc_hash_table_list_destroy(element_events_list);
+    sc_monitor_release_write(&event_subscription->monitor);
   }
-  sc_monitor_release_write(&subscription_manager->events_table_monitor);
+  sc_mem_free(subscriptions);
 
 result:
   return SC_RESULT_OK;
@@ -312,8 +248,13 @@ sc_result sc_event_emit(
       ctx, subscription_addr, event_type_addr, connector_addr, connector_type, other_addr, callback, event_addr);
 }
 
-sc_result sc_event_emit_impl(
-    sc_memory_context const * ctx,
+/*! Adds to emission queue sc-events for all subscriptions of sc-element \p subscription_addr matching emitting event.
+ * @note The caller must be in read section of events index of sc-event subscription manager.
+ */
+sc_result _sc_event_emit_for_subscriptions(
+    sc_event_subscription_manager * subscription_manager,
+    sc_event_emission_manager * emission_manager,
+    sc_addr user_addr,
     sc_addr subscription_addr,
     sc_event_type event_type_addr,
     sc_addr connector_addr,
@@ -322,52 +263,106 @@ sc_result sc_event_emit_impl(
     sc_event_do_after_callback callback,
     sc_addr event_addr)
 {
-  sc_hash_table_list * element_events_list = null_ptr;
-  sc_event_subscription * event_subscription = null_ptr;
-
-  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
-  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
-
-  // if table is empty, then do nothing
   sc_result result = SC_RESULT_NO;
-  if (subscription_manager == null_ptr || subscription_manager->events_table == null_ptr)
-    goto result;
+  sc_event_subscriptions_bucket const * bucket =
+      sc_event_subscriptions_index_get_bucket(subscription_manager->events_index, subscription_addr);
+  if (bucket == null_ptr)
+    return result;
 
-  // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
-  // lookup for all registered to specified sc-element events
-  sc_monitor_acquire_read(&subscription_manager->events_table_monitor);
-  if (subscription_manager != null_ptr)
-    element_events_list =
-        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(subscription_addr));
-
-  while (element_events_list != null_ptr)
+  // sc-event subscriptions with the same sc-event type and sc-connector type mask are checked once by their group
+  for (sc_uint32 i = 0; i < bucket->groups_count; ++i)
   {
-    event_subscription = (sc_event_subscription *)element_events_list->data;
+    sc_event_subscriptions_group const * group = &bucket->groups[i];
+    if (!SC_ADDR_IS_EQUAL(group->subscription_addr, subscription_addr)
+        || !SC_ADDR_IS_EQUAL(group->event_type_addr, event_type_addr)
+        || (group->event_element_type & connector_type) != group->event_element_type)
+      continue;
 
-    if (SC_ADDR_IS_EQUAL(event_subscription->event_type_addr, event_type_addr)
-        && ((event_subscription->event_element_type & connector_type) == event_subscription->event_element_type))
-    {
+    for (sc_uint32 j = group->begin; j < group->begin + group->count; ++j)
       _sc_event_emission_manager_add(
           emission_manager,
-          event_subscription,
-          ctx->user_addr,
+          bucket->subscriptions[j],
+          user_addr,
           connector_addr,
           connector_type,
           other_addr,
           callback,
           event_addr);
 
-      result = SC_RESULT_OK;
-    }
-
-    element_events_list = element_events_list->next;
+    result = SC_RESULT_OK;
   }
-  sc_monitor_release_read(&subscription_manager->events_table_monitor);
+
+  return result;
+}
+
+sc_result sc_event_emit_impl(
+    sc_memory_context const * ctx,
+    sc_addr subscription_addr,
+    sc_event_type event_type_addr,
+    sc_addr connector_addr,
+    sc_type connector_type,
+    sc_addr other_addr,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr)
+{
+  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
+  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
+
+  // if table is empty, then do nothing
+  sc_result result = SC_RESULT_NO;
+  if (subscription_manager == null_ptr || subscription_manager->events_index == null_ptr
+      || emission_manager == null_ptr)
+    goto result;
+
+  // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
+  // lookup for all registered to specified sc-element events
+  sc_uint32 const epoch = sc_event_subscriptions_index_read_begin(subscription_manager->events_index);
+  result = _sc_event_emit_for_subscriptions(
+      subscription_manager,
+      emission_manager,
+      ctx->user_addr,
+      subscription_addr,
+      event_type_addr,
+      connector_addr,
+      connector_type,
+      other_addr,
+      callback,
+      event_addr);
+  sc_event_subscriptions_index_read_end(subscription_manager->events_index, epoch);
 
 result:
   return result;
 }
 
+void sc_event_emit_batch_impl(
+    sc_memory_context const * ctx,
+    sc_event_emit_params const * params,
+    sc_uint32 params_count)
+{
+  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
+  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
+
+  // if table is empty, then do nothing
+  if (params_count == 0 || subscription_manager == null_ptr || subscription_manager->events_index == null_ptr
+      || emission_manager == null_ptr)
+    return;
+
+  sc_uint32 const epoch = sc_event_subscriptions_index_read_begin(subscription_manager->events_index);
+  for (sc_uint32 i = 0; i < params_count; ++i)
+    _sc_event_emit_for_subscriptions(
+        subscription_manager,
+        emission_manager,
+        ctx->user_addr,
+        params[i].subscription_addr,
+        params[i].event_type_addr,
+        params[i].connector_addr,
+        params[i].connector_type,
+        params[i].other_addr,
+        null_ptr,
+        SC_ADDR_EMPTY);
+  sc_event_subscriptions_index_read_end(subscription_manager->events_index, epoch);
+}
+
 sc_bool sc_event_subscription_is_deletable(sc_event_subscription const * event_subscription)
 {
   return event_subscription->ref_count == SC_EVENT_REQUEST_DESTROY;
@@ -9,6 +9,7 @@
 #include "sc-core/sc-base/sc_allocator.h"
 
 #include "sc-store/sc-base/sc_monitor_table.h"
+#include "sc-store/sc-base/sc_monitor_private.h"
 
 #include "sc-store/sc_element.h"
 #include "sc-store/sc_storage.h"
@@ -220,9 +221,59 @@ void sc_iterator3_free(sc_iterator3 * it)
   sc_mem_free(it);
 }
 
-sc_addr _sc_iterator3_get_other_edge_incident_element(sc_element * el, sc_addr incident_element)
+sc_addr _sc_iterator3_get_other_edge_incident_element(sc_arc_info const * arc, sc_addr incident_element)
 {
-  return SC_ADDR_IS_EQUAL(incident_element, el->arc.end) ? el->arc.begin : el->arc.end;
+  return SC_ADDR_IS_EQUAL(incident_element, arc->end) ? arc->begin : arc->end;
+}
+
+/*! Acquires read monitor of sc-arc while read monitors of fixed sc-elements of iterator are acquired. Writers and
+ * iterators wait only for monitors following held ones in order of their identifiers, so they can't wait for each other
+ * in a cycle. The monitor of sc-arc preceding held monitors is only tried, and if it is busy, held monitors are released
+ * and all monitors are acquired again in order.
+ * @param arc_monitor Pointer to monitor of sc-arc, it differs from held monitors.
+ * @param monitor Pointer to held monitor.
+ * @param other_monitor Pointer to other held monitor or null_ptr, if only one monitor is held.
+ * @returns SC_FALSE, if held monitors were released, so sc-arc could be erased or reused meanwhile.
+ */
+sc_bool _sc_iterator3_acquire_arc_monitor(sc_monitor * arc_monitor, sc_monitor * monitor, sc_monitor * other_monitor)
+{
+  if (arc_monitor == null_ptr)
+    return SC_TRUE;
+
+  sc_uint32 held_id = monitor != null_ptr ? monitor->id : 0;
+  if (other_monitor != null_ptr)
+    held_id = sc_max(held_id, other_monitor->id);
+
+  if (arc_monitor->id > held_id)
+  {
+    sc_monitor_acquire_read(arc_monitor);
+    return SC_TRUE;
+  }
+
+  if (sc_monitor_try_acquire_read(arc_monitor))
+    return SC_TRUE;
+
+  sc_monitor_release_read_n(2, monitor, other_monitor);
+  sc_monitor_acquire_read_n(3, monitor, other_monitor, arc_monitor);
+  return SC_FALSE;
+}
+
+/*! Checks that sc-element is still sc-connector between fixed sc-elements of iterator. Empty sc-address matches any
+ * sc-element.
+ */
+sc_bool _sc_iterator3_is_arc_incident(sc_addr arc_addr, sc_element * el, sc_addr arc_begin, sc_addr arc_end)
+{
+  if ((el->flags.type & sc_type_connector_mask) == 0)
+    return SC_FALSE;
+
+  sc_arc_info const * arc = sc_storage_get_element_arc(arc_addr, el);
+  if ((SC_ADDR_IS_EMPTY(arc_begin) || SC_ADDR_IS_EQUAL(arc_begin, arc->begin))
+      && (SC_ADDR_IS_EMPTY(arc_end) || SC_ADDR_IS_EQUAL(arc_end, arc->end)))
+    return SC_TRUE;
+
+  return sc_type_has_subtype(el->flags.type, sc_type_common_edge)
+         && (SC_ADDR_IS_EMPTY(arc_begin) || SC_ADDR_IS_EQUAL(arc_begin, arc->end))
+         && (SC_ADDR_IS_EMPTY(arc_end) || SC_ADDR_IS_EQUAL(arc_end, arc->begin));
 }
 
 sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
@@ -234,7 +285,7 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
 
   sc_monitor * arc_monitor = null_ptr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_begin);
+  sc_monitor * monitor = sc_storage_get_element_monitor(arc_begin);
   sc_monitor_acquire_read(monitor);
 
   if (_sc_memory_context_check_local_and_global_permissions(
@@ -255,24 +306,25 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
   }
   else
   {
-    sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(arc_begin, it->results[1].addr);
-    if (is_not_same)
-    {
-      arc_monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, it->results[1].addr);
-      sc_monitor_acquire_read(arc_monitor);
-    }
+    arc_monitor = sc_storage_get_element_monitor(it->results[1].addr);
+    sc_bool const is_not_same = arc_monitor != monitor;
+    sc_bool const are_held =
+        is_not_same == SC_FALSE || _sc_iterator3_acquire_arc_monitor(arc_monitor, monitor, null_ptr);
 
     result = sc_storage_get_element_by_addr(it->results[1].addr, &el);
-    if (result != SC_RESULT_OK)
+    if (result != SC_RESULT_OK
+        || (are_held == SC_FALSE
+            && _sc_iterator3_is_arc_incident(it->results[1].addr, el, arc_begin, SC_ADDR_EMPTY) == SC_FALSE))
     {
       if (is_not_same)
         sc_monitor_release_read(arc_monitor);
       goto error;
     }
 
+    sc_arc_info const * arc = sc_storage_get_element_arc(it->results[1].addr, el);
     arc_addr = sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-                   ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.end) ? el->arc.next_end_out_arc : el->arc.next_begin_out_arc
-                   : el->arc.next_begin_out_arc;
+                   ? SC_ADDR_IS_EQUAL(arc_begin, arc->end) ? arc->next_end_out_arc : arc->next_begin_out_arc
+                   : arc->next_begin_out_arc;
 
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
@@ -281,25 +333,26 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
   // iterate through outgoing sc-arcs
   while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
   {
-    sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_addr);
-    if (is_not_same)
-    {
-      arc_monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_addr);
-      sc_monitor_acquire_read(arc_monitor);
-    }
+    arc_monitor = sc_storage_get_element_monitor(arc_addr);
+    sc_bool const is_not_same = arc_monitor != monitor;
+    sc_bool const are_held =
+        is_not_same == SC_FALSE || _sc_iterator3_acquire_arc_monitor(arc_monitor, monitor, null_ptr);
 
     result = sc_storage_get_element_by_addr(arc_addr, &el);
-    if (result != SC_RESULT_OK)
+    if (result != SC_RESULT_OK
+        || (are_held == SC_FALSE
+            && _sc_iterator3_is_arc_incident(arc_addr, el, arc_begin, SC_ADDR_EMPTY) == SC_FALSE))
     {
       if (is_not_same)
         sc_monitor_release_read(arc_monitor);
       goto error;
     }
 
+    sc_arc_info const * arc = sc_storage_get_element_arc(arc_addr, el);
     sc_addr next_out_arc =
         sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-            ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.end) ? el->arc.next_end_out_arc : el->arc.next_begin_out_arc
-            : el->arc.next_begin_out_arc;
+            ? SC_ADDR_IS_EQUAL(arc_begin, arc->end) ? arc->next_end_out_arc : arc->next_begin_out_arc
+            : arc->next_begin_out_arc;
 
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
@@ -321,8 +374,8 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
 
     sc_type arc_type = el->flags.type;
     sc_addr arc_end = sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-                          ? _sc_iterator3_get_other_edge_incident_element(el, arc_begin)
-                          : el->arc.end;
+                          ? _sc_iterator3_get_other_edge_incident_element(arc, arc_begin)
+                          : arc->end;
 
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
@@ -374,8 +427,8 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
 
   sc_monitor * arc_monitor = null_ptr;
 
-  sc_monitor * beg_monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_begin);
-  sc_monitor * end_monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_end);
+  sc_monitor * beg_monitor = sc_storage_get_element_monitor(arc_begin);
+  sc_monitor * end_monitor = sc_storage_get_element_monitor(arc_end);
   sc_monitor_acquire_read_n(2, beg_monitor, end_monitor);
 
   if (_sc_memory_context_check_local_and_global_permissions(
@@ -402,25 +455,25 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
   }
   else
   {
-    sc_bool const is_not_same =
-        SC_ADDR_IS_NOT_EQUAL(arc_begin, it->results[1].addr) && SC_ADDR_IS_NOT_EQUAL(arc_end, it->results[1].addr);
-    if (is_not_same)
-    {
-      arc_monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, it->results[1].addr);
-      sc_monitor_acquire_read(arc_monitor);
-    }
+    arc_monitor = sc_storage_get_element_monitor(it->results[1].addr);
+    sc_bool const is_not_same = arc_monitor != beg_monitor && arc_monitor != end_monitor;
+    sc_bool const are_held =
+        is_not_same == SC_FALSE || _sc_iterator3_acquire_arc_monitor(arc_monitor, beg_monitor, end_monitor);
 
     result = sc_storage_get_element_by_addr(it->results[1].addr, &el);
-    if (result != SC_RESULT_OK)
+    if (result != SC_RESULT_OK
+        || (are_held == SC_FALSE
+            && _sc_iterator3_is_arc_incident(it->results[1].addr, el, arc_begin, arc_end) == SC_FALSE))
     {
       if (is_not_same)
         sc_monitor_release_read(arc_monitor);
       goto error;
     }
 
+    sc_arc_info const * arc = sc_storage_get_element_arc(it->results[1].addr, el);
     arc_addr = sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-                   ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
-                   : el->arc.next_end_in_arc;
+                   ? SC_ADDR_IS_EQUAL(arc_end, arc->end) ? arc->next_end_in_arc : arc->next_begin_in_arc
+                   : arc->next_end_in_arc;
 
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
@@ -429,25 +482,26 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
   // trying to find incoming sc-arc, that created before iterator, and wasn't deleted
   while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
   {
-    sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_addr) && SC_ADDR_IS_NOT_EQUAL(arc_end, arc_addr);
-    if (is_not_same)
-    {
-      arc_monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_addr);
-      sc_monitor_acquire_read(arc_monitor);
-    }
+    arc_monitor = sc_storage_get_element_monitor(arc_addr);
+    sc_bool const is_not_same = arc_monitor != beg_monitor && arc_monitor != end_monitor;
+    sc_bool const are_held =
+        is_not_same == SC_FALSE || _sc_iterator3_acquire_arc_monitor(arc_monitor, beg_monitor, end_monitor);
 
     result = sc_storage_get_element_by_addr(arc_addr, &el);
-    if (result != SC_RESULT_OK)
+    if (result != SC_RESULT_OK
+        || (are_held == SC_FALSE
+            && _sc_iterator3_is_arc_incident(arc_addr, el, arc_begin, arc_end) == SC_FALSE))
     {
       if (is_not_same)
         sc_monitor_release_read(arc_monitor);
       goto error;
     }
 
+    sc_arc_info const * arc = sc_storage_get_element_arc(arc_addr, el);
     sc_addr next_in_arc =
         sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-            ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
-            : el->arc.next_end_in_arc;
+            ? SC_ADDR_IS_EQUAL(arc_end, arc->end) ? arc->next_end_in_arc : arc->next_begin_in_arc
+            : arc->next_end_in_arc;
 
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
@@ -470,8 +524,8 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
     sc_type arc_type = el->flags.type;
 
     sc_bool is_begin_same = sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-                                ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.begin) || SC_ADDR_IS_EQUAL(arc_begin, el->arc.end)
-                                : SC_ADDR_IS_EQUAL(arc_begin, el->arc.begin);
+                                ? SC_ADDR_IS_EQUAL(arc_begin, arc->begin) || SC_ADDR_IS_EQUAL(arc_begin, arc->end)
+                                : SC_ADDR_IS_EQUAL(arc_begin, arc->begin);
 
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
@@ -511,7 +565,7 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
 
   sc_monitor * arc_monitor;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_end);
+  sc_monitor * monitor = sc_storage_get_element_monitor(arc_end);
   sc_monitor_acquire_read(monitor);
 
   if (_sc_memory_context_check_local_and_global_permissions(
@@ -536,27 +590,28 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
   }
   else
   {
-    sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(arc_end, it->results[1].addr);
-    if (is_not_same)
-    {
-      arc_monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, it->results[1].addr);
-      sc_monitor_acquire_read(arc_monitor);
-    }
+    arc_monitor = sc_storage_get_element_monitor(it->results[1].addr);
+    sc_bool const is_not_same = arc_monitor != monitor;
+    sc_bool const are_held =
+        is_not_same == SC_FALSE || _sc_iterator3_acquire_arc_monitor(arc_monitor, monitor, null_ptr);
 
     result = sc_storage_get_element_by_addr(it->results[1].addr, &el);
-    if (result != SC_RESULT_OK)
+    if (result != SC_RESULT_OK
+        || (are_held == SC_FALSE
+            && _sc_iterator3_is_arc_incident(it->results[1].addr, el, SC_ADDR_EMPTY, arc_end) == SC_FALSE))
     {
       if (is_not_same)
         sc_monitor_release_read(arc_monitor);
       goto error;
     }
 
+    sc_arc_info const * arc = sc_storage_get_element_arc(it->results[1].addr, el);
     arc_addr = sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-                   ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
+                   ? SC_ADDR_IS_EQUAL(arc_end, arc->end) ? arc->next_end_in_arc : arc->next_begin_in_arc
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-                   : (search_structure ? el->arc.next_in_arc_from_structure : el->arc.next_end_in_arc);
+                   : (search_structure ? arc->next_in_arc_from_structure : arc->next_end_in_arc);
 #else
-                   : el->arc.next_end_in_arc;
+                   : arc->next_end_in_arc;
 #endif
 
     if (is_not_same)
@@ -566,28 +621,29 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
   // trying to find incoming sc-arc, that created before iterator, and wasn't deleted
   while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
   {
-    sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(arc_end, arc_addr);
-    if (is_not_same)
-    {
-      arc_monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_addr);
-      sc_monitor_acquire_read(arc_monitor);
-    }
+    arc_monitor = sc_storage_get_element_monitor(arc_addr);
+    sc_bool const is_not_same = arc_monitor != monitor;
+    sc_bool const are_held =
+        is_not_same == SC_FALSE || _sc_iterator3_acquire_arc_monitor(arc_monitor, monitor, null_ptr);
 
     result = sc_storage_get_element_by_addr(arc_addr, &el);
-    if (result != SC_RESULT_OK)
+    if (result != SC_RESULT_OK
+        || (are_held == SC_FALSE
+            && _sc_iterator3_is_arc_incident(arc_addr, el, SC_ADDR_EMPTY, arc_end) == SC_FALSE))
     {
       if (is_not_same)
         sc_monitor_release_read(arc_monitor);
       goto error;
     }
 
+    sc_arc_info const * arc = sc_storage_get_element_arc(arc_addr, el);
     sc_addr next_in_arc =
         sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-            ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
+            ? SC_ADDR_IS_EQUAL(arc_end, arc->end) ? arc->next_end_in_arc : arc->next_begin_in_arc
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-            : (search_structure ? el->arc.next_in_arc_from_structure : el->arc.next_end_in_arc);
+            : (search_structure ? arc->next_in_arc_from_structure : arc->next_end_in_arc);
 #else
-            : el->arc.next_end_in_arc;
+            : arc->next_end_in_arc;
 #endif
 
     if (_sc_memory_context_check_local_and_global_permissions(
@@ -610,8 +666,8 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
 
     sc_type arc_type = el->flags.type;
     sc_addr arc_begin = sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-                            ? _sc_iterator3_get_other_edge_incident_element(el, arc_end)
-                            : el->arc.begin;
+                            ? _sc_iterator3_get_other_edge_incident_element(arc, arc_end)
+                            : arc->begin;
 
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
@@ -655,7 +711,7 @@ sc_bool _sc_iterator3_a_f_a_next(sc_iterator3 * it)
 {
   sc_addr const arc_addr = it->results[1].addr = it->params[1].addr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(arc_addr);
   sc_monitor_acquire_read(monitor);
 
   sc_element * arc_el;
@@ -663,6 +719,8 @@ sc_bool _sc_iterator3_a_f_a_next(sc_iterator3 * it)
   if (result != SC_RESULT_OK)
     goto error;
 
+  sc_arc_info const * arc = sc_storage_get_element_arc(arc_addr, arc_el);
+
   if (_sc_memory_context_check_local_and_global_permissions(
           sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
       == SC_FALSE)
@@ -675,19 +733,19 @@ sc_bool _sc_iterator3_a_f_a_next(sc_iterator3 * it)
   it->results[1].is_accessed = SC_TRUE;
 
   if (_sc_memory_context_check_local_and_global_permissions(
-          sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_el->arc.begin)
+          sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc->begin)
       == SC_FALSE)
     goto success;
 
-  it->results[0].addr = arc_el->arc.begin;
+  it->results[0].addr = arc->begin;
   it->results[0].is_accessed = SC_TRUE;
 
   if (_sc_memory_context_check_local_and_global_permissions(
-          sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_el->arc.end)
+          sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc->end)
       == SC_FALSE)
     goto success;
 
-  it->results[2].addr = arc_el->arc.end;
+  it->results[2].addr = arc->end;
   it->results[2].is_accessed = SC_TRUE;
 
 success:
@@ -706,7 +764,7 @@ sc_bool _sc_iterator3_f_f_a_next(sc_iterator3 * it)
   sc_addr const arc_begin = it->results[0].addr = it->params[0].addr;
   sc_addr const arc_addr = it->results[1].addr = it->params[1].addr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(arc_addr);
   sc_monitor_acquire_read(monitor);
 
   sc_element * arc_el;
@@ -714,6 +772,8 @@ sc_bool _sc_iterator3_f_f_a_next(sc_iterator3 * it)
   if (result != SC_RESULT_OK)
     goto error;
 
+  sc_arc_info const * arc = sc_storage_get_element_arc(arc_addr, arc_el);
+
   if (_sc_memory_context_check_local_and_global_permissions(
           sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
       == SC_FALSE)
@@ -728,17 +788,17 @@ sc_bool _sc_iterator3_f_f_a_next(sc_iterator3 * it)
   sc_addr arc_end;
   if (sc_type_has_subtype(arc_el->flags.type, sc_type_common_edge))
   {
-    if (SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_el->arc.begin) && SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_el->arc.end))
+    if (SC_ADDR_IS_NOT_EQUAL(arc_begin, arc->begin) && SC_ADDR_IS_NOT_EQUAL(arc_begin, arc->end))
       goto error;
 
-    arc_end = _sc_iterator3_get_other_edge_incident_element(arc_el, arc_begin);
+    arc_end = _sc_iterator3_get_other_edge_incident_element(arc, arc_begin);
   }
   else
   {
-    if (SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_el->arc.begin))
+    if (SC_ADDR_IS_NOT_EQUAL(arc_begin, arc->begin))
       goto error;
 
-    arc_end = arc_el->arc.end;
+    arc_end = arc->end;
   }
 
   if (_sc_memory_context_check_local_and_global_permissions(
@@ -770,7 +830,7 @@ sc_bool _sc_iterator3_a_f_f_next(sc_iterator3 * it)
   sc_addr const arc_addr = it->results[1].addr = it->params[1].addr;
   sc_addr const arc_end = it->results[2].addr = it->params[2].addr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(arc_addr);
   sc_monitor_acquire_read(monitor);
 
   sc_element * arc_el;
@@ -778,6 +838,8 @@ sc_bool _sc_iterator3_a_f_f_next(sc_iterator3 * it)
   if (result != SC_RESULT_OK)
     goto error;
 
+  sc_arc_info const * arc = sc_storage_get_element_arc(arc_addr, arc_el);
+
   if (_sc_memory_context_check_local_and_global_permissions(
           sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
       == SC_FALSE)
@@ -792,17 +854,17 @@ sc_bool _sc_iterator3_a_f_f_next(sc_iterator3 * it)
   sc_addr arc_begin;
   if (sc_type_has_subtype(arc_el->flags.type, sc_type_common_edge))
   {
-    if (SC_ADDR_IS_NOT_EQUAL(arc_end, arc_el->arc.begin) && SC_ADDR_IS_NOT_EQUAL(arc_end, arc_el->arc.end))
+    if (SC_ADDR_IS_NOT_EQUAL(arc_end, arc->begin) && SC_ADDR_IS_NOT_EQUAL(arc_end, arc->end))
       goto error;
 
-    arc_begin = _sc_iterator3_get_other_edge_incident_element(arc_el, arc_end);
+    arc_begin = _sc_iterator3_get_other_edge_incident_element(arc, arc_end);
   }
   else
   {
-    if (SC_ADDR_IS_NOT_EQUAL(arc_end, arc_el->arc.end))
+    if (SC_ADDR_IS_NOT_EQUAL(arc_end, arc->end))
       goto error;
 
-    arc_begin = arc_el->arc.begin;
+    arc_begin = arc->begin;
   }
 
   if (_sc_memory_context_check_local_and_global_permissions(
@@ -835,7 +897,7 @@ sc_bool _sc_iterator3_f_f_f_next(sc_iterator3 * it)
   sc_addr const arc_addr = it->results[1].addr = it->params[1].addr;
   sc_addr const arc_end = it->results[2].addr = it->params[2].addr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, arc_addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(arc_addr);
   sc_monitor_acquire_read(monitor);
 
   sc_element * arc_el;
@@ -843,6 +905,8 @@ sc_bool _sc_iterator3_f_f_f_next(sc_iterator3 * it)
   if (result != SC_RESULT_OK)
     goto error;
 
+  sc_arc_info const * arc = sc_storage_get_element_arc(arc_addr, arc_el);
+
   if (_sc_memory_context_check_local_and_global_permissions(
           sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
       == SC_FALSE)
@@ -856,18 +920,18 @@ sc_bool _sc_iterator3_f_f_f_next(sc_iterator3 * it)
 
   if (sc_type_has_subtype(arc_el->flags.type, sc_type_common_edge))
   {
-    if (SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_el->arc.begin) && SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_el->arc.end))
+    if (SC_ADDR_IS_NOT_EQUAL(arc_begin, arc->begin) && SC_ADDR_IS_NOT_EQUAL(arc_begin, arc->end))
       goto error;
 
-    if (SC_ADDR_IS_NOT_EQUAL(arc_end, arc_el->arc.begin) && SC_ADDR_IS_NOT_EQUAL(arc_end, arc_el->arc.end))
+    if (SC_ADDR_IS_NOT_EQUAL(arc_end, arc->begin) && SC_ADDR_IS_NOT_EQUAL(arc_end, arc->end))
       goto error;
   }
   else
   {
-    if (SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_el->arc.begin))
+    if (SC_ADDR_IS_NOT_EQUAL(arc_begin, arc->begin))
       goto error;
 
-    if (SC_ADDR_IS_NOT_EQUAL(arc_end, arc_el->arc.end))
+    if (SC_ADDR_IS_NOT_EQUAL(arc_end, arc->end))
       goto error;
   }
 
@@ -6,17 +6,61 @@
 
 #include "sc_segment.h"
 
+#include <glib.h>
+
 #include "sc-core/sc-base/sc_allocator.h"
 
 #include "sc_element.h"
 
+void _sc_segment_init_elements_monitors(sc_segment * segment)
+{
+  // Monitors ids are unique among all segments, so monitors of sc-elements are acquired in the same order by all
+  // threads.
+  sc_uint32 const first_monitor_id = (sc_uint32)segment->num * SC_SEGMENT_ELEMENTS_MONITORS_COUNT;
+  for (sc_uint32 i = 0; i < SC_SEGMENT_ELEMENTS_MONITORS_COUNT; ++i)
+  {
+    sc_monitor_init(&segment->elements_monitors[i]);
+    segment->elements_monitors[i].id = first_monitor_id + i + 1;
+  }
+}
+
 sc_segment * sc_segment_new(sc_addr_seg num)
 {
   sc_segment * segment = sc_mem_new(sc_segment, 1);
+  segment->elements = sc_mem_new(sc_element, SC_SEGMENT_ELEMENTS_COUNT);
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  // records are zeroed on allocation, so pages of not taken records aren't backed by memory until they are taken
+  segment->arcs = sc_mem_new(sc_arc_info, SC_SEGMENT_ELEMENTS_COUNT);
+  segment->last_engaged_arc_index = 0;
+  segment->last_released_arc_index = 0;
+#endif
   segment->num = num;
   segment->last_engaged_offset = 0;
   segment->last_released_offset = 0;
+  segment->is_mapped = SC_FALSE;
+  segment->is_changed = SC_TRUE;
   sc_monitor_init(&segment->monitor);
+  _sc_segment_init_elements_monitors(segment);
+
+  return segment;
+}
+
+sc_segment * sc_segment_new_mapped(sc_addr_seg num, sc_element * elements)
+{
+  sc_segment * segment = sc_mem_new(sc_segment, 1);
+  segment->elements = elements;
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  segment->arcs = null_ptr;
+  segment->last_engaged_arc_index = 0;
+  segment->last_released_arc_index = 0;
+#endif
+  segment->num = num;
+  segment->last_engaged_offset = 0;
+  segment->last_released_offset = 0;
+  segment->is_mapped = SC_TRUE;
+  segment->is_changed = SC_FALSE;
+  sc_monitor_init(&segment->monitor);
+  _sc_segment_init_elements_monitors(segment);
 
   return segment;
 }
@@ -24,9 +68,90 @@ sc_segment * sc_segment_new(sc_addr_seg num)
 void sc_segment_free(sc_segment * segment)
 {
   sc_monitor_destroy(&segment->monitor);
+  for (sc_uint32 i = 0; i < SC_SEGMENT_ELEMENTS_MONITORS_COUNT; ++i)
+    sc_monitor_destroy(&segment->elements_monitors[i]);
+  if (segment->is_mapped == SC_FALSE)
+  {
+    sc_mem_free(segment->elements);
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+    sc_mem_free(segment->arcs);
+#endif
+  }
   sc_mem_free(segment);
 }
 
+sc_monitor * sc_segment_get_element_monitor(sc_segment * segment, sc_addr_offset offset)
+{
+  return &segment->elements_monitors[offset & (SC_SEGMENT_ELEMENTS_MONITORS_COUNT - 1)];
+}
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+sc_addr_offset sc_segment_allocate_arc(sc_segment * segment)
+{
+  sc_addr_offset arc_index = segment->last_released_arc_index;
+  if (arc_index == 0)
+    return ++segment->last_engaged_arc_index;
+
+  // released records are linked by offsets of their begin sc-addresses
+  segment->last_released_arc_index = segment->arcs[arc_index].begin.offset;
+  segment->arcs[arc_index] = (sc_arc_info){0};
+  return arc_index;
+}
+
+void sc_segment_release_arc(sc_segment * segment, sc_addr_offset arc_index)
+{
+  if (arc_index == 0)
+    return;
+
+  segment->arcs[arc_index] = (sc_arc_info){.begin = {.offset = segment->last_released_arc_index}};
+  segment->last_released_arc_index = arc_index;
+}
+#endif
+
+void sc_segment_mark_changed(sc_segment * segment)
+{
+  g_atomic_int_set(&segment->is_changed, SC_TRUE);
+}
+
+sc_bool sc_segment_is_changed(sc_segment * segment)
+{
+  return g_atomic_int_get(&segment->is_changed) != SC_FALSE;
+}
+
+void sc_segment_reset_changed(sc_segment * segment)
+{
+  g_atomic_int_set(&segment->is_changed, SC_FALSE);
+}
+
+void sc_segment_restore_free_offsets(
+    sc_element * elements,
+    sc_addr_offset * last_engaged_offset,
+    sc_addr_offset * last_released_offset)
+{
+  sc_addr_offset engaged_offset = *last_engaged_offset;
+  for (; engaged_offset != 0 && (elements[engaged_offset].flags.states & SC_STATE_ELEMENT_EXIST) == 0; --engaged_offset)
+  {
+    if (elements[engaged_offset].flags.type != 0)
+      elements[engaged_offset].flags.type = 0;
+  }
+
+  // links are written only if they differ, so pages of not changed sc-elements aren't copied in mapped image
+  sc_addr_offset released_offset = 0;
+  for (sc_addr_offset offset = engaged_offset; offset != 0; --offset)
+  {
+    sc_element * element = &elements[offset];
+    if ((element->flags.states & SC_STATE_ELEMENT_EXIST) == SC_STATE_ELEMENT_EXIST)
+      continue;
+
+    if (element->flags.type != released_offset)
+      element->flags.type = released_offset;
+    released_offset = offset;
+  }
+
+  *last_engaged_offset = engaged_offset;
+  *last_released_offset = released_offset;
+}
+
 void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat)
 {
   for (sc_addr_offset i = 0; i < seg->last_engaged_offset; ++i)
@@ -18,16 +18,29 @@
 #include "sc-store/sc-base/sc_monitor_private.h"
 
 #define SC_SEG_ELEMENTS_SIZE_BYTE (sizeof(sc_element) * SC_SEGMENT_ELEMENTS_COUNT)
+#define SC_SEG_ARCS_SIZE_BYTE (sizeof(sc_arc_info) * SC_SEGMENT_ELEMENTS_COUNT)
+
+//! Count of monitors striping sc-elements of segment, must be a power of 2
+#define SC_SEGMENT_ELEMENTS_MONITORS_COUNT 1024
 
 /*! Structure for segment storing
  */
 struct _sc_segment
 {
-  sc_element elements[SC_SEGMENT_ELEMENTS_COUNT];
+  sc_element * elements;               // sc-elements of the segment, allocated or mapped from segments file
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  sc_arc_info * arcs;                      // sc-connectors records of the segment, record 0 is empty record of sc-nodes
+  sc_addr_offset last_engaged_arc_index;   // index of the last sc-connector record taken from the segment
+  sc_addr_offset last_released_arc_index;  // index of the last released sc-connector record
+#endif
   sc_addr_seg num;                     // number of this segment in memory
   sc_addr_offset last_engaged_offset;  // number of sc-element in the segment
   sc_addr_offset last_released_offset;
+  sc_bool is_mapped;  // SC_TRUE, if `elements` points into memory-mapped segments file and mustn't be freed
+  sc_int32 is_changed;  // non-zero, if sc-elements of the segment changed since the last full dump of segments
   sc_monitor monitor;
+  sc_monitor elements_monitors[SC_SEGMENT_ELEMENTS_MONITORS_COUNT];  // sc-element with offset i is locked by monitor
+                                                                     // i % SC_SEGMENT_ELEMENTS_MONITORS_COUNT
 };
 
 /*! Create new segment with specified size.
@@ -35,8 +48,80 @@ struct _sc_segment
  */
 sc_segment * sc_segment_new(sc_addr_seg num);
 
+/*! Create new segment over sc-elements image mapped from segments file.
+ * @param num Number of created instance in sc-memory
+ * @param elements Pointer to the first of SC_SEGMENT_ELEMENTS_COUNT mapped sc-elements
+ * @remarks Pages of the image are faulted in on first access to its sc-elements. In compact sc-elements layout,
+ * `arcs` of created segment must be set to mapped sc-connectors records.
+ */
+sc_segment * sc_segment_new_mapped(sc_addr_seg num, sc_element * elements);
+
 void sc_segment_free(sc_segment * segment);
 
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+//! Gets sc-connector record of sc-element of segment
+#  define sc_segment_get_element_arc(segment, element) (&(segment)->arcs[(element)->arc_index])
+
+/*! Takes sc-connector record from segment.
+ * @param segment Pointer to segment of sc-connector
+ * @returns Index of empty sc-connector record.
+ * @remarks Call it while segment is locked. Released records are taken first, so taken records are dense and pages of
+ * not taken records aren't touched.
+ */
+sc_addr_offset sc_segment_allocate_arc(sc_segment * segment);
+
+/*! Releases sc-connector record of segment.
+ * @param segment Pointer to segment of sc-connector
+ * @param arc_index Index of released sc-connector record, it is ignored if it is 0
+ * @remarks Call it while segment is locked.
+ */
+void sc_segment_release_arc(sc_segment * segment, sc_addr_offset arc_index);
+#else
+#  define sc_segment_get_element_arc(segment, element) (&(element)->arc)
+#endif
+
+/*! Gets monitor locking sc-element of segment.
+ * @param segment Pointer to segment of sc-element
+ * @param offset Offset of sc-element in segment
+ * @returns Pointer to monitor shared by every SC_SEGMENT_ELEMENTS_MONITORS_COUNT-th sc-element of segment.
+ * @remarks Different sc-elements can be locked by the same monitor. Compare monitors, not sc-addresses, before
+ * acquiring monitor of one sc-element while monitor of another sc-element is held.
+ */
+sc_monitor * sc_segment_get_element_monitor(sc_segment * segment, sc_addr_offset offset);
+
+/*! Marks segment as changed since the last full dump of sc-memory segments.
+ * @param segment Pointer to changed segment
+ * @remarks Call it after sc-elements of the segment are changed: a dump running concurrently either copies
+ * these changes or finds the segment changed on the next dump.
+ */
+void sc_segment_mark_changed(sc_segment * segment);
+
+/*! Checks if segment changed since the last full dump of sc-memory segments.
+ * @param segment Pointer to segment to check
+ * @returns SC_TRUE, if segment changed.
+ */
+sc_bool sc_segment_is_changed(sc_segment * segment);
+
+/*! Clears changes mark of segment before it is dumped.
+ * @param segment Pointer to segment to dump
+ * @remarks Call it before sc-elements of the segment are copied to be dumped.
+ */
+void sc_segment_reset_changed(sc_segment * segment);
+
+/*! Restores free offsets of sc-elements image of segment from existing sc-elements.
+ * @param elements Pointer to the first of SC_SEGMENT_ELEMENTS_COUNT sc-elements of image
+ * @param last_engaged_offset Pointer to the last engaged offset of image, it is set to offset of the last existing
+ * sc-element
+ * @param last_released_offset Pointer to the last released offset of image, it is set to the first of not existing
+ * sc-elements before the last engaged offset
+ * @remarks Offsets reserved by threads caches aren't taken by sc-elements yet, so they are free in restored image.
+ * Only free-list links of not existing sc-elements are changed.
+ */
+void sc_segment_restore_free_offsets(
+    sc_element * elements,
+    sc_addr_offset * last_engaged_offset,
+    sc_addr_offset * last_released_offset);
+
 //! Collects segment elements statistics
 void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat);
 
@@ -17,6 +17,8 @@
 #include "sc_segment.h"
 #include "sc_element.h"
 
+#include "sc-base/sc_thread.h"
+
 #include "sc-fs-memory/sc_fs_memory.h"
 
 #include "sc_storage_private.h"
@@ -24,47 +26,104 @@
 
 sc_storage * storage = null_ptr;
 
+// Each thread generates sc-elements from its cache of free offsets of a segment, which it takes in bulk. So threads
+// lock shared sc-storage structures once per SC_STORAGE_THREAD_CACHE_OFFSETS_COUNT generated sc-elements. Caches are
+// owned by sc-storage and are found by threads without locks, until sc-storage generation is changed on its
+// initialization or shutdown. Cache of thread is released on its exit.
+static sc_int32 storage_generation = 0;
+static _Thread_local sc_storage_thread_cache * thread_cache = null_ptr;
+static _Thread_local sc_int32 thread_cache_storage_generation = 0;
+
+void _sc_storage_release_thread_cache(sc_pointer data);
+static sc_thread_local thread_cache_key = SC_THREAD_LOCAL_INIT(_sc_storage_release_thread_cache);
+
+void _sc_storage_flush_threads_caches();
+void _sc_storage_restore_free_offsets();
+
 sc_result sc_storage_initialize(sc_memory_params const * params)
 {
   if (sc_fs_memory_initialize_ext(params) != SC_FS_MEMORY_OK)
     return SC_RESULT_ERROR;
 
   storage = sc_mem_new(sc_storage, 1);
+  g_atomic_int_inc(&storage_generation);
   storage->max_segments_count = params->max_loaded_segments;
   storage->segments_count = 0;
   storage->last_not_engaged_segment_num = 0;
   storage->last_released_segment_num = 0;
   storage->segments = sc_mem_new(sc_segment *, params->max_loaded_segments);
   sc_monitor_init(&storage->segments_monitor);
-  _sc_monitor_table_init(&storage->addr_monitors_table);
 
   sc_memory_info("Sc-memory configuration:");
   sc_message("\tClean on initialize: %s", params->clear ? "On" : "Off");
   sc_message("\tSc-element size: %zd", sizeof(sc_element));
-  sc_message("\tSc-segment size: %zd", sizeof(sc_segment));
+  sc_message("\tSc-segment size: %zd", sizeof(sc_segment) + SC_SEG_ELEMENTS_SIZE_BYTE);
   sc_message("\tSc-segment elements count: %d", SC_SEGMENT_ELEMENTS_COUNT);
   sc_message("\tSc-storage size: %zd", sizeof(sc_storage));
   sc_message("\tMax segments count: %d", storage->max_segments_count);
 
-  storage->processes_segments_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  // caches are keyed by themselves, so exited thread removes its cache without knowing its sc-thread
+  storage->processes_caches_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, sc_mem_free);
   sc_monitor_init(&storage->processes_monitor);
 
+  sc_storage_wal_initialize(&storage->wal, params);
+  sc_storage_link_contents_cache_initialize(&storage->link_contents_cache, params);
+
   sc_result result = SC_TRUE;
-  if (params->clear == SC_FALSE)
-  {
-    sc_monitor_acquire_write(&storage->segments_monitor);
+  sc_monitor_acquire_write(&storage->segments_monitor);
+  // cleared repo is loaded, if bundle is extracted into it
+  if (params->clear == SC_FALSE || params->bundle != null_ptr)
     result = sc_fs_memory_load(storage) == SC_FS_MEMORY_OK;
-    sc_monitor_release_write(&storage->segments_monitor);
-  }
+  // changes made after the last save are replayed over loaded sc-memory segments
+  if (result == SC_TRUE)
+    result = sc_storage_wal_open(storage->wal, storage) == SC_RESULT_OK;
+  if (result == SC_TRUE)
+    _sc_storage_restore_free_offsets();
+  sc_monitor_release_write(&storage->segments_monitor);
 
   sc_storage_dump_manager_initialize(&storage->dump_manager, params);
 
   sc_event_subscription_manager_initialize(&storage->events_subscription_manager);
-  sc_event_emission_manager_initialize(&storage->events_emission_manager, params);
+  if (sc_event_emission_manager_initialize(&storage->events_emission_manager, params) != SC_RESULT_OK)
+    result = SC_FALSE;
 
   return result;
 }
 
+// Offsets reserved by threads caches are logged as engaged. So free offsets of sc-segments changed after the last save
+// are restored, the others are restored on save. Sc-segments with free offsets are listed as released again.
+void _sc_storage_restore_free_offsets()
+{
+  storage->last_released_segment_num = 0;
+  for (sc_addr_seg num = storage->segments_count; num != 0; --num)
+  {
+    sc_segment * segment = storage->segments[num - 1];
+    if (segment == null_ptr)
+      continue;
+
+    if (sc_segment_is_changed(segment))
+      sc_segment_restore_free_offsets(
+          segment->elements, &segment->last_engaged_offset, &segment->last_released_offset);
+
+    if (segment->last_released_offset == 0)
+      continue;
+
+    if (segment->elements[0].flags.type != storage->last_released_segment_num)
+      segment->elements[0].flags.type = storage->last_released_segment_num;
+    storage->last_released_segment_num = num;
+  }
+}
+
+sc_result _sc_storage_save(sc_fs_memory_status (*save)(sc_storage * storage))
+{
+  // write-ahead log records made before the save are removed after it
+  sc_storage_wal_start_checkpoint(storage->wal);
+  sc_bool const is_saved = save(storage) == SC_FS_MEMORY_OK;
+  sc_storage_wal_finish_checkpoint(storage->wal, is_saved);
+
+  return is_saved ? SC_RESULT_OK : SC_RESULT_ERROR;
+}
+
 sc_result sc_storage_shutdown(sc_bool save_state)
 {
   if (storage == null_ptr)
@@ -78,12 +137,17 @@ sc_result sc_storage_shutdown(sc_bool save_state)
 
   sc_storage_dump_manager_shutdown(storage->dump_manager);
 
+  _sc_storage_flush_threads_caches();
+
   if (save_state == SC_TRUE)
   {
-    if (sc_fs_memory_save(storage) != SC_FS_MEMORY_OK)
+    if (_sc_storage_save(sc_fs_memory_save) != SC_RESULT_OK)
       return SC_RESULT_ERROR;
   }
 
+  sc_storage_wal_shutdown(storage->wal);
+  storage->wal = null_ptr;
+
 error:
   if (sc_fs_memory_shutdown() != SC_FS_MEMORY_OK)
     return SC_RESULT_ERROR;
@@ -93,12 +157,14 @@ error:
 
   sc_monitor_acquire_write(&storage->processes_monitor);
 
-  if (storage->processes_segments_table != null_ptr)
+  if (storage->processes_caches_table != null_ptr)
   {
-    sc_hash_table_destroy(storage->processes_segments_table);
-    storage->processes_segments_table = null_ptr;
+    sc_hash_table_destroy(storage->processes_caches_table);
+    storage->processes_caches_table = null_ptr;
   }
 
+  g_atomic_int_inc(&storage_generation);
+
   sc_monitor_release_write(&storage->processes_monitor);
   sc_monitor_destroy(&storage->processes_monitor);
 
@@ -116,7 +182,7 @@ error:
 
   sc_mem_free(storage->segments);
   sc_monitor_destroy(&storage->segments_monitor);
-  _sc_monitor_table_destroy(&storage->addr_monitors_table);
+  sc_storage_link_contents_cache_shutdown(storage->link_contents_cache);
   sc_mem_free(storage);
   storage = null_ptr;
 
@@ -143,6 +209,11 @@ sc_event_subscription_manager * sc_storage_get_event_subscription_manager()
   return storage ? storage->events_subscription_manager : null_ptr;
 }
 
+sc_storage_link_contents_cache * sc_storage_get_link_contents_cache()
+{
+  return storage ? storage->link_contents_cache : null_ptr;
+}
+
 sc_bool sc_storage_is_element(sc_memory_context const * ctx, sc_addr addr)
 {
   sc_element * el = null_ptr;
@@ -173,24 +244,187 @@ error:
   return result;
 }
 
-sc_result sc_storage_free_element(sc_addr addr)
+sc_monitor * sc_storage_get_element_monitor(sc_addr addr)
 {
-  sc_result result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+  if (storage == null_ptr || addr.seg == 0 || addr.offset == 0 || addr.seg > storage->max_segments_count)
+    return null_ptr;
 
-  sc_element * element;
-  if (sc_storage_get_element_by_addr(addr, &element) != SC_RESULT_OK)
-    goto error;
+  sc_segment * segment = storage->segments[addr.seg - 1];
+  if (segment == null_ptr)
+    return null_ptr;
+
+  return sc_segment_get_element_monitor(segment, addr.offset);
+}
+
+sc_arc_info * sc_storage_get_element_arc(sc_addr addr, sc_element * element)
+{
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  return sc_segment_get_element_arc(storage->segments[addr.seg - 1], element);
+#else
+  return &element->arc;
+#endif
+}
+
+// Monitors of sc-elements are striped, so sc-element can be locked by one of already held monitors
+sc_monitor * _sc_storage_get_not_held_element_monitor(
+    sc_addr addr,
+    sc_monitor * first_held_monitor,
+    sc_monitor * second_held_monitor)
+{
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
+  return monitor == first_held_monitor || monitor == second_held_monitor ? null_ptr : monitor;
+}
+
+#ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
+#  define SC_STORAGE_ADJACENT_ERASED_CONNECTORS_COUNT 6
+#  define SC_STORAGE_GENERATED_CONNECTOR_CHANGED_ELEMENTS_COUNT 8
+#else
+#  define SC_STORAGE_ADJACENT_ERASED_CONNECTORS_COUNT 4
+#  define SC_STORAGE_GENERATED_CONNECTOR_CHANGED_ELEMENTS_COUNT 7
+#endif
+
+sc_uint32 _sc_storage_get_monitor_id(sc_monitor const * monitor)
+{
+  return monitor == null_ptr ? 0 : monitor->id;
+}
+
+int _sc_storage_compare_monitors(void const * a, void const * b)
+{
+  sc_uint32 const first_id = _sc_storage_get_monitor_id(*(sc_monitor * const *)a);
+  sc_uint32 const second_id = _sc_storage_get_monitor_id(*(sc_monitor * const *)b);
+  return first_id < second_id ? -1 : first_id > second_id;
+}
+
+/*! Acquires write monitors of sc-connectors adjacent to changed one in lists of its begin and end sc-elements, while
+ * their write monitors are held. Monitors following held ones in order of identifiers are waited for, preceding ones
+ * are only tried, because their holders can wait for held monitors. So writers and iterators never wait in a cycle.
+ * @param beg_monitor Pointer to held monitor of begin sc-element.
+ * @param end_monitor Pointer to held monitor of end sc-element.
+ * @param count Number of monitors.
+ * @param monitors Monitors not equal to held ones, null_ptr items are skipped. They are sorted and deduplicated in
+ * place, so they are released by _sc_storage_release_adjacent_monitors in reverse order.
+ * @returns Pointer to busy monitor, if it can't be acquired without waiting, then no monitors are acquired. Caller
+ * releases held monitors and waits for busy monitor before it tries again.
+ */
+sc_monitor * _sc_storage_acquire_adjacent_monitors(
+    sc_monitor * beg_monitor,
+    sc_monitor * end_monitor,
+    sc_uint32 count,
+    sc_monitor ** monitors)
+{
+  qsort(monitors, count, sizeof(sc_monitor *), _sc_storage_compare_monitors);
+  for (sc_uint32 i = 1; i < count; ++i)
+  {
+    if (monitors[i] == monitors[i - 1])
+      monitors[i - 1] = null_ptr;
+  }
+
+  sc_uint32 const held_id = sc_max(_sc_storage_get_monitor_id(beg_monitor), _sc_storage_get_monitor_id(end_monitor));
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (monitors[i] == null_ptr)
+      continue;
+
+    if (monitors[i]->id > held_id)
+      sc_monitor_acquire_write(monitors[i]);
+    else if (sc_monitor_try_acquire_write(monitors[i]) == SC_FALSE)
+    {
+      for (sc_uint32 j = 0; j < i; ++j)
+        sc_monitor_release_write(monitors[j]);
+      return monitors[i];
+    }
+  }
+
+  return null_ptr;
+}
+
+void _sc_storage_release_adjacent_monitors(sc_uint32 count, sc_monitor ** monitors)
+{
+  for (sc_uint32 i = count; i > 0; --i)
+    sc_monitor_release_write(monitors[i - 1]);
+}
+
+// Busy monitor is waited for after held monitors are released, so its holder can acquire them
+void _sc_storage_wait_for_monitor(sc_monitor * monitor)
+{
+  sc_monitor_acquire_write(monitor);
+  sc_monitor_release_write(monitor);
+}
+
+// Changes are written to write-ahead log and marked for the next dump after they are made. Offset of sc-address can be
+// 0 for service sc-element of sc-segment.
+void _sc_storage_mark_element_changed(sc_addr addr)
+{
+  if (SC_ADDR_IS_EMPTY(addr) || addr.seg > storage->max_segments_count)
+    return;
 
-  sc_monitor_acquire_read(&storage->segments_monitor);
   sc_segment * segment = storage->segments[addr.seg - 1];
-  sc_monitor_release_read(&storage->segments_monitor);
   if (segment == null_ptr)
-    goto error;
+    return;
+
+  sc_element const * element = &segment->elements[addr.offset];
+  sc_storage_wal_write_element(storage->wal, addr, element);
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  if (element->arc_index != 0)
+    sc_storage_wal_write_arc(storage->wal, segment, element->arc_index);
+#endif
+  sc_segment_mark_changed(segment);
+}
 
+// Images of sc-elements changed by one operation are written to write-ahead log by one record, so replay doesn't
+// restore a part of the operation. All sc-elements must be locked by caller.
+void _sc_storage_mark_elements_changed(sc_uint32 count, sc_addr const * addrs)
+{
+  sc_storage_wal_operation operation;
+  sc_storage_wal_start_operation(storage->wal, &operation);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_addr const addr = addrs[i];
+    if (SC_ADDR_IS_EMPTY(addr) || addr.seg > storage->max_segments_count)
+      continue;
+
+    // the same sc-element can be changed twice, for example, by generation of loop sc-connector
+    sc_bool is_marked = SC_FALSE;
+    for (sc_uint32 j = 0; j < i && is_marked == SC_FALSE; ++j)
+      is_marked = SC_ADDR_IS_EQUAL(addrs[j], addr);
+
+    sc_segment * segment = storage->segments[addr.seg - 1];
+    if (is_marked || segment == null_ptr)
+      continue;
+
+    sc_element const * element = &segment->elements[addr.offset];
+    sc_storage_wal_operation_write_element(&operation, addr, element);
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+    if (element->arc_index != 0)
+      sc_storage_wal_operation_write_arc(&operation, segment, element->arc_index);
+#endif
+    sc_segment_mark_changed(segment);
+  }
+
+  sc_storage_wal_finish_operation(&operation);
+}
+
+void _sc_storage_mark_segment_changed(sc_segment * segment)
+{
+  sc_storage_wal_write_segment(storage->wal, segment);
+  sc_segment_mark_changed(segment);
+}
+
+void _sc_storage_release_offset(sc_segment * segment, sc_addr_offset offset)
+{
   sc_monitor_acquire_write(&segment->monitor);
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  sc_addr_offset const arc_index = segment->elements[offset].arc_index;
+  sc_segment_release_arc(segment, arc_index);
+  if (arc_index != 0)
+    sc_storage_wal_write_arc(storage->wal, segment, arc_index);
+#endif
   sc_addr_offset const last_released_offset = segment->last_released_offset;
-  segment->elements[addr.offset] = (sc_element){(sc_element_flags){.type = last_released_offset}};
-  segment->last_released_offset = addr.offset;
+  segment->elements[offset] = (sc_element){(sc_element_flags){.type = last_released_offset}};
+  segment->last_released_offset = offset;
+  _sc_storage_mark_element_changed((sc_addr){segment->num, offset});
+  _sc_storage_mark_segment_changed(segment);
   sc_monitor_release_write(&segment->monitor);
 
   if (last_released_offset == 0)
@@ -198,8 +432,27 @@ sc_result sc_storage_free_element(sc_addr addr)
     sc_monitor_acquire_write(&storage->segments_monitor);
     segment->elements[0].flags.type = storage->last_released_segment_num;
     storage->last_released_segment_num = segment->num;
+    _sc_storage_mark_element_changed((sc_addr){segment->num, 0});
+    sc_storage_wal_write_storage(storage->wal, storage);
     sc_monitor_release_write(&storage->segments_monitor);
   }
+}
+
+sc_result sc_storage_free_element(sc_addr addr)
+{
+  sc_result result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+
+  sc_element * element;
+  if (sc_storage_get_element_by_addr(addr, &element) != SC_RESULT_OK)
+    goto error;
+
+  sc_monitor_acquire_read(&storage->segments_monitor);
+  sc_segment * segment = storage->segments[addr.seg - 1];
+  sc_monitor_release_read(&storage->segments_monitor);
+  if (segment == null_ptr)
+    goto error;
+
+  _sc_storage_release_offset(segment, addr.offset);
 
   result = SC_RESULT_OK;
 error:
@@ -220,6 +473,8 @@ sc_segment * _sc_storage_get_last_not_engaged_segment()
     {
       storage->last_not_engaged_segment_num = segment->elements[0].flags.states;
       segment->elements[0].flags.states = 0;
+      _sc_storage_mark_element_changed((sc_addr){segment->num, 0});
+      sc_storage_wal_write_storage(storage->wal, storage);
     }
   }
   while (segment != null_ptr
@@ -236,6 +491,7 @@ sc_segment * _sc_storage_get_new_segment()
 
   segment = storage->segments[storage->segments_count] = sc_segment_new(storage->segments_count + 1);
   ++storage->segments_count;
+  sc_storage_wal_write_storage(storage->wal, storage);
 
 error:
   return segment;
@@ -261,159 +517,202 @@ error:
   return segment;
 }
 
-void _sc_storage_check_segment_type(sc_segment ** segment)
+sc_storage_thread_cache * _sc_storage_get_thread_cache()
 {
-  sc_monitor_acquire_read(&(*segment)->monitor);
-  sc_addr_offset last_released_offset = (*segment)->last_released_offset;
-  sc_addr_offset last_engaged_offset = (*segment)->last_engaged_offset;
-  sc_monitor_release_read(&(*segment)->monitor);
+  if (thread_cache_storage_generation == g_atomic_int_get(&storage_generation))
+    return thread_cache;
 
-  if (last_released_offset != 0)
-    return;
-  else if (last_engaged_offset + 1 == SC_SEGMENT_ELEMENTS_COUNT)
-    *segment = null_ptr;
+  sc_storage_thread_cache * cache = null_ptr;
+
+  sc_monitor_acquire_write(&storage->processes_monitor);
+  if (storage->processes_caches_table == null_ptr)
+    goto end;
+
+  cache = sc_mem_new(sc_storage_thread_cache, 1);
+  sc_hash_table_insert(storage->processes_caches_table, cache, cache);
+
+  thread_cache = cache;
+  thread_cache_storage_generation = g_atomic_int_get(&storage_generation);
+  sc_thread_local_set(&thread_cache_key, cache);
+
+end:
+  sc_monitor_release_write(&storage->processes_monitor);
+  return cache;
 }
 
-sc_segment * _sc_storage_get_segment()
+void _sc_storage_fill_thread_cache_from_segment(sc_storage_thread_cache * cache, sc_segment * segment)
 {
-  sc_segment * segment = null_ptr;
-  sc_thread * thread = sc_thread_self();
+  sc_monitor_acquire_write(&segment->monitor);
 
-  sc_monitor_acquire_read(&storage->processes_monitor);
+  while (cache->offsets_count < SC_STORAGE_THREAD_CACHE_OFFSETS_COUNT
+         && segment->last_engaged_offset + 1 != SC_SEGMENT_ELEMENTS_COUNT)
+    cache->offsets[cache->offsets_count++] = ++segment->last_engaged_offset;
 
-  if (storage->processes_segments_table != null_ptr)
-    segment = (sc_segment *)sc_hash_table_get(storage->processes_segments_table, thread);
+  while (cache->offsets_count < SC_STORAGE_THREAD_CACHE_OFFSETS_COUNT && segment->last_released_offset != 0)
+  {
+    sc_addr_offset const element_offset = segment->last_released_offset;
+    sc_element * element = &segment->elements[element_offset];
+    segment->last_released_offset = element->flags.type;
+    element->flags.type = 0;
+    cache->offsets[cache->offsets_count++] = element_offset;
+  }
 
-  sc_monitor_release_read(&storage->processes_monitor);
+  _sc_storage_mark_segment_changed(segment);
+  sc_monitor_release_write(&segment->monitor);
 
-  if (segment != null_ptr)
-    _sc_storage_check_segment_type(&segment);
+  cache->offsets_segment = segment;
+}
 
-  if (segment == null_ptr)
+void _sc_storage_fill_thread_cache_from_released_segments(sc_storage_thread_cache * cache)
+{
+  sc_monitor_acquire_write(&storage->segments_monitor);
+
+  while (cache->offsets_count == 0)
   {
-    sc_monitor_acquire_write(&storage->processes_monitor);
-    sc_monitor_acquire_write(&storage->segments_monitor);
+    sc_addr_seg const segment_num = storage->last_released_segment_num;
+    if (segment_num == 0 || segment_num > storage->max_segments_count)
+      break;
 
-    segment = _sc_storage_get_last_not_engaged_segment();
-    if (segment == null_ptr)
-    {
-      segment = _sc_storage_get_new_segment();
-      if (segment == null_ptr)
-        segment = _sc_storage_get_last_free_segment();
-    }
+    sc_segment * segment = storage->segments[segment_num - 1];
+    _sc_storage_fill_thread_cache_from_segment(cache, segment);
 
-    if (segment != null_ptr)
+    // segment is removed from list of segments with released sc-elements, if all of them are taken
+    sc_monitor_acquire_read(&segment->monitor);
+    sc_bool const is_segment_released = segment->last_released_offset == 0;
+    sc_monitor_release_read(&segment->monitor);
+    if (is_segment_released)
     {
-      if (storage->processes_segments_table != null_ptr)
-        sc_hash_table_insert(storage->processes_segments_table, thread, segment);
+      storage->last_released_segment_num = segment->elements[0].flags.type;
+      segment->elements[0].flags.type = 0;
+      _sc_storage_mark_element_changed((sc_addr){segment->num, 0});
+      sc_storage_wal_write_storage(storage->wal, storage);
     }
-
-    sc_monitor_release_write(&storage->segments_monitor);
-    sc_monitor_release_write(&storage->processes_monitor);
   }
 
-  return segment;
+  sc_monitor_release_write(&storage->segments_monitor);
 }
 
-sc_element * _sc_storage_get_element(sc_addr * addr)
+sc_bool _sc_storage_fill_thread_cache(sc_storage_thread_cache * cache)
 {
-  sc_element * element = null_ptr;
-  sc_addr_offset element_offset;
-
-  sc_segment * segment = _sc_storage_get_segment();
-  if (segment == null_ptr)
-    goto error;
-
-  sc_monitor_acquire_write(&segment->monitor);
+  cache->offsets_count = 0;
+  cache->next_offset_idx = 0;
 
-  if (segment->last_engaged_offset + 1 != SC_SEGMENT_ELEMENTS_COUNT)
-  {
-    element_offset = ++segment->last_engaged_offset;
-    element = &segment->elements[element_offset];
+  if (cache->segment != null_ptr)
+    _sc_storage_fill_thread_cache_from_segment(cache, cache->segment);
 
-    *addr = (sc_addr){segment->num, element_offset};
-  }
-  else if (segment->last_released_offset != 0)
+  if (cache->offsets_count == 0)
   {
-    element_offset = segment->last_released_offset;
-    element = &segment->elements[element_offset];
-    segment->last_released_offset = element->flags.type;
-    element->flags.type = 0;
+    sc_monitor_acquire_write(&storage->segments_monitor);
+    sc_segment * segment = _sc_storage_get_last_not_engaged_segment();
+    if (segment == null_ptr)
+      segment = _sc_storage_get_new_segment();
+    if (segment == null_ptr)
+      segment = _sc_storage_get_last_free_segment();
+    sc_monitor_release_write(&storage->segments_monitor);
 
-    *addr = (sc_addr){segment->num, element_offset};
+    cache->segment = segment;
+    if (segment != null_ptr)
+      _sc_storage_fill_thread_cache_from_segment(cache, segment);
   }
 
-  sc_monitor_release_write(&segment->monitor);
+  if (cache->offsets_count == 0)
+    _sc_storage_fill_thread_cache_from_released_segments(cache);
 
-error:
-  return element;
+  return cache->offsets_count != 0;
 }
 
-sc_element * _sc_storage_get_released_element(sc_addr * addr)
+// Not used offsets of cache are released to be taken by other threads.
+void _sc_storage_flush_thread_cache(sc_storage_thread_cache * cache)
 {
-  sc_segment * segment = null_ptr;
-  sc_element * element = null_ptr;
-  sc_addr_offset element_offset = 0;
+  for (; cache->next_offset_idx < cache->offsets_count; ++cache->next_offset_idx)
+    _sc_storage_release_offset(cache->offsets_segment, cache->offsets[cache->next_offset_idx]);
 
-  sc_monitor_acquire_write(&storage->segments_monitor);
+  cache->offsets_count = 0;
+  cache->next_offset_idx = 0;
+}
 
-  sc_addr_seg segment_num = 0;
-new_segment:
+void _sc_storage_flush_threads_caches()
 {
-  segment_num = storage->last_released_segment_num;
-  if (segment_num == 0 || segment_num > storage->max_segments_count)
-    goto error;
+  sc_monitor_acquire_write(&storage->processes_monitor);
+
+  sc_hash_table_iterator iterator;
+  sc_hash_table_iterator_init(&iterator, storage->processes_caches_table);
+  sc_pointer key, value;
+  while (sc_hash_table_iterator_next(&iterator, &key, &value))
+    _sc_storage_flush_thread_cache(value);
+
+  sc_monitor_release_write(&storage->processes_monitor);
 }
 
-  segment = storage->segments[segment_num - 1];
+sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_addr * addr)
+{
+  *addr = SC_ADDR_EMPTY;
+  sc_element * element = null_ptr;
 
-  element_offset = segment->last_released_offset;
-  if (segment->last_released_offset == 0)
-  {
-    storage->last_released_segment_num = segment->elements[0].flags.type;
-    segment->elements[0].flags.type = 0;
-    goto new_segment;
-  }
-  else
-  {
-    element = &segment->elements[element_offset];
-    segment->last_released_offset = element->flags.type;
-    element->flags.type = 0;
-  }
+  sc_storage_thread_cache * cache = _sc_storage_get_thread_cache();
+  if (cache == null_ptr)
+    goto error;
 
-  if (segment->last_released_offset == 0)
+  if (cache->next_offset_idx == cache->offsets_count && _sc_storage_fill_thread_cache(cache) == SC_FALSE)
   {
-    storage->last_released_segment_num = segment->elements[0].flags.type;
-    segment->elements[0].flags.type = 0;
+    sc_memory_error(
+        "Max segments count is %d. SC-memory is full. Please, extends or swap sc-memory",
+        storage->max_segments_count);
+    goto error;
   }
 
-error:
-  sc_monitor_release_write(&storage->segments_monitor);
+  sc_addr_offset const element_offset = cache->offsets[cache->next_offset_idx++];
+  element = &cache->offsets_segment->elements[element_offset];
+  *addr = (sc_addr){cache->offsets_segment->num, element_offset};
 
-  *addr = (sc_addr){segment_num, element_offset};
+  element->flags.states |= SC_STATE_ELEMENT_EXIST;
+  _sc_storage_mark_element_changed(*addr);
 
+error:
   return element;
 }
 
-sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_addr * addr)
+// Sc-elements of batch are taken from thread cache by runs of offsets of one sc-segment, which is filled under one lock
+// of sc-segment. Each run is written to write-ahead log by one record and its sc-segment is marked once.
+sc_uint32 _sc_storage_allocate_new_elements(sc_uint32 count, sc_type const * types, sc_addr * addrs)
 {
-  *addr = SC_ADDR_EMPTY;
-  sc_element * element = null_ptr;
+  sc_uint32 allocated_count = 0;
 
-  element = _sc_storage_get_element(addr);
-  if (element == null_ptr)
+  sc_storage_thread_cache * cache = _sc_storage_get_thread_cache();
+  if (cache == null_ptr)
+    goto error;
+
+  while (allocated_count < count)
   {
-    element = _sc_storage_get_released_element(addr);
-    if (element == null_ptr)
+    if (cache->next_offset_idx == cache->offsets_count && _sc_storage_fill_thread_cache(cache) == SC_FALSE)
+    {
       sc_memory_error(
           "Max segments count is %d. SC-memory is full. Please, extends or swap sc-memory",
           storage->max_segments_count);
-  }
+      goto error;
+    }
 
-  if (element != null_ptr)
-    element->flags.states |= SC_STATE_ELEMENT_EXIST;
+    sc_segment * segment = cache->offsets_segment;
+    sc_storage_wal_operation operation;
+    sc_storage_wal_start_operation(storage->wal, &operation);
 
-  return element;
+    for (; allocated_count < count && cache->next_offset_idx < cache->offsets_count; ++allocated_count)
+    {
+      sc_addr_offset const element_offset = cache->offsets[cache->next_offset_idx++];
+      sc_element * element = &segment->elements[element_offset];
+      addrs[allocated_count] = (sc_addr){segment->num, element_offset};
+
+      element->flags.type = types == null_ptr ? 0 : types[allocated_count];
+      element->flags.states |= SC_STATE_ELEMENT_EXIST;
+      sc_storage_wal_operation_write_element(&operation, addrs[allocated_count], element);
+    }
+
+    sc_storage_wal_finish_operation(&operation);
+    sc_segment_mark_changed(segment);
+  }
+
+error:
+  return allocated_count;
 }
 
 void sc_storage_start_new_process()
@@ -421,28 +720,18 @@ void sc_storage_start_new_process()
   if (storage == null_ptr)
     return;
 
-  sc_thread * thread = sc_thread_self();
-  sc_monitor_acquire_write(&storage->processes_monitor);
-  if (storage->processes_segments_table == null_ptr)
-    goto end;
-
-  sc_hash_table_insert(storage->processes_segments_table, thread, null_ptr);
+  sc_storage_thread_cache * cache = _sc_storage_get_thread_cache();
+  if (cache == null_ptr)
+    return;
 
-end:
-  sc_monitor_release_write(&storage->processes_monitor);
+  _sc_storage_flush_thread_cache(cache);
+  cache->segment = null_ptr;
 }
 
-void sc_storage_end_new_process()
+// Sc-segment reserved by thread is listed as not engaged, if it has free offsets
+void _sc_storage_release_thread_cache_segment(sc_storage_thread_cache * cache)
 {
-  if (storage == null_ptr)
-    return;
-
-  sc_thread * thread = sc_thread_self();
-  sc_monitor_acquire_write(&storage->processes_monitor);
-  if (storage->processes_segments_table == null_ptr)
-    goto end;
-
-  sc_segment * segment = sc_hash_table_get(storage->processes_segments_table, thread);
+  sc_segment * segment = cache->segment;
   if (segment != null_ptr
       && (segment->last_engaged_offset + 1 != SC_SEGMENT_ELEMENTS_COUNT || segment->last_released_offset != 0))
   {
@@ -451,20 +740,53 @@ void sc_storage_end_new_process()
     sc_addr_seg const last_not_engaged_segment_num = storage->last_not_engaged_segment_num;
     segment->elements[0].flags.states = last_not_engaged_segment_num;
     storage->last_not_engaged_segment_num = segment->num;
+    _sc_storage_mark_element_changed((sc_addr){segment->num, 0});
+    sc_storage_wal_write_storage(storage->wal, storage);
 
     sc_monitor_release_write(&storage->segments_monitor);
   }
-  sc_hash_table_insert(storage->processes_segments_table, thread, null_ptr);
+  cache->segment = null_ptr;
+}
 
-end:
+void sc_storage_end_new_process()
+{
+  if (storage == null_ptr)
+    return;
+
+  sc_storage_thread_cache * cache = _sc_storage_get_thread_cache();
+  if (cache == null_ptr)
+    return;
+
+  _sc_storage_flush_thread_cache(cache);
+  _sc_storage_release_thread_cache_segment(cache);
+}
+
+// Offsets of exited thread are released, even if it didn't end its process. Caches of previous sc-storages are freed on
+// their shutdown.
+void _sc_storage_release_thread_cache(sc_pointer data)
+{
+  if (storage == null_ptr || thread_cache_storage_generation != g_atomic_int_get(&storage_generation))
+    return;
+
+  sc_storage_thread_cache * cache = data;
+  sc_monitor_acquire_write(&storage->processes_monitor);
+  if (storage->processes_caches_table != null_ptr)
+  {
+    _sc_storage_flush_thread_cache(cache);
+    _sc_storage_release_thread_cache_segment(cache);
+    sc_hash_table_remove(storage->processes_caches_table, cache);
+  }
   sc_monitor_release_write(&storage->processes_monitor);
+
+  thread_cache = null_ptr;
+  thread_cache_storage_generation = 0;
 }
 
 sc_result _sc_storage_element_erase(sc_addr addr)
 {
   sc_result result;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_write(monitor);
 
   sc_element * element;
@@ -481,84 +803,74 @@ sc_result _sc_storage_element_erase(sc_addr addr)
   sc_monitor_release_write(monitor);
 
   if (sc_type_has_subtype(type, sc_type_node_link))
+  {
     sc_fs_memory_unlink_string(SC_ADDR_LOCAL_TO_INT(addr));
+    sc_storage_wal_write_link_content_removal(storage->wal, SC_ADDR_LOCAL_TO_INT(addr));
+
+    sc_monitor_acquire_write(monitor);
+    sc_storage_link_contents_cache_remove(storage->link_contents_cache, SC_ADDR_LOCAL_TO_INT(addr));
+    sc_monitor_release_write(monitor);
+  }
   else if (sc_type_has_subtype_in_mask(type, sc_type_connector_mask))
   {
     sc_bool const is_edge = sc_type_has_subtype(type, sc_type_common_edge);
 
-    sc_addr begin_addr = element->arc.begin;
-    sc_addr end_addr = element->arc.end;
+    sc_arc_info const * arc = sc_storage_get_element_arc(addr, element);
+    sc_addr begin_addr = arc->begin;
+    sc_addr end_addr = arc->end;
 
     sc_bool const is_not_loop = SC_ADDR_IS_NOT_EQUAL(begin_addr, end_addr);
 
-    sc_monitor * beg_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, begin_addr);
-    sc_monitor * end_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, end_addr);
-
-    sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
+    sc_monitor * beg_monitor = sc_storage_get_element_monitor(begin_addr);
+    sc_monitor * end_monitor = sc_storage_get_element_monitor(end_addr);
 
-    // outgoing sc-arcs
-    sc_addr prev_out_connector_addr = element->arc.prev_begin_out_arc;
-    sc_monitor * prev_out_arc_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, prev_out_connector_addr)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, prev_out_connector_addr))
-      prev_out_arc_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, prev_out_connector_addr);
-
-    sc_addr next_out_connector_addr = element->arc.next_begin_out_arc;
-    sc_monitor * next_out_arc_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, next_out_connector_addr)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, next_out_connector_addr))
-      next_out_arc_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, next_out_connector_addr);
-
-    // incoming sc-arcs
-    sc_addr prev_in_connector_addr = element->arc.prev_end_in_arc;
-    sc_monitor * prev_in_arc_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, prev_in_connector_addr)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, prev_in_connector_addr))
-      prev_in_arc_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, prev_in_connector_addr);
-
-    sc_addr next_in_arc = element->arc.next_end_in_arc;
-    sc_monitor * next_in_arc_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, next_in_arc) && SC_ADDR_IS_NOT_EQUAL(end_addr, next_in_arc))
-      next_in_arc_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, next_in_arc);
+    sc_addr prev_out_connector_addr, next_out_connector_addr, prev_in_connector_addr, next_in_arc;
+#ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
+    sc_addr prev_in_arc_from_structure, next_in_arc_from_structure_addr;
+#endif
+    sc_monitor * adjacent_monitors[SC_STORAGE_ADJACENT_ERASED_CONNECTORS_COUNT];
+    while (SC_TRUE)
+    {
+      sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
 
+      // monitors of begin and end sc-elements are already held, they can lock sibling sc-connectors too
+      prev_out_connector_addr = arc->prev_begin_out_arc;
+      next_out_connector_addr = arc->next_begin_out_arc;
+      prev_in_connector_addr = arc->prev_end_in_arc;
+      next_in_arc = arc->next_end_in_arc;
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-    sc_addr prev_in_arc_from_structure = element->arc.prev_in_arc_from_structure;
-    sc_monitor * prev_in_arc_from_structure_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, prev_in_arc_from_structure)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, prev_in_arc_from_structure))
-      prev_in_arc_from_structure_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, prev_in_arc_from_structure);
-
-    sc_addr next_in_arc_from_structure_addr = element->arc.next_in_arc_from_structure;
-    sc_monitor * next_in_arc_from_structure_monitor = null_ptr;
-    if (SC_ADDR_IS_NOT_EQUAL(begin_addr, next_in_arc_from_structure_addr)
-        && SC_ADDR_IS_NOT_EQUAL(end_addr, next_in_arc_from_structure_addr))
-      next_in_arc_from_structure_monitor =
-          sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, next_in_arc_from_structure_addr);
+      prev_in_arc_from_structure = arc->prev_in_arc_from_structure;
+      next_in_arc_from_structure_addr = arc->next_in_arc_from_structure;
 #endif
 
+      sc_addr const adjacent_addrs[] = {
+          prev_out_connector_addr,
+          next_out_connector_addr,
+          prev_in_connector_addr,
+          next_in_arc,
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-    sc_monitor_acquire_write_n(
-        6,
-        prev_out_arc_monitor,
-        next_out_arc_monitor,
-        prev_in_arc_monitor,
-        next_in_arc_monitor,
-        prev_in_arc_from_structure_monitor,
-        next_in_arc_from_structure_monitor);
-#else
-    sc_monitor_acquire_write_n(3, prev_out_arc_monitor, next_out_arc_monitor, prev_in_arc_monitor, next_in_arc_monitor);
+          prev_in_arc_from_structure,
+          next_in_arc_from_structure_addr,
 #endif
+      };
+      for (sc_uint32 i = 0; i < SC_STORAGE_ADJACENT_ERASED_CONNECTORS_COUNT; ++i)
+        adjacent_monitors[i] = _sc_storage_get_not_held_element_monitor(adjacent_addrs[i], beg_monitor, end_monitor);
+
+      sc_monitor * busy_monitor = _sc_storage_acquire_adjacent_monitors(
+          beg_monitor, end_monitor, SC_STORAGE_ADJACENT_ERASED_CONNECTORS_COUNT, adjacent_monitors);
+      if (busy_monitor == null_ptr)
+        break;
+
+      sc_monitor_release_write_n(2, beg_monitor, end_monitor);
+      _sc_storage_wait_for_monitor(busy_monitor);
+    }
 
     if (SC_ADDR_IS_NOT_EMPTY(prev_out_connector_addr))
     {
       sc_element * prev_el_arc;
       result = sc_storage_get_element_by_addr(prev_out_connector_addr, &prev_el_arc);
       if (result == SC_RESULT_OK)
-        prev_el_arc->arc.next_begin_out_arc = next_out_connector_addr;
+        sc_storage_get_element_arc(prev_out_connector_addr, prev_el_arc)->next_begin_out_arc = next_out_connector_addr;
     }
 
     if (SC_ADDR_IS_NOT_EMPTY(next_out_connector_addr))
@@ -566,7 +878,7 @@ sc_result _sc_storage_element_erase(sc_addr addr)
       sc_element * next_el_arc;
       result = sc_storage_get_element_by_addr(next_out_connector_addr, &next_el_arc);
       if (result == SC_RESULT_OK)
-        next_el_arc->arc.prev_begin_out_arc = prev_out_connector_addr;
+        sc_storage_get_element_arc(next_out_connector_addr, next_el_arc)->prev_begin_out_arc = prev_out_connector_addr;
     }
 
     sc_element * b_el;
@@ -592,7 +904,7 @@ sc_result _sc_storage_element_erase(sc_addr addr)
       sc_element * prev_el_arc;
       result = sc_storage_get_element_by_addr(prev_in_connector_addr, &prev_el_arc);
       if (result == SC_RESULT_OK)
-        prev_el_arc->arc.next_end_in_arc = next_in_arc;
+        sc_storage_get_element_arc(prev_in_connector_addr, prev_el_arc)->next_end_in_arc = next_in_arc;
     }
 
     if (SC_ADDR_IS_NOT_EMPTY(next_in_arc))
@@ -600,7 +912,7 @@ sc_result _sc_storage_element_erase(sc_addr addr)
       sc_element * next_el_arc;
       result = sc_storage_get_element_by_addr(next_in_arc, &next_el_arc);
       if (result == SC_RESULT_OK)
-        next_el_arc->arc.prev_end_in_arc = prev_in_connector_addr;
+        sc_storage_get_element_arc(next_in_arc, next_el_arc)->prev_end_in_arc = prev_in_connector_addr;
     }
 
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
@@ -609,7 +921,8 @@ sc_result _sc_storage_element_erase(sc_addr addr)
       sc_element * prev_el_arc;
       result = sc_storage_get_element_by_addr(prev_in_arc_from_structure, &prev_el_arc);
       if (result == SC_RESULT_OK)
-        prev_el_arc->arc.next_in_arc_from_structure = next_in_arc_from_structure_addr;
+        sc_storage_get_element_arc(prev_in_arc_from_structure, prev_el_arc)->next_in_arc_from_structure =
+            next_in_arc_from_structure_addr;
     }
 
     if (SC_ADDR_IS_NOT_EMPTY(next_in_arc_from_structure_addr))
@@ -617,7 +930,8 @@ sc_result _sc_storage_element_erase(sc_addr addr)
       sc_element * next_el_arc;
       result = sc_storage_get_element_by_addr(next_in_arc_from_structure_addr, &next_el_arc);
       if (result == SC_RESULT_OK)
-        next_el_arc->arc.prev_in_arc_from_structure = prev_in_arc_from_structure;
+        sc_storage_get_element_arc(next_in_arc_from_structure_addr, next_el_arc)->prev_in_arc_from_structure =
+            prev_in_arc_from_structure;
     }
 #endif
 
@@ -644,18 +958,21 @@ sc_result _sc_storage_element_erase(sc_addr addr)
       }
     }
 
+    sc_addr const changed_addrs[] = {
+        begin_addr,
+        end_addr,
+        prev_out_connector_addr,
+        next_out_connector_addr,
+        prev_in_connector_addr,
+        next_in_arc,
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-    sc_monitor_release_write_n(
-        6,
-        prev_out_arc_monitor,
-        next_out_arc_monitor,
-        prev_in_arc_monitor,
-        next_in_arc_monitor,
-        prev_in_arc_from_structure_monitor,
-        next_in_arc_from_structure_monitor);
-#else
-    sc_monitor_release_write_n(4, prev_out_arc_monitor, next_out_arc_monitor, prev_in_arc_monitor, next_in_arc_monitor);
+        prev_in_arc_from_structure,
+        next_in_arc_from_structure_addr,
 #endif
+    };
+    _sc_storage_mark_elements_changed(sizeof(changed_addrs) / sizeof(changed_addrs[0]), changed_addrs);
+
+    _sc_storage_release_adjacent_monitors(SC_STORAGE_ADJACENT_ERASED_CONNECTORS_COUNT, adjacent_monitors);
     sc_monitor_release_write_n(2, beg_monitor, end_monitor);
   }
 
@@ -695,7 +1012,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
     element_addr.seg = SC_ADDR_LOCAL_SEG_FROM_INT((sc_pointer_to_sc_addr_hash)p_addr);
     element_addr.offset = SC_ADDR_LOCAL_OFFSET_FROM_INT((sc_pointer_to_sc_addr_hash)p_addr);
 
-    sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, element_addr);
+    sc_monitor * monitor = sc_storage_get_element_monitor(element_addr);
     sc_monitor_acquire_read(monitor);
     result = sc_storage_get_element_by_addr(element_addr, &el);
     if (result != SC_RESULT_OK)
@@ -705,8 +1022,9 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
     }
 
     sc_type const type = el->flags.type;
-    sc_addr const begin_addr = el->arc.begin;
-    sc_addr const end_addr = el->arc.end;
+    sc_arc_info const * arc = sc_storage_get_element_arc(element_addr, el);
+    sc_addr const begin_addr = arc->begin;
+    sc_addr const end_addr = arc->end;
 
     sc_result erase_incoming_connector_result = SC_RESULT_NO;
     sc_result erase_outgoing_connector_result = SC_RESULT_NO;
@@ -820,7 +1138,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
         sc_queue_push(&iter_queue, p_addr);
       }
 
-      connector_addr = connector->arc.next_begin_out_arc;
+      connector_addr = sc_storage_get_element_arc(connector_addr, connector)->next_begin_out_arc;
     }
 
     connector_addr = el->first_in_arc;
@@ -839,7 +1157,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
         sc_queue_push(&iter_queue, p_addr);
       }
 
-      connector_addr = connector->arc.next_end_in_arc;
+      connector_addr = sc_storage_get_element_arc(connector_addr, connector)->next_end_in_arc;
     }
 
     sc_monitor_release_read(monitor);
@@ -864,6 +1182,16 @@ error:
   return result;
 }
 
+sc_bool _sc_storage_is_node_type(sc_type type)
+{
+  return !(sc_type_is_not_node(type) && (!sc_type_is(type, sc_type_const) && !sc_type_is(type, sc_type_var)));
+}
+
+sc_bool _sc_storage_is_link_type(sc_type type)
+{
+  return !sc_type_is_not_node_link(type);
+}
+
 sc_addr sc_storage_node_new(sc_memory_context const * ctx, sc_type type)
 {
   sc_result result;
@@ -874,7 +1202,7 @@ sc_addr sc_storage_node_new_ext(sc_memory_context const * ctx, sc_type type, sc_
 {
   sc_addr addr = SC_ADDR_EMPTY;
 
-  if (sc_type_is_not_node(type) && (!sc_type_is(type, sc_type_const) && !sc_type_is(type, sc_type_var)))
+  if (_sc_storage_is_node_type(type) == SC_FALSE)
   {
     *result = SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE;
     return addr;
@@ -888,6 +1216,7 @@ sc_addr sc_storage_node_new_ext(sc_memory_context const * ctx, sc_type type, sc_
   }
 
   element->flags.type = sc_type_node | type;
+  _sc_storage_mark_element_changed(addr);
   *result = SC_RESULT_OK;
   return addr;
 }
@@ -902,7 +1231,7 @@ sc_addr sc_storage_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_
 {
   sc_addr addr = SC_ADDR_EMPTY;
 
-  if (sc_type_is_not_node_link(type))
+  if (_sc_storage_is_link_type(type) == SC_FALSE)
   {
     *result = SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK;
     return addr;
@@ -916,16 +1245,94 @@ sc_addr sc_storage_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_
   }
 
   element->flags.type = sc_type_node_link | type;
+  _sc_storage_mark_element_changed(addr);
   *result = SC_RESULT_OK;
   return addr;
 }
 
+// Sc-elements with valid types are allocated together, so sc-elements of batch don't lock sc-segments one by one
+sc_result _sc_storage_elements_new_batch(
+    sc_type const * types,
+    sc_uint32 count,
+    sc_bool (*is_type_valid)(sc_type),
+    sc_type element_type,
+    sc_result type_error,
+    sc_addr * addrs)
+{
+  sc_result result = SC_RESULT_OK;
+
+  sc_uint32 valid_count = 0;
+  sc_uint32 * valid_indices = sc_mem_new(sc_uint32, count);
+  sc_type * valid_types = sc_mem_new(sc_type, count);
+  sc_addr * valid_addrs = sc_mem_new(sc_addr, count);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    addrs[i] = SC_ADDR_EMPTY;
+
+    if (is_type_valid(types[i]) == SC_FALSE)
+    {
+      result = type_error;
+      continue;
+    }
+
+    valid_indices[valid_count] = i;
+    valid_types[valid_count] = element_type | types[i];
+    ++valid_count;
+  }
+
+  sc_uint32 const allocated_count = _sc_storage_allocate_new_elements(valid_count, valid_types, valid_addrs);
+  if (allocated_count != valid_count)
+    result = SC_RESULT_ERROR_FULL_MEMORY;
+
+  for (sc_uint32 i = 0; i < allocated_count; ++i)
+    addrs[valid_indices[i]] = valid_addrs[i];
+
+  sc_mem_free(valid_addrs);
+  sc_mem_free(valid_types);
+  sc_mem_free(valid_indices);
+  return result;
+}
+
+sc_result sc_storage_nodes_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * addrs)
+{
+  return _sc_storage_elements_new_batch(
+      types, count, _sc_storage_is_node_type, sc_type_node, SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE, addrs);
+}
+
+sc_result sc_storage_links_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * addrs)
+{
+  return _sc_storage_elements_new_batch(
+      types, count, _sc_storage_is_link_type, sc_type_node_link, SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK, addrs);
+}
+
+// Record of generated sc-connector is taken from sc-connectors records of its segment in compact sc-elements layout
+sc_arc_info * _sc_storage_allocate_element_arc(sc_addr connector_addr, sc_element * arc_el)
+{
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  sc_segment * segment = storage->segments[connector_addr.seg - 1];
+  sc_monitor_acquire_write(&segment->monitor);
+  arc_el->arc_index = sc_segment_allocate_arc(segment);
+  _sc_storage_mark_segment_changed(segment);
+  sc_monitor_release_write(&segment->monitor);
+#endif
+
+  return sc_storage_get_element_arc(connector_addr, arc_el);
+}
+
+// Monitors of first sc-connectors of begin and end sc-elements must be locked by caller
 void _sc_storage_make_elements_incident_to_arc(
     sc_addr connector_addr,
-    sc_element * arc_el,
-    sc_addr beg_addr,
+    sc_arc_info * arc,
     sc_element * beg_el,
-    sc_addr end_addr,
     sc_element * end_el,
     sc_bool is_reverse,
     sc_bool is_loop)
@@ -935,20 +1342,6 @@ void _sc_storage_make_elements_incident_to_arc(
   sc_addr first_out_connector_addr = beg_el->first_out_arc;
   sc_addr first_in_connector_addr = end_el->first_in_arc;
 
-  sc_monitor * first_out_arc_monitor = null_ptr;
-  sc_monitor * first_in_arc_monitor = null_ptr;
-
-  if (SC_ADDR_IS_NOT_EQUAL(first_out_connector_addr, beg_addr)
-      && SC_ADDR_IS_NOT_EQUAL(first_out_connector_addr, end_addr))
-    first_out_arc_monitor =
-        sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_out_connector_addr);
-  if (SC_ADDR_IS_NOT_EQUAL(first_in_connector_addr, beg_addr)
-      && SC_ADDR_IS_NOT_EQUAL(first_in_connector_addr, end_addr))
-    first_in_arc_monitor =
-        sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_in_connector_addr);
-
-  sc_monitor_acquire_write_n(2, first_out_arc_monitor, first_in_arc_monitor);
-
   if (SC_ADDR_IS_NOT_EMPTY(first_out_connector_addr))
     sc_storage_get_element_by_addr(first_out_connector_addr, &first_out_arc);
 
@@ -958,29 +1351,27 @@ void _sc_storage_make_elements_incident_to_arc(
   // set next outgoing sc-arc for our generated arc
   if (is_reverse)
   {
-    arc_el->arc.next_end_out_arc = first_out_connector_addr;
-    arc_el->arc.next_begin_in_arc = first_in_connector_addr;
+    arc->next_end_out_arc = first_out_connector_addr;
+    arc->next_begin_in_arc = first_in_connector_addr;
   }
   else
   {
-    arc_el->arc.next_begin_out_arc = first_out_connector_addr;
-    arc_el->arc.next_end_in_arc = first_in_connector_addr;
+    arc->next_begin_out_arc = first_out_connector_addr;
+    arc->next_end_in_arc = first_in_connector_addr;
 
     if (is_loop)
     {
-      arc_el->arc.next_end_out_arc = first_out_connector_addr;
-      arc_el->arc.next_begin_in_arc = first_in_connector_addr;
+      arc->next_end_out_arc = first_out_connector_addr;
+      arc->next_begin_in_arc = first_in_connector_addr;
     }
 
     if (first_out_arc)
-      first_out_arc->arc.prev_begin_out_arc = connector_addr;
+      sc_storage_get_element_arc(first_out_connector_addr, first_out_arc)->prev_begin_out_arc = connector_addr;
 
     if (first_in_arc)
-      first_in_arc->arc.prev_end_in_arc = connector_addr;
+      sc_storage_get_element_arc(first_in_connector_addr, first_in_arc)->prev_end_in_arc = connector_addr;
   }
 
-  sc_monitor_release_write_n(2, first_out_arc_monitor, first_in_arc_monitor);
-
   // set our arc as first output/input at begin/end elements
   beg_el->first_out_arc = connector_addr;
   end_el->first_in_arc = connector_addr;
@@ -990,33 +1381,22 @@ void _sc_storage_make_elements_incident_to_arc(
 }
 
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-void _sc_storage_update_structure_arcs(
-    sc_addr connector_addr,
-    sc_element * arc_el,
-    sc_addr beg_addr,
-    sc_addr end_addr,
-    sc_element * end_el)
+// Monitor of first sc-connector from structure of end sc-element must be locked by caller
+void _sc_storage_update_structure_arcs(sc_addr connector_addr, sc_arc_info * arc, sc_element * end_el)
 {
   sc_element * first_in_accessed_arc = null_ptr;
   sc_addr first_in_accessed_connector_addr = end_el->first_in_arc_from_structure;
-  sc_monitor * first_in_accessed_arc_monitor = null_ptr;
-
-  if (SC_ADDR_IS_NOT_EQUAL(first_in_accessed_connector_addr, beg_addr)
-      && SC_ADDR_IS_NOT_EQUAL(first_in_accessed_connector_addr, end_addr))
-    first_in_accessed_arc_monitor =
-        sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_in_accessed_connector_addr);
-
-  sc_monitor_acquire_write(first_in_accessed_arc_monitor);
 
   if (SC_ADDR_IS_NOT_EMPTY(first_in_accessed_connector_addr))
     sc_storage_get_element_by_addr(first_in_accessed_connector_addr, &first_in_accessed_arc);
 
-  arc_el->arc.next_in_arc_from_structure = first_in_accessed_connector_addr;
+  arc->next_in_arc_from_structure = first_in_accessed_connector_addr;
 
   if (first_in_accessed_arc)
-    first_in_accessed_arc->arc.prev_in_arc_from_structure = connector_addr;
-
-  sc_monitor_release_write(first_in_accessed_arc_monitor);
+  {
+    sc_storage_get_element_arc(first_in_accessed_connector_addr, first_in_accessed_arc)->prev_in_arc_from_structure =
+        connector_addr;
+  }
 
   end_el->first_in_arc_from_structure = connector_addr;
 }
@@ -1028,68 +1408,74 @@ sc_addr sc_storage_arc_new(sc_memory_context const * ctx, sc_type type, sc_addr
   return sc_storage_arc_new_ext(ctx, type, beg_addr, end_addr, &result);
 }
 
-sc_addr sc_storage_arc_new_ext(
+// Begin and end sc-elements of generated sc-connector must be locked by caller. If monitor of adjacent sc-connector
+// can't be acquired without waiting, nothing is changed and it is returned as busy monitor.
+sc_result _sc_storage_try_arc_new_locked(
     sc_memory_context const * ctx,
     sc_type type,
+    sc_addr connector_addr,
+    sc_element * arc_el,
     sc_addr beg_addr,
     sc_addr end_addr,
-    sc_result * result)
+    sc_monitor ** busy_monitor)
 {
-  sc_addr connector_addr = SC_ADDR_EMPTY;
-
-  if (sc_type_is_not_connector(type))
-  {
-    *result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
-    return connector_addr;
-  }
-
-  if (SC_ADDR_IS_EMPTY(beg_addr) || SC_ADDR_IS_EMPTY(end_addr))
-  {
-    *result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
-    return connector_addr;
-  }
-
   sc_element *beg_el = null_ptr, *end_el = null_ptr;
+  sc_result result = sc_storage_get_element_by_addr(beg_addr, &beg_el);
+  if (result != SC_RESULT_OK)
+    return result;
 
-  sc_element * arc_el = sc_storage_allocate_new_element(ctx, &connector_addr);
-  if (arc_el == null_ptr)
-  {
-    *result = SC_RESULT_ERROR_FULL_MEMORY;
-    return connector_addr;
-  }
-
-  arc_el->flags.type = type;
-  arc_el->arc.begin = beg_addr;
-  arc_el->arc.end = end_addr;
+  result = sc_storage_get_element_by_addr(end_addr, &end_el);
+  if (result != SC_RESULT_OK)
+    return result;
 
   sc_bool is_edge = sc_type_has_subtype(type, sc_type_common_edge);
   sc_bool is_not_loop = SC_ADDR_IS_NOT_EQUAL(beg_addr, end_addr);
+#ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
+  sc_bool const is_structure_arc = sc_type_is_structure_and_arc(beg_el->flags.type, type);
+#endif
 
-  // try to lock begin and end elements
-  sc_monitor * beg_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, beg_addr);
-  sc_monitor * end_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, end_addr);
-  sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
-
-  *result = sc_storage_get_element_by_addr(beg_addr, &beg_el);
-  if (*result != SC_RESULT_OK)
-    goto error;
+  // generated sc-connector and first sc-connectors of begin and end sc-elements are locked to change their lists. They
+  // are written to log together with begin and end sc-elements, so their records follow their previous changes.
+  sc_addr const changed_addrs[] = {
+      connector_addr,
+      beg_addr,
+      end_addr,
+      beg_el->first_out_arc,
+      end_el->first_in_arc,
+      is_edge && is_not_loop ? end_el->first_out_arc : SC_ADDR_EMPTY,
+      is_edge && is_not_loop ? beg_el->first_in_arc : SC_ADDR_EMPTY,
+#ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
+      is_structure_arc ? end_el->first_in_arc_from_structure : SC_ADDR_EMPTY,
+#endif
+  };
+  sc_monitor * beg_monitor = sc_storage_get_element_monitor(beg_addr);
+  sc_monitor * end_monitor = sc_storage_get_element_monitor(end_addr);
+  sc_monitor * changed_monitors[SC_STORAGE_GENERATED_CONNECTOR_CHANGED_ELEMENTS_COUNT];
+  for (sc_uint32 i = 0; i < SC_STORAGE_GENERATED_CONNECTOR_CHANGED_ELEMENTS_COUNT; ++i)
+    changed_monitors[i] = _sc_storage_get_not_held_element_monitor(changed_addrs[i], beg_monitor, end_monitor);
+
+  *busy_monitor = _sc_storage_acquire_adjacent_monitors(
+      beg_monitor, end_monitor, SC_STORAGE_GENERATED_CONNECTOR_CHANGED_ELEMENTS_COUNT, changed_monitors);
+  if (*busy_monitor != null_ptr)
+    return SC_RESULT_OK;
 
-  *result = sc_storage_get_element_by_addr(end_addr, &end_el);
-  if (*result != SC_RESULT_OK)
-    goto error;
+  arc_el->flags.type = type;
+  sc_arc_info * arc = _sc_storage_allocate_element_arc(connector_addr, arc_el);
+  arc->begin = beg_addr;
+  arc->end = end_addr;
 
-  // lock arcs to change output/input list
-  _sc_storage_make_elements_incident_to_arc(
-      connector_addr, arc_el, beg_addr, beg_el, end_addr, end_el, SC_FALSE, !is_not_loop);
+  _sc_storage_make_elements_incident_to_arc(connector_addr, arc, beg_el, end_el, SC_FALSE, !is_not_loop);
   if (is_edge && is_not_loop)
-    _sc_storage_make_elements_incident_to_arc(
-        connector_addr, arc_el, end_addr, end_el, beg_addr, beg_el, SC_TRUE, SC_FALSE);
+    _sc_storage_make_elements_incident_to_arc(connector_addr, arc, end_el, beg_el, SC_TRUE, SC_FALSE);
 
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
-  if (sc_type_is_structure_and_arc(beg_el->flags.type, type))
-    _sc_storage_update_structure_arcs(connector_addr, arc_el, beg_addr, end_addr, end_el);
+  if (is_structure_arc)
+    _sc_storage_update_structure_arcs(connector_addr, arc, end_el);
 #endif
 
+  _sc_storage_mark_elements_changed(SC_STORAGE_GENERATED_CONNECTOR_CHANGED_ELEMENTS_COUNT, changed_addrs);
+  _sc_storage_release_adjacent_monitors(SC_STORAGE_GENERATED_CONNECTOR_CHANGED_ELEMENTS_COUNT, changed_monitors);
+
   // emit events
   if (is_edge && is_not_loop)
   {
@@ -1125,21 +1511,209 @@ sc_addr sc_storage_arc_new_ext(
   sc_event_emit(
       ctx, beg_addr, sc_event_after_generate_connector_addr, connector_addr, type, end_addr, null_ptr, SC_ADDR_EMPTY);
 
-  sc_monitor_release_write_n(2, beg_monitor, end_monitor);
+  return SC_RESULT_OK;
+}
+
+// Begin and end sc-elements of generated sc-connector must be locked by caller. Their monitors are released and
+// acquired again, while busy monitor of adjacent sc-connector is waited for.
+sc_result _sc_storage_arc_new_locked(
+    sc_memory_context const * ctx,
+    sc_type type,
+    sc_addr connector_addr,
+    sc_element * arc_el,
+    sc_addr beg_addr,
+    sc_addr end_addr)
+{
+  sc_monitor * beg_monitor = sc_storage_get_element_monitor(beg_addr);
+  sc_monitor * end_monitor = sc_storage_get_element_monitor(end_addr);
+
+  while (SC_TRUE)
+  {
+    sc_monitor * busy_monitor = null_ptr;
+    sc_result const result =
+        _sc_storage_try_arc_new_locked(ctx, type, connector_addr, arc_el, beg_addr, end_addr, &busy_monitor);
+    if (busy_monitor == null_ptr)
+      return result;
+
+    sc_monitor_release_write_n(2, beg_monitor, end_monitor);
+    _sc_storage_wait_for_monitor(busy_monitor);
+    sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
+  }
+}
+
+sc_addr sc_storage_arc_new_ext(
+    sc_memory_context const * ctx,
+    sc_type type,
+    sc_addr beg_addr,
+    sc_addr end_addr,
+    sc_result * result)
+{
+  sc_addr connector_addr = SC_ADDR_EMPTY;
+
+  if (sc_type_is_not_connector(type))
+  {
+    *result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
+    return connector_addr;
+  }
+
+  if (SC_ADDR_IS_EMPTY(beg_addr) || SC_ADDR_IS_EMPTY(end_addr))
+  {
+    *result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+    return connector_addr;
+  }
+
+  sc_element * arc_el = sc_storage_allocate_new_element(ctx, &connector_addr);
+  if (arc_el == null_ptr)
+  {
+    *result = SC_RESULT_ERROR_FULL_MEMORY;
+    return connector_addr;
+  }
+
+  // try to lock begin and end elements
+  sc_monitor * beg_monitor = sc_storage_get_element_monitor(beg_addr);
+  sc_monitor * end_monitor = sc_storage_get_element_monitor(end_addr);
+  sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
+
+  *result = _sc_storage_arc_new_locked(ctx, type, connector_addr, arc_el, beg_addr, end_addr);
+  if (*result != SC_RESULT_OK)
+  {
+    sc_storage_free_element(connector_addr);
+    connector_addr = SC_ADDR_EMPTY;
+  }
 
-  *result = SC_RESULT_OK;
-  return connector_addr;
-error:
-  sc_storage_free_element(connector_addr);
   sc_monitor_release_write_n(2, beg_monitor, end_monitor);
-  return SC_ADDR_EMPTY;
+  return connector_addr;
+}
+
+typedef struct
+{
+  sc_uint32 index;
+  sc_addr connector_addr;
+  sc_monitor * first_monitor;
+  sc_monitor * second_monitor;
+} sc_storage_arc_batch_item;
+
+int _sc_storage_compare_arc_batch_items(void const * a, void const * b)
+{
+  sc_storage_arc_batch_item const * first_item = a;
+  sc_storage_arc_batch_item const * second_item = b;
+
+  sc_uint32 const first_id = _sc_storage_get_monitor_id(first_item->first_monitor);
+  sc_uint32 const second_id = _sc_storage_get_monitor_id(second_item->first_monitor);
+  if (first_id != second_id)
+    return first_id < second_id ? -1 : 1;
+
+  sc_uint32 const first_next_id = _sc_storage_get_monitor_id(first_item->second_monitor);
+  sc_uint32 const second_next_id = _sc_storage_get_monitor_id(second_item->second_monitor);
+  if (first_next_id != second_next_id)
+    return first_next_id < second_next_id ? -1 : 1;
+
+  return first_item->index < second_item->index ? -1 : first_item->index > second_item->index;
+}
+
+sc_result sc_storage_arcs_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_addr const * beg_addrs,
+    sc_addr const * end_addrs,
+    sc_uint32 count,
+    sc_addr * connector_addrs)
+{
+  sc_result result = SC_RESULT_OK;
+  sc_storage_arc_batch_item * items = sc_mem_new(sc_storage_arc_batch_item, count);
+  sc_addr * allocated_addrs = sc_mem_new(sc_addr, count);
+  sc_uint32 items_count = 0;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    connector_addrs[i] = SC_ADDR_EMPTY;
+
+    if (sc_type_is_not_connector(types[i]))
+    {
+      result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
+      continue;
+    }
+
+    if (SC_ADDR_IS_EMPTY(beg_addrs[i]) || SC_ADDR_IS_EMPTY(end_addrs[i]))
+    {
+      result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+      continue;
+    }
+
+    sc_monitor * beg_monitor = sc_storage_get_element_monitor(beg_addrs[i]);
+    sc_monitor * end_monitor = sc_storage_get_element_monitor(end_addrs[i]);
+    sc_storage_arc_batch_item * item = &items[items_count++];
+    item->index = i;
+    sc_bool const is_beg_monitor_first =
+        _sc_storage_get_monitor_id(beg_monitor) < _sc_storage_get_monitor_id(end_monitor);
+    item->first_monitor = is_beg_monitor_first ? beg_monitor : end_monitor;
+    item->second_monitor = is_beg_monitor_first ? end_monitor : beg_monitor;
+  }
+
+  // sc-elements of sc-connectors are allocated before monitors of incident sc-elements are acquired, so sc-segments
+  // aren't locked under monitors of sc-elements
+  sc_uint32 const allocated_count = _sc_storage_allocate_new_elements(items_count, null_ptr, allocated_addrs);
+  if (allocated_count != items_count)
+    result = SC_RESULT_ERROR_FULL_MEMORY;
+  items_count = allocated_count;
+  for (sc_uint32 j = 0; j < items_count; ++j)
+    items[j].connector_addr = allocated_addrs[j];
+
+  // all sc-connectors between the same pair of sc-elements monitors are generated under one lock. Sc-connectors of one
+  // group are generated in order of arrays.
+  qsort(items, items_count, sizeof(sc_storage_arc_batch_item), _sc_storage_compare_arc_batch_items);
+
+  sc_uint32 group_end;
+  for (sc_uint32 group_begin = 0; group_begin < items_count; group_begin = group_end)
+  {
+    sc_monitor * first_monitor = items[group_begin].first_monitor;
+    sc_monitor * second_monitor = items[group_begin].second_monitor;
+
+    group_end = group_begin + 1;
+    while (group_end < items_count && items[group_end].first_monitor == first_monitor
+           && items[group_end].second_monitor == second_monitor)
+      ++group_end;
+
+    sc_monitor_acquire_write_n(2, first_monitor, second_monitor);
+
+    for (sc_uint32 j = group_begin; j < group_end; ++j)
+    {
+      sc_uint32 const i = items[j].index;
+      sc_addr const connector_addr = items[j].connector_addr;
+
+      sc_element * arc_el;
+      sc_storage_get_element_by_addr(connector_addr, &arc_el);
+      sc_result const arc_result =
+          _sc_storage_arc_new_locked(ctx, types[i], connector_addr, arc_el, beg_addrs[i], end_addrs[i]);
+      if (arc_result != SC_RESULT_OK)
+      {
+        result = arc_result;
+        continue;
+      }
+
+      connector_addrs[i] = connector_addr;
+    }
+
+    sc_monitor_release_write_n(2, first_monitor, second_monitor);
+  }
+
+  // sc-elements of not generated sc-connectors are released after monitors of incident sc-elements are released
+  for (sc_uint32 j = 0; j < items_count; ++j)
+  {
+    if (SC_ADDR_IS_EMPTY(connector_addrs[items[j].index]))
+      sc_storage_free_element(items[j].connector_addr);
+  }
+
+  sc_mem_free(allocated_addrs);
+  sc_mem_free(items);
+  return result;
 }
 
 sc_uint32 sc_storage_get_element_outgoing_arcs_count(sc_memory_context const * ctx, sc_addr addr, sc_result * result)
 {
   sc_uint32 count = 0;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_read(monitor);
 
   sc_element * el = null_ptr;
@@ -1158,7 +1732,7 @@ sc_uint32 sc_storage_get_element_incoming_arcs_count(sc_memory_context const * c
 {
   sc_uint32 count = 0;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_read(monitor);
 
   sc_element * el = null_ptr;
@@ -1280,7 +1854,7 @@ sc_result sc_storage_change_element_subtype(sc_memory_context const * ctx, sc_ad
 
   sc_element * el = null_ptr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_write(monitor);
 
   result = sc_storage_get_element_by_addr(addr, &el);
@@ -1294,6 +1868,7 @@ sc_result sc_storage_change_element_subtype(sc_memory_context const * ctx, sc_ad
   }
 
   el->flags.type = type;
+  _sc_storage_mark_element_changed(addr);
 
 error:
   sc_monitor_release_write(monitor);
@@ -1307,7 +1882,7 @@ sc_result sc_storage_get_arc_begin(sc_memory_context const * ctx, sc_addr addr,
 
   sc_element * el = null_ptr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_read(monitor);
 
   result = sc_storage_get_element_by_addr(addr, &el);
@@ -1320,7 +1895,7 @@ sc_result sc_storage_get_arc_begin(sc_memory_context const * ctx, sc_addr addr,
     goto error;
   }
 
-  *result_begin_addr = el->arc.begin;
+  *result_begin_addr = sc_storage_get_element_arc(addr, el)->begin;
 
 error:
   sc_monitor_release_read(monitor);
@@ -1334,7 +1909,7 @@ sc_result sc_storage_get_arc_end(sc_memory_context const * ctx, sc_addr addr, sc
 
   sc_element * el = null_ptr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_read(monitor);
 
   result = sc_storage_get_element_by_addr(addr, &el);
@@ -1347,7 +1922,7 @@ sc_result sc_storage_get_arc_end(sc_memory_context const * ctx, sc_addr addr, sc
     goto error;
   }
 
-  *result_end_addr = el->arc.end;
+  *result_end_addr = sc_storage_get_element_arc(addr, el)->end;
 
 error:
   sc_monitor_release_read(monitor);
@@ -1366,7 +1941,7 @@ sc_result sc_storage_get_arc_info(
 
   sc_element * el = null_ptr;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_read(monitor);
 
   result = sc_storage_get_element_by_addr(addr, &el);
@@ -1379,8 +1954,9 @@ sc_result sc_storage_get_arc_info(
     goto error;
   }
 
-  *result_begin_addr = el->arc.begin;
-  *result_end_addr = el->arc.end;
+  sc_arc_info const * arc = sc_storage_get_element_arc(addr, el);
+  *result_begin_addr = arc->begin;
+  *result_end_addr = arc->end;
 
 error:
   sc_monitor_release_read(monitor);
@@ -1397,18 +1973,12 @@ sc_result sc_storage_set_link_content(
 
   sc_element * el = null_ptr;
 
-  sc_char * string = null_ptr;
+  // content is read from stream by sc-fs-memory, big content is copied by chunks
   sc_uint32 string_size = 0;
-  if (sc_stream_get_data(stream, &string, &string_size) == SC_FALSE)
-  {
-    sc_mem_free(string);
+  if (sc_stream_get_length(stream, &string_size) != SC_RESULT_OK)
     return SC_RESULT_ERROR_STREAM_IO;
-  }
-
-  if (string == null_ptr)
-    sc_string_empty(string);
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_write(monitor);
 
   result = sc_storage_get_element_by_addr(addr, &el);
@@ -1421,10 +1991,28 @@ sc_result sc_storage_set_link_content(
     goto error;
   }
 
-  if (sc_fs_memory_link_string_ext(SC_ADDR_LOCAL_TO_INT(addr), string, string_size, is_searchable_string)
-      != SC_FS_MEMORY_OK)
-  {
+  // written strings aren't changed, so previous content is restored by its offset, if new content isn't logged
+  sc_uint64 previous_string_offset;
+  sc_fs_memory_status const previous_fs_memory_status =
+      sc_fs_memory_get_string_offset_by_link_hash(SC_ADDR_LOCAL_TO_INT(addr), &previous_string_offset);
+
+  sc_fs_memory_status const fs_memory_status =
+      sc_fs_memory_link_stream(SC_ADDR_LOCAL_TO_INT(addr), stream, is_searchable_string);
+  // cached content is stale even if new content is written partially
+  sc_storage_link_contents_cache_remove(storage->link_contents_cache, SC_ADDR_LOCAL_TO_INT(addr));
+  if (fs_memory_status == SC_FS_MEMORY_OK)
+    result = sc_storage_wal_write_link_content_stream(
+        storage->wal, SC_ADDR_LOCAL_TO_INT(addr), stream, is_searchable_string);
+  else
     result = SC_RESULT_ERROR_FILE_MEMORY_IO;
+
+  // sc-link keeps content that is in the log, if new content isn't written or logged
+  if (result != SC_RESULT_OK)
+  {
+    if (previous_fs_memory_status == SC_FS_MEMORY_OK)
+      sc_fs_memory_link_string_offset(SC_ADDR_LOCAL_TO_INT(addr), previous_string_offset);
+    else
+      sc_fs_memory_unlink_string(SC_ADDR_LOCAL_TO_INT(addr));
     goto error;
   }
 
@@ -1432,12 +2020,10 @@ sc_result sc_storage_set_link_content(
       ctx, addr, sc_event_before_change_link_content_addr, SC_ADDR_EMPTY, 0, SC_ADDR_EMPTY, null_ptr, SC_ADDR_EMPTY);
 
   sc_monitor_release_write(monitor);
-  sc_mem_free(string);
 
   return SC_RESULT_OK;
 error:
   sc_monitor_release_write(monitor);
-  sc_mem_free(string);
 
   return result;
 }
@@ -1451,7 +2037,7 @@ sc_result sc_storage_get_link_content(sc_memory_context const * ctx, sc_addr add
   sc_char * string = null_ptr;
   sc_uint32 string_size = 0;
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = sc_storage_get_element_monitor(addr);
   sc_monitor_acquire_read(monitor);
 
   result = sc_storage_get_element_by_addr(addr, &el);
@@ -1464,20 +2050,36 @@ sc_result sc_storage_get_link_content(sc_memory_context const * ctx, sc_addr add
     goto error;
   }
 
+  *stream = sc_storage_link_contents_cache_get(storage->link_contents_cache, SC_ADDR_LOCAL_TO_INT(addr));
+  if (*stream != null_ptr)
+  {
+    sc_monitor_release_read(monitor);
+    return SC_RESULT_OK;
+  }
+
+  // big contents and contents of files are read by chunks and aren't cached
   sc_fs_memory_status const fs_memory_status =
-      sc_fs_memory_get_string_by_link_hash(SC_ADDR_LOCAL_TO_INT(addr), &string, &string_size);
+      sc_fs_memory_get_stream_by_link_hash(SC_ADDR_LOCAL_TO_INT(addr), &string, &string_size, stream);
   if (fs_memory_status != SC_FS_MEMORY_OK && fs_memory_status != SC_FS_MEMORY_NO_STRING)
   {
     result = SC_RESULT_ERROR_FILE_MEMORY_IO;
     goto error;
   }
 
-  sc_monitor_release_read(monitor);
+  if (*stream != null_ptr)
+  {
+    sc_monitor_release_read(monitor);
+    return SC_RESULT_OK;
+  }
 
   if (string == null_ptr)
     sc_string_empty(string);
 
-  *stream = sc_stream_memory_new(string, string_size, SC_STREAM_FLAG_READ, SC_TRUE);
+  // content is put while sc-link is locked, so it can't be changed and removed from cache before
+  *stream = sc_storage_link_contents_cache_put(
+      storage->link_contents_cache, SC_ADDR_LOCAL_TO_INT(addr), string, string_size);
+
+  sc_monitor_release_read(monitor);
 
   return SC_RESULT_OK;
 error:
@@ -1601,5 +2203,10 @@ sc_result sc_storage_get_elements_stat(sc_stat * stat)
 
 sc_result sc_storage_save(sc_memory_context const * ctx)
 {
-  return sc_fs_memory_save(storage) == SC_FS_MEMORY_OK ? SC_RESULT_OK : SC_RESULT_ERROR;
+  return _sc_storage_save(sc_fs_memory_save);
+}
+
+sc_result sc_storage_save_changes()
+{
+  return _sc_storage_save(sc_fs_memory_save_changes);
 }
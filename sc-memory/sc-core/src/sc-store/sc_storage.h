@@ -259,6 +259,72 @@ sc_addr sc_storage_arc_new_ext(
     sc_addr end_addr,
     sc_result * result);
 
+/*!
+ * @brief Generates sc-nodes with the specified types.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of the new sc-nodes.
+ * @param count Count of the new sc-nodes.
+ * @param addrs Array of `count` sc-addrs where sc-addrs of the generated sc-nodes are stored. sc-addr of sc-node that
+ *              wasn't generated is empty.
+ *
+ * @return Returns SC_RESULT_OK if all sc-nodes were generated, otherwise the result of the last failed generation.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_nodes_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * addrs);
+
+/*!
+ * @brief Generates sc-links with the specified types.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of the new sc-links.
+ * @param count Count of the new sc-links.
+ * @param addrs Array of `count` sc-addrs where sc-addrs of the generated sc-links are stored. sc-addr of sc-link that
+ *              wasn't generated is empty.
+ *
+ * @return Returns SC_RESULT_OK if all sc-links were generated, otherwise the result of the last failed generation.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_links_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * addrs);
+
+/*!
+ * @brief Generates sc-connectors with the specified types between the specified sc-elements.
+ *
+ * Sc-elements of all sc-connectors are allocated before monitors of their begin and end sc-elements are acquired.
+ * Sc-connectors are grouped by these monitors. Monitors of each group are acquired once and all sc-connectors of the
+ * group are generated under them in order of the arrays.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of the new sc-connectors.
+ * @param beg_addrs sc-addrs of the begin sc-elements.
+ * @param end_addrs sc-addrs of the end sc-elements.
+ * @param count Count of the new sc-connectors.
+ * @param connector_addrs Array of `count` sc-addrs where sc-addrs of the generated sc-connectors are stored. sc-addr
+ *                        of sc-connector that wasn't generated is empty.
+ *
+ * @return Returns SC_RESULT_OK if all sc-connectors were generated, otherwise the result of the last failed
+ *         generation.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_arcs_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_addr const * beg_addrs,
+    sc_addr const * end_addrs,
+    sc_uint32 count,
+    sc_addr * connector_addrs);
+
 /*!
  * @brief Retrieves the count of output connectors for the specified sc-element.
  *
@@ -647,4 +713,19 @@ sc_result sc_storage_get_elements_stat(sc_stat * stat);
  */
 sc_result sc_storage_save(sc_memory_context const * ctx);
 
+/*!
+ * @brief Saves sc-segments changed since the last full save of the sc-storage.
+ *
+ * This function is used by the periodic dump of the sc-storage. It writes only images of changed
+ * sc-segments next to the last fully saved sc-segments, so the cost of a dump is proportional to the
+ * amount of changes rather than to the size of the sc-storage. When most sc-segments are changed,
+ * it saves the whole sc-storage as `sc_storage_save` does.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *         If an error occurs during the saving process, an appropriate error code is returned.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_save_changes();
+
 #endif
@@ -63,7 +63,7 @@ void _sc_storage_dump_manager_delete_timer(sc_timer timer)
 void _sc_storage_dump_timer()
 {
   sc_memory_info("Dump sc-memory by period");
-  sc_storage_save(null_ptr);
+  sc_storage_save_changes();
 }
 
 void _sc_storage_dump_statistics_timer()
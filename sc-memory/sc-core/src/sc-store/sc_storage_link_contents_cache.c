@@ -0,0 +1,257 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_storage_link_contents_cache.h"
+
+#include "sc-core/sc_stream_memory.h"
+#include "sc-core/sc-base/sc_allocator.h"
+
+#include "sc-store/sc-base/sc_message.h"
+#include "sc-store/sc-base/sc_mutex_private.h"
+#include "sc-store/sc-container/sc_number_hash_map.h"
+
+#include "sc_stream_private.h"
+
+#define SC_STORAGE_LINK_CONTENTS_CACHE_SHARDS_COUNT 16
+
+typedef struct _sc_storage_link_content sc_storage_link_content;
+
+struct _sc_storage_link_content
+{
+  sc_char * string;                    // content of sc-link
+  sc_uint32 string_size;               // size of content
+  sc_uint32 references_count;          // number of streams and cache shard referencing content, changed atomically
+  sc_addr_hash link_hash;              // hash of sc-link sc-address
+  sc_storage_link_content * previous;  // more recently used content of cache shard
+  sc_storage_link_content * next;      // less recently used content of cache shard
+};
+
+typedef struct
+{
+  sc_mutex mutex;                                 // mutex for contents, their usage list and counters
+  sc_number_hash_map * link_hashes_contents;      // map with hashes of sc-links and pointers to their contents
+  sc_storage_link_content * most_recently_used;   // head of contents usage list
+  sc_storage_link_content * least_recently_used;  // tail of contents usage list
+  sc_uint64 size;                                 // number of bytes used by contents
+  sc_uint64 max_size;                             // maximum number of bytes used by contents
+  sc_uint64 hits_count;
+  sc_uint64 misses_count;
+  sc_uint64 evictions_count;
+} sc_storage_link_contents_cache_shard;
+
+struct _sc_storage_link_contents_cache
+{
+  sc_storage_link_contents_cache_shard shards[SC_STORAGE_LINK_CONTENTS_CACHE_SHARDS_COUNT];
+};
+
+sc_uint64 _sc_storage_link_content_get_size(sc_storage_link_content const * content)
+{
+  return sizeof(sc_storage_link_content) + content->string_size;
+}
+
+void _sc_storage_link_content_release(void * data)
+{
+  sc_storage_link_content * content = data;
+  if (g_atomic_int_dec_and_test((sc_int32 *)&content->references_count))
+  {
+    sc_mem_free(content->string);
+    sc_mem_free(content);
+  }
+}
+
+sc_stream * _sc_storage_link_content_get_stream(sc_storage_link_content * content)
+{
+  g_atomic_int_inc((sc_int32 *)&content->references_count);
+  return sc_stream_memory_new_shared(
+      content->string, content->string_size, _sc_storage_link_content_release, content);
+}
+
+sc_storage_link_contents_cache_shard * _sc_storage_link_contents_cache_get_shard(
+    sc_storage_link_contents_cache * cache,
+    sc_addr_hash const link_hash)
+{
+  // adjacent sc-links of one sc-segment are distributed over different shards
+  return &cache->shards[link_hash % SC_STORAGE_LINK_CONTENTS_CACHE_SHARDS_COUNT];
+}
+
+void _sc_storage_link_contents_cache_shard_unlink(
+    sc_storage_link_contents_cache_shard * shard,
+    sc_storage_link_content * content)
+{
+  if (content->previous == null_ptr)
+    shard->most_recently_used = content->next;
+  else
+    content->previous->next = content->next;
+
+  if (content->next == null_ptr)
+    shard->least_recently_used = content->previous;
+  else
+    content->next->previous = content->previous;
+
+  content->previous = null_ptr;
+  content->next = null_ptr;
+}
+
+void _sc_storage_link_contents_cache_shard_push_front(
+    sc_storage_link_contents_cache_shard * shard,
+    sc_storage_link_content * content)
+{
+  content->previous = null_ptr;
+  content->next = shard->most_recently_used;
+  if (shard->most_recently_used == null_ptr)
+    shard->least_recently_used = content;
+  else
+    shard->most_recently_used->previous = content;
+  shard->most_recently_used = content;
+}
+
+void _sc_storage_link_contents_cache_shard_erase(
+    sc_storage_link_contents_cache_shard * shard,
+    sc_storage_link_content * content)
+{
+  sc_number_hash_map_remove(shard->link_hashes_contents, content->link_hash, null_ptr);
+  _sc_storage_link_contents_cache_shard_unlink(shard, content);
+  shard->size -= _sc_storage_link_content_get_size(content);
+  _sc_storage_link_content_release(content);
+}
+
+void sc_storage_link_contents_cache_initialize(
+    sc_storage_link_contents_cache ** cache,
+    sc_memory_params const * params)
+{
+  *cache = null_ptr;
+  if (params->link_contents_cache_size == 0)
+    return;
+
+  *cache = sc_mem_new(sc_storage_link_contents_cache, 1);
+  for (sc_uint32 i = 0; i < SC_STORAGE_LINK_CONTENTS_CACHE_SHARDS_COUNT; ++i)
+  {
+    sc_storage_link_contents_cache_shard * shard = &(*cache)->shards[i];
+    sc_mutex_init(&shard->mutex);
+    sc_number_hash_map_initialize(&shard->link_hashes_contents, 0);
+    shard->max_size = params->link_contents_cache_size / SC_STORAGE_LINK_CONTENTS_CACHE_SHARDS_COUNT;
+  }
+
+  sc_message("\tLink contents cache size: %u", params->link_contents_cache_size);
+}
+
+void sc_storage_link_contents_cache_shutdown(sc_storage_link_contents_cache * cache)
+{
+  if (cache == null_ptr)
+    return;
+
+  for (sc_uint32 i = 0; i < SC_STORAGE_LINK_CONTENTS_CACHE_SHARDS_COUNT; ++i)
+  {
+    sc_storage_link_contents_cache_shard * shard = &cache->shards[i];
+    sc_mutex_lock(&shard->mutex);
+    while (shard->most_recently_used != null_ptr)
+      _sc_storage_link_contents_cache_shard_erase(shard, shard->most_recently_used);
+    sc_mutex_unlock(&shard->mutex);
+
+    sc_number_hash_map_destroy(shard->link_hashes_contents);
+    sc_mutex_destroy(&shard->mutex);
+  }
+
+  sc_mem_free(cache);
+}
+
+sc_stream * sc_storage_link_contents_cache_get(sc_storage_link_contents_cache * cache, sc_addr_hash link_hash)
+{
+  if (cache == null_ptr)
+    return null_ptr;
+
+  sc_storage_link_contents_cache_shard * shard = _sc_storage_link_contents_cache_get_shard(cache, link_hash);
+  sc_stream * stream = null_ptr;
+
+  sc_mutex_lock(&shard->mutex);
+  sc_uint64 content_pointer;
+  if (sc_number_hash_map_get(shard->link_hashes_contents, link_hash, &content_pointer))
+  {
+    sc_storage_link_content * content = (sc_storage_link_content *)content_pointer;
+    _sc_storage_link_contents_cache_shard_unlink(shard, content);
+    _sc_storage_link_contents_cache_shard_push_front(shard, content);
+    stream = _sc_storage_link_content_get_stream(content);
+    ++shard->hits_count;
+  }
+  else
+    ++shard->misses_count;
+  sc_mutex_unlock(&shard->mutex);
+
+  return stream;
+}
+
+sc_stream * sc_storage_link_contents_cache_put(
+    sc_storage_link_contents_cache * cache,
+    sc_addr_hash link_hash,
+    sc_char * string,
+    sc_uint32 string_size)
+{
+  if (cache == null_ptr)
+    return sc_stream_memory_new(string, string_size, SC_STREAM_FLAG_READ, SC_TRUE);
+
+  sc_storage_link_content * content = sc_mem_new(sc_storage_link_content, 1);
+  content->string = string;
+  content->string_size = string_size;
+  content->link_hash = link_hash;
+
+  sc_storage_link_contents_cache_shard * shard = _sc_storage_link_contents_cache_get_shard(cache, link_hash);
+  sc_uint64 const content_size = _sc_storage_link_content_get_size(content);
+
+  sc_mutex_lock(&shard->mutex);
+  // content bigger than shard isn't cached, content put by concurrent reader is the same
+  if (content_size <= shard->max_size && !sc_number_hash_map_get(shard->link_hashes_contents, link_hash, null_ptr))
+  {
+    while (shard->size + content_size > shard->max_size)
+    {
+      _sc_storage_link_contents_cache_shard_erase(shard, shard->least_recently_used);
+      ++shard->evictions_count;
+    }
+
+    content->references_count = 1;
+    sc_number_hash_map_insert(shard->link_hashes_contents, link_hash, (sc_uint64)content);
+    _sc_storage_link_contents_cache_shard_push_front(shard, content);
+    shard->size += content_size;
+  }
+  sc_stream * stream = _sc_storage_link_content_get_stream(content);
+  sc_mutex_unlock(&shard->mutex);
+
+  return stream;
+}
+
+void sc_storage_link_contents_cache_remove(sc_storage_link_contents_cache * cache, sc_addr_hash link_hash)
+{
+  if (cache == null_ptr)
+    return;
+
+  sc_storage_link_contents_cache_shard * shard = _sc_storage_link_contents_cache_get_shard(cache, link_hash);
+
+  sc_mutex_lock(&shard->mutex);
+  sc_uint64 content_pointer;
+  if (sc_number_hash_map_get(shard->link_hashes_contents, link_hash, &content_pointer))
+    _sc_storage_link_contents_cache_shard_erase(shard, (sc_storage_link_content *)content_pointer);
+  sc_mutex_unlock(&shard->mutex);
+}
+
+void sc_storage_link_contents_cache_get_statistics(
+    sc_storage_link_contents_cache * cache,
+    sc_storage_link_contents_cache_statistics * statistics)
+{
+  sc_mem_set(statistics, 0, sizeof(sc_storage_link_contents_cache_statistics));
+  if (cache == null_ptr)
+    return;
+
+  for (sc_uint32 i = 0; i < SC_STORAGE_LINK_CONTENTS_CACHE_SHARDS_COUNT; ++i)
+  {
+    sc_storage_link_contents_cache_shard * shard = &cache->shards[i];
+    sc_mutex_lock(&shard->mutex);
+    statistics->hits_count += shard->hits_count;
+    statistics->misses_count += shard->misses_count;
+    statistics->evictions_count += shard->evictions_count;
+    statistics->contents_count += shard->link_hashes_contents->size;
+    statistics->size += shard->size;
+    sc_mutex_unlock(&shard->mutex);
+  }
+}
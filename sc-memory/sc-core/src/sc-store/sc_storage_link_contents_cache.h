@@ -0,0 +1,82 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_storage_link_contents_cache_h_
+#define _sc_storage_link_contents_cache_h_
+
+#include "sc-core/sc_memory_params.h"
+#include "sc-core/sc_stream.h"
+#include "sc-core/sc_types.h"
+
+//! Statistics of sc-links contents cache.
+typedef struct
+{
+  sc_uint64 hits_count;       ///< Number of sc-links contents read from cache.
+  sc_uint64 misses_count;     ///< Number of sc-links contents not found in cache and read from sc-fs-memory.
+  sc_uint64 evictions_count;  ///< Number of least recently used sc-links contents evicted to fit into cache size.
+  sc_uint64 contents_count;   ///< Number of sc-links contents stored in cache now.
+  sc_uint64 size;             ///< Number of bytes used by sc-links contents stored in cache now.
+} sc_storage_link_contents_cache_statistics;
+
+/*! Bounded cache of sc-links contents read from sc-fs-memory.
+ * Contents are distributed over shards by hashes of sc-links, each shard evicts least recently used contents when
+ * their size exceeds its part of cache size. Streams of cached contents read them without copying: contents are
+ * counted by references and live until the last stream of them is freed.
+ */
+typedef struct _sc_storage_link_contents_cache sc_storage_link_contents_cache;
+
+/*! Initializes sc-links contents cache, if it is enabled by `params->link_contents_cache_size`.
+ * @param cache[out] Pointer to initialized sc-links contents cache or null_ptr, if it is disabled
+ * @param params Sc-memory params
+ */
+void sc_storage_link_contents_cache_initialize(
+    sc_storage_link_contents_cache ** cache,
+    sc_memory_params const * params);
+
+/*! Releases all contents of sc-links contents cache and destroys it. Streams of released contents stay valid.
+ * @param cache Pointer to sc-links contents cache
+ */
+void sc_storage_link_contents_cache_shutdown(sc_storage_link_contents_cache * cache);
+
+/*! Gets stream of cached content of sc-link.
+ * @param cache Pointer to sc-links contents cache
+ * @param link_hash Hash of sc-link sc-address
+ * @returns Stream reading cached content without copying or null_ptr, if content of sc-link isn't cached.
+ * @remarks Call it while sc-link is locked for reading, so its content isn't changed concurrently.
+ */
+sc_stream * sc_storage_link_contents_cache_get(sc_storage_link_contents_cache * cache, sc_addr_hash link_hash);
+
+/*! Puts content of sc-link read from sc-fs-memory into sc-links contents cache and gets stream of it.
+ * @param cache Pointer to sc-links contents cache, it may be null_ptr
+ * @param link_hash Hash of sc-link sc-address
+ * @param string Content of sc-link, cache or returned stream takes ownership of it
+ * @param string_size Size of sc-link content
+ * @returns Stream reading content without copying.
+ * @remarks Call it while sc-link is locked for reading, so content removed by concurrent change isn't put again.
+ */
+sc_stream * sc_storage_link_contents_cache_put(
+    sc_storage_link_contents_cache * cache,
+    sc_addr_hash link_hash,
+    sc_char * string,
+    sc_uint32 string_size);
+
+/*! Removes content of sc-link from sc-links contents cache.
+ * @param cache Pointer to sc-links contents cache
+ * @param link_hash Hash of sc-link sc-address
+ * @remarks Call it after content of sc-link is changed or removed in sc-fs-memory, while sc-link is locked for
+ * writing.
+ */
+void sc_storage_link_contents_cache_remove(sc_storage_link_contents_cache * cache, sc_addr_hash link_hash);
+
+/*! Collects statistics of sc-links contents cache.
+ * @param cache Pointer to sc-links contents cache
+ * @param statistics[out] Pointer to statistics to be filled, it is filled by zeros if cache is disabled
+ */
+void sc_storage_link_contents_cache_get_statistics(
+    sc_storage_link_contents_cache * cache,
+    sc_storage_link_contents_cache_statistics * statistics);
+
+#endif
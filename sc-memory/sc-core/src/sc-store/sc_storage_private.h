@@ -7,13 +7,22 @@
 #ifndef _sc_storage_private_h_
 #define _sc_storage_private_h_
 
-#include "sc-store/sc-base/sc_monitor_table.h"
-
 #include "sc-store/sc-event/sc_event_private.h"
 
 #include "sc-store/sc_storage_dump_manager.h"
+#include "sc-store/sc_storage_link_contents_cache.h"
+#include "sc-store/sc_storage_wal.h"
+
+#define SC_STORAGE_THREAD_CACHE_OFFSETS_COUNT 64
 
-#include "sc-store/sc-base/sc_monitor_table_private.h"
+typedef struct _sc_storage_thread_cache
+{
+  sc_segment * segment;                                           // segment reserved by thread to generate sc-elements
+  sc_segment * offsets_segment;                                   // segment of cached free offsets
+  sc_addr_offset offsets[SC_STORAGE_THREAD_CACHE_OFFSETS_COUNT];  // free offsets taken in bulk
+  sc_uint32 offsets_count;
+  sc_uint32 next_offset_idx;  // index of offset of the next generated sc-element
+} sc_storage_thread_cache;
 
 struct _sc_storage
 {
@@ -23,10 +32,11 @@ struct _sc_storage
   sc_addr_seg last_not_engaged_segment_num;
   sc_addr_seg last_released_segment_num;
   sc_monitor segments_monitor;
-  sc_monitor_table addr_monitors_table;
-  sc_hash_table * processes_segments_table;
+  sc_hash_table * processes_caches_table;  // caches of free offsets of threads generating sc-elements
   sc_monitor processes_monitor;
   sc_storage_dump_manager * dump_manager;
+  sc_storage_wal * wal;
+  sc_storage_link_contents_cache * link_contents_cache;
   sc_event_emission_manager * events_emission_manager;
   sc_event_subscription_manager * events_subscription_manager;
 };
@@ -37,10 +47,25 @@ sc_event_emission_manager * sc_storage_get_event_emission_manager();
 
 sc_event_subscription_manager * sc_storage_get_event_subscription_manager();
 
+sc_storage_link_contents_cache * sc_storage_get_link_contents_cache();
+
 sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_addr * addr);
 
 sc_result sc_storage_get_element_by_addr(sc_addr addr, sc_element ** el);
 
+/*! Gets monitor locking sc-element, it is one of monitors striping sc-elements of sc-segment.
+ * @param addr Sc-address of sc-element
+ * @returns Pointer to monitor or null_ptr, if sc-address is not valid.
+ */
+sc_monitor * sc_storage_get_element_monitor(sc_addr addr);
+
+/*! Gets sc-connector record of sc-element.
+ * @param addr Sc-address of sc-element
+ * @param element Pointer to sc-element
+ * @returns Pointer to sc-connector record stored in sc-element or, in compact sc-elements layout, in its segment.
+ */
+sc_arc_info * sc_storage_get_element_arc(sc_addr addr, sc_element * element);
+
 sc_result sc_storage_free_element(sc_addr addr);
 
 #endif
@@ -0,0 +1,795 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_storage_wal.h"
+
+#include <pthread.h>
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#include "sc_segment.h"
+#include "sc_storage_private.h"
+#include "sc_memory_private.h"
+
+#include "sc-fs-memory/sc_fs_memory.h"
+#include "sc-fs-memory/sc_file_system.h"
+#include "sc-fs-memory/sc_io.h"
+
+#include "sc-base/sc_mutex_private.h"
+
+#include "sc_stream_private.h"
+
+#define SC_STORAGE_WAL_MAGIC 0x4c415753  // "SWAL"
+#define SC_STORAGE_WAL_INITIAL_BUFFER_SIZE 4096
+#define SC_STORAGE_WAL_MAX_BUFFER_SIZE 0x100000
+#define SC_STORAGE_WAL_SLEEP_PERIOD 100  // milliseconds
+
+// Log record layout: [record type][payload size][payload][checksum of record type, payload size and payload]
+#define SC_STORAGE_WAL_RECORD_HEADER_SIZE (sizeof(sc_uint8) + sizeof(sc_uint32))
+#define SC_STORAGE_WAL_RECORD_CHECKSUM_SIZE sizeof(sc_uint32)
+
+typedef enum
+{
+  SC_STORAGE_WAL_ELEMENT_RECORD = 1,
+  SC_STORAGE_WAL_SEGMENT_RECORD,
+  SC_STORAGE_WAL_STORAGE_RECORD,
+  SC_STORAGE_WAL_LINK_CONTENT_RECORD,
+  SC_STORAGE_WAL_LINK_CONTENT_REMOVAL_RECORD,
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  SC_STORAGE_WAL_ARC_RECORD,
+#endif
+  SC_STORAGE_WAL_OPERATION_RECORD,  // records of one operation, they are replayed only together
+} sc_storage_wal_record_type;
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+// Segment record contains its number, offsets of sc-elements and indices of sc-connectors records
+#  define SC_STORAGE_WAL_SEGMENT_ATTRIBUTES_COUNT 5
+#else
+#  define SC_STORAGE_WAL_SEGMENT_ATTRIBUTES_COUNT 3
+#endif
+
+struct _sc_storage_wal
+{
+  sc_char * path;             // log file path
+  sc_char * checkpoint_path;  // log file path with records appended before the running or failed sc-memory save
+  sc_io_channel * channel;    // channel of log file to append records
+  sc_uint32 sync_period;      // period (in milliseconds) to write appended records into log file
+  sc_int32 is_running;        // SC_TRUE, while thread writes appended records periodically, it is accessed atomically
+  pthread_t sync_thread;
+  sc_mutex buffer_mutex;                 // mutex to append records into buffer
+  sc_mutex file_mutex;                   // mutex to write records into log file and to switch log files
+  sc_storage_wal_buffer buffer;          // records appended since the last writing
+  sc_storage_wal_buffer written_buffer;  // records being written into log file
+};
+
+sc_uint32 _sc_storage_wal_checksum_append(sc_uint32 checksum, sc_char const * data, sc_uint32 size)
+{
+  // FNV-1a hash
+  for (sc_uint32 i = 0; i < size; ++i)
+  {
+    checksum ^= (sc_uint8)data[i];
+    checksum *= 16777619u;
+  }
+  return checksum;
+}
+
+sc_uint32 _sc_storage_wal_checksum(sc_char const * data, sc_uint32 size)
+{
+  return _sc_storage_wal_checksum_append(2166136261u, data, size);
+}
+
+void _sc_storage_wal_buffer_reserve(sc_storage_wal_buffer * buffer, sc_uint32 size)
+{
+  if (buffer->size + size <= buffer->capacity)
+    return;
+
+  sc_uint32 capacity = buffer->capacity == 0 ? SC_STORAGE_WAL_INITIAL_BUFFER_SIZE : buffer->capacity;
+  while (capacity < buffer->size + size)
+    capacity *= 2;
+
+  sc_char * data = sc_mem_new(sc_char, capacity);
+  if (buffer->size != 0)
+    sc_mem_cpy(data, buffer->data, buffer->size);
+  sc_mem_free(buffer->data);
+  buffer->data = data;
+  buffer->capacity = capacity;
+}
+
+sc_io_channel * _sc_storage_wal_new_channel(sc_char const * path)
+{
+  sc_bool const is_new_file = sc_fs_is_file(path) == SC_FALSE;
+
+  sc_io_channel * channel = sc_io_new_channel(path, "a", null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_memory_error("Can't open sc-storage write-ahead log %s", path);
+    return null_ptr;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_uint32 const magic = SC_STORAGE_WAL_MAGIC;
+  sc_uint64 written_bytes = 0;
+  if (is_new_file
+      && (sc_io_channel_write_chars(channel, &magic, sizeof(magic), &written_bytes, null_ptr) != SC_FS_IO_STATUS_NORMAL
+          || written_bytes != sizeof(magic) || sc_io_channel_flush(channel, null_ptr) != SC_FS_IO_STATUS_NORMAL))
+    sc_memory_error("Error while sc-storage write-ahead log header writing to %s", path);
+
+  return channel;
+}
+
+//! Writes appended records into log file, it is called while file mutex is locked.
+void _sc_storage_wal_write_buffer(sc_storage_wal * wal)
+{
+  // records are appended into other buffer while these ones are written
+  sc_mutex_lock(&wal->buffer_mutex);
+  sc_storage_wal_buffer const buffer = wal->buffer;
+  wal->buffer = wal->written_buffer;
+  wal->written_buffer = buffer;
+  sc_mutex_unlock(&wal->buffer_mutex);
+
+  sc_uint64 written_bytes = 0;
+  if (wal->written_buffer.size != 0 && wal->channel != null_ptr
+      && (sc_io_channel_write_chars(
+              wal->channel, wal->written_buffer.data, wal->written_buffer.size, &written_bytes, null_ptr)
+              != SC_FS_IO_STATUS_NORMAL
+          || written_bytes != wal->written_buffer.size
+          || sc_io_channel_flush(wal->channel, null_ptr) != SC_FS_IO_STATUS_NORMAL
+          || sc_io_channel_sync(wal->channel) != 0))
+    sc_memory_error("Error while sc-storage write-ahead log writing to %s", wal->path);
+  wal->written_buffer.size = 0;
+}
+
+void _sc_storage_wal_flush(sc_storage_wal * wal)
+{
+  sc_mutex_lock(&wal->file_mutex);
+  _sc_storage_wal_write_buffer(wal);
+  sc_mutex_unlock(&wal->file_mutex);
+}
+
+void _sc_storage_wal_buffer_write_record(
+    sc_storage_wal_buffer * buffer,
+    sc_storage_wal_record_type type,
+    void const * payload,
+    sc_uint32 payload_size,
+    void const * payload_tail,
+    sc_uint32 payload_tail_size)
+{
+  sc_uint8 const record_type = type;
+  sc_uint32 const record_payload_size = payload_size + payload_tail_size;
+  sc_uint32 const record_size =
+      SC_STORAGE_WAL_RECORD_HEADER_SIZE + record_payload_size + SC_STORAGE_WAL_RECORD_CHECKSUM_SIZE;
+
+  _sc_storage_wal_buffer_reserve(buffer, record_size);
+  sc_char * record = buffer->data + buffer->size;
+  sc_mem_cpy(record, &record_type, sizeof(record_type));
+  sc_mem_cpy(record + sizeof(record_type), &record_payload_size, sizeof(record_payload_size));
+  sc_mem_cpy(record + SC_STORAGE_WAL_RECORD_HEADER_SIZE, payload, payload_size);
+  if (payload_tail_size != 0)
+    sc_mem_cpy(record + SC_STORAGE_WAL_RECORD_HEADER_SIZE + payload_size, payload_tail, payload_tail_size);
+  sc_uint32 const checksum =
+      _sc_storage_wal_checksum(record, SC_STORAGE_WAL_RECORD_HEADER_SIZE + record_payload_size);
+  sc_mem_cpy(
+      record + SC_STORAGE_WAL_RECORD_HEADER_SIZE + record_payload_size,
+      &checksum,
+      SC_STORAGE_WAL_RECORD_CHECKSUM_SIZE);
+  buffer->size += record_size;
+}
+
+void _sc_storage_wal_append(
+    sc_storage_wal * wal,
+    sc_storage_wal_record_type type,
+    void const * payload,
+    sc_uint32 payload_size,
+    void const * payload_tail,
+    sc_uint32 payload_tail_size)
+{
+  if (wal == null_ptr)
+    return;
+
+  sc_mutex_lock(&wal->buffer_mutex);
+
+  _sc_storage_wal_buffer_write_record(&wal->buffer, type, payload, payload_size, payload_tail, payload_tail_size);
+  sc_bool const is_write_needed = wal->sync_period == 0 || wal->buffer.size >= SC_STORAGE_WAL_MAX_BUFFER_SIZE;
+
+  sc_mutex_unlock(&wal->buffer_mutex);
+
+  // records appended by other threads are written together with this one
+  if (is_write_needed)
+    _sc_storage_wal_flush(wal);
+}
+
+void * _sc_storage_wal_sync_periodic(void * arg)
+{
+  sc_storage_wal * wal = arg;
+
+  while (g_atomic_int_get(&wal->is_running))
+  {
+    for (sc_uint32 i = 0; i < wal->sync_period && g_atomic_int_get(&wal->is_running); i += SC_STORAGE_WAL_SLEEP_PERIOD)
+    {
+      sc_uint32 const sleep_period = wal->sync_period - i < SC_STORAGE_WAL_SLEEP_PERIOD
+                                         ? wal->sync_period - i
+                                         : SC_STORAGE_WAL_SLEEP_PERIOD;
+      g_usleep(sleep_period * 1000);
+    }
+
+    _sc_storage_wal_flush(wal);
+  }
+
+  pthread_exit(null_ptr);
+}
+
+sc_segment * _sc_storage_wal_get_segment(sc_storage * storage, sc_addr_seg num)
+{
+  if (num == 0 || num > storage->max_segments_count)
+    return null_ptr;
+
+  while (storage->segments_count < num)
+  {
+    storage->segments[storage->segments_count] = sc_segment_new(storage->segments_count + 1);
+    ++storage->segments_count;
+  }
+
+  return storage->segments[num - 1];
+}
+
+/*! Reads record at position in data, if it is complete and its checksum is valid.
+ * @returns Size of read record or 0, if record is torn or corrupted.
+ */
+sc_uint64 _sc_storage_wal_read_record(
+    sc_char const * data,
+    sc_uint64 size,
+    sc_uint64 position,
+    sc_uint8 * type,
+    sc_char const ** payload,
+    sc_uint32 * payload_size)
+{
+  if (position + SC_STORAGE_WAL_RECORD_HEADER_SIZE > size)
+    return 0;
+
+  sc_mem_cpy(type, data + position, sizeof(*type));
+  sc_mem_cpy(payload_size, data + position + sizeof(*type), sizeof(*payload_size));
+
+  sc_uint64 const record_size =
+      SC_STORAGE_WAL_RECORD_HEADER_SIZE + (sc_uint64)*payload_size + SC_STORAGE_WAL_RECORD_CHECKSUM_SIZE;
+  if (position + record_size > size)
+    return 0;
+
+  sc_uint32 checksum;
+  sc_mem_cpy(&checksum, data + position + SC_STORAGE_WAL_RECORD_HEADER_SIZE + *payload_size, sizeof(checksum));
+  if (checksum != _sc_storage_wal_checksum(data + position, SC_STORAGE_WAL_RECORD_HEADER_SIZE + *payload_size))
+    return 0;
+
+  *payload = data + position + SC_STORAGE_WAL_RECORD_HEADER_SIZE;
+  return record_size;
+}
+
+sc_bool _sc_storage_wal_apply_record(
+    sc_storage * storage,
+    sc_storage_wal_record_type type,
+    sc_char const * payload,
+    sc_uint32 payload_size)
+{
+  switch (type)
+  {
+  case SC_STORAGE_WAL_OPERATION_RECORD:
+  {
+    // the whole operation record is checked by its checksum, so all its records are complete
+    sc_uint64 position = 0;
+    while (position < payload_size)
+    {
+      sc_uint8 operation_record_type;
+      sc_char const * operation_record_payload;
+      sc_uint32 operation_record_payload_size;
+      sc_uint64 const operation_record_size = _sc_storage_wal_read_record(
+          payload,
+          payload_size,
+          position,
+          &operation_record_type,
+          &operation_record_payload,
+          &operation_record_payload_size);
+      if (operation_record_size == 0 || operation_record_type == SC_STORAGE_WAL_OPERATION_RECORD
+          || _sc_storage_wal_apply_record(
+                 storage, operation_record_type, operation_record_payload, operation_record_payload_size)
+                 == SC_FALSE)
+        return SC_FALSE;
+
+      position += operation_record_size;
+    }
+    return SC_TRUE;
+  }
+
+  case SC_STORAGE_WAL_ELEMENT_RECORD:
+  {
+    sc_addr addr;
+    if (payload_size != sizeof(addr) + sizeof(sc_element))
+      return SC_FALSE;
+    sc_mem_cpy(&addr, payload, sizeof(addr));
+
+    sc_segment * segment = _sc_storage_wal_get_segment(storage, addr.seg);
+    if (segment == null_ptr || addr.offset >= SC_SEGMENT_ELEMENTS_COUNT)
+      return SC_FALSE;
+
+    sc_mem_cpy(&segment->elements[addr.offset], payload + sizeof(addr), sizeof(sc_element));
+    // offset reserved before the last save is saved as free, so it is engaged again by its sc-element
+    if (addr.offset > segment->last_engaged_offset)
+      segment->last_engaged_offset = addr.offset;
+    sc_segment_mark_changed(segment);
+    return SC_TRUE;
+  }
+
+  case SC_STORAGE_WAL_SEGMENT_RECORD:
+  {
+    sc_addr_seg segment_attributes[SC_STORAGE_WAL_SEGMENT_ATTRIBUTES_COUNT];
+    if (payload_size != sizeof(segment_attributes))
+      return SC_FALSE;
+    sc_mem_cpy(segment_attributes, payload, sizeof(segment_attributes));
+
+    sc_segment * segment = _sc_storage_wal_get_segment(storage, segment_attributes[0]);
+    if (segment == null_ptr)
+      return SC_FALSE;
+
+    segment->last_engaged_offset = segment_attributes[1];
+    segment->last_released_offset = segment_attributes[2];
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+    segment->last_engaged_arc_index = segment_attributes[3];
+    segment->last_released_arc_index = segment_attributes[4];
+#endif
+    sc_segment_mark_changed(segment);
+    return SC_TRUE;
+  }
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+  case SC_STORAGE_WAL_ARC_RECORD:
+  {
+    sc_addr_seg arc_attributes[2];
+    if (payload_size != sizeof(arc_attributes) + sizeof(sc_arc_info))
+      return SC_FALSE;
+    sc_mem_cpy(arc_attributes, payload, sizeof(arc_attributes));
+
+    sc_segment * segment = _sc_storage_wal_get_segment(storage, arc_attributes[0]);
+    if (segment == null_ptr || arc_attributes[1] >= SC_SEGMENT_ELEMENTS_COUNT)
+      return SC_FALSE;
+
+    sc_mem_cpy(&segment->arcs[arc_attributes[1]], payload + sizeof(arc_attributes), sizeof(sc_arc_info));
+    sc_segment_mark_changed(segment);
+    return SC_TRUE;
+  }
+#endif
+
+  case SC_STORAGE_WAL_STORAGE_RECORD:
+  {
+    sc_addr_seg storage_attributes[3];
+    if (payload_size != sizeof(storage_attributes))
+      return SC_FALSE;
+    sc_mem_cpy(storage_attributes, payload, sizeof(storage_attributes));
+
+    if (storage_attributes[0] != 0 && _sc_storage_wal_get_segment(storage, storage_attributes[0]) == null_ptr)
+      return SC_FALSE;
+
+    storage->last_not_engaged_segment_num = storage_attributes[1];
+    storage->last_released_segment_num = storage_attributes[2];
+    return SC_TRUE;
+  }
+
+  case SC_STORAGE_WAL_LINK_CONTENT_RECORD:
+  {
+    sc_addr_hash link_hash;
+    sc_uint8 is_searchable_string;
+    if (payload_size < sizeof(link_hash) + sizeof(is_searchable_string))
+      return SC_FALSE;
+    sc_mem_cpy(&link_hash, payload, sizeof(link_hash));
+    sc_mem_cpy(&is_searchable_string, payload + sizeof(link_hash), sizeof(is_searchable_string));
+
+    sc_uint32 const string_size = payload_size - sizeof(link_hash) - sizeof(is_searchable_string);
+    return sc_fs_memory_link_string_ext(
+               link_hash,
+               payload + sizeof(link_hash) + sizeof(is_searchable_string),
+               string_size,
+               is_searchable_string)
+           == SC_FS_MEMORY_OK;
+  }
+
+  case SC_STORAGE_WAL_LINK_CONTENT_REMOVAL_RECORD:
+  {
+    sc_addr_hash link_hash;
+    if (payload_size != sizeof(link_hash))
+      return SC_FALSE;
+    sc_mem_cpy(&link_hash, payload, sizeof(link_hash));
+
+    return sc_fs_memory_unlink_string(link_hash) == SC_FS_MEMORY_OK;
+  }
+  }
+
+  return SC_FALSE;
+}
+
+sc_result _sc_storage_wal_replay_file(sc_char const * path, sc_storage * storage, sc_uint32 * records_count)
+{
+  if (sc_fs_is_file(path) == SC_FALSE)
+    return SC_RESULT_OK;
+
+  sc_fs_mapped_file * file = sc_fs_map_file(path);
+  if (file == null_ptr)
+    return SC_RESULT_ERROR;
+
+  sc_char const * data = sc_fs_mapped_file_get_data(file);
+  sc_uint64 const size = sc_fs_mapped_file_get_size(file);
+  sc_uint32 magic = 0;
+  if (size >= sizeof(magic))
+    sc_mem_cpy(&magic, data, sizeof(magic));
+
+  // log file is created empty, if crash happened before its header writing
+  if (magic != SC_STORAGE_WAL_MAGIC)
+  {
+    sc_fs_unmap_file(file);
+    if (size > sizeof(magic))
+    {
+      sc_memory_error("Invalid sc-storage write-ahead log %s", path);
+      return SC_RESULT_ERROR;
+    }
+
+    sc_fs_remove_file(path);
+    return SC_RESULT_OK;
+  }
+
+  sc_uint64 position = sizeof(magic);
+  while (SC_TRUE)
+  {
+    sc_uint8 type;
+    sc_char const * payload;
+    sc_uint32 payload_size;
+    sc_uint64 const record_size = _sc_storage_wal_read_record(data, size, position, &type, &payload, &payload_size);
+    if (record_size == 0)
+      break;
+
+    if (_sc_storage_wal_apply_record(storage, type, payload, payload_size) == SC_FALSE)
+    {
+      sc_memory_error("Error while sc-storage write-ahead log record %d replaying from %s", *records_count, path);
+      sc_fs_unmap_file(file);
+      return SC_RESULT_ERROR;
+    }
+
+    ++*records_count;
+    position += record_size;
+  }
+
+  sc_fs_unmap_file(file);
+
+  // records torn by a crash weren't completed and are cut off to append new records after complete ones
+  if (position != size)
+  {
+    sc_memory_warning("Cut off %ld bytes of torn records from sc-storage write-ahead log %s", size - position, path);
+    if (sc_fs_truncate_file(path, position) == SC_FALSE)
+    {
+      sc_memory_error("Can't cut off torn records from sc-storage write-ahead log %s", path);
+      return SC_RESULT_ERROR;
+    }
+  }
+
+  return SC_RESULT_OK;
+}
+
+void sc_storage_wal_initialize(sc_storage_wal ** wal, sc_memory_params const * params)
+{
+  *wal = null_ptr;
+  if (params->wal == SC_FALSE || params->storage == null_ptr)
+    return;
+
+  *wal = sc_mem_new(sc_storage_wal, 1);
+  sc_fs_concat_path(params->storage, "wal.scdb", &(*wal)->path);
+  sc_fs_concat_path(params->storage, "wal_checkpoint.scdb", &(*wal)->checkpoint_path);
+  (*wal)->sync_period = params->wal_sync_period;
+  sc_mutex_init(&(*wal)->buffer_mutex);
+  sc_mutex_init(&(*wal)->file_mutex);
+
+  sc_memory_info("Initialize sc-storage write-ahead log");
+  sc_message("\tWrite-ahead log sync period: %d milliseconds", (*wal)->sync_period);
+
+  if (params->clear == SC_TRUE)
+  {
+    sc_fs_remove_file((*wal)->checkpoint_path);
+    sc_fs_remove_file((*wal)->path);
+  }
+}
+
+sc_result sc_storage_wal_open(sc_storage_wal * wal, sc_storage * storage)
+{
+  if (wal == null_ptr)
+    return SC_RESULT_OK;
+
+  // records of the checkpoint log file are made before records of the log file
+  sc_uint32 records_count = 0;
+  if (_sc_storage_wal_replay_file(wal->checkpoint_path, storage, &records_count) != SC_RESULT_OK
+      || _sc_storage_wal_replay_file(wal->path, storage, &records_count) != SC_RESULT_OK)
+    return SC_RESULT_ERROR;
+  if (records_count != 0)
+    sc_memory_info("Replayed %d records of sc-storage write-ahead log", records_count);
+
+  wal->channel = _sc_storage_wal_new_channel(wal->path);
+  if (wal->channel == null_ptr)
+    return SC_RESULT_ERROR;
+
+  if (wal->sync_period != 0)
+  {
+    g_atomic_int_set(&wal->is_running, SC_TRUE);
+    pthread_create(&wal->sync_thread, null_ptr, _sc_storage_wal_sync_periodic, wal);
+  }
+
+  return SC_RESULT_OK;
+}
+
+void sc_storage_wal_shutdown(sc_storage_wal * wal)
+{
+  if (wal == null_ptr)
+    return;
+
+  if (g_atomic_int_get(&wal->is_running))
+  {
+    g_atomic_int_set(&wal->is_running, SC_FALSE);
+    pthread_join(wal->sync_thread, null_ptr);
+  }
+
+  _sc_storage_wal_flush(wal);
+  if (wal->channel != null_ptr)
+  {
+    sc_io_channel_shutdown(wal->channel, SC_TRUE, null_ptr);
+  }
+
+  sc_mutex_destroy(&wal->buffer_mutex);
+  sc_mutex_destroy(&wal->file_mutex);
+  sc_mem_free(wal->buffer.data);
+  sc_mem_free(wal->written_buffer.data);
+  sc_mem_free(wal->checkpoint_path);
+  sc_mem_free(wal->path);
+  sc_mem_free(wal);
+}
+
+void sc_storage_wal_write_element(sc_storage_wal * wal, sc_addr addr, sc_element const * element)
+{
+  _sc_storage_wal_append(wal, SC_STORAGE_WAL_ELEMENT_RECORD, &addr, sizeof(addr), element, sizeof(sc_element));
+}
+
+void sc_storage_wal_start_operation(sc_storage_wal * wal, sc_storage_wal_operation * operation)
+{
+  *operation = (sc_storage_wal_operation){.wal = wal};
+}
+
+void sc_storage_wal_operation_write_element(
+    sc_storage_wal_operation * operation,
+    sc_addr addr,
+    sc_element const * element)
+{
+  if (operation->wal == null_ptr)
+    return;
+
+  _sc_storage_wal_buffer_write_record(
+      &operation->records, SC_STORAGE_WAL_ELEMENT_RECORD, &addr, sizeof(addr), element, sizeof(sc_element));
+}
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+void sc_storage_wal_operation_write_arc(
+    sc_storage_wal_operation * operation,
+    sc_segment const * segment,
+    sc_addr_offset arc_index)
+{
+  if (operation->wal == null_ptr)
+    return;
+
+  sc_addr_seg const arc_attributes[2] = {segment->num, arc_index};
+  _sc_storage_wal_buffer_write_record(
+      &operation->records,
+      SC_STORAGE_WAL_ARC_RECORD,
+      arc_attributes,
+      sizeof(arc_attributes),
+      &segment->arcs[arc_index],
+      sizeof(sc_arc_info));
+}
+#endif
+
+void sc_storage_wal_finish_operation(sc_storage_wal_operation * operation)
+{
+  if (operation->wal == null_ptr)
+    return;
+
+  if (operation->records.size != 0)
+    _sc_storage_wal_append(
+        operation->wal, SC_STORAGE_WAL_OPERATION_RECORD, operation->records.data, operation->records.size, null_ptr, 0);
+  sc_mem_free(operation->records.data);
+  operation->records = (sc_storage_wal_buffer){0};
+}
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+void sc_storage_wal_write_arc(sc_storage_wal * wal, sc_segment const * segment, sc_addr_offset arc_index)
+{
+  sc_addr_seg const arc_attributes[2] = {segment->num, arc_index};
+  _sc_storage_wal_append(
+      wal,
+      SC_STORAGE_WAL_ARC_RECORD,
+      arc_attributes,
+      sizeof(arc_attributes),
+      &segment->arcs[arc_index],
+      sizeof(sc_arc_info));
+}
+#endif
+
+void sc_storage_wal_write_segment(sc_storage_wal * wal, sc_segment const * segment)
+{
+  sc_addr_seg const segment_attributes[SC_STORAGE_WAL_SEGMENT_ATTRIBUTES_COUNT] = {
+      segment->num,
+      segment->last_engaged_offset,
+      segment->last_released_offset,
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+      segment->last_engaged_arc_index,
+      segment->last_released_arc_index,
+#endif
+  };
+  _sc_storage_wal_append(
+      wal, SC_STORAGE_WAL_SEGMENT_RECORD, segment_attributes, sizeof(segment_attributes), null_ptr, 0);
+}
+
+void sc_storage_wal_write_storage(sc_storage_wal * wal, sc_storage const * storage)
+{
+  sc_addr_seg const storage_attributes[3] = {
+      storage->segments_count, storage->last_not_engaged_segment_num, storage->last_released_segment_num};
+  _sc_storage_wal_append(
+      wal, SC_STORAGE_WAL_STORAGE_RECORD, storage_attributes, sizeof(storage_attributes), null_ptr, 0);
+}
+
+void sc_storage_wal_write_link_content(
+    sc_storage_wal * wal,
+    sc_addr_hash link_hash,
+    sc_char const * string,
+    sc_uint32 string_size,
+    sc_bool is_searchable_string)
+{
+  sc_char link_attributes[sizeof(link_hash) + sizeof(sc_uint8)];
+  sc_mem_cpy(link_attributes, &link_hash, sizeof(link_hash));
+  link_attributes[sizeof(link_hash)] = (sc_char)is_searchable_string;
+  _sc_storage_wal_append(
+      wal, SC_STORAGE_WAL_LINK_CONTENT_RECORD, link_attributes, sizeof(link_attributes), string, string_size);
+}
+
+sc_bool _sc_storage_wal_write_chars(sc_storage_wal * wal, sc_char const * chars, sc_uint32 size)
+{
+  sc_uint64 written_bytes = 0;
+  return sc_io_channel_write_chars(wal->channel, chars, size, &written_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+         && written_bytes == size;
+}
+
+sc_result sc_storage_wal_write_link_content_stream(
+    sc_storage_wal * wal,
+    sc_addr_hash link_hash,
+    sc_stream const * stream,
+    sc_bool is_searchable_string)
+{
+  if (wal == null_ptr)
+    return SC_RESULT_OK;
+
+  sc_uint32 string_size;
+  if (sc_stream_seek(stream, SC_STREAM_SEEK_SET, 0) != SC_RESULT_OK
+      || sc_stream_get_length(stream, &string_size) != SC_RESULT_OK)
+  {
+    sc_memory_error("Error while sc-link content reading for sc-storage write-ahead log %s", wal->path);
+    return SC_RESULT_ERROR_STREAM_IO;
+  }
+
+  // small contents are appended into buffer together with other records
+  if (string_size < SC_STREAM_CHUNK_SIZE)
+  {
+    sc_char * string = null_ptr;
+    sc_result result = SC_RESULT_OK;
+    if (sc_stream_get_data(stream, &string, &string_size) == SC_TRUE)
+      sc_storage_wal_write_link_content(
+          wal, link_hash, string == null_ptr ? "" : string, string_size, is_searchable_string);
+    else
+    {
+      sc_memory_error("Error while sc-link content reading for sc-storage write-ahead log %s", wal->path);
+      result = SC_RESULT_ERROR_STREAM_IO;
+    }
+    sc_mem_free(string);
+    return result;
+  }
+
+  sc_char record_header[SC_STORAGE_WAL_RECORD_HEADER_SIZE + sizeof(link_hash) + sizeof(sc_uint8)];
+  {
+    sc_uint8 const record_type = SC_STORAGE_WAL_LINK_CONTENT_RECORD;
+    sc_uint32 const record_payload_size = sizeof(link_hash) + sizeof(sc_uint8) + string_size;
+    sc_mem_cpy(record_header, &record_type, sizeof(record_type));
+    sc_mem_cpy(record_header + sizeof(record_type), &record_payload_size, sizeof(record_payload_size));
+    sc_mem_cpy(record_header + SC_STORAGE_WAL_RECORD_HEADER_SIZE, &link_hash, sizeof(link_hash));
+    record_header[SC_STORAGE_WAL_RECORD_HEADER_SIZE + sizeof(link_hash)] = (sc_char)is_searchable_string;
+  }
+  sc_uint32 checksum = _sc_storage_wal_checksum(record_header, sizeof(record_header));
+
+  sc_char * chunk = sc_mem_new(sc_char, SC_STREAM_CHUNK_SIZE);
+  sc_bool is_read = SC_TRUE;
+  sc_bool is_written = SC_TRUE;
+
+  sc_mutex_lock(&wal->file_mutex);
+
+  // big content is written into log file by chunks after records appended before it
+  _sc_storage_wal_write_buffer(wal);
+  if (wal->channel != null_ptr)
+  {
+    // all records are flushed after writing, so the record starts at the end of log file
+    off_t const record_position = sc_io_channel_get_end_position(wal->channel);
+    is_written = record_position >= 0 && _sc_storage_wal_write_chars(wal, record_header, sizeof(record_header));
+    for (sc_uint64 written_size = 0; is_written && written_size < string_size; written_size += SC_STREAM_CHUNK_SIZE)
+    {
+      sc_uint32 chunk_size = SC_STREAM_CHUNK_SIZE;
+      if (chunk_size > string_size - written_size)
+        chunk_size = string_size - written_size;
+
+      if (sc_stream_read_data_full(stream, chunk, chunk_size) == SC_FALSE)
+      {
+        is_read = SC_FALSE;
+        break;
+      }
+
+      checksum = _sc_storage_wal_checksum_append(checksum, chunk, chunk_size);
+      is_written = _sc_storage_wal_write_chars(wal, chunk, chunk_size);
+    }
+
+    // record with unread content is removed, otherwise replay would stop on it or overwrite content of sc-link
+    if (is_read == SC_FALSE)
+      is_written = sc_io_channel_flush(wal->channel, null_ptr) == SC_FS_IO_STATUS_NORMAL
+                   && sc_io_channel_truncate(wal->channel, record_position) == 0;
+    else
+      is_written = is_written && _sc_storage_wal_write_chars(wal, (sc_char *)&checksum, sizeof(checksum))
+                   && sc_io_channel_flush(wal->channel, null_ptr) == SC_FS_IO_STATUS_NORMAL
+                   && sc_io_channel_sync(wal->channel) == 0;
+  }
+
+  sc_mutex_unlock(&wal->file_mutex);
+
+  sc_mem_free(chunk);
+
+  if (is_written == SC_FALSE)
+    sc_memory_error("Error while sc-storage write-ahead log writing to %s", wal->path);
+  if (is_read == SC_FALSE)
+  {
+    sc_memory_error("Error while sc-link content reading for sc-storage write-ahead log %s", wal->path);
+    return SC_RESULT_ERROR_STREAM_IO;
+  }
+
+  return SC_RESULT_OK;
+}
+
+void sc_storage_wal_write_link_content_removal(sc_storage_wal * wal, sc_addr_hash link_hash)
+{
+  _sc_storage_wal_append(wal, SC_STORAGE_WAL_LINK_CONTENT_REMOVAL_RECORD, &link_hash, sizeof(link_hash), null_ptr, 0);
+}
+
+void sc_storage_wal_start_checkpoint(sc_storage_wal * wal)
+{
+  if (wal == null_ptr)
+    return;
+
+  _sc_storage_wal_flush(wal);
+
+  // if the previous save failed, records are appended to the log file and the checkpoint log file remains
+  sc_mutex_lock(&wal->file_mutex);
+  if (wal->channel != null_ptr && sc_fs_is_file(wal->checkpoint_path) == SC_FALSE)
+  {
+    sc_io_channel_shutdown(wal->channel, SC_TRUE, null_ptr);
+    if (sc_fs_rename_file(wal->path, wal->checkpoint_path) == SC_FALSE)
+      sc_memory_error("Can't rename %s -> %s", wal->path, wal->checkpoint_path);
+    wal->channel = _sc_storage_wal_new_channel(wal->path);
+  }
+  sc_mutex_unlock(&wal->file_mutex);
+}
+
+void sc_storage_wal_finish_checkpoint(sc_storage_wal * wal, sc_bool is_saved)
+{
+  if (wal == null_ptr || is_saved == SC_FALSE)
+    return;
+
+  // records of the checkpoint log file were made before the save started and are saved
+  sc_mutex_lock(&wal->file_mutex);
+  if (sc_fs_is_file(wal->checkpoint_path) && sc_fs_remove_file(wal->checkpoint_path) == SC_FALSE)
+    sc_memory_error("Can't remove sc-storage write-ahead log %s", wal->checkpoint_path);
+  sc_mutex_unlock(&wal->file_mutex);
+}
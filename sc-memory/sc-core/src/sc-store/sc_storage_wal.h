@@ -0,0 +1,168 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_storage_wal_h_
+#define _sc_storage_wal_h_
+
+#include "sc-core/sc_memory_params.h"
+#include "sc-core/sc_types.h"
+
+#include "sc_storage.h"
+
+/*! Write-ahead log of sc-storage changes.
+ * Log records contain images of changed sc-elements, sc-segments offsets and sc-storage attributes, and changed sc-links
+ * contents. Records are appended to the log after changes are made in memory and are written to the log file in groups:
+ * by period or, if period is 0, on each change. After sc-memory segments are loaded, records are replayed over them,
+ * so changes made after the last save of sc-memory survive a crash.
+ */
+typedef struct _sc_storage_wal sc_storage_wal;
+
+//! Buffer of log records.
+typedef struct
+{
+  sc_char * data;
+  sc_uint32 size;
+  sc_uint32 capacity;
+} sc_storage_wal_buffer;
+
+/*! Images of sc-elements changed by one operation, for example, by generation or erasure of sc-connector. They are
+ * appended to the log by one record, so replay restores either all of them or none of them.
+ */
+typedef struct
+{
+  sc_storage_wal * wal;           // log to append the operation to, or null_ptr, if log is disabled
+  sc_storage_wal_buffer records;  // records of the operation
+} sc_storage_wal_operation;
+
+/*! Initializes write-ahead log in sc-memory repo directory, if it is enabled by `params->wal`.
+ * @param wal[out] Pointer to initialized write-ahead log or null_ptr, if it is disabled
+ * @param params Sc-memory params
+ */
+void sc_storage_wal_initialize(sc_storage_wal ** wal, sc_memory_params const * params);
+
+/*! Replays write-ahead log over loaded sc-memory segments and opens log file to append new records.
+ * @param wal Pointer to write-ahead log
+ * @param storage Pointer to sc-storage with loaded sc-memory segments
+ * @returns SC_RESULT_OK, if log is replayed and opened.
+ * @remarks Torn records at the end of log file, left by a crash during writing, are cut off.
+ */
+sc_result sc_storage_wal_open(sc_storage_wal * wal, sc_storage * storage);
+
+/*! Writes all appended records into log file and closes it.
+ * @param wal Pointer to write-ahead log
+ */
+void sc_storage_wal_shutdown(sc_storage_wal * wal);
+
+/*! Appends image of changed sc-element.
+ * @param wal Pointer to write-ahead log
+ * @param addr Sc-address of changed sc-element, its offset can be 0 for sc-segment service sc-element
+ * @param element Pointer to changed sc-element
+ * @remarks Call it while changed sc-element is locked, so its records are ordered as its changes.
+ */
+void sc_storage_wal_write_element(sc_storage_wal * wal, sc_addr addr, sc_element const * element);
+
+/*! Starts collecting images of sc-elements changed by one operation.
+ * @param wal Pointer to write-ahead log
+ * @param operation[out] Pointer to started operation
+ */
+void sc_storage_wal_start_operation(sc_storage_wal * wal, sc_storage_wal_operation * operation);
+
+/*! Adds image of sc-element changed by operation.
+ * @param operation Pointer to started operation
+ * @param addr Sc-address of changed sc-element
+ * @param element Pointer to changed sc-element
+ */
+void sc_storage_wal_operation_write_element(
+    sc_storage_wal_operation * operation,
+    sc_addr addr,
+    sc_element const * element);
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+/*! Adds image of sc-connector record changed by operation.
+ * @param operation Pointer to started operation
+ * @param segment Pointer to segment of sc-connector record
+ * @param arc_index Index of changed sc-connector record in segment
+ */
+void sc_storage_wal_operation_write_arc(
+    sc_storage_wal_operation * operation,
+    sc_segment const * segment,
+    sc_addr_offset arc_index);
+#endif
+
+/*! Appends all images of operation to the log by one record.
+ * @param operation Pointer to started operation
+ * @remarks Call it while all sc-elements of operation are locked, so their records are ordered as their changes.
+ */
+void sc_storage_wal_finish_operation(sc_storage_wal_operation * operation);
+
+/*! Appends last engaged and last released offsets of changed sc-segment, and its sc-connectors records indices in
+ * compact sc-elements layout.
+ * @param wal Pointer to write-ahead log
+ * @param segment Pointer to changed sc-segment
+ */
+void sc_storage_wal_write_segment(sc_storage_wal * wal, sc_segment const * segment);
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+/*! Appends image of changed sc-connector record.
+ * @param wal Pointer to write-ahead log
+ * @param segment Pointer to segment of sc-connector record
+ * @param arc_index Index of changed sc-connector record in segment
+ */
+void sc_storage_wal_write_arc(sc_storage_wal * wal, sc_segment const * segment, sc_addr_offset arc_index);
+#endif
+
+/*! Appends sc-segments count, last not engaged and last released sc-segments numbers of sc-storage.
+ * @param wal Pointer to write-ahead log
+ * @param storage Pointer to changed sc-storage
+ */
+void sc_storage_wal_write_storage(sc_storage_wal * wal, sc_storage const * storage);
+
+/*! Appends changed content of sc-link.
+ * @param wal Pointer to write-ahead log
+ * @param link_hash Hash of sc-link sc-address
+ * @param string Content of sc-link
+ * @param string_size Size of sc-link content
+ * @param is_searchable_string SC_TRUE, if content of sc-link can be found by its substrings
+ */
+void sc_storage_wal_write_link_content(
+    sc_storage_wal * wal,
+    sc_addr_hash link_hash,
+    sc_char const * string,
+    sc_uint32 string_size,
+    sc_bool is_searchable_string);
+
+/*! Appends changed content of sc-link read from stream. Big content is written into log file by chunks instead of
+ * appending it into buffer of records.
+ * @param wal Pointer to write-ahead log
+ * @param link_hash Hash of sc-link sc-address
+ * @param stream Seekable stream with content of sc-link
+ * @param is_searchable_string SC_TRUE, if content of sc-link can be found by its substrings
+ * @returns SC_RESULT_ERROR_STREAM_IO, if content can't be read from stream. In this case the record isn't appended.
+ */
+sc_result sc_storage_wal_write_link_content_stream(
+    sc_storage_wal * wal,
+    sc_addr_hash link_hash,
+    sc_stream const * stream,
+    sc_bool is_searchable_string);
+
+/*! Appends removal of sc-link content.
+ * @param wal Pointer to write-ahead log
+ * @param link_hash Hash of sc-link sc-address
+ */
+void sc_storage_wal_write_link_content_removal(sc_storage_wal * wal, sc_addr_hash link_hash);
+
+/*! Starts log checkpoint before sc-memory save: appended records are moved into checkpoint log file.
+ * @param wal Pointer to write-ahead log
+ */
+void sc_storage_wal_start_checkpoint(sc_storage_wal * wal);
+
+/*! Finishes log checkpoint after sc-memory save: checkpoint log file is removed, if sc-memory is saved.
+ * @param wal Pointer to write-ahead log
+ * @param is_saved SC_TRUE, if sc-memory is saved
+ */
+void sc_storage_wal_finish_checkpoint(sc_storage_wal * wal, sc_bool is_saved);
+
+#endif
@@ -154,3 +154,19 @@ sc_bool sc_stream_get_data(sc_stream const * stream, sc_char ** data, sc_uint32
 
   return SC_TRUE;
 }
+
+sc_bool sc_stream_read_data_full(sc_stream const * stream, sc_char * data, sc_uint32 length)
+{
+  sc_uint32 read_bytes = 0;
+  while (read_bytes < length)
+  {
+    sc_uint32 chunk_read_bytes = 0;
+    if (sc_stream_read_data(stream, data + read_bytes, length - read_bytes, &chunk_read_bytes) != SC_RESULT_OK
+        || chunk_read_bytes == 0)
+      return SC_FALSE;
+
+    read_bytes += chunk_read_bytes;
+  }
+
+  return SC_TRUE;
+}
@@ -0,0 +1,175 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <glib.h>
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#include "sc-store/sc-base/sc_assert_utils.h"
+
+#include "sc_stream_private.h"
+
+#define SC_BASE64_ENCODED_SIZE(size) (((size) + 2) / 3 * 4)
+
+typedef struct
+{
+  sc_stream * stream;        // stream with data to encode
+  sc_uint32 data_size;       // size of data to encode
+  sc_uint32 size;            // size of data encoding
+  sc_uint32 position;        // current position in data encoding
+  sc_char * data_chunk;      // chunk of data to encode
+  sc_char * chunk;           // encoding of data chunk
+  sc_uint32 chunk_position;  // position of chunk in data encoding
+  sc_uint32 chunk_size;      // size of chunk, it is 0 if chunk isn't encoded yet
+} sc_base64_encoding;
+
+/*! Encodes chunk of data containing position of encoding. Chunks of data begin at offsets divisible by
+ * SC_STREAM_CHUNK_SIZE, that is divisible by 3, so encodings of chunks are parts of encoding of the whole data.
+ */
+sc_result _sc_base64_encoding_encode_chunk(sc_base64_encoding * encoding)
+{
+  sc_uint32 const data_chunk_offset = encoding->position / 4 * 3 / SC_STREAM_CHUNK_SIZE * SC_STREAM_CHUNK_SIZE;
+  sc_uint32 data_chunk_size = encoding->data_size - data_chunk_offset;
+  if (data_chunk_size > SC_STREAM_CHUNK_SIZE)
+    data_chunk_size = SC_STREAM_CHUNK_SIZE;
+
+  encoding->chunk_size = 0;
+  if (sc_stream_seek(encoding->stream, SC_STREAM_SEEK_SET, data_chunk_offset) != SC_RESULT_OK
+      || sc_stream_read_data_full(encoding->stream, encoding->data_chunk, data_chunk_size) == SC_FALSE)
+    return SC_RESULT_ERROR;
+
+  gint state = 0;
+  gint save = 0;
+  gsize chunk_size = g_base64_encode_step(
+      (guchar const *)encoding->data_chunk, data_chunk_size, FALSE, encoding->chunk, &state, &save);
+  chunk_size += g_base64_encode_close(FALSE, encoding->chunk + chunk_size, &state, &save);
+
+  encoding->chunk_position = SC_BASE64_ENCODED_SIZE(data_chunk_offset);
+  encoding->chunk_size = (sc_uint32)chunk_size;
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_base64_read(sc_stream const * stream, sc_char * data, sc_uint32 length, sc_uint32 * bytes_read)
+{
+  sc_assert(stream != null_ptr);
+  sc_base64_encoding * encoding = (sc_base64_encoding *)stream->handler;
+
+  *bytes_read = 0;
+  while (*bytes_read < length && encoding->position < encoding->size)
+  {
+    if (encoding->chunk_size == 0 || encoding->position < encoding->chunk_position
+        || encoding->position >= encoding->chunk_position + encoding->chunk_size)
+    {
+      if (_sc_base64_encoding_encode_chunk(encoding) != SC_RESULT_OK)
+        return SC_RESULT_ERROR;
+    }
+
+    sc_uint32 const chunk_offset = encoding->position - encoding->chunk_position;
+    sc_uint32 size = encoding->chunk_size - chunk_offset;
+    if (size > length - *bytes_read)
+      size = length - *bytes_read;
+
+    sc_mem_cpy(data + *bytes_read, encoding->chunk + chunk_offset, size);
+    *bytes_read += size;
+    encoding->position += size;
+  }
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_base64_write(sc_stream const * stream, sc_char * data, sc_uint32 length, sc_uint32 * bytes_written)
+{
+  return SC_RESULT_ERROR;
+}
+
+sc_result sc_stream_base64_seek(sc_stream const * stream, sc_stream_seek_origin origin, sc_uint32 offset)
+{
+  sc_assert(stream != null_ptr);
+  sc_base64_encoding * encoding = (sc_base64_encoding *)stream->handler;
+
+  switch (origin)
+  {
+  case SC_STREAM_SEEK_END:
+    if (offset > encoding->size)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    encoding->position = encoding->size - offset;
+    break;
+
+  case SC_STREAM_SEEK_CUR:
+    if (offset > encoding->size - encoding->position)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    encoding->position += offset;
+    break;
+
+  case SC_STREAM_SEEK_SET:
+    if (offset > encoding->size)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    encoding->position = offset;
+    break;
+  }
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_base64_tell(sc_stream const * stream, sc_uint32 * position)
+{
+  sc_assert(stream != null_ptr);
+  *position = ((sc_base64_encoding *)stream->handler)->position;
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_base64_free_handler(sc_stream const * stream)
+{
+  sc_assert(stream != null_ptr);
+  sc_base64_encoding * encoding = (sc_base64_encoding *)stream->handler;
+
+  sc_result const result = sc_stream_free(encoding->stream);
+  sc_mem_free(encoding->data_chunk);
+  sc_mem_free(encoding->chunk);
+  sc_mem_free(encoding);
+  return result;
+}
+
+sc_bool sc_stream_base64_eof(sc_stream const * stream)
+{
+  sc_assert(stream != null_ptr);
+  sc_base64_encoding * encoding = (sc_base64_encoding *)stream->handler;
+  return encoding->position == encoding->size;
+}
+
+sc_stream * sc_stream_base64_new(sc_stream * stream)
+{
+  if (stream == null_ptr)
+    return null_ptr;
+
+  sc_uint32 data_size;
+  if (sc_stream_get_length(stream, &data_size) != SC_RESULT_OK)
+  {
+    sc_stream_free(stream);
+    return null_ptr;
+  }
+
+  sc_base64_encoding * encoding = sc_mem_new(sc_base64_encoding, 1);
+  encoding->stream = stream;
+  encoding->data_size = data_size;
+  encoding->size = SC_BASE64_ENCODED_SIZE(data_size);
+  encoding->data_chunk = sc_mem_new(sc_char, SC_STREAM_CHUNK_SIZE);
+  encoding->chunk = sc_mem_new(sc_char, SC_BASE64_ENCODED_SIZE(SC_STREAM_CHUNK_SIZE));
+
+  sc_stream * base64_stream = sc_mem_new(sc_stream, 1);
+
+  base64_stream->flags = SC_STREAM_FLAG_READ | SC_STREAM_FLAG_TELL | SC_STREAM_FLAG_SEEK;
+  base64_stream->handler = (void *)encoding;
+
+  base64_stream->read_func = &sc_stream_base64_read;
+  base64_stream->write_func = &sc_stream_base64_write;
+  base64_stream->seek_func = &sc_stream_base64_seek;
+  base64_stream->tell_func = &sc_stream_base64_tell;
+  base64_stream->free_func = &sc_stream_base64_free_handler;
+  base64_stream->eof_func = &sc_stream_base64_eof;
+
+  return base64_stream;
+}
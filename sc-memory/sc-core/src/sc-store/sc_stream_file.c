@@ -6,7 +6,9 @@
 
 #include "sc-core/sc_stream_file.h"
 
+#include <errno.h>
 #include <stdio.h>
+#include <unistd.h>
 
 #include "sc-core/sc-base/sc_allocator.h"
 
@@ -140,3 +142,129 @@ sc_stream * sc_stream_file_new(sc_char const * file_name, sc_uint8 flags)
 
   return stream;
 }
+
+typedef struct
+{
+  sc_int32 file_descriptor;  // duplicate of descriptor of file with region
+  sc_uint64 offset;          // offset of region in file
+  sc_uint32 size;            // size of region
+  sc_uint32 position;        // current position in region
+} sc_file_region;
+
+sc_result sc_stream_file_region_read(sc_stream const * stream, sc_char * data, sc_uint32 length, sc_uint32 * bytes_read)
+{
+  sc_assert(stream != null_ptr);
+  sc_file_region * region = (sc_file_region *)stream->handler;
+
+  if (length > region->size - region->position)
+    length = region->size - region->position;
+
+  *bytes_read = 0;
+  while (*bytes_read < length)
+  {
+    ssize_t const result = pread(
+        region->file_descriptor,
+        data + *bytes_read,
+        length - *bytes_read,
+        (off_t)(region->offset + region->position + *bytes_read));
+    if (result < 0 && errno == EINTR)
+      continue;
+    if (result < 0)
+      return SC_RESULT_ERROR;
+    if (result == 0)
+      break;
+
+    *bytes_read += (sc_uint32)result;
+  }
+
+  region->position += *bytes_read;
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_file_region_write(
+    sc_stream const * stream,
+    sc_char * data,
+    sc_uint32 length,
+    sc_uint32 * bytes_written)
+{
+  return SC_RESULT_ERROR;
+}
+
+sc_result sc_stream_file_region_seek(sc_stream const * stream, sc_stream_seek_origin origin, sc_uint32 offset)
+{
+  sc_assert(stream != null_ptr);
+  sc_file_region * region = (sc_file_region *)stream->handler;
+
+  switch (origin)
+  {
+  case SC_STREAM_SEEK_END:
+    if (offset > region->size)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    region->position = region->size - offset;
+    break;
+
+  case SC_STREAM_SEEK_CUR:
+    if (offset > region->size - region->position)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    region->position += offset;
+    break;
+
+  case SC_STREAM_SEEK_SET:
+    if (offset > region->size)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    region->position = offset;
+    break;
+  }
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_file_region_tell(sc_stream const * stream, sc_uint32 * position)
+{
+  sc_assert(stream != null_ptr);
+  *position = ((sc_file_region *)stream->handler)->position;
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_file_region_free_handler(sc_stream const * stream)
+{
+  sc_assert(stream != null_ptr);
+  sc_file_region * region = (sc_file_region *)stream->handler;
+
+  sc_result const result = close(region->file_descriptor) == 0 ? SC_RESULT_OK : SC_RESULT_ERROR;
+  sc_mem_free(region);
+  return result;
+}
+
+sc_bool sc_stream_file_region_eof(sc_stream const * stream)
+{
+  sc_assert(stream != null_ptr);
+  sc_file_region * region = (sc_file_region *)stream->handler;
+  return region->position == region->size;
+}
+
+sc_stream * sc_stream_file_region_new(sc_int32 file_descriptor, sc_uint64 offset, sc_uint32 size)
+{
+  sc_int32 const region_file_descriptor = dup(file_descriptor);
+  if (region_file_descriptor < 0)
+    return null_ptr;
+
+  sc_file_region * region = sc_mem_new(sc_file_region, 1);
+  region->file_descriptor = region_file_descriptor;
+  region->offset = offset;
+  region->size = size;
+
+  sc_stream * stream = sc_mem_new(sc_stream, 1);
+
+  stream->flags = SC_STREAM_FLAG_READ | SC_STREAM_FLAG_TELL | SC_STREAM_FLAG_SEEK;
+  stream->handler = (void *)region;
+
+  stream->read_func = &sc_stream_file_region_read;
+  stream->write_func = &sc_stream_file_region_write;
+  stream->seek_func = &sc_stream_file_region_seek;
+  stream->tell_func = &sc_stream_file_region_tell;
+  stream->free_func = &sc_stream_file_region_free_handler;
+  stream->eof_func = &sc_stream_file_region_eof;
+
+  return stream;
+}
@@ -15,10 +15,12 @@
 
 struct _sc_memory_buffer
 {
-  char * data;         // pointer to data
-  sc_uint32 size;      // size of data
-  sc_uint32 pos;       // current position
-  sc_bool data_owner;  // ownership on data buffer
+  char * data;              // pointer to data
+  sc_uint32 size;           // size of data
+  sc_uint32 pos;            // current position
+  sc_bool data_owner;       // ownership on data buffer
+  void (*release)(void *);  // function releasing reference to shared data buffer
+  void * release_data;      // data passed to release function
 };
 
 typedef struct _sc_memory_buffer sc_memory_buffer;
@@ -93,6 +95,8 @@ sc_result sc_stream_memory_free_handler(sc_stream const * stream)
 
   if (buffer->data_owner == SC_TRUE)
     sc_mem_free(buffer->data);
+  else if (buffer->release != null_ptr)
+    buffer->release(buffer->release_data);
 
   sc_mem_free(buffer);
 
@@ -142,3 +146,16 @@ sc_stream * sc_stream_memory_new(sc_char const * buffer, sc_uint buffer_size, sc
 
   return stream;
 }
+
+sc_stream * sc_stream_memory_new_shared(
+    sc_char const * buffer,
+    sc_uint32 buffer_size,
+    void (*release)(void *),
+    void * release_data)
+{
+  sc_stream * stream = sc_stream_memory_new(buffer, buffer_size, SC_STREAM_FLAG_READ, SC_FALSE);
+  sc_memory_buffer * data_buffer = (sc_memory_buffer *)stream->handler;
+  data_buffer->release = release;
+  data_buffer->release_data = release_data;
+  return stream;
+}
@@ -9,6 +9,8 @@
 
 #include "sc-core/sc_stream.h"
 
+#define SC_STREAM_CHUNK_SIZE 0xC000   // size of chunks to copy and encode big data of streams, it is divisible by 3
+
 /*! Pointer to stream read function. This function read data into specified \i buffer with
  * fixed \i length and return number of bytes, that has been read.
  */
@@ -58,4 +60,47 @@ struct _sc_stream
   fStreamEof eof_func;
 };
 
+/*! Reads \p length bytes from stream. Unlike sc_stream_read_data, it repeats reading while stream reads less bytes
+ * than requested.
+ * @param stream Pointer to stream
+ * @param data Pointer to buffer to read data into
+ * @param length Number of bytes to read
+ * @returns SC_TRUE, if all bytes are read.
+ */
+sc_bool sc_stream_read_data_full(sc_stream const * stream, sc_char * data, sc_uint32 length);
+
+/*! Creates memory stream reading shared buffer without copying it.
+ * @param buffer Pointer to shared memory buffer with data
+ * @param buffer_size Size of data in buffer
+ * @param release Function that releases reference of stream to buffer, it is called with \p release_data when stream
+ * is freed
+ * @param release_data Data passed to \p release
+ * @returns Returns stream pointer, it should be freed with sc_stream_free function.
+ */
+sc_stream * sc_stream_memory_new_shared(
+    sc_char const * buffer,
+    sc_uint32 buffer_size,
+    void (*release)(void *),
+    void * release_data);
+
+/*! Creates stream reading region of opened file by positional reads. Stream reads region by its own duplicate of file
+ * descriptor, so region is read in parallel with other readers and writers of file and after file descriptor is
+ * closed.
+ * @param file_descriptor Descriptor of opened file
+ * @param offset Offset of region in file
+ * @param size Size of region
+ * @returns Returns stream pointer or null_ptr, if file descriptor can't be duplicated. It should be freed with
+ * sc_stream_free function.
+ */
+sc_stream * sc_stream_file_region_new(sc_int32 file_descriptor, sc_uint64 offset, sc_uint32 size);
+
+/*! Creates stream reading base64 encoding of data of other stream. Data are read and encoded by chunks, so encoding
+ * of big data isn't stored in memory.
+ * @param stream Pointer to seekable stream with data to encode, it is owned by created stream or freed, if size of
+ * its data can't be got
+ * @returns Returns stream pointer or null_ptr, if size of data can't be got. It should be freed with sc_stream_free
+ * function.
+ */
+sc_stream * sc_stream_base64_new(sc_stream * stream);
+
 #endif
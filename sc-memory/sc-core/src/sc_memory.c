@@ -9,6 +9,7 @@
 
 #include "sc-store/sc_storage.h"
 #include "sc-store/sc_storage_private.h"
+#include "sc-store/sc-fs-memory/sc_fs_memory_bundle.h"
 #include "sc_memory_private.h"
 #include "sc-core/sc_helper.h"
 #include "sc_helper_private.h"
@@ -148,6 +149,18 @@ void sc_memory_shutdown_extensions()
   sc_memory_info("Extensions shutdown");
 }
 
+sc_result sc_memory_write_bundle(sc_memory_params const * params, sc_char const * bundle_path)
+{
+  sc_memory_info("Write bundle");
+  if (sc_fs_memory_bundle_write(&params->version, params->storage, bundle_path) != SC_FS_MEMORY_OK)
+  {
+    sc_memory_error("Error while write bundle %s", bundle_path);
+    return SC_RESULT_ERROR;
+  }
+
+  return SC_RESULT_OK;
+}
+
 void * sc_memory_get_context_manager()
 {
   return memory->context_manager;
@@ -331,14 +344,12 @@ sc_addr sc_memory_arc_new(sc_memory_context const * ctx, sc_type type, sc_addr b
   return sc_memory_arc_new_ext(ctx, type, beg, end, &result);
 }
 
-sc_addr sc_memory_arc_new_ext(sc_memory_context const * ctx, sc_type type, sc_addr beg, sc_addr end, sc_result * result)
+static sc_result _sc_memory_check_arc_new_permissions(
+    sc_memory_context const * ctx,
+    sc_type type,
+    sc_addr beg,
+    sc_addr end)
 {
-  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
-  {
-    *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
-    return SC_ADDR_EMPTY;
-  }
-
   if (_sc_memory_context_check_if_has_permitted_structure(
           memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, beg)
           == SC_FALSE
@@ -347,30 +358,144 @@ sc_addr sc_memory_arc_new_ext(sc_memory_context const * ctx, sc_type type, sc_ad
     if (_sc_memory_context_check_local_and_global_permissions(
             memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, beg)
         == SC_FALSE)
-    {
-      *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
-      return SC_ADDR_EMPTY;
-    }
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
     if (_sc_memory_context_check_local_and_global_permissions(
             memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, end)
         == SC_FALSE)
-    {
-      *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
-      return SC_ADDR_EMPTY;
-    }
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
   }
 
   if (_sc_memory_context_check_global_permissions_to_write_permissions(
           memory->context_manager, ctx, beg, type, SC_CONTEXT_PERMISSIONS_TO_WRITE_PERMISSIONS)
       == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS;
+
+  return SC_RESULT_OK;
+}
+
+sc_addr sc_memory_arc_new_ext(sc_memory_context const * ctx, sc_type type, sc_addr beg, sc_addr end, sc_result * result)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
   {
-    *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS;
+    *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
     return SC_ADDR_EMPTY;
   }
 
+  *result = _sc_memory_check_arc_new_permissions(ctx, type, beg, end);
+  if (*result != SC_RESULT_OK)
+    return SC_ADDR_EMPTY;
+
   return sc_storage_arc_new_ext(ctx, type, beg, end, result);
 }
 
+static void _sc_memory_clear_addrs(sc_uint32 count, sc_addr * addrs)
+{
+  for (sc_uint32 i = 0; i < count; ++i)
+    addrs[i] = SC_ADDR_EMPTY;
+}
+
+sc_result
+sc_memory_nodes_new_batch(sc_memory_context const * ctx, sc_type const * types, sc_uint32 count, sc_addr * addrs)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+  {
+    _sc_memory_clear_addrs(count, addrs);
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+  }
+
+  return sc_storage_nodes_new_batch(ctx, types, count, addrs);
+}
+
+sc_result
+sc_memory_links_new_batch(sc_memory_context const * ctx, sc_type const * types, sc_uint32 count, sc_addr * addrs)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+  {
+    _sc_memory_clear_addrs(count, addrs);
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+  }
+
+  return sc_storage_links_new_batch(ctx, types, count, addrs);
+}
+
+sc_result sc_memory_arcs_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_addr const * beg_addrs,
+    sc_addr const * end_addrs,
+    sc_uint32 count,
+    sc_addr * connector_addrs)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+  {
+    _sc_memory_clear_addrs(count, connector_addrs);
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+  }
+
+  sc_result result = SC_RESULT_OK;
+  sc_result permissions_result = SC_RESULT_OK;
+
+  // only sc-connectors that context has permissions to generate are passed to sc-storage
+  sc_uint32 permitted_count = 0;
+  sc_uint32 * permitted_indices = sc_mem_new(sc_uint32, count);
+  sc_type * permitted_types = sc_mem_new(sc_type, count);
+  sc_addr * permitted_beg_addrs = sc_mem_new(sc_addr, count);
+  sc_addr * permitted_end_addrs = sc_mem_new(sc_addr, count);
+  sc_addr * permitted_connector_addrs = sc_mem_new(sc_addr, count);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    connector_addrs[i] = SC_ADDR_EMPTY;
+
+    // the same permissions are not checked again for sc-connectors that follow each other
+    if (i == 0 || types[i] != types[i - 1] || SC_ADDR_IS_NOT_EQUAL(beg_addrs[i], beg_addrs[i - 1])
+        || SC_ADDR_IS_NOT_EQUAL(end_addrs[i], end_addrs[i - 1]))
+      permissions_result = _sc_memory_check_arc_new_permissions(ctx, types[i], beg_addrs[i], end_addrs[i]);
+
+    if (permissions_result != SC_RESULT_OK)
+    {
+      result = permissions_result;
+      continue;
+    }
+
+    permitted_indices[permitted_count] = i;
+    permitted_types[permitted_count] = types[i];
+    permitted_beg_addrs[permitted_count] = beg_addrs[i];
+    permitted_end_addrs[permitted_count] = end_addrs[i];
+    ++permitted_count;
+  }
+
+  // events of generated sc-connectors are emitted after all of them are generated
+  sc_bool const are_events_pending = _sc_memory_context_are_events_pending(ctx);
+  if (are_events_pending == SC_FALSE)
+    _sc_memory_context_pending_begin((sc_memory_context *)ctx);
+
+  sc_result const storage_result = sc_storage_arcs_new_batch(
+      ctx,
+      permitted_types,
+      permitted_beg_addrs,
+      permitted_end_addrs,
+      permitted_count,
+      permitted_connector_addrs);
+
+  if (are_events_pending == SC_FALSE)
+    _sc_memory_context_pending_end((sc_memory_context *)ctx);
+
+  if (storage_result != SC_RESULT_OK)
+    result = storage_result;
+
+  for (sc_uint32 i = 0; i < permitted_count; ++i)
+    connector_addrs[permitted_indices[i]] = permitted_connector_addrs[i];
+
+  sc_mem_free(permitted_connector_addrs);
+  sc_mem_free(permitted_end_addrs);
+  sc_mem_free(permitted_beg_addrs);
+  sc_mem_free(permitted_types);
+  sc_mem_free(permitted_indices);
+
+  return result;
+}
+
 sc_result sc_memory_get_element_type(sc_memory_context const * ctx, sc_addr addr, sc_type * result)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
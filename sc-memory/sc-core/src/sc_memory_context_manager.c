@@ -17,23 +17,46 @@
 #include "sc-store/sc_storage_private.h"
 #include "sc_memory_private.h"
 
-/*! Structure representing parameters for emitting a sc-event.
- * @note This structure holds the parameters required for emitting a sc-event in a memory context.
+/*! Structure representing a chunk of pending events of a sc-memory context.
+ * @note Chunks are linked in order of pending events. Every next chunk is twice as large as the previous one up to
+ * SC_CONTEXT_PEND_EVENTS_CHUNK_MAX_SIZE, so pending an event takes constant time.
  */
-struct _sc_event_emit_params
+struct _sc_event_emit_params_chunk
 {
-  sc_addr subscription_addr;      ///< sc-address representing the subscription associated with the event.
-  sc_event_type event_type_addr;  ///< Type of the event to be emitted.
-  sc_addr connector_addr;         ///< sc-address representing the connector associated with the event.
-  sc_type connector_type;         ///< sc-type of the connector associated with the event.
-  sc_addr other_addr;             ///< sc-address representing the other element associated with the event.
+  sc_event_emit_params_chunk * next;  ///< Pointer to the next chunk of pending events.
+  sc_uint32 size;                     ///< Number of pending events in the chunk.
+  sc_uint32 capacity;                 ///< Maximum number of pending events in the chunk.
+  sc_event_emit_params params[];      ///< Parameters of pending events.
 };
 
+#define SC_CONTEXT_PEND_EVENTS_CHUNK_MIN_SIZE 16
+#define SC_CONTEXT_PEND_EVENTS_CHUNK_MAX_SIZE 1024
+
 #define SC_CONTEXT_FLAG_PENDING_EVENTS 0x1
 #define SC_CONTEXT_FLAG_BLOCKING_EVENTS 0x2
 
 #define SC_CONTEXT_PERMISSIONS_FULL 0xff
 
+sc_event_emit_params_chunk * _sc_memory_context_pend_events_chunk_new(sc_uint32 capacity)
+{
+  sc_event_emit_params_chunk * chunk =
+      _sc_mem_new(sizeof(sc_event_emit_params_chunk) + capacity * sizeof(sc_event_emit_params));
+  chunk->next = null_ptr;
+  chunk->size = 0;
+  chunk->capacity = capacity;
+  return chunk;
+}
+
+void _sc_memory_context_free_pend_events(sc_event_emit_params_chunk * chunk)
+{
+  while (chunk != null_ptr)
+  {
+    sc_event_emit_params_chunk * next = chunk->next;
+    sc_mem_free(chunk);
+    chunk = next;
+  }
+}
+
 void _sc_memory_context_manager_initialize(sc_memory_context_manager ** manager, sc_bool user_mode)
 {
   sc_memory_info("Initialize context manager");
@@ -133,6 +156,7 @@ sc_memory_context * _sc_memory_context_new_impl(sc_memory_context_manager * mana
   ctx->global_permissions = _sc_context_get_user_global_permissions(ctx->user_addr);
   ctx->local_permissions = _sc_context_get_user_local_permissions(ctx->user_addr);
   ctx->pend_events = null_ptr;
+  ctx->pend_events_tail = null_ptr;
 
   sc_hash_table_insert(
       manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
@@ -209,6 +233,7 @@ void _sc_memory_context_free_impl(sc_memory_context_manager * manager, sc_memory
   sc_hash_table_remove(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
   --manager->context_count;
 
+  _sc_memory_context_free_pend_events(ctx->pend_events);
   sc_mem_free(ctx);
 error:
   sc_monitor_release_write(&manager->context_monitor);
@@ -238,42 +263,54 @@ void _sc_memory_context_pend_event(
     sc_type connector_type,
     sc_addr other_addr)
 {
-  sc_event_emit_params * params = sc_mem_new(sc_event_emit_params, 1);
+  sc_memory_context * context = (sc_memory_context *)ctx;
+
+  sc_monitor_acquire_write(&context->monitor);
+
+  sc_event_emit_params_chunk * chunk = context->pend_events_tail;
+  if (chunk == null_ptr)
+  {
+    chunk = _sc_memory_context_pend_events_chunk_new(SC_CONTEXT_PEND_EVENTS_CHUNK_MIN_SIZE);
+    context->pend_events = chunk;
+    context->pend_events_tail = chunk;
+  }
+  else if (chunk->size == chunk->capacity)
+  {
+    chunk->next =
+        _sc_memory_context_pend_events_chunk_new(sc_min(chunk->capacity * 2, SC_CONTEXT_PEND_EVENTS_CHUNK_MAX_SIZE));
+    chunk = chunk->next;
+    context->pend_events_tail = chunk;
+  }
+
+  sc_event_emit_params * params = &chunk->params[chunk->size++];
   params->event_type_addr = event_type_addr;
   params->subscription_addr = subscription_addr;
   params->connector_addr = connector_addr;
   params->connector_type = connector_type;
   params->other_addr = other_addr;
 
-  sc_monitor_acquire_write((sc_monitor *)&ctx->monitor);
-  ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_append(ctx->pend_events, params);
-  sc_monitor_release_write((sc_monitor *)&ctx->monitor);
+  sc_monitor_release_write(&context->monitor);
 }
 
 void _sc_memory_context_emit_events(sc_memory_context const * ctx)
 {
-  GSList * item = null_ptr;
-  sc_event_emit_params * event_params = null_ptr;
+  sc_memory_context * context = (sc_memory_context *)ctx;
 
-  // Emit all saved events
-  while (ctx->pend_events)
-  {
-    item = ctx->pend_events;
-    event_params = (sc_event_emit_params *)item->data;
-
-    sc_event_emit_impl(
-        ctx,
-        event_params->subscription_addr,
-        event_params->event_type_addr,
-        event_params->connector_addr,
-        event_params->connector_type,
-        event_params->other_addr,
-        null_ptr,
-        SC_ADDR_EMPTY);
-    sc_mem_free(event_params);
-
-    ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_remove_sublist(ctx->pend_events, ctx->pend_events);
-  }
+  sc_event_emit_params_chunk * chunk = context->pend_events;
+  if (chunk == null_ptr)
+    return;
+
+  // Emit all saved events chunk by chunk, the first chunk is kept to pend next events without allocations
+  sc_event_emit_batch_impl(ctx, chunk->params, chunk->size);
+  chunk->size = 0;
+
+  sc_event_emit_params_chunk * next = chunk->next;
+  chunk->next = null_ptr;
+  context->pend_events_tail = chunk;
+
+  for (chunk = next; chunk != null_ptr; chunk = chunk->next)
+    sc_event_emit_batch_impl(ctx, chunk->params, chunk->size);
+  _sc_memory_context_free_pend_events(next);
 }
 
 void _sc_memory_context_pending_begin(sc_memory_context * ctx)
@@ -15,7 +15,19 @@
 #include "sc-store/sc-base/sc_message.h"
 
 typedef struct _sc_memory_context_manager sc_memory_context_manager;
-typedef struct _sc_event_emit_params sc_event_emit_params;
+typedef struct _sc_event_emit_params_chunk sc_event_emit_params_chunk;
+
+/*! Structure representing parameters for emitting a sc-event.
+ * @note This structure holds the parameters required for emitting a sc-event in a memory context.
+ */
+typedef struct _sc_event_emit_params
+{
+  sc_addr subscription_addr;      ///< sc-address representing the subscription associated with the event.
+  sc_event_type event_type_addr;  ///< Type of the event to be emitted.
+  sc_addr connector_addr;         ///< sc-address representing the connector associated with the event.
+  sc_type connector_type;         ///< sc-type of the connector associated with the event.
+  sc_addr other_addr;             ///< sc-address representing the other element associated with the event.
+} sc_event_emit_params;
 
 #define SC_CONTEXT_PERMISSIONS_AUTHENTICATED 0x1
 
@@ -109,7 +121,8 @@ void _sc_memory_context_pending_end(sc_memory_context * ctx);
  * @param connector_addr sc-address representing the sc-connector associated with the event.
  * @param connector_type sc-type representing the sc-connector associated with the event.
  * @param other_addr sc-address representing the other sc-element associated with the event.
- * @note This function adds an event to the pending events list in the sc-memory context, to be emitted later.
+ * @note This function adds an event to the pending events list in the sc-memory context, to be emitted later. Events
+ * are stored in chunks, so it takes constant time regardless of the number of already pending events.
  */
 void _sc_memory_context_pend_event(
     sc_memory_context const * ctx,
@@ -122,6 +135,7 @@ void _sc_memory_context_pend_event(
 /*! Function that emits pending events in a sc-memory context.
  * @param ctx Pointer to the sc-memory context for which pending events are emitted.
  * @note This function emits all pending events in the sc-memory context, clearing the pending events list afterward.
+ * Events of each chunk are dispatched to the emission pool as one batch.
  */
 void _sc_memory_context_emit_events(sc_memory_context const * ctx);
 
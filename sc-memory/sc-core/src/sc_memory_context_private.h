@@ -13,6 +13,8 @@
 #include "sc-store/sc-container/sc_hash_table.h"
 #include "sc-store/sc-base/sc_monitor_private.h"
 
+#include "sc_memory_context_manager.h"
+
 /*! Structure representing a memory context manager.
  * @note This structure manages memory contexts and user authentications in the sc-memory.
  */
@@ -83,7 +85,10 @@ struct _sc_memory_context
   sc_permissions global_permissions;  ///< Global permissions within the knowledge base.
   sc_hash_table * local_permissions;  ///< Local permissions within sc-structures.
   sc_uint8 flags;                     ///< Flags indicating the state of the sc-memory context.
-  sc_hash_table_list * pend_events;   ///< List of pending events to be emitted in the sc-memory context.
+  ///< First chunk of pending events to be emitted in the sc-memory context.
+  sc_event_emit_params_chunk * pend_events;
+  ///< Last chunk of pending events, new pending events are added to it.
+  sc_event_emit_params_chunk * pend_events_tail;
   sc_monitor monitor;                 ///< Monitor for synchronizing access to the sc-memory context.
 };
 
@@ -14,6 +14,7 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->clear = SC_FALSE;
 
   params->storage = (sc_char const *)null_ptr;
+  params->bundle = (sc_char const *)null_ptr;
   params->extensions_directories = (sc_char const **)null_ptr;
   params->extensions_directories_count = 0;
   params->enabled_extensions = (sc_char const **)null_ptr;
@@ -21,12 +22,17 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->max_loaded_segments = DEFAULT_MAX_LOADED_SEGMENTS;
   params->limit_max_threads_by_max_physical_cores = DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES;
   params->max_events_and_agents_threads = DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS;
+  params->events_queue_size = DEFAULT_EVENTS_QUEUE_SIZE;
+  params->events_threads_affinity = DEFAULT_EVENTS_THREADS_AFFINITY;
 
   params->dump_memory = SC_TRUE;
   params->dump_memory_period = DEFAULT_DUMP_MEMORY_PERIOD;  // seconds
   params->dump_memory_statistics = SC_TRUE;
   params->dump_memory_statistics_period = DEFAULT_DUMP_MEMORY_STATISTICS_PERIOD;  // seconds
 
+  params->wal = DEFAULT_WAL;
+  params->wal_sync_period = DEFAULT_WAL_SYNC_PERIOD;  // milliseconds
+
   params->log_type = DEFAULT_LOG_TYPE;
   params->log_file = DEFAULT_LOG_FILE;
   params->log_level = DEFAULT_LOG_LEVEL;
@@ -40,4 +46,5 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
   params->term_separators = DEFAULT_TERM_SEPARATORS;
   params->search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+  params->link_contents_cache_size = DEFAULT_LINK_CONTENTS_CACHE_SIZE;
 }
@@ -10,6 +10,8 @@ extern "C"
 {
 #include <sc-core/sc_memory.h>
 #include <sc-core/sc-container/sc_string.h>
+
+#include <sc-store/sc_storage_private.h>
 }
 
 TEST_F(ScMemoryTest, sc_memory_find_links_with_content_string)
@@ -86,6 +88,53 @@ TEST_F(ScMemoryTest, sc_memory_find_links_contents_by_content_substring)
   sc_list_destroy(string_hashes);
 }
 
+TEST_F(ScMemoryTest, sc_memory_get_link_content_from_cache)
+{
+  sc_memory_context * context = **m_ctx;
+  sc_addr const link_addr = sc_memory_link_new2(context, sc_type_const_node_link);
+
+  auto const & setLinkContent = [&](sc_char const * content)
+  {
+    sc_stream * stream = sc_stream_memory_new(content, sc_str_len(content), SC_STREAM_FLAG_READ, SC_FALSE);
+    EXPECT_EQ(sc_memory_set_link_content(context, link_addr, stream), SC_RESULT_OK);
+    sc_stream_free(stream);
+  };
+  auto const & expectLinkContent = [&](std::string const & content)
+  {
+    sc_stream * stream;
+    EXPECT_EQ(sc_memory_get_link_content(context, link_addr, &stream), SC_RESULT_OK);
+    sc_char * data;
+    sc_uint32 size;
+    EXPECT_TRUE(sc_stream_get_data(stream, &data, &size));
+    EXPECT_EQ(std::string(data, size), content);
+    sc_mem_free(data);
+    sc_stream_free(stream);
+  };
+
+  sc_storage_link_contents_cache_statistics statistics;
+  sc_storage_link_contents_cache_get_statistics(sc_storage_get_link_contents_cache(), &statistics);
+  sc_uint64 const hits_count = statistics.hits_count;
+  sc_uint64 const misses_count = statistics.misses_count;
+  sc_uint64 const contents_count = statistics.contents_count;
+
+  setLinkContent("content");
+  expectLinkContent("content");
+  expectLinkContent("content");
+
+  // changed content isn't read from cache
+  setLinkContent("new content");
+  expectLinkContent("new content");
+
+  sc_storage_link_contents_cache_get_statistics(sc_storage_get_link_contents_cache(), &statistics);
+  EXPECT_EQ(statistics.hits_count - hits_count, 1u);
+  EXPECT_EQ(statistics.misses_count - misses_count, 2u);
+  EXPECT_EQ(statistics.contents_count - contents_count, 1u);
+
+  EXPECT_EQ(sc_memory_element_free(context, link_addr), SC_RESULT_OK);
+  sc_storage_link_contents_cache_get_statistics(sc_storage_get_link_contents_cache(), &statistics);
+  EXPECT_EQ(statistics.contents_count, contents_count);
+}
+
 TEST_F(ScMemoryTest, sc_event_subscription_invalid)
 {
   sc_memory_context * context = **m_ctx;
@@ -0,0 +1,161 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+#include <sc-core/sc-base/sc_monitor.h>
+#include <sc-store/sc-base/sc_monitor_private.h>
+}
+
+TEST(ScMonitorTest, ReadersAndWritersExclusion)
+{
+  sc_monitor monitor;
+  sc_monitor_init(&monitor);
+
+  size_t const threadsCount = 8;
+  size_t const iterationsCount = 10000;
+  size_t value = 0;
+  std::atomic_bool isValueOdd = false;
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadsCount; ++i)
+  {
+    threads.emplace_back(
+        [&, i]()
+        {
+          for (size_t j = 0; j < iterationsCount; ++j)
+          {
+            if (i % 2 == 0)
+            {
+              sc_monitor_acquire_write(&monitor);
+              ++value;
+              ++value;
+              sc_monitor_release_write(&monitor);
+            }
+            else
+            {
+              sc_monitor_acquire_read(&monitor);
+              if (value % 2 != 0)
+                isValueOdd = true;
+              sc_monitor_release_read(&monitor);
+            }
+          }
+        });
+  }
+
+  for (auto & thread : threads)
+    thread.join();
+
+  EXPECT_FALSE(isValueOdd);
+  EXPECT_EQ(value, threadsCount / 2 * iterationsCount * 2);
+
+  sc_monitor_destroy(&monitor);
+}
+
+TEST(ScMonitorTest, ReaderWaitsForWaitingWriter)
+{
+  sc_monitor monitor;
+  sc_monitor_init(&monitor);
+
+  sc_monitor_acquire_read(&monitor);
+
+  std::atomic_bool isWritten = false;
+  std::thread writer(
+      [&]()
+      {
+        sc_monitor_acquire_write(&monitor);
+        isWritten = true;
+        sc_monitor_release_write(&monitor);
+      });
+
+  while (g_atomic_int_get(&monitor.writers) == 0)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  // reader coming after waiting writer doesn't overtake it
+  std::atomic_bool isWrittenBeforeRead = false;
+  std::thread reader(
+      [&]()
+      {
+        sc_monitor_acquire_read(&monitor);
+        isWrittenBeforeRead = isWritten.load();
+        sc_monitor_release_read(&monitor);
+      });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(isWritten);
+  sc_monitor_release_read(&monitor);
+
+  writer.join();
+  reader.join();
+
+  EXPECT_TRUE(isWritten);
+  EXPECT_TRUE(isWrittenBeforeRead);
+
+  sc_monitor_destroy(&monitor);
+}
+
+TEST(ScMonitorTest, TryAcquireReadDoesntWaitForWriter)
+{
+  sc_monitor monitor;
+  sc_monitor_init(&monitor);
+
+  EXPECT_TRUE(sc_monitor_try_acquire_read(&monitor));
+
+  std::atomic_bool isWritten = false;
+  std::thread writer(
+      [&]()
+      {
+        sc_monitor_acquire_write(&monitor);
+        isWritten = true;
+        sc_monitor_release_write(&monitor);
+      });
+
+  while (g_atomic_int_get(&monitor.writers) == 0)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  // reader trying to come after waiting writer fails instead of waiting for it
+  EXPECT_FALSE(sc_monitor_try_acquire_read(&monitor));
+  EXPECT_FALSE(isWritten);
+  sc_monitor_release_read(&monitor);
+
+  writer.join();
+  EXPECT_TRUE(isWritten);
+
+  EXPECT_TRUE(sc_monitor_try_acquire_read(&monitor));
+  sc_monitor_release_read(&monitor);
+
+  sc_monitor_destroy(&monitor);
+}
+
+TEST(ScMonitorTest, TryAcquireWriteDoesntWaitForReaderOrWriter)
+{
+  sc_monitor monitor;
+  sc_monitor_init(&monitor);
+
+  sc_monitor_acquire_read(&monitor);
+  EXPECT_FALSE(sc_monitor_try_acquire_write(&monitor));
+  sc_monitor_release_read(&monitor);
+
+  EXPECT_TRUE(sc_monitor_try_acquire_write(&monitor));
+  EXPECT_FALSE(sc_monitor_try_acquire_write(&monitor));
+  EXPECT_FALSE(sc_monitor_try_acquire_read(&monitor));
+  sc_monitor_release_write(&monitor);
+
+  // failed tries don't leave monitor acquired
+  EXPECT_TRUE(sc_monitor_try_acquire_read(&monitor));
+  sc_monitor_release_read(&monitor);
+  sc_monitor_acquire_write(&monitor);
+  sc_monitor_release_write(&monitor);
+
+  sc_monitor_destroy(&monitor);
+}
@@ -0,0 +1,139 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+extern "C"
+{
+#include <sc-core/sc_stream.h>
+#include <sc-core/sc-base/sc_allocator.h>
+#include <sc-core/sc-container/sc_string.h>
+
+#include <sc-store/sc_storage_link_contents_cache.h>
+}
+
+sc_char * _test_new_link_content(std::string const & content)
+{
+  sc_char * string;
+  sc_str_cpy(string, content.c_str(), content.size());
+  return string;
+}
+
+std::string _test_get_stream_content(sc_stream * stream)
+{
+  sc_char * data;
+  sc_uint32 size;
+  EXPECT_TRUE(sc_stream_get_data(stream, &data, &size));
+  std::string content(data, size);
+  sc_mem_free(data);
+  return content;
+}
+
+sc_storage_link_contents_cache * _test_initialize_link_contents_cache(sc_uint32 size)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.link_contents_cache_size = size;
+
+  sc_storage_link_contents_cache * cache;
+  sc_storage_link_contents_cache_initialize(&cache, &params);
+  return cache;
+}
+
+TEST(ScStorageLinkContentsCacheTest, GetPutRemove)
+{
+  sc_storage_link_contents_cache * cache = _test_initialize_link_contents_cache(DEFAULT_LINK_CONTENTS_CACHE_SIZE);
+  ASSERT_NE(cache, nullptr);
+
+  EXPECT_EQ(sc_storage_link_contents_cache_get(cache, 1), nullptr);
+
+  sc_stream * stream = sc_storage_link_contents_cache_put(cache, 1, _test_new_link_content("content"), 7);
+  EXPECT_EQ(_test_get_stream_content(stream), "content");
+  sc_stream_free(stream);
+
+  stream = sc_storage_link_contents_cache_get(cache, 1);
+  ASSERT_NE(stream, nullptr);
+  EXPECT_EQ(_test_get_stream_content(stream), "content");
+
+  // stream reads content removed from cache
+  sc_storage_link_contents_cache_remove(cache, 1);
+  EXPECT_EQ(sc_storage_link_contents_cache_get(cache, 1), nullptr);
+  EXPECT_EQ(_test_get_stream_content(stream), "content");
+  sc_stream_free(stream);
+
+  sc_storage_link_contents_cache_statistics statistics;
+  sc_storage_link_contents_cache_get_statistics(cache, &statistics);
+  EXPECT_EQ(statistics.hits_count, 1u);
+  EXPECT_EQ(statistics.misses_count, 2u);
+  EXPECT_EQ(statistics.evictions_count, 0u);
+  EXPECT_EQ(statistics.contents_count, 0u);
+  EXPECT_EQ(statistics.size, 0u);
+
+  sc_storage_link_contents_cache_shutdown(cache);
+}
+
+TEST(ScStorageLinkContentsCacheTest, EvictLeastRecentlyUsed)
+{
+  // each of 16 shards fits two contents of 1000 bytes
+  sc_storage_link_contents_cache * cache = _test_initialize_link_contents_cache(16 * 2500);
+  ASSERT_NE(cache, nullptr);
+
+  // sc-links with hashes 0, 16 and 32 are stored in the same shard
+  std::string const content(1000, 'a');
+  sc_stream_free(sc_storage_link_contents_cache_put(cache, 0, _test_new_link_content(content), content.size()));
+  sc_stream_free(sc_storage_link_contents_cache_put(cache, 16, _test_new_link_content(content), content.size()));
+
+  sc_stream * stream = sc_storage_link_contents_cache_get(cache, 0);
+  ASSERT_NE(stream, nullptr);
+  sc_stream_free(stream);
+
+  sc_stream * evicted_stream = sc_storage_link_contents_cache_get(cache, 16);
+  ASSERT_NE(evicted_stream, nullptr);
+
+  sc_stream_free(sc_storage_link_contents_cache_put(cache, 32, _test_new_link_content(content), content.size()));
+  sc_stream_free(sc_storage_link_contents_cache_put(cache, 48, _test_new_link_content(content), content.size()));
+
+  EXPECT_EQ(sc_storage_link_contents_cache_get(cache, 0), nullptr);
+  EXPECT_EQ(sc_storage_link_contents_cache_get(cache, 16), nullptr);
+  // stream reads evicted content
+  EXPECT_EQ(_test_get_stream_content(evicted_stream), content);
+  sc_stream_free(evicted_stream);
+
+  // content bigger than shard isn't cached
+  std::string const big_content(3000, 'b');
+  stream = sc_storage_link_contents_cache_put(cache, 64, _test_new_link_content(big_content), big_content.size());
+  EXPECT_EQ(_test_get_stream_content(stream), big_content);
+  sc_stream_free(stream);
+  EXPECT_EQ(sc_storage_link_contents_cache_get(cache, 64), nullptr);
+
+  sc_storage_link_contents_cache_statistics statistics;
+  sc_storage_link_contents_cache_get_statistics(cache, &statistics);
+  EXPECT_EQ(statistics.evictions_count, 2u);
+  EXPECT_EQ(statistics.contents_count, 2u);
+
+  sc_storage_link_contents_cache_shutdown(cache);
+}
+
+TEST(ScStorageLinkContentsCacheTest, Disabled)
+{
+  sc_storage_link_contents_cache * cache = _test_initialize_link_contents_cache(0);
+  EXPECT_EQ(cache, nullptr);
+
+  sc_stream * stream = sc_storage_link_contents_cache_put(cache, 1, _test_new_link_content("content"), 7);
+  EXPECT_EQ(_test_get_stream_content(stream), "content");
+  sc_stream_free(stream);
+  EXPECT_EQ(sc_storage_link_contents_cache_get(cache, 1), nullptr);
+  sc_storage_link_contents_cache_remove(cache, 1);
+
+  sc_storage_link_contents_cache_statistics statistics;
+  sc_storage_link_contents_cache_get_statistics(cache, &statistics);
+  EXPECT_EQ(statistics.hits_count, 0u);
+  EXPECT_EQ(statistics.misses_count, 0u);
+
+  sc_storage_link_contents_cache_shutdown(cache);
+}
@@ -0,0 +1,62 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include <glib.h>
+
+#include <string>
+#include <vector>
+
+extern "C"
+{
+#include <sc-core/sc_stream_memory.h>
+#include <sc-core/sc-base/sc_allocator.h>
+
+#include <sc-store/sc_stream_private.h>
+}
+
+TEST(ScStreamBase64Test, ReadByChunks)
+{
+  std::vector<sc_uint32> const sizes = {
+      0, 1, 2, 3, 4, SC_STREAM_CHUNK_SIZE - 1, SC_STREAM_CHUNK_SIZE, 3 * SC_STREAM_CHUNK_SIZE + 2};
+  for (sc_uint32 const size : sizes)
+  {
+    std::string data(size, '\0');
+    for (sc_uint32 i = 0; i < size; ++i)
+      data[i] = (sc_char)(i * 13 % 256);
+    sc_char * expected_encoding = g_base64_encode((guchar const *)data.data(), data.size());
+
+    sc_stream * stream =
+        sc_stream_base64_new(sc_stream_memory_new(data.data(), data.size(), SC_STREAM_FLAG_READ, SC_FALSE));
+    ASSERT_NE(stream, nullptr);
+
+    sc_uint32 length;
+    EXPECT_EQ(sc_stream_get_length(stream, &length), SC_RESULT_OK);
+    EXPECT_EQ(length, std::string(expected_encoding).size());
+
+    // encoding is read by parts not aligned with chunks of data
+    std::string encoding;
+    sc_char part[1000];
+    sc_uint32 read_bytes;
+    while (!sc_stream_eof(stream))
+    {
+      EXPECT_EQ(sc_stream_read_data(stream, part, sizeof(part), &read_bytes), SC_RESULT_OK);
+      encoding.append(part, read_bytes);
+    }
+    EXPECT_EQ(encoding, expected_encoding) << "size: " << size;
+
+    if (length > 10)
+    {
+      EXPECT_EQ(sc_stream_seek(stream, SC_STREAM_SEEK_END, 10), SC_RESULT_OK);
+      EXPECT_EQ(sc_stream_read_data(stream, part, sizeof(part), &read_bytes), SC_RESULT_OK);
+      EXPECT_EQ(std::string(part, read_bytes), std::string(expected_encoding + length - 10));
+    }
+
+    g_free(expected_encoding);
+    sc_stream_free(stream);
+  }
+}
@@ -0,0 +1,110 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <sc-memory/test/sc_test.hpp>
+
+#include <map>
+#include <random>
+
+extern "C"
+{
+#include <sc-store/sc-container/sc_number_hash_map.h>
+}
+
+TEST(ScNumberHashMapTest, sc_number_hash_map_init_destroy)
+{
+  sc_number_hash_map * map;
+  EXPECT_TRUE(sc_number_hash_map_initialize(&map, 0));
+  EXPECT_EQ(map->size, 0u);
+  EXPECT_TRUE(sc_number_hash_map_destroy(map));
+
+  EXPECT_TRUE(sc_number_hash_map_initialize(&map, 1000));
+  EXPECT_GE(map->capacity, 1000u);
+  EXPECT_TRUE(sc_number_hash_map_destroy(map));
+
+  EXPECT_FALSE(sc_number_hash_map_initialize(nullptr, 0));
+  EXPECT_FALSE(sc_number_hash_map_destroy(nullptr));
+}
+
+TEST(ScNumberHashMapTest, sc_number_hash_map_insert_get_remove)
+{
+  sc_number_hash_map * map;
+  EXPECT_TRUE(sc_number_hash_map_initialize(&map, 0));
+
+  sc_uint64 value;
+  EXPECT_FALSE(sc_number_hash_map_get(map, 0, &value));
+  EXPECT_TRUE(sc_number_hash_map_insert(map, 0, 10));
+  EXPECT_TRUE(sc_number_hash_map_get(map, 0, &value));
+  EXPECT_EQ(value, 10u);
+
+  EXPECT_TRUE(sc_number_hash_map_insert(map, 0, 20));
+  EXPECT_TRUE(sc_number_hash_map_get(map, 0, &value));
+  EXPECT_EQ(value, 20u);
+  EXPECT_EQ(map->size, 1u);
+
+  EXPECT_FALSE(sc_number_hash_map_insert(map, SC_NUMBER_HASH_MAP_EMPTY_KEY, 1));
+  EXPECT_FALSE(sc_number_hash_map_get(map, SC_NUMBER_HASH_MAP_EMPTY_KEY, &value));
+
+  EXPECT_TRUE(sc_number_hash_map_remove(map, 0, &value));
+  EXPECT_EQ(value, 20u);
+  EXPECT_FALSE(sc_number_hash_map_remove(map, 0, nullptr));
+  EXPECT_FALSE(sc_number_hash_map_get(map, 0, &value));
+  EXPECT_EQ(map->size, 0u);
+
+  EXPECT_TRUE(sc_number_hash_map_destroy(map));
+}
+
+sc_bool _test_sc_number_hash_map_sum(sc_uint64 key, sc_uint64 value, void ** arguments)
+{
+  *(sc_uint64 *)arguments[0] += key;
+  *(sc_uint64 *)arguments[1] += value;
+  return SC_TRUE;
+}
+
+TEST(ScNumberHashMapTest, sc_number_hash_map_compare_with_std_map)
+{
+  sc_number_hash_map * map;
+  EXPECT_TRUE(sc_number_hash_map_initialize(&map, 0));
+
+  std::map<sc_uint64, sc_uint64> expected;
+  std::mt19937_64 generator(42);
+  for (sc_uint64 i = 0; i < 100000; ++i)
+  {
+    // small keys range produces long probe sequences and many removals from their middle
+    sc_uint64 const key = generator() % 5000;
+    if (generator() % 3 == 0)
+    {
+      sc_uint64 value;
+      EXPECT_EQ(sc_number_hash_map_remove(map, key, &value), expected.erase(key) == 1);
+    }
+    else
+    {
+      EXPECT_TRUE(sc_number_hash_map_insert(map, key, i));
+      expected[key] = i;
+    }
+  }
+
+  EXPECT_EQ(map->size, expected.size());
+  sc_uint64 expected_keys_sum = 0;
+  sc_uint64 expected_values_sum = 0;
+  for (auto const & [key, expected_value] : expected)
+  {
+    sc_uint64 value;
+    EXPECT_TRUE(sc_number_hash_map_get(map, key, &value));
+    EXPECT_EQ(value, expected_value);
+    expected_keys_sum += key;
+    expected_values_sum += expected_value;
+  }
+
+  sc_uint64 keys_sum = 0;
+  sc_uint64 values_sum = 0;
+  void * arguments[2] = {&keys_sum, &values_sum};
+  EXPECT_TRUE(sc_number_hash_map_visit(map, _test_sc_number_hash_map_sum, arguments));
+  EXPECT_EQ(keys_sum, expected_keys_sum);
+  EXPECT_EQ(values_sum, expected_values_sum);
+
+  EXPECT_TRUE(sc_number_hash_map_destroy(map));
+}
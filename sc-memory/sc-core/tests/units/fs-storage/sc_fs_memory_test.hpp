@@ -15,6 +15,7 @@ class ScFSMemoryTest : public testing::Test
 public:
   static inline sc_char SC_FS_MEMORY_PATH[10] = "fs-memory";
   static inline sc_char SC_FS_MEMORY_SEGMENTS_PATH[24] = "fs-memory/segments.scdb";
+  static inline sc_char SC_FS_MEMORY_SEGMENTS_CHANGES_PATH[32] = "fs-memory/segments_changes.scdb";
 
 protected:
   void SetUp() override {}
@@ -6,12 +6,21 @@
 
 #include "sc_dictionary_fs_memory_test.hpp"
 
+#include <atomic>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
 extern "C"
 {
 #include <sc-core/sc-base/sc_allocator.h>
 #include <sc-core/sc-container/sc_list.h>
 #include <sc-core/sc-container/sc_string.h>
+#include <sc-core/sc_stream_file.h>
+#include <sc-core/sc_stream_memory.h>
 
+#include <sc-store/sc_stream_private.h>
 #include <sc-store/sc-fs-memory/sc_dictionary_fs_memory.h>
 #include <sc-store/sc-fs-memory/sc_dictionary_fs_memory_private.h>
 #include <sc-store/sc-fs-memory/sc_file_system.h>
@@ -77,6 +86,8 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_nullptr)
   EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 0, nullptr, 0), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 0), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, 0, nullptr, nullptr), SC_FS_MEMORY_NO);
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_offset_by_link_hash(memory, 0, nullptr), SC_FS_MEMORY_NO);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string_offset(memory, 0, 0), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_get_link_hashes_by_string(memory, nullptr, 0, nullptr), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_get_link_hashes_by_substring(memory, nullptr, 0, nullptr), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_get_link_hashes_by_substring_ext(memory, nullptr, 0, 0, nullptr), SC_FS_MEMORY_NO);
@@ -106,6 +117,36 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_init_save_shutdown_load
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_save_changed)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+
+  sc_char string[] = TEXT_EXAMPLE_1;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, string, sc_str_len(string)), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(memory->is_changed);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_FALSE(memory->is_changed);
+
+  // not changed dictionaries aren't rewritten
+  auto const saveTime = std::filesystem::last_write_time(memory->string_offsets_link_hashes_path);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(saveTime, std::filesystem::last_write_time(memory->string_offsets_link_hashes_path));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 112), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(memory->is_changed);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  sc_char * found_string;
+  sc_uint64 size;
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, 112, &found_string, &size), SC_FS_MEMORY_NO_STRING);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_init_rm_shutdown_load)
 {
   sc_dictionary_fs_memory * memory;
@@ -173,6 +214,46 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash_by_threads)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_uint32 const stringsCount = 1000;
+  for (sc_uint32 i = 1; i <= stringsCount; ++i)
+  {
+    std::string const string = "string " + std::to_string(i);
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, i, string.c_str(), string.size()), SC_FS_MEMORY_OK);
+  }
+
+  // Strings are read by several threads at the same time
+  std::atomic_uint readStringsCount = 0;
+  std::vector<std::thread> threads;
+  for (sc_uint32 t = 0; t < 4; ++t)
+    threads.emplace_back(
+        [&]()
+        {
+          for (sc_uint32 i = 1; i <= stringsCount; ++i)
+          {
+            sc_char * foundString;
+            sc_uint64 size;
+            if (sc_dictionary_fs_memory_get_string_by_link_hash(memory, i, &foundString, &size) != SC_FS_MEMORY_OK)
+              continue;
+
+            if (std::string(foundString, size) == "string " + std::to_string(i))
+              ++readStringsCount;
+            sc_mem_free(foundString);
+          }
+        });
+
+  for (auto & thread : threads)
+    thread.join();
+
+  EXPECT_EQ(readStringsCount.load(), 4 * stringsCount);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash_invalid_data)
 {
   sc_dictionary_fs_memory * memory;
@@ -252,6 +333,35 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_link_string_offset_restore)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  {
+    sc_addr_hash hash = 112;
+    sc_uint64 string_offset;
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_string_offset_by_link_hash(memory, hash, &string_offset), SC_FS_MEMORY_NO_STRING);
+
+    sc_char string1[] = TEXT_EXAMPLE_1;
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_get_string_offset_by_link_hash(memory, hash, &string_offset), SC_FS_MEMORY_OK);
+
+    sc_char string2[] = TEXT_EXAMPLE_2;
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string_offset(memory, hash, string_offset), SC_FS_MEMORY_OK);
+
+    sc_char * found_string;
+    sc_uint64 size;
+    EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash, &found_string, &size), SC_FS_MEMORY_OK);
+    EXPECT_TRUE(sc_str_cmp(found_string, string1));
+    sc_mem_free(found_string);
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash_not_found)
 {
   sc_dictionary_fs_memory * memory;
@@ -886,6 +996,96 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_stri
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+void _test_expect_link_hashes_by_string(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * string,
+    std::vector<sc_addr_hash> const & expected_link_hashes)
+{
+  sc_list * found_link_hashes;
+  sc_list_init(&found_link_hashes);
+  sc_link_handler link_handler;
+  link_handler.check_link_callback = nullptr;
+  link_handler.check_link_callback_data = nullptr;
+  link_handler.request_link_callback = nullptr;
+  link_handler.request_link_callback_data = nullptr;
+  link_handler.push_link_callback = _test_push_link_hash;
+  link_handler.push_link_callback_data = found_link_hashes;
+  link_handler.push_link_content_callback = nullptr;
+  link_handler.push_link_content_callback_data = nullptr;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_link_hashes_by_string(memory, string, sc_str_len(string), &link_handler),
+      SC_FS_MEMORY_OK);
+  EXPECT_EQ(found_link_hashes->size, expected_link_hashes.size());
+
+  std::vector<sc_addr_hash> link_hashes;
+  sc_iterator * it = sc_list_iterator(found_link_hashes);
+  while (sc_iterator_next(it))
+    link_hashes.push_back((sc_pointer_to_sc_addr_hash)sc_iterator_get(it));
+  sc_iterator_destroy(it);
+  sc_list_destroy(found_link_hashes);
+
+  EXPECT_EQ(link_hashes, expected_link_hashes);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_string_relink_unlink_save_load)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char string1[] = TEXT_EXAMPLE_1;
+  sc_char string2[] = TEXT_EXAMPLE_2;
+
+  sc_addr_hash const LINKS_COUNT = 100;
+  for (sc_addr_hash hash = 0; hash < LINKS_COUNT; ++hash)
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+
+  // relink link from the middle, unlink the first and the last links of string
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 50, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 0), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, LINKS_COUNT - 1), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, LINKS_COUNT), SC_FS_MEMORY_OK);
+
+  std::vector<sc_addr_hash> expected_link_hashes;
+  for (sc_addr_hash hash = 1; hash < LINKS_COUNT - 1; ++hash)
+  {
+    if (hash != 50)
+      expected_link_hashes.push_back(hash);
+  }
+  _test_expect_link_hashes_by_string(memory, string1, expected_link_hashes);
+  _test_expect_link_hashes_by_string(memory, string2, {50});
+
+  sc_char * found_string;
+  sc_uint64 found_string_size;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash(memory, 0, &found_string, &found_string_size),
+      SC_FS_MEMORY_NO_STRING);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash(memory, 50, &found_string, &found_string_size),
+      SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_str_cmp(found_string, string2));
+  sc_mem_free(found_string);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  _test_expect_link_hashes_by_string(memory, string1, expected_link_hashes);
+  _test_expect_link_hashes_by_string(memory, string2, {50});
+
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash(memory, 0, &found_string, &found_string_size),
+      SC_FS_MEMORY_NO_STRING);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash(memory, 1, &found_string, &found_string_size),
+      SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_str_cmp(found_string, string1));
+  sc_mem_free(found_string);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_substring)
 {
   sc_dictionary_fs_memory * memory;
@@ -987,6 +1187,88 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_subs
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+void _test_expect_link_hashes_by_substring(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * substring,
+    std::vector<sc_addr_hash> const & expected_link_hashes)
+{
+  sc_list * found_link_hashes;
+  sc_list_init(&found_link_hashes);
+  sc_link_handler link_handler;
+  link_handler.check_link_callback = nullptr;
+  link_handler.check_link_callback_data = nullptr;
+  link_handler.request_link_callback = nullptr;
+  link_handler.request_link_callback_data = nullptr;
+  link_handler.push_link_callback = _test_push_link_hash;
+  link_handler.push_link_callback_data = found_link_hashes;
+  link_handler.push_link_content_callback = nullptr;
+  link_handler.push_link_content_callback_data = nullptr;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_link_hashes_by_substring(memory, substring, sc_str_len(substring), &link_handler),
+      SC_FS_MEMORY_OK);
+
+  std::vector<sc_addr_hash> link_hashes;
+  sc_iterator * it = sc_list_iterator(found_link_hashes);
+  while (sc_iterator_next(it))
+    link_hashes.push_back((sc_pointer_to_sc_addr_hash)sc_iterator_get(it));
+  sc_iterator_destroy(it);
+  sc_list_destroy(found_link_hashes);
+
+  EXPECT_EQ(link_hashes, expected_link_hashes) << "substring: " << substring;
+}
+
+void _test_expect_link_hashes_by_infixes(sc_dictionary_fs_memory * memory)
+{
+  _test_expect_link_hashes_by_substring(memory, "irst str", {112});
+  _test_expect_link_hashes_by_substring(memory, "econd", {518});
+  _test_expect_link_hashes_by_substring(memory, "tring", {112, 518, 700});
+  _test_expect_link_hashes_by_substring(memory, "s the ", {112, 518});
+  _test_expect_link_hashes_by_substring(memory, "strings", {700});
+  _test_expect_link_hashes_by_substring(memory, "ing st", {700});
+  _test_expect_link_hashes_by_substring(memory, "third", {});
+  _test_expect_link_hashes_by_substring(memory, "firsts", {});
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_infix_save_load)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char string1[] = TEXT_EXAMPLE_1;
+  sc_char string2[] = TEXT_EXAMPLE_2;
+  sc_char string3[] = "string strings";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 700, string3, sc_str_len(string3)), SC_FS_MEMORY_OK);
+  // not searchable strings aren't found by infixes
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string_ext(memory, 800, "the first strings", 17, SC_FALSE), SC_FS_MEMORY_OK);
+
+  _test_expect_link_hashes_by_infixes(memory);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  _test_expect_link_hashes_by_infixes(memory);
+
+  // index is built by loaded strings if there is no its file
+  EXPECT_TRUE(sc_fs_remove_file(memory->trigrams_string_offsets_path));
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  _test_expect_link_hashes_by_infixes(memory);
+
+  sc_char string4[] = "the third string";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 900, string4, sc_str_len(string4)), SC_FS_MEMORY_OK);
+  _test_expect_link_hashes_by_substring(memory, "third", {900});
+  _test_expect_link_hashes_by_substring(memory, "rd str", {900});
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_substring_when_false_config)
 {
   sc_dictionary_fs_memory * memory;
@@ -1574,3 +1856,120 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_mutiple_link_strings_wi
 
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
+
+std::string _test_read_stream(sc_stream * stream)
+{
+  sc_char * data;
+  sc_uint32 size;
+  EXPECT_TRUE(sc_stream_get_data(stream, &data, &size));
+  std::string content(data, size);
+  sc_mem_free(data);
+  return content;
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_link_stream_get_stream_by_link_hash)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  std::string big_content(3 * SC_STREAM_CHUNK_SIZE + 5, 'a');
+  for (size_t i = 0; i < big_content.size(); ++i)
+    big_content[i] = (sc_char)('a' + i % 26);
+  sc_stream * stream = sc_stream_memory_new(big_content.c_str(), big_content.size(), SC_STREAM_FLAG_READ, SC_FALSE);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_stream(memory, 112, stream, SC_TRUE), SC_FS_MEMORY_OK);
+  sc_stream_free(stream);
+
+  sc_char small_content[] = TEXT_EXAMPLE_1;
+  stream = sc_stream_memory_new(small_content, sc_str_len(small_content), SC_STREAM_FLAG_READ, SC_FALSE);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_stream(memory, 518, stream, SC_TRUE), SC_FS_MEMORY_OK);
+  sc_stream_free(stream);
+
+  auto const & expectContents = [&]()
+  {
+    sc_char * string;
+    sc_uint64 size;
+    sc_stream * found_stream;
+    // big content is read from strings channel by chunks
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_stream_by_link_hash(memory, 112, &string, &size, &found_stream), SC_FS_MEMORY_OK);
+    EXPECT_EQ(string, nullptr);
+    EXPECT_NE(found_stream, nullptr);
+    EXPECT_EQ(_test_read_stream(found_stream), big_content);
+    sc_stream_free(found_stream);
+
+    EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, 112, &string, &size), SC_FS_MEMORY_OK);
+    EXPECT_EQ(std::string(string, size), big_content);
+    sc_mem_free(string);
+
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_stream_by_link_hash(memory, 518, &string, &size, &found_stream), SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_stream, nullptr);
+    EXPECT_EQ(std::string(string, size), small_content);
+    sc_mem_free(string);
+
+    // small content is found by its substrings
+    _test_expect_link_hashes_by_substring(memory, "first", {518});
+  };
+  expectContents();
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  expectContents();
+
+  // stream reads content changed after it is got
+  sc_char * string;
+  sc_uint64 size;
+  sc_stream * found_stream;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_stream_by_link_hash(memory, 112, &string, &size, &found_stream), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 112, small_content, sc_str_len(small_content)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_read_stream(found_stream), big_content);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // stream reads strings channel after sc-fs-memory is shut down
+  EXPECT_EQ(_test_read_stream(found_stream), big_content);
+  sc_stream_free(found_stream);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_stream_by_link_hash_binary_file)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  std::string file_content(2 * SC_STREAM_CHUNK_SIZE + 1, '\0');
+  for (size_t i = 0; i < file_content.size(); ++i)
+    file_content[i] = (sc_char)(i * 7 % 256);
+  sc_char file_path[] = "fs-memory/content.bin";
+  sc_stream * file_stream = sc_stream_file_new(file_path, SC_STREAM_FLAG_WRITE);
+  sc_uint32 written_bytes;
+  sc_stream_write_data(file_stream, file_content.data(), file_content.size(), &written_bytes);
+  sc_stream_free(file_stream);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, file_path, sc_str_len(file_path)), SC_FS_MEMORY_OK);
+
+  sc_char * encoded_content = g_base64_encode((guchar const *)file_content.data(), file_content.size());
+
+  // content of binary file is encoded by chunks while it is read
+  sc_char * string;
+  sc_uint64 size;
+  sc_stream * found_stream;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_stream_by_link_hash(memory, 112, &string, &size, &found_stream), SC_FS_MEMORY_OK);
+  EXPECT_EQ(string, nullptr);
+  EXPECT_NE(found_stream, nullptr);
+  EXPECT_EQ(_test_read_stream(found_stream), encoded_content);
+  sc_stream_free(found_stream);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, 112, &string, &size), SC_FS_MEMORY_OK);
+  EXPECT_EQ(std::string(string, size), encoded_content);
+  sc_mem_free(string);
+
+  g_free(encoded_content);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
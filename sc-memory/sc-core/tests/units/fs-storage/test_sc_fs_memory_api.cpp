@@ -6,12 +6,15 @@
 
 #include "sc_fs_memory_test.hpp"
 
+#include <fstream>
+
 extern "C"
 {
 #include <sc-core/sc-container/sc_string.h>
 
 #include <sc-store/sc-fs-memory/sc_file_system.h>
 #include <sc-store/sc-fs-memory/sc_fs_memory.h>
+#include <sc-store/sc-fs-memory/sc_fs_memory_bundle.h>
 #include <sc-store/sc-fs-memory/sc_io.h>
 #include <sc-store/sc_segment.h>
 #include <sc-store/sc_storage_private.h>
@@ -71,6 +74,332 @@ TEST_F(ScFSMemoryTest, sc_fs_memory_save_load)
   EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
 }
 
+TEST_F(ScFSMemoryTest, sc_fs_memory_save_load_mapped_segments)
+{
+  EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
+
+  sc_storage * storage = sc_mem_new(sc_storage, 1);
+  storage->segments = sc_mem_new(sc_segment *, 2);
+
+  storage->segments_count = 2;
+  storage->segments[0] = sc_segment_new(1);
+  storage->segments[1] = sc_segment_new(2);
+  storage->segments[0]->elements[1].flags = sc_element_flags{sc_type_const_node, SC_STATE_ELEMENT_EXIST};
+  storage->segments[0]->last_engaged_offset = 1;
+  storage->segments[1]->elements[SC_SEGMENT_ELEMENTS_COUNT - 1].flags =
+      sc_element_flags{sc_type_const_node_link, SC_STATE_ELEMENT_EXIST};
+  storage->segments[1]->last_engaged_offset = SC_SEGMENT_ELEMENTS_COUNT - 1;
+  storage->segments[1]->last_released_offset = 5;
+  EXPECT_EQ(sc_fs_memory_save(storage), SC_FS_MEMORY_OK);
+  sc_segment_free(storage->segments[0]);
+  sc_segment_free(storage->segments[1]);
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments_count, 2u);
+  EXPECT_TRUE(storage->segments[0]->is_mapped);
+  EXPECT_TRUE(storage->segments[1]->is_mapped);
+  EXPECT_EQ(storage->segments[0]->elements[1].flags.type, sc_type_const_node);
+  EXPECT_EQ(storage->segments[0]->last_engaged_offset, 1u);
+  EXPECT_EQ(storage->segments[0]->last_released_offset, 0u);
+  EXPECT_EQ(storage->segments[1]->elements[SC_SEGMENT_ELEMENTS_COUNT - 1].flags.type, sc_type_const_node_link);
+  EXPECT_EQ(storage->segments[1]->last_engaged_offset, SC_SEGMENT_ELEMENTS_COUNT - 1);
+  // not existing sc-elements are saved as free, even if they aren't released, for example, reserved by threads caches
+  EXPECT_EQ(storage->segments[1]->last_released_offset, 1u);
+  EXPECT_EQ(storage->segments[1]->elements[1].flags.type, 2u);
+
+  // changes of mapped sc-elements are saved, but aren't written to mapped file directly
+  storage->segments[0]->elements[2].flags = sc_element_flags{sc_type_const_node, SC_STATE_ELEMENT_EXIST};
+  storage->segments[0]->last_engaged_offset = 2;
+  EXPECT_EQ(sc_fs_memory_save(storage), SC_FS_MEMORY_OK);
+  sc_segment_free(storage->segments[0]);
+  sc_segment_free(storage->segments[1]);
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments[0]->elements[2].flags.type, sc_type_const_node);
+  EXPECT_EQ(storage->segments[0]->last_engaged_offset, 2u);
+  sc_segment_free(storage->segments[0]);
+  sc_segment_free(storage->segments[1]);
+
+  sc_mem_free(storage->segments);
+  sc_mem_free(storage);
+
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScFSMemoryTest, sc_fs_memory_load_streamed_segments)
+{
+  EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
+
+  sc_storage * storage = sc_mem_new(sc_storage, 1);
+  storage->segments = sc_mem_new(sc_segment *, 2);
+
+  // segments file of previous versions has no layout magic in its header
+  sc_io_channel * channel = sc_io_new_write_channel(SC_FS_MEMORY_SEGMENTS_PATH, nullptr);
+  sc_io_channel_set_encoding(channel, nullptr, nullptr);
+  EXPECT_NE(channel, nullptr);
+  sc_fs_memory_header const header = {};
+  EXPECT_EQ(sc_fs_memory_header_write(channel, header), SC_FS_MEMORY_OK);
+
+  sc_uint64 written_bytes;
+  sc_addr_seg const storage_attributes[] = {1, 1, 0};
+  EXPECT_EQ(
+      sc_io_channel_write_chars(channel, storage_attributes, sizeof(storage_attributes), &written_bytes, nullptr),
+      SC_FS_IO_STATUS_NORMAL);
+  for (sc_addr_offset offset = 0; offset < SC_SEGMENT_ELEMENTS_COUNT; ++offset)
+  {
+    sc_full_element element = {};
+    if (offset == 1)
+      element.flags = sc_element_flags{sc_type_const_node, SC_STATE_ELEMENT_EXIST};
+    EXPECT_EQ(
+        sc_io_channel_write_chars(channel, &element, sizeof(element), &written_bytes, nullptr),
+        SC_FS_IO_STATUS_NORMAL);
+  }
+  sc_addr_offset const segment_offsets[] = {1, 0};
+  EXPECT_EQ(
+      sc_io_channel_write_chars(channel, segment_offsets, sizeof(segment_offsets), &written_bytes, nullptr),
+      SC_FS_IO_STATUS_NORMAL);
+  sc_io_channel_shutdown(channel, SC_TRUE, nullptr);
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments_count, 1u);
+  EXPECT_FALSE(storage->segments[0]->is_mapped);
+  EXPECT_EQ(storage->segments[0]->elements[1].flags.type, sc_type_const_node);
+  EXPECT_EQ(storage->segments[0]->last_engaged_offset, 1u);
+
+  // segments file is saved in mapped layout after loading streamed one
+  EXPECT_EQ(sc_fs_memory_save(storage), SC_FS_MEMORY_OK);
+  sc_segment_free(storage->segments[0]);
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments_count, 1u);
+  EXPECT_TRUE(storage->segments[0]->is_mapped);
+  EXPECT_EQ(storage->segments[0]->elements[1].flags.type, sc_type_const_node);
+  sc_segment_free(storage->segments[0]);
+
+  sc_mem_free(storage->segments);
+  sc_mem_free(storage);
+
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+}
+
+#ifdef SC_COMPACT_ELEMENTS_LAYOUT
+TEST_F(ScFSMemoryTest, sc_fs_memory_save_load_compact_segments)
+{
+  EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
+
+  sc_storage * storage = sc_mem_new(sc_storage, 1);
+  storage->segments = sc_mem_new(sc_segment *, 1);
+
+  storage->segments_count = 1;
+  sc_segment * segment = storage->segments[0] = sc_segment_new(1);
+  segment->elements[1].flags = sc_element_flags{sc_type_const_node, SC_STATE_ELEMENT_EXIST};
+  segment->elements[2].flags = sc_element_flags{sc_type_const_perm_pos_arc, SC_STATE_ELEMENT_EXIST};
+  segment->elements[2].arc_index = sc_segment_allocate_arc(segment);
+  segment->arcs[segment->elements[2].arc_index].begin = sc_addr{1, 1};
+  segment->arcs[segment->elements[2].arc_index].end = sc_addr{1, 1};
+  segment->last_engaged_offset = 2;
+  // not engaged sc-connectors records aren't saved
+  segment->arcs[2].begin = sc_addr{1, 2};
+  EXPECT_EQ(sc_fs_memory_save(storage), SC_FS_MEMORY_OK);
+  sc_segment_free(segment);
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  segment = storage->segments[0];
+  EXPECT_TRUE(segment->is_mapped);
+  EXPECT_EQ(segment->elements[1].arc_index, 0u);
+  EXPECT_EQ(segment->elements[2].arc_index, 1u);
+  EXPECT_EQ(segment->last_engaged_arc_index, 1u);
+  EXPECT_EQ(segment->last_released_arc_index, 0u);
+  sc_arc_info const * arc = sc_segment_get_element_arc(segment, &segment->elements[2]);
+  EXPECT_EQ(arc->begin.offset, 1u);
+  EXPECT_EQ(arc->end.offset, 1u);
+  EXPECT_EQ(segment->arcs[2].begin.offset, 0u);
+
+  // released sc-connectors records are taken first
+  sc_segment_release_arc(segment, segment->elements[2].arc_index);
+  EXPECT_EQ(sc_segment_allocate_arc(segment), 1u);
+  EXPECT_EQ(sc_segment_allocate_arc(segment), 2u);
+  sc_segment_free(segment);
+
+  sc_mem_free(storage->segments);
+  sc_mem_free(storage);
+
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+}
+#endif
+
+TEST_F(ScFSMemoryTest, sc_fs_memory_save_load_segments_changes)
+{
+  EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
+
+  sc_storage * storage = sc_mem_new(sc_storage, 1);
+  storage->segments = sc_mem_new(sc_segment *, 4);
+  storage->max_segments_count = 4;
+
+  storage->segments_count = 3;
+  for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+  {
+    storage->segments[i] = sc_segment_new(i + 1);
+    storage->segments[i]->elements[1].flags = sc_element_flags{sc_type_const_node, SC_STATE_ELEMENT_EXIST};
+    storage->segments[i]->last_engaged_offset = 1;
+  }
+  EXPECT_EQ(sc_fs_memory_save(storage), SC_FS_MEMORY_OK);
+  EXPECT_FALSE(sc_segment_is_changed(storage->segments[0]));
+  EXPECT_FALSE(sc_segment_is_changed(storage->segments[1]));
+  EXPECT_FALSE(sc_segment_is_changed(storage->segments[2]));
+
+  EXPECT_EQ(sc_fs_memory_save_changes(storage), SC_FS_MEMORY_OK);
+  EXPECT_FALSE(sc_fs_is_file(SC_FS_MEMORY_SEGMENTS_CHANGES_PATH));
+
+  storage->segments[1]->elements[2].flags = sc_element_flags{sc_type_const_node_link, SC_STATE_ELEMENT_EXIST};
+  storage->segments[1]->last_engaged_offset = 2;
+  sc_segment_mark_changed(storage->segments[1]);
+  EXPECT_EQ(sc_fs_memory_save_changes(storage), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_is_file(SC_FS_MEMORY_SEGMENTS_CHANGES_PATH));
+  for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+    sc_segment_free(storage->segments[i]);
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments_count, 3u);
+  EXPECT_FALSE(sc_segment_is_changed(storage->segments[0]));
+  EXPECT_TRUE(sc_segment_is_changed(storage->segments[1]));
+  EXPECT_FALSE(sc_segment_is_changed(storage->segments[2]));
+  EXPECT_EQ(storage->segments[1]->elements[1].flags.type, sc_type_const_node);
+  EXPECT_EQ(storage->segments[1]->elements[2].flags.type, sc_type_const_node_link);
+  EXPECT_EQ(storage->segments[1]->last_engaged_offset, 2u);
+
+  // changes are accumulated until the next full save
+  storage->segments[3] = sc_segment_new(4);
+  storage->segments[3]->elements[1].flags = sc_element_flags{sc_type_const_node, SC_STATE_ELEMENT_EXIST};
+  storage->segments[3]->last_engaged_offset = 1;
+  storage->segments_count = 4;
+  EXPECT_EQ(sc_fs_memory_save_changes(storage), SC_FS_MEMORY_OK);
+  for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+    sc_segment_free(storage->segments[i]);
+  storage->segments_count = 0;
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments_count, 4u);
+  EXPECT_EQ(storage->segments[1]->elements[2].flags.type, sc_type_const_node_link);
+  EXPECT_EQ(storage->segments[3]->elements[1].flags.type, sc_type_const_node);
+  EXPECT_EQ(storage->segments[3]->last_engaged_offset, 1u);
+
+  EXPECT_EQ(sc_fs_memory_save(storage), SC_FS_MEMORY_OK);
+  EXPECT_FALSE(sc_fs_is_file(SC_FS_MEMORY_SEGMENTS_CHANGES_PATH));
+  for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+    sc_segment_free(storage->segments[i]);
+  storage->segments_count = 0;
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments_count, 4u);
+  EXPECT_FALSE(sc_segment_is_changed(storage->segments[1]));
+  EXPECT_EQ(storage->segments[1]->elements[2].flags.type, sc_type_const_node_link);
+  for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+    sc_segment_free(storage->segments[i]);
+
+  sc_mem_free(storage->segments);
+  sc_mem_free(storage);
+
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScFSMemoryTest, sc_fs_memory_bundle_write_extract)
+{
+  EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
+
+  sc_storage * storage = sc_mem_new(sc_storage, 1);
+  storage->segments = sc_mem_new(sc_segment *, 1);
+  storage->segments_count = 1;
+  storage->segments[0] = sc_segment_new(1);
+  storage->segments[0]->elements[1].flags = sc_element_flags{sc_type_const_node_link, SC_STATE_ELEMENT_EXIST};
+  storage->segments[0]->last_engaged_offset = 1;
+  EXPECT_EQ(sc_fs_memory_link_string(1, "bundled string", 14), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_save(storage), SC_FS_MEMORY_OK);
+  sc_segment_free(storage->segments[0]);
+  storage->segments_count = 0;
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  std::string const bundlePath = std::string(SC_FS_MEMORY_PATH) + "/kb.bundle";
+  EXPECT_EQ(sc_fs_memory_bundle_write(&params.version, SC_FS_MEMORY_PATH, bundlePath.c_str()), SC_FS_MEMORY_OK);
+
+  std::string const extractedPath = std::string(SC_FS_MEMORY_PATH) + "/extracted";
+  params.storage = extractedPath.c_str();
+  params.bundle = bundlePath.c_str();
+  params.clear = SC_TRUE;
+  EXPECT_EQ(sc_fs_memory_initialize_ext(&params), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_is_file((extractedPath + "/segments.scdb").c_str()));
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments_count, 1u);
+  EXPECT_EQ(storage->segments[0]->elements[1].flags.type, sc_type_const_node_link);
+  EXPECT_EQ(storage->segments[0]->last_engaged_offset, 1u);
+  sc_char * string;
+  sc_uint32 stringSize;
+  EXPECT_EQ(sc_fs_memory_get_string_by_link_hash(1, &string, &stringSize), SC_FS_MEMORY_OK);
+  EXPECT_EQ(std::string(string, stringSize), "bundled string");
+  sc_mem_free(string);
+  sc_segment_free(storage->segments[0]);
+
+  sc_mem_free(storage->segments);
+  sc_mem_free(storage);
+
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScFSMemoryTest, sc_fs_memory_bundle_extract_corrupted)
+{
+  EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_link_string(1, "bundled string", 14), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  std::string const bundlePath = std::string(SC_FS_MEMORY_PATH) + "/kb.bundle";
+  EXPECT_EQ(sc_fs_memory_bundle_write(&params.version, SC_FS_MEMORY_PATH, bundlePath.c_str()), SC_FS_MEMORY_OK);
+
+  std::string const extractedPath = std::string(SC_FS_MEMORY_PATH) + "/extracted";
+  params.storage = extractedPath.c_str();
+  params.bundle = "fs-memory/unknown.bundle";
+  EXPECT_EQ(sc_fs_memory_initialize_ext(&params), SC_FS_MEMORY_READ_ERROR);
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_NO);
+
+  // data of sections follows sections table aligned to memory pages
+  std::fstream bundle{bundlePath, std::ios::in | std::ios::out | std::ios::binary};
+  bundle.seekg(0x10000);
+  char const byte = static_cast<char>(bundle.get());
+  bundle.seekp(0x10000);
+  bundle.put(static_cast<char>(~byte));
+  bundle.close();
+
+  params.bundle = bundlePath.c_str();
+  EXPECT_EQ(sc_fs_memory_initialize_ext(&params), SC_FS_MEMORY_READ_ERROR);
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_NO);
+}
+
+TEST_F(ScFSMemoryTest, sc_fs_memory_bundle_write_not_read_file)
+{
+  EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_link_string(1, "bundled string", 14), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+
+  // not empty file that can't be mapped isn't written as empty section
+  std::string const notReadPath = std::string(SC_FS_MEMORY_PATH) + "/not_read.scdb";
+  EXPECT_TRUE(sc_fs_create_directory(notReadPath.c_str()));
+  EXPECT_TRUE(sc_fs_create_file((notReadPath + "/content").c_str()));
+
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  std::string const bundlePath = std::string(SC_FS_MEMORY_PATH) + "/kb.bundle";
+  EXPECT_EQ(
+      sc_fs_memory_bundle_write(&params.version, SC_FS_MEMORY_PATH, bundlePath.c_str()), SC_FS_MEMORY_READ_ERROR);
+  EXPECT_FALSE(sc_fs_is_file(bundlePath.c_str()));
+
+  EXPECT_TRUE(sc_fs_remove_directory(notReadPath.c_str()));
+  EXPECT_EQ(sc_fs_memory_bundle_write(&params.version, SC_FS_MEMORY_PATH, bundlePath.c_str()), SC_FS_MEMORY_OK);
+}
+
 TEST_F(ScFSMemoryTest, sc_fs_memory_save_load_save_invalid_file_read)
 {
   EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
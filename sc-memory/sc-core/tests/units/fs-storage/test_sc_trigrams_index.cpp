@@ -0,0 +1,131 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <sc-memory/test/sc_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+#include <sc-core/sc-base/sc_allocator.h>
+
+#include <sc-store/sc-fs-memory/sc_file_system.h>
+#include <sc-store/sc-fs-memory/sc_trigrams_index.h>
+}
+
+std::vector<sc_uint64> _test_get_trigrams_index_string_offsets(sc_trigrams_index * index, std::string const & substring)
+{
+  sc_uint64 * string_offsets;
+  sc_uint64 string_offsets_count;
+  EXPECT_TRUE(sc_trigrams_index_get_string_offsets(
+      index, substring.c_str(), substring.size(), &string_offsets, &string_offsets_count));
+  std::vector<sc_uint64> found_string_offsets(string_offsets, string_offsets + string_offsets_count);
+  sc_mem_free(string_offsets);
+  return found_string_offsets;
+}
+
+TEST(ScTrigramsIndexTest, sc_trigrams_index_get_string_offsets)
+{
+  sc_trigrams_index * index;
+  EXPECT_TRUE(sc_trigrams_index_initialize(&index));
+
+  sc_trigrams_index_append_string(index, 0, "it is the first string", 22);
+  sc_trigrams_index_append_string(index, 30, "it is the second string", 23);
+  sc_trigrams_index_append_string(index, 60, "aaaaaa", 6);
+  sc_trigrams_index_append_string(index, 70, "ab", 2);
+
+  EXPECT_EQ(_test_get_trigrams_index_string_offsets(index, "irst str"), std::vector<sc_uint64>({0}));
+  EXPECT_EQ(_test_get_trigrams_index_string_offsets(index, "string"), std::vector<sc_uint64>({0, 30}));
+  EXPECT_EQ(_test_get_trigrams_index_string_offsets(index, "aaaa"), std::vector<sc_uint64>({60}));
+  EXPECT_EQ(_test_get_trigrams_index_string_offsets(index, "third"), std::vector<sc_uint64>());
+  // found strings contain all trigrams of substring, but not substring itself
+  EXPECT_EQ(_test_get_trigrams_index_string_offsets(index, "the string"), std::vector<sc_uint64>({30}));
+
+  sc_uint64 * string_offsets;
+  sc_uint64 string_offsets_count;
+  EXPECT_FALSE(sc_trigrams_index_get_string_offsets(index, "ab", 2, &string_offsets, &string_offsets_count));
+  EXPECT_EQ(string_offsets_count, 0u);
+
+  EXPECT_TRUE(sc_trigrams_index_destroy(index));
+
+  EXPECT_FALSE(sc_trigrams_index_initialize(nullptr));
+  EXPECT_FALSE(sc_trigrams_index_destroy(nullptr));
+}
+
+TEST(ScTrigramsIndexTest, sc_trigrams_index_compare_with_brute_force_save_load)
+{
+  sc_trigrams_index * index;
+  EXPECT_TRUE(sc_trigrams_index_initialize(&index));
+
+  // small alphabet produces long lists of strings offsets with many common trigrams
+  std::mt19937_64 generator(42);
+  std::vector<std::pair<sc_uint64, std::string>> strings;
+  sc_uint64 string_offset = 0;
+  for (sc_uint32 i = 0; i < 2000; ++i)
+  {
+    std::string string(generator() % 20, 'a');
+    for (auto & symbol : string)
+      symbol = (sc_char)('a' + generator() % 4);
+
+    sc_trigrams_index_append_string(index, string_offset, string.c_str(), string.size());
+    strings.emplace_back(string_offset, string);
+    string_offset += string.size() + sizeof(sc_uint64) + generator() % 1000000;
+  }
+
+  auto const & expectStringOffsets = [&strings](sc_trigrams_index * index)
+  {
+    std::mt19937_64 generator(43);
+    for (sc_uint32 i = 0; i < 200; ++i)
+    {
+      std::string substring(SC_TRIGRAM_SIZE + generator() % 3, 'a');
+      for (auto & symbol : substring)
+        symbol = (sc_char)('a' + generator() % 4);
+
+      std::vector<sc_uint64> expected_string_offsets;
+      for (auto const & [offset, string] : strings)
+      {
+        if (string.find(substring) != std::string::npos)
+          expected_string_offsets.push_back(offset);
+      }
+
+      std::vector<sc_uint64> found_string_offsets;
+      for (sc_uint64 offset : _test_get_trigrams_index_string_offsets(index, substring))
+      {
+        auto const it = std::find_if(
+            strings.begin(),
+            strings.end(),
+            [offset](auto const & string)
+            {
+              return string.first == offset;
+            });
+        EXPECT_NE(it, strings.end());
+        if (it != strings.end() && it->second.find(substring) != std::string::npos)
+          found_string_offsets.push_back(offset);
+      }
+
+      EXPECT_EQ(found_string_offsets, expected_string_offsets) << "substring: " << substring;
+    }
+  };
+  expectStringOffsets(index);
+
+  sc_char const path[] = "trigrams_string_offsets.scdb";
+  EXPECT_TRUE(sc_trigrams_index_save(index, path));
+  EXPECT_TRUE(sc_trigrams_index_destroy(index));
+
+  EXPECT_TRUE(sc_trigrams_index_initialize(&index));
+  EXPECT_TRUE(sc_trigrams_index_load(index, path));
+  expectStringOffsets(index);
+  EXPECT_TRUE(sc_trigrams_index_destroy(index));
+
+  EXPECT_TRUE(sc_fs_remove_file(path));
+
+  EXPECT_TRUE(sc_trigrams_index_initialize(&index));
+  EXPECT_FALSE(sc_trigrams_index_load(index, path));
+  EXPECT_TRUE(sc_trigrams_index_destroy(index));
+}
@@ -12,6 +12,7 @@
 #include "sc-memory/sc_result.hpp"
 #include "sc-memory/sc_event_subscription.hpp"
 #include "sc-memory/sc_keynodes.hpp"
+#include "sc-memory/sc_template_cache.hpp"
 
 template <class TScEvent, class TScContext>
 ScAgent<TScEvent, TScContext>::ScAgent() noexcept
@@ -389,7 +390,7 @@ ScTemplate ScAgent<TScEvent, TScContext>::BuildInitiationConditionTemplate(
   }
 
   ScTemplate initiationConditionTemplate;
-  this->m_context.BuildTemplate(initiationConditionTemplate, initiationConditionTemplateAddr, templateParams);
+  ScTemplateCache::Build(this->m_context, initiationConditionTemplate, initiationConditionTemplateAddr, templateParams);
   return initiationConditionTemplate;
 }
 
@@ -399,7 +400,7 @@ ScTemplate ScAgent<TScEvent, TScContext>::BuildResultConditionTemplate(
     ScAddr const & resultConditionTemplateAddr) noexcept
 {
   ScTemplate resultConditionTemplate;
-  this->m_context.BuildTemplate(resultConditionTemplate, resultConditionTemplateAddr);
+  ScTemplateCache::Build(this->m_context, resultConditionTemplate, resultConditionTemplateAddr);
   return resultConditionTemplate;
 }
 
@@ -33,6 +33,7 @@ class ScAgentContext : public ScMemoryContext
   friend class ScAgent;
   friend class ScAction;
   friend class ScServerMessageAction;
+  friend class ScMemoryTemplateSearchCursor;
 
   SC_DISALLOW_COPY(ScAgentContext);
 
@@ -76,6 +76,19 @@ public:
    */
   _SC_EXTERN static bool Shutdown(bool saveState = true);
 
+  /*!
+   * @brief Writes bundle of saved sc-memory binaries.
+   *
+   * This function writes sc-memory binaries saved in the storage directory into one bundle file. The bundle can be
+   * specified in `bundle` parameter of sc-memory to be extracted into empty storage directory on initialization.
+   *
+   * @param params The parameters of sc-memory with path to the storage directory.
+   * @param bundlePath Path to the bundle file to write.
+   *
+   * @return true if the bundle is written; otherwise, returns false.
+   */
+  _SC_EXTERN static bool WriteBundle(sc_memory_params const & params, std::string const & bundlePath);
+
   _SC_EXTERN static void LogMute();
   _SC_EXTERN static void LogUnmute();
 
@@ -88,6 +101,7 @@ class ScMemoryContext
   friend class ScMemory;
   friend class ScAction;
   friend class ScTemplateKeynode;
+  friend class ScTemplateParallelSearch;
 
 public:
   struct ScMemoryStatistics
@@ -469,6 +483,81 @@ public:
       ScAddr const & sourceElementAddr,
       ScAddr const & targetElementAddr) noexcept(false);
 
+  /*!
+   * @brief Generates new sc-nodes with the specified types.
+   *
+   * This method creates sc-nodes in one call to sc-memory and returns their sc-addresses in order of the specified
+   * types.
+   *
+   * @param nodeTypes Sc-types of the sc-nodes to create.
+   *
+   * @return Sc-addresses of the newly created sc-nodes.
+   *
+   * @throws utils::ExceptionInvalidParams if one of the specified types is not a valid sc-node type.
+   * @throws utils::ExceptionCritical if sc-memory is full.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddrVector nodeAddrs = context.GenerateNodes({ScType::ConstNode, ScType::ConstNodeClass});
+   * @endcode
+   */
+  _SC_EXTERN ScAddrVector GenerateNodes(std::vector<ScType> const & nodeTypes) noexcept(false);
+
+  /*!
+   * @brief Generates new sc-links with the specified types.
+   *
+   * This method creates sc-links in one call to sc-memory and returns their sc-addresses in order of the specified
+   * types.
+   *
+   * @param linkTypes Sc-types of the sc-links to create.
+   *
+   * @return Sc-addresses of the newly created sc-links.
+   *
+   * @throws utils::ExceptionInvalidParams if one of the specified types is not a valid sc-link type.
+   * @throws utils::ExceptionCritical if sc-memory is full.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddrVector linkAddrs = context.GenerateLinks({ScType::ConstNodeLink, ScType::ConstNodeLinkClass});
+   * @endcode
+   */
+  _SC_EXTERN ScAddrVector GenerateLinks(std::vector<ScType> const & linkTypes) noexcept(false);
+
+  /*!
+   * @brief Generates new sc-connectors with the specified types, sources, and targets.
+   *
+   * This method creates sc-connectors in one call to sc-memory. The i-th sc-connector has type `connectorTypes[i]`
+   * and goes from `sourceElementAddrs[i]` to `targetElementAddrs[i]`. Sc-connectors incident to sc-elements locked by
+   * the same monitors are generated under one lock of these monitors in order of the specified vectors, and events of
+   * all sc-connectors are emitted after all of them are generated.
+   *
+   * @param connectorTypes Sc-types of the sc-connectors to create.
+   * @param sourceElementAddrs Sc-addresses of the source sc-elements.
+   * @param targetElementAddrs Sc-addresses of the target sc-elements.
+   *
+   * @return Sc-addresses of the newly created sc-connectors in order of the specified types.
+   *
+   * @throws utils::ExceptionInvalidParams if sizes of the specified vectors differ, if one of the specified source
+   * or target sc-addresses is invalid or if one of the specified types is not a valid sc-connector type.
+   * @throws utils::ExceptionCritical if sc-memory is full.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have write
+   * permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddr sourceNodeAddr = context.GenerateNode(ScType::ConstNode);
+   * ScAddrVector targetNodeAddrs = context.GenerateNodes({ScType::ConstNode, ScType::ConstNode});
+   * ScAddrVector arcAddrs = context.GenerateConnectors(
+   *     {ScType::ConstPermPosArc, ScType::ConstPermPosArc}, {sourceNodeAddr, sourceNodeAddr}, targetNodeAddrs);
+   * @endcode
+   */
+  _SC_EXTERN ScAddrVector GenerateConnectors(
+      std::vector<ScType> const & connectorTypes,
+      ScAddrVector const & sourceElementAddrs,
+      ScAddrVector const & targetElementAddrs) noexcept(false);
+
   /*!
    * @brief Gets the type of the specified sc-element.
    *
@@ -14,6 +14,7 @@
 #include "sc_link_filter.hpp"
 #include "sc_iterator.hpp"
 #include "sc_template.hpp"
+#include "sc_template_cache.hpp"
 
 #include "sc_stream.hpp"
 #include "sc_structure.hpp"
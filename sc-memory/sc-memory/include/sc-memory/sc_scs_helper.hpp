@@ -23,6 +23,11 @@ using SCsFileInterfacePtr = std::shared_ptr<SCsFileInterface>;
 
 class ScMemoryContext;
 
+namespace scs
+{
+class Parser;
+}
+
 class SCsHelper final
 {
 public:
@@ -30,6 +35,8 @@ public:
 
   _SC_EXTERN bool GenerateBySCsText(std::string const & scsText, ScAddr const & outputStructure = ScAddr::Empty);
   _SC_EXTERN void GenerateBySCsTextLazy(std::string const & scsText, ScAddr const & outputStructure = ScAddr::Empty);
+  //! Generates SCs text already parsed by `parser`. SCs text can be parsed in any thread, it doesn't use sc-memory.
+  _SC_EXTERN bool GenerateByParsedSCs(scs::Parser const & parser, ScAddr const & outputStructure = ScAddr::Empty);
   _SC_EXTERN std::string const & GetLastError() const;
 
 private:
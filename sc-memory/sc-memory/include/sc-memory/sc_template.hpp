@@ -197,6 +197,7 @@ enum class _SC_EXTERN ScTemplateResultCode : uint8_t
 class _SC_EXTERN ScTemplateParams
 {
   friend class ScTemplateGenerator;
+  friend class ScTemplateCache;
 
 public:
   using ScTemplateItemsToParams = std::map<std::string, ScAddr>;
@@ -294,6 +295,8 @@ class _SC_EXTERN ScTemplate
   friend class ScTemplateBuilder;
   friend class ScTemplateBuilderFromScs;
   friend class ScTemplateLoader;
+  friend class ScTemplateCache;
+  friend class ScTemplateParallelSearch;
 
 public:
   /*!
@@ -392,6 +395,29 @@ public:
    */
   [[nodiscard]] _SC_EXTERN size_t Size() const;
 
+  /*!
+   * @brief Sets count of threads used to search sc-constructions by object of `ScTemplate`.
+   *
+   * By default, search is performed in the calling thread. If count of threads is greater than one, then independent
+   * connectivity components of sc-template are searched concurrently and found sc-constructions of them are joined,
+   * or, if sc-template is connected, candidates of its first searched triple are found by the calling thread and
+   * distributed between threads. Search results are the same as in sequential search, but their order can differ.
+   *
+   * @param threadsCount A count of threads.
+   * @return A reference to the current ScTemplate object.
+   * @warning In parallel search check and filter callbacks can be called from several threads concurrently, so they
+   * must be thread-safe. Result callbacks are called sequentially. If sc-template has several connectivity
+   * components, result callbacks are called after all components are searched.
+   */
+  _SC_EXTERN ScTemplate & SetSearchThreadsCount(size_t threadsCount) noexcept;
+
+  /*!
+   * @brief Gets count of threads used to search sc-constructions by object of `ScTemplate`.
+   *
+   * @return The count of threads.
+   */
+  [[nodiscard]] _SC_EXTERN size_t GetSearchThreadsCount() const noexcept;
+
   /*!
    * @brief Checks if object of `ScTemplate` has a replacement for a given name.
    *
@@ -562,6 +588,7 @@ protected:
   std::map<std::string, ScAddr>
       m_templateItemsNamesToReplacementItemsAddrs;  ///< Map of template items names to replacement items addresses.
   std::map<std::string, ScType> m_templateItemsNamesToTypes;  ///< Map of template items names to types.
+  size_t m_searchThreadsCount = 1;                            ///< Count of threads to search by sc-template.
 
   enum class ScTemplateTripleType : uint8_t
   {
@@ -595,6 +622,7 @@ class _SC_EXTERN ScTemplateResultItem
   friend class ScTemplateGenerator;
   friend class ScSet;
   friend class ScTemplateSearch;
+  friend class ScTemplateParallelSearch;
   friend class ScTemplateSearchResult;
 
 public:
@@ -724,6 +752,7 @@ using ScTemplateSearchResultItem = ScTemplateResultItem;
 class _SC_EXTERN ScTemplateSearchResult
 {
   friend class ScTemplateSearch;
+  friend class ScTemplateParallelSearch;
 
 public:
   _SC_EXTERN ScTemplateSearchResult() noexcept;
@@ -0,0 +1,65 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_template.hpp"
+
+class ScMemoryContext;
+
+/*!
+ * @class ScTemplateCache
+ * @brief Caches sc-templates built from sc-structures in sc-memory.
+ *
+ * Building a sc-template from sc-structure requires traversal of all sc-structure elements and ordering of its
+ * connectors. ScTemplateCache stores triples of sc-template built from sc-structure once and builds objects of
+ * `ScTemplate` from them, substituting only specified parameters. Cached triples are replayed only if sc-structure
+ * still has the same sc-arcs to the same sc-elements, as when they were built. It is checked on each build, so
+ * sc-template of changed sc-structure is rebuilt at once. This cache is used to check initiation and result conditions
+ * of agents.
+ *
+ * @note Changes of sc-types of sc-elements of cached sc-structure aren't tracked. Call `Invalidate` for such
+ * sc-structure after changing sc-types of its sc-elements.
+ */
+class _SC_EXTERN ScTemplateCache
+{
+public:
+  /*!
+   * @brief Builds sc-template from sc-structure using cached triples of this sc-template.
+   *
+   * If triples of sc-template for this sc-structure aren't cached, then builds them and caches. Parameters are
+   * substituted in built sc-template in the same way as `ScMemoryContext::BuildTemplate` does it.
+   *
+   * @param context A sc-memory context used to build sc-template if it isn't cached.
+   * @param resultTemplate A built sc-template.
+   * @param translatableTemplateAddr A sc-address of sc-structure to build sc-template from.
+   * @param params Parameters to substitute in sc-template.
+   * @throws utils::ExceptionInvalidParams if sc-template is invalid or sc-structure is not valid sc-element.
+   */
+  static _SC_EXTERN void Build(
+      ScMemoryContext & context,
+      ScTemplate & resultTemplate,
+      ScAddr const & translatableTemplateAddr,
+      ScTemplateParams const & params = ScTemplateParams::Empty) noexcept(false);
+
+  /*!
+   * @brief Checks whether triples of sc-template built from sc-structure are cached.
+   * @param translatableTemplateAddr A sc-address of sc-structure.
+   * @return true if triples of sc-template are cached, otherwise false.
+   */
+  static _SC_EXTERN bool HasTemplate(ScAddr const & translatableTemplateAddr) noexcept;
+
+  /*!
+   * @brief Removes cached triples of sc-template built from sc-structure.
+   * @param translatableTemplateAddr A sc-address of sc-structure.
+   */
+  static _SC_EXTERN void Invalidate(ScAddr const & translatableTemplateAddr) noexcept;
+
+  /*!
+   * @brief Removes all cached sc-templates.
+   */
+  static _SC_EXTERN void Clear() noexcept;
+};
@@ -7,6 +7,7 @@
 #include "sc-memory/sc_memory.hpp"
 
 #include "sc-memory/sc_keynodes.hpp"
+#include "sc-memory/sc_template_cache.hpp"
 #include "sc-memory/sc_utils.hpp"
 #include "sc-memory/sc_stream.hpp"
 
@@ -96,6 +97,7 @@ bool ScMemory::Shutdown(bool saveState /* = true */)
 {
   ms_globalLogger = utils::ScLogger();
 
+  ScTemplateCache::Clear();
   ScKeynodes::Shutdown(ms_globalContext);
   bool result = sc_memory_shutdown(saveState);
 
@@ -106,6 +108,11 @@ bool ScMemory::Shutdown(bool saveState /* = true */)
   return result;
 }
 
+bool ScMemory::WriteBundle(sc_memory_params const & params, std::string const & bundlePath)
+{
+  return sc_memory_write_bundle(&params, bundlePath.c_str()) == SC_RESULT_OK;
+}
+
 void ScMemory::LogMute()
 {
   isLogMuted = true;
@@ -464,6 +471,136 @@ ScAddr ScMemoryContext::CreateEdge(
   return GenerateConnector(connectorType, sourceElementAddr, targetElementAddr);
 }
 
+ScAddrVector ScMemoryContext::GenerateNodes(std::vector<ScType> const & nodeTypes)
+{
+  CHECK_CONTEXT;
+
+  size_t const count = nodeTypes.size();
+  std::vector<sc_type> types(count);
+  for (size_t i = 0; i < count; ++i)
+    types[i] = *nodeTypes[i];
+
+  std::vector<sc_addr> nodeAddrs(count);
+  sc_result const result = sc_memory_nodes_new_batch(m_context, types.data(), count, nodeAddrs.data());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified types must be sc-node types. You should provide any of ScType::...Node... values as types.");
+
+  case SC_RESULT_ERROR_FULL_MEMORY:
+    SC_THROW_EXCEPTION(utils::ExceptionCritical, "Not able to create sc-nodes because sc-memory is full.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to create sc-nodes because sc-memory context is not authorized.");
+
+  default:
+    break;
+  }
+
+  return {nodeAddrs.cbegin(), nodeAddrs.cend()};
+}
+
+ScAddrVector ScMemoryContext::GenerateLinks(std::vector<ScType> const & linkTypes)
+{
+  CHECK_CONTEXT;
+
+  size_t const count = linkTypes.size();
+  std::vector<sc_type> types(count);
+  for (size_t i = 0; i < count; ++i)
+    types[i] = *linkTypes[i];
+
+  std::vector<sc_addr> linkAddrs(count);
+  sc_result const result = sc_memory_links_new_batch(m_context, types.data(), count, linkAddrs.data());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified types must be sc-link types. You should provide any of ScType::...NodeLink... values as types.");
+
+  case SC_RESULT_ERROR_FULL_MEMORY:
+    SC_THROW_EXCEPTION(utils::ExceptionCritical, "Not able to create sc-links because sc-memory is full.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to create sc-links because sc-memory context is not authorized.");
+
+  default:
+    break;
+  }
+
+  return {linkAddrs.cbegin(), linkAddrs.cend()};
+}
+
+ScAddrVector ScMemoryContext::GenerateConnectors(
+    std::vector<ScType> const & connectorTypes,
+    ScAddrVector const & sourceElementAddrs,
+    ScAddrVector const & targetElementAddrs)
+{
+  CHECK_CONTEXT;
+
+  size_t const count = connectorTypes.size();
+  if (sourceElementAddrs.size() != count || targetElementAddrs.size() != count)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified types, source and target sc-element sc-addresses must have the same sizes to create sc-connectors.");
+
+  std::vector<sc_type> types(count);
+  std::vector<sc_addr> sourceAddrs(count);
+  std::vector<sc_addr> targetAddrs(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    types[i] = *connectorTypes[i];
+    sourceAddrs[i] = *sourceElementAddrs[i];
+    targetAddrs[i] = *targetElementAddrs[i];
+  }
+
+  std::vector<sc_addr> connectorAddrs(count);
+  sc_result const result = sc_memory_arcs_new_batch(
+      m_context, types.data(), sourceAddrs.data(), targetAddrs.data(), count, connectorAddrs.data());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ADDR_IS_NOT_VALID:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified source or target sc-element sc-addresses are invalid to create sc-connectors.");
+
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified types must be sc-connector types. You should provide any of ScType::...Arc... or "
+        "ScType::...Edge... values as types.");
+
+  case SC_RESULT_ERROR_FULL_MEMORY:
+    SC_THROW_EXCEPTION(utils::ExceptionCritical, "Not able to create sc-connectors because sc-memory is full.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to create sc-connectors because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to create sc-connectors because sc-memory context hasn't write permissions.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to create sc-connectors because sc-memory context hasn't permissions to write permissions.");
+
+  default:
+    break;
+  }
+
+  return {connectorAddrs.cbegin(), connectorAddrs.cend()};
+}
+
 ScType ScMemoryContext::GetElementType(ScAddr const & elementAddr) const
 {
   CHECK_CONTEXT;
@@ -42,13 +42,16 @@ protected:
         ResolveElement(parsedElement);
     }
 
-    // generate triples
-    std::unordered_set<std::string> typeArcsCache;
+    // generate triples, sc-connectors are generated by batches, if there is no output structure
     parser.ForEachTripleForGeneration(
         [&](scs::ParsedElement const & source,
             scs::ParsedElement const & connector,
             scs::ParsedElement const & target) -> void
         {
+          // sc-connectors incident to not generated sc-connectors are generated in the next batch
+          if (m_pendingConnectorIdtfs.count(source.GetIdtf()) || m_pendingConnectorIdtfs.count(target.GetIdtf()))
+            GeneratePendingConnectors();
+
           auto const & sourceResult = ResolveElement(source);
           auto const & targetResult = ResolveElement(target);
 
@@ -60,16 +63,15 @@ protected:
                 "Specified in triple sc-connector `" << connectorIdtf << "` has incorrect type `"
                                                      << std::string(connectorType) << "`.");
 
-          ScAddr const connectorAddr = m_ctx.GenerateConnector(connectorType, sourceResult.first, targetResult.first);
-          m_idtfCache.insert({connectorIdtf, connectorAddr});
+          m_pendingConnectors.push_back({connectorIdtf, connectorType, sourceResult, targetResult});
+          m_pendingConnectorIdtfs.insert(connectorIdtf);
 
+          // sc-arcs of output structure are generated after sc-connector of each triple, as they are generated
+          // one by one, to keep order of triples in lists of incident sc-elements
           if (m_outputStructure.IsValid())
-          {
-            AppendToOutputStructure(sourceResult.first, connectorAddr, targetResult.first);
-            AppendToOutputStructure(sourceResult.second);
-            AppendToOutputStructure(targetResult.second);
-          }
+            GeneratePendingConnectors();
         });
+    GeneratePendingConnectors();
 
     parser.ForEachParsedElement(
         [this](scs::ParsedElement const & el)
@@ -80,15 +82,74 @@ protected:
   }
 
 private:
-  template <class... Args>
-  void AppendToOutputStructure(Args const &... addrs)
+  struct PendingConnector
   {
-    ScAddrVector const & addrVector{addrs...};
-    for (ScAddr const & addr : addrVector)
+    std::string m_idtf;
+    ScType m_type;
+    std::pair<ScAddr, ScAddrVector> m_sourceResult;
+    std::pair<ScAddr, ScAddrVector> m_targetResult;
+  };
+
+  void GeneratePendingConnectors()
+  {
+    if (m_pendingConnectors.empty())
+      return;
+
+    size_t const count = m_pendingConnectors.size();
+    std::vector<ScType> connectorTypes(count);
+    ScAddrVector sourceAddrs(count);
+    ScAddrVector targetAddrs(count);
+    for (size_t i = 0; i < count; ++i)
     {
-      if (!m_ctx.CheckConnector(m_outputStructure, addr, ScType::ConstPermPosArc))
-        m_ctx.GenerateConnector(ScType::ConstPermPosArc, m_outputStructure, addr);
+      PendingConnector const & connector = m_pendingConnectors[i];
+      connectorTypes[i] = connector.m_type;
+      sourceAddrs[i] = connector.m_sourceResult.first;
+      targetAddrs[i] = connector.m_targetResult.first;
     }
+
+    ScAddrVector const & connectorAddrs = m_ctx.GenerateConnectors(connectorTypes, sourceAddrs, targetAddrs);
+
+    ScAddrVector structureElementAddrs;
+    for (size_t i = 0; i < count; ++i)
+    {
+      PendingConnector const & connector = m_pendingConnectors[i];
+      m_idtfCache.insert({connector.m_idtf, connectorAddrs[i]});
+
+      if (m_outputStructure.IsValid())
+      {
+        structureElementAddrs.insert(
+            structureElementAddrs.end(), {sourceAddrs[i], connectorAddrs[i], targetAddrs[i]});
+        structureElementAddrs.insert(
+            structureElementAddrs.end(),
+            connector.m_sourceResult.second.cbegin(),
+            connector.m_sourceResult.second.cend());
+        structureElementAddrs.insert(
+            structureElementAddrs.end(),
+            connector.m_targetResult.second.cbegin(),
+            connector.m_targetResult.second.cend());
+      }
+    }
+
+    m_pendingConnectors.clear();
+    m_pendingConnectorIdtfs.clear();
+
+    AppendToOutputStructure(structureElementAddrs);
+  }
+
+  void AppendToOutputStructure(ScAddrVector const & addrs)
+  {
+    ScAddrVector notAppendedAddrs;
+    ScAddrUnorderedSet checkedAddrs;
+    for (ScAddr const & addr : addrs)
+    {
+      if (addr.IsValid() && checkedAddrs.insert(addr).second
+          && !m_ctx.CheckConnector(m_outputStructure, addr, ScType::ConstPermPosArc))
+        notAppendedAddrs.push_back(addr);
+    }
+
+    size_t const count = notAppendedAddrs.size();
+    m_ctx.GenerateConnectors(
+        std::vector<ScType>(count, ScType::ConstPermPosArc), ScAddrVector(count, m_outputStructure), notAppendedAddrs);
   }
 
   ScAddrVector SetSCsGlobalIdtf(std::string const & idtf, ScAddr const & addr)
@@ -294,6 +355,9 @@ private:
   ScAddr m_outputStructure;
 
   std::unordered_map<std::string, ScAddr> m_idtfCache;
+
+  std::vector<PendingConnector> m_pendingConnectors;
+  std::unordered_set<std::string> m_pendingConnectorIdtfs;
 };
 
 }  // namespace impl
@@ -349,6 +413,27 @@ void SCsHelper::GenerateBySCsTextLazy(std::string const & scsText, ScAddr const
   }
 }
 
+bool SCsHelper::GenerateByParsedSCs(scs::Parser const & parser, ScAddr const & outputStructure)
+{
+  m_lastError = "";
+  bool result = true;
+
+  ScMemoryContextEventsPendingGuard guard(m_ctx);
+
+  try
+  {
+    impl::StructGenerator generate(m_ctx, m_fileInterface, outputStructure);
+    generate(parser);
+  }
+  catch (utils::ScException const & ex)
+  {
+    m_lastError = ex.Description();
+    result = false;
+  }
+
+  return result;
+}
+
 std::string const & SCsHelper::GetLastError() const
 {
   return m_lastError;
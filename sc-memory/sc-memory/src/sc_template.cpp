@@ -257,6 +257,7 @@ ScTemplate::ScTemplate(ScTemplate && other) noexcept
   , m_priorityOrderedTemplateTriples(std::move(other.m_priorityOrderedTemplateTriples))
   , m_templateItemsNamesToReplacementItemsAddrs(std::move(other.m_templateItemsNamesToReplacementItemsAddrs))
   , m_templateItemsNamesToTypes(std::move(other.m_templateItemsNamesToTypes))
+  , m_searchThreadsCount(other.m_searchThreadsCount)
 {
 }
 
@@ -270,6 +271,7 @@ ScTemplate & ScTemplate::operator=(ScTemplate && other) noexcept
   m_priorityOrderedTemplateTriples = std::move(other.m_priorityOrderedTemplateTriples);
   m_templateItemsNamesToReplacementItemsAddrs = std::move(other.m_templateItemsNamesToReplacementItemsAddrs);
   m_templateItemsNamesToTypes = std::move(other.m_templateItemsNamesToTypes);
+  m_searchThreadsCount = other.m_searchThreadsCount;
 
   other.Clear();
   return *this;
@@ -314,6 +316,17 @@ size_t ScTemplate::Size() const
   return m_templateTriples.size();
 }
 
+ScTemplate & ScTemplate::SetSearchThreadsCount(size_t threadsCount) noexcept
+{
+  m_searchThreadsCount = threadsCount;
+  return *this;
+}
+
+size_t ScTemplate::GetSearchThreadsCount() const noexcept
+{
+  return m_searchThreadsCount;
+}
+
 bool ScTemplate::HasReplacement(std::string const & repl) const
 {
   return m_templateItemsNamesToReplacementItemsPositions.find(repl)
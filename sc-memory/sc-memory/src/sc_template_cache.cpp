@@ -0,0 +1,153 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_template_cache.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <shared_mutex>
+
+#include "sc_template_private.hpp"
+#include "sc-memory/sc_memory.hpp"
+
+namespace
+{
+using ScTemplateTriples = std::vector<ScTemplateTriple::ScTemplateTripleItems>;
+// Sc-arcs from sc-structure to its sc-elements and these sc-elements
+using ScStructureElements = std::vector<std::pair<ScAddr, ScAddr>>;
+
+struct ScTemplateCacheEntry
+{
+  ScTemplateTriples m_triples;
+  // Sc-elements of sc-structure, from which triples are built. They are compared with current ones on each lookup, so
+  // triples of changed sc-structure aren't replayed.
+  ScStructureElements m_elements;
+};
+
+using ScTemplateCacheEntries = ScAddrToValueUnorderedMap<ScTemplateCacheEntry>;
+
+ScTemplateCacheEntries ms_entries;
+std::shared_mutex ms_entriesMutex;
+
+ScStructureElements GetStructureElements(ScMemoryContext & context, ScAddr const & translatableTemplateAddr)
+{
+  ScStructureElements elements;
+  ScIterator3Ptr const it = context.CreateIterator3(translatableTemplateAddr, ScType::ConstPermPosArc, ScType::Unknown);
+  while (it->Next())
+    elements.emplace_back(it->Get(1), it->Get(2));
+  return elements;
+}
+
+void AppendTriples(
+    ScTemplateTriples const & triples,
+    ScTemplate & resultTemplate,
+    ScTemplateParams::ScTemplateItemsToParams const & params)
+{
+  for (auto const & triple : triples)
+  {
+    if (params.empty())
+    {
+      resultTemplate.Triple(triple[0], triple[1], triple[2]);
+      continue;
+    }
+
+    ScTemplateTriple::ScTemplateTripleItems items = triple;
+    for (ScTemplateItem & item : items)
+    {
+      auto const & paramIt = params.find(item.m_name);
+      if (paramIt != params.cend())
+        item = ScTemplateItem(paramIt->second, item.m_name.c_str());
+    }
+    resultTemplate.Triple(items[0], items[1], items[2]);
+  }
+}
+
+bool ReplayTriples(
+    ScAddr const & translatableTemplateAddr,
+    ScStructureElements const & elements,
+    ScTemplate & resultTemplate,
+    ScTemplateParams::ScTemplateItemsToParams const & params)
+{
+  std::shared_lock lock(ms_entriesMutex);
+  auto const & it = ms_entries.find(translatableTemplateAddr);
+  if (it == ms_entries.cend() || it->second.m_elements != elements)
+    return false;
+
+  AppendTriples(it->second.m_triples, resultTemplate, params);
+  return true;
+}
+
+}  // namespace
+
+void ScTemplateCache::Build(
+    ScMemoryContext & context,
+    ScTemplate & resultTemplate,
+    ScAddr const & translatableTemplateAddr,
+    ScTemplateParams const & params)
+{
+  if (!context.IsElement(translatableTemplateAddr))
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Not able to build sc-template from sc-structure `" << translatableTemplateAddr.Hash()
+                                                             << "` because it is not valid.");
+
+  // Parameters can be specified by system identifiers of variables, so they are converted to names of sc-template
+  // items as sc-template builder does
+  ScTemplateParams::ScTemplateItemsToParams itemsToParams;
+  for (auto const & [varIdtf, value] : params.m_templateItemsToParams)
+  {
+    if (!varIdtf.empty() && std::all_of(varIdtf.cbegin(), varIdtf.cend(), ::isdigit))
+    {
+      itemsToParams[varIdtf] = value;
+      continue;
+    }
+
+    ScAddr const & varAddr = context.SearchElementBySystemIdentifier(varIdtf);
+    if (context.IsElement(varAddr))
+      itemsToParams[std::to_string(varAddr.Hash())] = value;
+  }
+
+  ScStructureElements elements = GetStructureElements(context, translatableTemplateAddr);
+  if (ReplayTriples(translatableTemplateAddr, elements, resultTemplate, itemsToParams))
+    return;
+
+  ScTemplate builtTemplate;
+  context.BuildTemplate(builtTemplate, translatableTemplateAddr);
+
+  ScTemplateTriples triples;
+  triples.reserve(builtTemplate.m_templateTriples.size());
+  for (ScTemplateTriple const * triple : builtTemplate.m_templateTriples)
+    triples.push_back(triple->GetValues());
+  AppendTriples(triples, resultTemplate, itemsToParams);
+
+  // Sc-structure can be changed while sc-template is built, then built triples can't be matched with its sc-elements
+  if (GetStructureElements(context, translatableTemplateAddr) != elements)
+    return;
+
+  std::unique_lock lock(ms_entriesMutex);
+  ScTemplateCacheEntry & entry = ms_entries[translatableTemplateAddr];
+  entry.m_triples = std::move(triples);
+  entry.m_elements = std::move(elements);
+}
+
+bool ScTemplateCache::HasTemplate(ScAddr const & translatableTemplateAddr) noexcept
+{
+  std::shared_lock lock(ms_entriesMutex);
+  return ms_entries.find(translatableTemplateAddr) != ms_entries.cend();
+}
+
+void ScTemplateCache::Invalidate(ScAddr const & translatableTemplateAddr) noexcept
+{
+  std::unique_lock lock(ms_entriesMutex);
+  ms_entries.erase(translatableTemplateAddr);
+}
+
+void ScTemplateCache::Clear() noexcept
+{
+  std::unique_lock lock(ms_entriesMutex);
+  ms_entries.clear();
+}
@@ -7,10 +7,185 @@
 #include "sc-memory/sc_template.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
 
 #include "sc_template_private.hpp"
 #include "sc-memory/sc_memory.hpp"
 
+/*!
+ * State shared between threads that search by the same sc-template in parallel.
+ */
+struct ScTemplateSearchSharedState
+{
+  //! Count of candidates of start triple that are claimed by thread at once
+  static constexpr size_t START_CANDIDATES_CHUNK_SIZE = 64;
+
+  //! Candidates of start triple found by one thread before search, other threads claim chunks of them
+  std::vector<ScAddrTriple> m_startCandidates;
+  //! Index of next chunk of start triple candidates that isn't claimed by any thread
+  std::atomic<size_t> m_nextStartCandidatesChunk{0};
+  std::atomic<bool> m_isStopped{false};
+
+  //! Serializes calls of result callbacks and storing of error
+  std::mutex m_mutex;
+  std::exception_ptr m_exception;
+
+  void SaveException(std::exception_ptr const & exception)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_exception)
+      m_exception = exception;
+    m_isStopped = true;
+  }
+};
+
+/*!
+ * Set of indices of sc-template triples stored as bits of words. Sc-templates usually contain less than 64 triples,
+ * so words of such set are stored in vector of one word, and copying of set allocates and copies this word only
+ * instead of nodes of tree of `std::set`.
+ */
+class ScTemplateSearchTriplesBitset
+{
+public:
+  explicit ScTemplateSearchTriplesBitset(size_t triplesCount = 0)
+    : m_words((triplesCount + WORD_SIZE - 1) / WORD_SIZE, 0)
+  {
+  }
+
+  bool Contains(size_t const tripleIdx) const
+  {
+    return (m_words[tripleIdx / WORD_SIZE] & GetMask(tripleIdx)) != 0;
+  }
+
+  void Insert(size_t const tripleIdx)
+  {
+    sc_uint64 & word = m_words[tripleIdx / WORD_SIZE];
+    m_size += (word & GetMask(tripleIdx)) == 0;
+    word |= GetMask(tripleIdx);
+  }
+
+  void Erase(size_t const tripleIdx)
+  {
+    sc_uint64 & word = m_words[tripleIdx / WORD_SIZE];
+    m_size -= (word & GetMask(tripleIdx)) != 0;
+    word &= ~GetMask(tripleIdx);
+  }
+
+  size_t Size() const
+  {
+    return m_size;
+  }
+
+private:
+  static constexpr size_t WORD_SIZE = 64;
+
+  static sc_uint64 GetMask(size_t const tripleIdx)
+  {
+    return sc_uint64(1) << (tripleIdx % WORD_SIZE);
+  }
+
+  std::vector<sc_uint64> m_words;
+  size_t m_size = 0;
+};
+
+/*!
+ * Set of sc-connectors stored in one open addressing table with linear probing. It is used instead of
+ * `std::unordered_set` for each found construction, so inserting of sc-connector doesn't allocate node and copying of
+ * set allocates one table.
+ */
+class ScTemplateSearchConnectorsSet
+{
+public:
+  bool Contains(ScAddr const & connectorAddr) const
+  {
+    if (m_size == 0 || !connectorAddr.IsValid())
+      return false;
+
+    for (size_t i = GetBucket(connectorAddr);; i = (i + 1) & (m_buckets.size() - 1))
+    {
+      if (m_buckets[i] == connectorAddr)
+        return true;
+      if (!m_buckets[i].IsValid())
+        return false;
+    }
+  }
+
+  void Insert(ScAddr const & connectorAddr)
+  {
+    if (!connectorAddr.IsValid())
+      return;
+
+    // load factor is kept less than 1/2, so probe sequences are short
+    if ((m_size + 1) * 2 > m_buckets.size())
+      Rehash(m_buckets.empty() ? MIN_BUCKETS_COUNT : m_buckets.size() * 2);
+
+    size_t i = GetBucket(connectorAddr);
+    for (; m_buckets[i].IsValid(); i = (i + 1) & (m_buckets.size() - 1))
+    {
+      if (m_buckets[i] == connectorAddr)
+        return;
+    }
+    m_buckets[i] = connectorAddr;
+    ++m_size;
+  }
+
+  void Erase(ScAddr const & connectorAddr)
+  {
+    if (m_size == 0 || !connectorAddr.IsValid())
+      return;
+
+    size_t const mask = m_buckets.size() - 1;
+    size_t i = GetBucket(connectorAddr);
+    for (; m_buckets[i] != connectorAddr; i = (i + 1) & mask)
+    {
+      if (!m_buckets[i].IsValid())
+        return;
+    }
+
+    // shift next sc-connectors of probe sequence back, so there are no holes in it
+    for (size_t j = (i + 1) & mask; m_buckets[j].IsValid(); j = (j + 1) & mask)
+    {
+      size_t const bucket = GetBucket(m_buckets[j]);
+      if (((j - bucket) & mask) >= ((j - i) & mask))
+      {
+        m_buckets[i] = m_buckets[j];
+        i = j;
+      }
+    }
+    m_buckets[i] = ScAddr::Empty;
+    --m_size;
+  }
+
+private:
+  static constexpr size_t MIN_BUCKETS_COUNT = 16;
+
+  size_t GetBucket(ScAddr const & connectorAddr) const
+  {
+    // Fibonacci hashing mixes segment and offset of sc-address
+    sc_uint64 const hash = (sc_uint64)ScAddrHashFunc()(connectorAddr) * 11400714819323198485ull;
+    return (size_t)(hash >> 32) & (m_buckets.size() - 1);
+  }
+
+  void Rehash(size_t const bucketsCount)
+  {
+    std::vector<ScAddr> buckets(bucketsCount, ScAddr::Empty);
+    buckets.swap(m_buckets);
+    m_size = 0;
+    for (ScAddr const & connectorAddr : buckets)
+    {
+      if (connectorAddr.IsValid())
+        Insert(connectorAddr);
+    }
+  }
+
+  std::vector<ScAddr> m_buckets;
+  size_t m_size = 0;
+};
+
 class ScTemplateSearch
 {
 public:
@@ -22,9 +197,38 @@ public:
     PrepareSearch();
   }
 
+  //! Copies prepared search plan of other search to search by it with other sc-memory context
+  ScTemplateSearch(ScTemplateSearch const & other, ScMemoryContext & context)
+    : m_template(other.m_template)
+    , m_context(context)
+    , m_templateItemsKeys(other.m_templateItemsKeys)
+    , m_templateItemsNamesSlots(other.m_templateItemsNamesSlots)
+    , m_namesSlots(other.m_namesSlots)
+    , m_templateItemsKeysToDependedTemplateTriples(other.m_templateItemsKeysToDependedTemplateTriples)
+    , m_cycledTemplateTriples(other.m_cycledTemplateTriples)
+    , m_connectivityComponentsTemplateTriples(other.m_connectivityComponentsTemplateTriples)
+    , m_connectivityComponentPriorityTemplateTriples(other.m_connectivityComponentPriorityTemplateTriples)
+    , m_structure(other.m_structure)
+    , m_callback(other.m_callback)
+    , m_callbackWithRequest(other.m_callbackWithRequest)
+    , m_filterCallback(other.m_filterCallback)
+    , m_checkCallback(other.m_checkCallback)
+  {
+  }
+
   using ScTemplateTriples = ScTemplate::ScTemplateGroupedTriples;
   using ScReplacementTriple = ScAddrTriple;
 
+  //! Replacement name of sc-template items with its type and sc-address specified in sc-template
+  struct ScTemplateNameSlot
+  {
+    std::string m_name;
+    bool m_hasType = false;
+    ScType m_type;
+    bool m_hasReplacementAddr = false;
+    ScAddr m_replacementAddr;
+  };
+
   void SetCallbackWithRequest(ScTemplateSearchResultCallbackWithRequest const & callback)
   {
     m_callbackWithRequest = callback;
@@ -45,19 +249,152 @@ public:
     m_checkCallback = checkCallback;
   }
 
+  /*!
+   * Sets state shared with other threads. Candidates of start triple are partitioned between threads by chunks
+   * and search is stopped in all threads if it is stopped in one of them.
+   * @note Candidates of start triple must be collected to state by `CollectStartCandidates` before search.
+   */
+  void SetSharedState(ScTemplateSearchSharedState * sharedState)
+  {
+    m_sharedState = sharedState;
+  }
+
+  //! Returns connectivity components of sc-template that have triples
+  std::vector<ScTemplateTriples> GetConnectivityComponents() const
+  {
+    std::vector<ScTemplateTriples> components;
+    for (ScTemplateTriples const & componentTriples : m_connectivityComponentsTemplateTriples)
+    {
+      if (!componentTriples.empty())
+        components.push_back(componentTriples);
+    }
+    return components;
+  }
+
+  /*!
+   * Checks that candidates of start triple can be partitioned between threads: each found construction contains
+   * only one candidate of start triple, so there is only one start triple and there are no triples equal to it.
+   */
+  bool IsStartTriplePartitionable()
+  {
+    if (m_template.Size() == 1)
+      return true;
+
+    if (m_connectivityComponentPriorityTemplateTriples.size() != 1)
+      return false;
+
+    ScTemplateTriple const * startTriple =
+        m_template.m_templateTriples[*m_connectivityComponentPriorityTemplateTriples.cbegin()];
+    return std::none_of(
+        m_template.m_templateTriples.cbegin(),
+        m_template.m_templateTriples.cend(),
+        [this, startTriple](ScTemplateTriple const * triple)
+        {
+          return triple->m_index != startTriple->m_index && IsTriplesEqual(startTriple, triple);
+        });
+  }
+
+  /*!
+   * Finds all candidates of start triple, so threads partition the same list of them. Threads don't iterate start
+   * triple themselves, because sc-connectors can be generated and erased between their iterations.
+   */
+  void CollectStartCandidates(std::vector<ScAddrTriple> & startCandidates)
+  {
+    m_namesSlotsPositions.assign(m_namesSlots.size(), NO_POSITION);
+
+    size_t const startTripleIdx =
+        m_template.Size() == 1 ? 0 : *m_connectivityComponentPriorityTemplateTriples.cbegin();
+    ScTemplateTriple const * startTriple = m_template.m_templateTriples[startTripleIdx];
+    ScIterator3Ptr const it = CreateValidIterator(startTriple, ScAddrVector(CalculateOneResultSize()));
+    while (it->Next())
+      startCandidates.push_back(it->Get());
+  }
+
 private:
   /*!
    * Prepares input sc-template to minimize search
    */
   void PrepareSearch()
   {
+    SetUpTemplateItemsSlots();
+
     if (m_template.Size() == 1)
       return;
 
     SetUpDependenciesBetweenTriples();
     RemoveCycledDependenciesBetweenTriples();
     FindConnectivityComponents();
-    FindTriplesWithMostMinimalArcsForFirstItem();
+    FindCheapestTriplesOfConnectivityComponents();
+  }
+
+  /*!
+   * Assigns integer slots to items of sc-template, so search doesn't compare and look up replacement names of items.
+   * Each item has a key that is the same for items of one triple with equal replacement names, and each replacement
+   * name has a slot with its type and sc-address specified in sc-template.
+   */
+  void SetUpTemplateItemsSlots()
+  {
+    size_t const itemsCount = m_template.Size() * 3;
+    m_templateItemsKeys.resize(itemsCount);
+    m_templateItemsNamesSlots.assign(itemsCount, NO_NAME_SLOT);
+    m_templateItemsKeysToDependedTemplateTriples.resize(itemsCount);
+
+    std::unordered_map<std::string, size_t> namesToSlots;
+    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+    {
+      auto const & items = triple->GetValues();
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        size_t const itemIdx = triple->m_index * 3 + i;
+        m_templateItemsKeys[itemIdx] = itemIdx;
+        if (items[i].m_name.empty())
+          continue;
+
+        for (size_t j = 0; j < i; ++j)
+        {
+          if (items[j].m_name == items[i].m_name)
+          {
+            m_templateItemsKeys[itemIdx] = triple->m_index * 3 + j;
+            break;
+          }
+        }
+
+        auto const & [it, isInserted] = namesToSlots.insert({items[i].m_name, m_namesSlots.size()});
+        if (isInserted)
+          m_namesSlots.push_back(CreateNameSlot(items[i].m_name));
+        m_templateItemsNamesSlots[itemIdx] = it->second;
+      }
+    }
+  }
+
+  ScTemplateNameSlot CreateNameSlot(std::string const & name) const
+  {
+    ScTemplateNameSlot slot;
+    slot.m_name = name;
+
+    auto const & typesIt = m_template.m_templateItemsNamesToTypes.find(name);
+    slot.m_hasType = typesIt != m_template.m_templateItemsNamesToTypes.cend();
+    if (slot.m_hasType)
+      slot.m_type = typesIt->second;
+
+    auto const & addrsIt = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(name);
+    slot.m_hasReplacementAddr = addrsIt != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend();
+    if (slot.m_hasReplacementAddr)
+      slot.m_replacementAddr = addrsIt->second;
+
+    return slot;
+  }
+
+  //! Returns index of triple item in items of all sc-template triples
+  static size_t GetItemIdx(ScTemplateTriple const * triple, ScTemplateItem const & item)
+  {
+    return triple->m_index * 3 + (&item - triple->GetValues().data());
+  }
+
+  //! Returns slot of replacement name of triple item or `NO_NAME_SLOT` if item has no replacement name
+  size_t GetNameSlot(ScTemplateTriple const * triple, ScTemplateItem const & item) const
+  {
+    return m_templateItemsNamesSlots[GetItemIdx(triple, item)];
   }
 
   /*!
@@ -71,13 +408,7 @@ private:
     auto const & AddDependenceFromTripleItemToOtherTriple =
         [this](ScTemplateTriple const * triple, ScTemplateItem const & tripleItem, ScTemplateTriple const * otherTriple)
     {
-      std::string const & key = GetKey(triple, tripleItem);
-
-      auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (found == m_templateItemsNamesToDependedTemplateTriples.cend())
-        m_templateItemsNamesToDependedTemplateTriples.insert({key, {otherTriple->m_index}});
-      else
-        found->second.insert(otherTriple->m_index);
+      m_templateItemsKeysToDependedTemplateTriples[GetKey(triple, tripleItem)].insert(otherTriple->m_index);
     };
 
     auto const & TryAddDependenceBetweenTriples = [&AddDependenceFromTripleItemToOtherTriple](
@@ -130,10 +461,11 @@ private:
    */
   void RemoveCycledDependenciesBetweenTriples()
   {
-    auto const & CheckIfItemIsNodeVarStruct = [this](ScTemplateItem const & item) -> bool
+    auto const & CheckIfItemIsNodeVarStruct = [this](ScTemplateTriple const * triple, ScTemplateItem const & item)
     {
-      auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-      return found != m_template.m_templateItemsNamesToTypes.cend() && found->second == ScType::VarNodeStructure;
+      size_t const nameSlot = GetNameSlot(triple, item);
+      return nameSlot != NO_NAME_SLOT && m_namesSlots[nameSlot].m_hasType
+             && m_namesSlots[nameSlot].m_type == ScType::VarNodeStructure;
     };
 
     auto const & faeTriples =
@@ -146,16 +478,10 @@ private:
 
     auto const & UpdateCycledTriples = [this](ScTemplateTriple const * triple, ScTemplateItem const & item)
     {
-      std::string const & key = GetKey(triple, item);
-
-      auto const & dependedTriples = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (dependedTriples != m_templateItemsNamesToDependedTemplateTriples.cend())
+      for (size_t const dependedTripleIdx : m_templateItemsKeysToDependedTemplateTriples[GetKey(triple, item)])
       {
-        for (size_t const dependedTripleIdx : dependedTriples->second)
-        {
-          if (IsTriplesEqual(triple, m_template.m_templateTriples[dependedTripleIdx]))
-            m_cycledTemplateTriples.insert(dependedTripleIdx);
-        }
+        if (IsTriplesEqual(triple, m_template.m_templateTriples[dependedTripleIdx]))
+          m_cycledTemplateTriples.insert(dependedTripleIdx);
       }
 
       m_cycledTemplateTriples.insert(triple->m_index);
@@ -168,7 +494,7 @@ private:
 
       bool isFound = false;
       if (m_cycledTemplateTriples.find(triple->m_index) == m_cycledTemplateTriples.cend()
-          && (CheckIfItemIsNodeVarStruct(item1)
+          && (CheckIfItemIsNodeVarStruct(triple, item1)
               || CheckIfItemIsFixedAndOtherConnectorItemIsConnector(triple->m_index, item1)))
       {
         ScTemplateTriples checkedTriples;
@@ -185,15 +511,10 @@ private:
     for (size_t const idx : m_cycledTemplateTriples)
     {
       ScTemplateTriple * triple = m_template.m_templateTriples[idx];
-      std::string const & key = GetKey(triple, (*triple)[0]);
-
-      auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (found != m_templateItemsNamesToDependedTemplateTriples.cend())
+      ScTemplateTriples & dependedTriples = m_templateItemsKeysToDependedTemplateTriples[GetKey(triple, (*triple)[0])];
+      for (size_t const otherIdx : m_cycledTemplateTriples)
       {
-        for (size_t const otherIdx : m_cycledTemplateTriples)
-        {
-          found->second.erase(otherIdx);
-        }
+        dependedTriples.erase(otherIdx);
       }
     }
   };
@@ -226,9 +547,7 @@ private:
       FindCycleWithFAATriple(item, triple, templateTripleToFind, checkedTemplateTriples, isFound);
     };
 
-    ScTemplateTriples nextTemplateTriples;
-    FindDependedTriple(templateItem, templateTriple, nextTemplateTriples);
-
+    ScTemplateTriples const & nextTemplateTriples = FindDependedTriples(templateItem, templateTriple);
     for (size_t const otherTemplateTripleIdx : nextTemplateTriples)
     {
       ScTemplateTriple const * otherTriple = m_template.m_templateTriples[otherTemplateTripleIdx];
@@ -294,9 +613,7 @@ private:
       ScTemplateTriples & checkedTemplateTriples,
       ScTemplateTriples & connectivityComponentTemplateTriples)
   {
-    ScTemplateTriples nextTriples;
-    FindDependedTriple(templateItem, templateTriple, nextTriples);
-
+    ScTemplateTriples const & nextTriples = FindDependedTriples(templateItem, templateTriple);
     for (size_t const otherTripleIdx : nextTriples)
     {
       // check if triple was passed in branch of sc-template
@@ -321,120 +638,106 @@ private:
   }
 
   /*!
-   * Finds all connectivity component triples among all triples that have the fixed first item, but not fixed
-   * other items, for which the minimum number of arcs goes/incomes out of the first item compared to the other triples.
+   * Plans search in each connectivity component: finds triple which iterator is estimated to be the cheapest one and
+   * starts search in this component from it.
+   * @note Only start triples are planned by cost. Join order of other triples isn't planned: they are joined by
+   * their dependencies on items of already found triples in order of items (connector, source, target) and indices of
+   * triples, as search iterates them.
    */
-  void FindTriplesWithMostMinimalArcsForFirstItem()
+  void FindCheapestTriplesOfConnectivityComponents()
   {
-    for (ScTemplateTriples const & connectivityComponentsTriples : m_connectivityComponentsTemplateTriples)
+    for (ScTemplateTriples const & connectivityComponentTriples : m_connectivityComponentsTemplateTriples)
     {
-      sc_int32 priorityTripleIdx = -1;
-      auto & afaTriples = m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::AFA];
-      if (!afaTriples.empty())
-        priorityTripleIdx = (sc_int32)*afaTriples.cbegin();
+      if (connectivityComponentTriples.empty())
+        continue;
 
-      if (priorityTripleIdx == -1)
+      sc_int32 priorityTripleIdx = -1;
+      size_t minCost = 0;
+      size_t minPriority = 0;
+      for (size_t const tripleIdx : connectivityComponentTriples)
       {
-        priorityTripleIdx = FindTripleWithMostMinimalInputArcsForThirdItem(connectivityComponentsTriples);
-        if (priorityTripleIdx == -1)
-          priorityTripleIdx = FindTripleWithMostMinimalOutputArcsForFirstItem(connectivityComponentsTriples);
+        ScTemplateTriple * triple = m_template.m_templateTriples[tripleIdx];
+
+        size_t cost;
+        if (!EstimateTripleIteratorCost(triple, cost))
+          continue;
+
+        auto const priority = (size_t)m_template.GetPriority(triple);
+        if (priorityTripleIdx == -1 || cost < minCost || (cost == minCost && priority < minPriority)
+            || (cost == minCost && priority == minPriority && tripleIdx < (size_t)priorityTripleIdx))
+        {
+          priorityTripleIdx = (sc_int32)tripleIdx;
+          minCost = cost;
+          minPriority = priority;
+        }
       }
 
-      // save triple in which the first item address has the most minimal count of incoming/outgoing sc-arcs in vector
-      // with more priority
       if (priorityTripleIdx != -1)
-      {
         m_connectivityComponentPriorityTemplateTriples.insert(priorityTripleIdx);
-      }
     }
   }
 
-  sc_int32 FindTripleWithMostMinimalInputArcsForThirdItem(ScTemplateTriples const & connectivityComponentsTriples)
+  /*!
+   * Estimates count of sc-connectors that iterator created for triple before search iterates. The estimation is
+   * based on counters of incoming and outgoing sc-connectors of fixed items of triple.
+   * @returns false if triple has no fixed items to create iterator for it.
+   */
+  bool EstimateTripleIteratorCost(ScTemplateTriple const * triple, size_t & cost) const
   {
-    auto triplesWithConstEndElement =
-        m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAF];
-    if (triplesWithConstEndElement.empty())
-    {
-      triplesWithConstEndElement =
-          m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::AAF];
-    }
-
-    // find triple in which the third item address has the most minimal count of incoming sc-arcs
-    sc_int32 priorityTripleIdx = -1;
-    sc_int32 minInputArcsCount = -1;
-    for (size_t const tripleIdx : triplesWithConstEndElement)
-    {
-      // check if triple in connectivity component
-      if (connectivityComponentsTriples.find(tripleIdx) == connectivityComponentsTriples.cend())
-        continue;
-
-      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
-      auto const count = (sc_int32)m_context.GetElementEdgesAndIncomingArcsCount(triple->GetValues()[2].m_addrValue);
-
-      if (minInputArcsCount == -1 || count < minInputArcsCount)
-      {
-        priorityTripleIdx = (sc_int32)tripleIdx;
-        minInputArcsCount = (sc_int32)count;
-      }
-    }
+    ScAddr const & addr1 = ResolveFixedAddr(triple, (*triple)[0]);
+    ScAddr const & addr2 = ResolveFixedAddr(triple, (*triple)[1]);
+    ScAddr const & addr3 = ResolveFixedAddr(triple, (*triple)[2]);
+
+    // F_F_A, A_F_F, A_F_A, F_F_F: sc-connector is fixed
+    if (addr2.IsValid())
+      cost = 1;
+    // F_A_F, A_A_F: iterators pass incoming sc-connectors of the third item
+    else if (addr3.IsValid())
+      cost = m_context.GetElementEdgesAndIncomingArcsCount(addr3);
+    // F_A_A: iterator passes outgoing sc-connectors of the first item
+    else if (addr1.IsValid())
+      cost = m_context.GetElementEdgesAndOutgoingArcsCount(addr1);
+    else
+      return false;
 
-    return priorityTripleIdx;
+    return true;
   }
 
-  sc_int32 FindTripleWithMostMinimalOutputArcsForFirstItem(ScTemplateTriples const & connectivityComponentsTriples)
+  //! Returns sc-address of triple item that is known before search
+  ScAddr const & ResolveFixedAddr(ScTemplateTriple const * triple, ScTemplateItem const & templateItem) const
   {
-    auto triplesWithConstBeginElement =
-        m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAN];
-    // if there are no triples with the no connector third item than sort triples with the connector third item
-    if (triplesWithConstBeginElement.empty())
-      triplesWithConstBeginElement =
-          m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAE];
+    if (templateItem.IsAddr())
+      return templateItem.m_addrValue;
 
-    // find triple in which the first item address has the most minimal count of outgoing sc-arcs
-    sc_int32 priorityTripleIdx = -1;
-    sc_int32 minOutputArcsCount = -1;
-    for (size_t const tripleIdx : triplesWithConstBeginElement)
+    if (templateItem.IsReplacement())
     {
-      // check if triple in connectivity component
-      if (connectivityComponentsTriples.find(tripleIdx) == connectivityComponentsTriples.cend())
-        continue;
-
-      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
-      auto const count = (sc_int32)m_context.GetElementEdgesAndOutgoingArcsCount(triple->GetValues()[0].m_addrValue);
-
-      if (minOutputArcsCount == -1 || count < minOutputArcsCount)
-      {
-        priorityTripleIdx = (sc_int32)tripleIdx;
-        minOutputArcsCount = (sc_int32)count;
-      }
+      size_t const nameSlot = GetNameSlot(triple, templateItem);
+      if (nameSlot != NO_NAME_SLOT && m_namesSlots[nameSlot].m_hasReplacementAddr)
+        return m_namesSlots[nameSlot].m_replacementAddr;
     }
 
-    return priorityTripleIdx;
+    return ScAddr::Empty;
   }
 
-  //! Returns key - "${item replacement name}${triple index}"
-  static std::string GetKey(ScTemplateTriple const * triple, ScTemplateItem const & item)
+  //! Returns key of triple item, it is the same for items of the triple with equal replacement names
+  size_t GetKey(ScTemplateTriple const * triple, ScTemplateItem const & item) const
   {
-    std::ostringstream stream;
-    stream << item.m_name << "_" << triple->m_index;
-    return stream.str();
+    return m_templateItemsKeys[GetItemIdx(triple, item)];
   }
 
-  void FindDependedTriple(ScTemplateItem const & item, ScTemplateTriple const * triple, ScTemplateTriples & nextTriples)
+  ScTemplateTriples const & FindDependedTriples(ScTemplateItem const & item, ScTemplateTriple const * triple) const
   {
+    static ScTemplateTriples const noTriples;
     if (item.m_name.empty())
-      return;
+      return noTriples;
 
-    std::string const & key = GetKey(triple, item);
-    auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-    if (found != m_templateItemsNamesToDependedTemplateTriples.cend())
-      nextTriples = found->second;
+    return m_templateItemsKeysToDependedTemplateTriples[GetKey(triple, item)];
   }
 
   bool IsTriplesEqual(
       ScTemplateTriple const * templateTriple,
       ScTemplateTriple const * otherTemplateTriple,
-      std::string const & itemName = "")
+      size_t const itemNameSlot = NO_NAME_SLOT) const
   {
     if (templateTriple->m_index == otherTemplateTriple->m_index)
       return true;
@@ -442,20 +745,23 @@ private:
     auto const & tripleValues = templateTriple->GetValues();
     auto const & otherTripleValues = otherTemplateTriple->GetValues();
 
-    auto const & IsTriplesItemsEqual = [this](ScTemplateItem const & item, ScTemplateItem const & otherItem) -> bool
+    size_t const tripleItemsIdx = templateTriple->m_index * 3;
+    size_t const otherTripleItemsIdx = otherTemplateTriple->m_index * 3;
+
+    auto const & IsTriplesItemsEqual = [&](size_t const i) -> bool
     {
+      ScTemplateItem const & item = tripleValues[i];
+      ScTemplateItem const & otherItem = otherTripleValues[i];
+      size_t const nameSlot = m_templateItemsNamesSlots[tripleItemsIdx + i];
+      size_t const otherNameSlot = m_templateItemsNamesSlots[otherTripleItemsIdx + i];
+
       bool isEqual = item.m_typeValue == otherItem.m_typeValue;
       if (!isEqual)
       {
-        auto found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-        if (found == m_template.m_templateItemsNamesToTypes.cend())
-        {
-          found = m_template.m_templateItemsNamesToTypes.find(otherItem.m_name);
-          if (found != m_template.m_templateItemsNamesToTypes.cend())
-            isEqual = item.m_typeValue == found->second;
-        }
-        else
-          isEqual = found->second == otherItem.m_typeValue;
+        if (nameSlot != NO_NAME_SLOT && m_namesSlots[nameSlot].m_hasType)
+          isEqual = m_namesSlots[nameSlot].m_type == otherItem.m_typeValue;
+        else if (otherNameSlot != NO_NAME_SLOT && m_namesSlots[otherNameSlot].m_hasType)
+          isEqual = item.m_typeValue == m_namesSlots[otherNameSlot].m_type;
       }
 
       if (isEqual)
@@ -463,27 +769,25 @@ private:
 
       if (!isEqual)
       {
-        auto found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(item.m_name);
-        if (found == m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
-        {
-          found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(otherItem.m_name);
-          if (found != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
-            isEqual = item.m_addrValue == found->second;
-        }
-        else
-          isEqual = found->second == otherItem.m_addrValue;
+        if (nameSlot != NO_NAME_SLOT && m_namesSlots[nameSlot].m_hasReplacementAddr)
+          isEqual = m_namesSlots[nameSlot].m_replacementAddr == otherItem.m_addrValue;
+        else if (otherNameSlot != NO_NAME_SLOT && m_namesSlots[otherNameSlot].m_hasReplacementAddr)
+          isEqual = item.m_addrValue == m_namesSlots[otherNameSlot].m_replacementAddr;
       }
 
       return isEqual;
     };
 
-    return IsTriplesItemsEqual(tripleValues[0], otherTripleValues[0])
-           && IsTriplesItemsEqual(tripleValues[1], otherTripleValues[1])
-           && IsTriplesItemsEqual(tripleValues[2], otherTripleValues[2])
-           && ((tripleValues[0].m_name == otherTripleValues[0].m_name
-                && (itemName.empty() || otherTripleValues[0].m_name == itemName))
-               || (tripleValues[2].m_name == otherTripleValues[2].m_name
-                   && (itemName.empty() || otherTripleValues[0].m_name == itemName)));
+    // items with equal replacement names have equal slots, and items without replacement names have no slots
+    auto const & IsTriplesItemsNamesEqual = [&](size_t const i) -> bool
+    {
+      return m_templateItemsNamesSlots[tripleItemsIdx + i] == m_templateItemsNamesSlots[otherTripleItemsIdx + i];
+    };
+    bool const isFirstItemNameMatched =
+        itemNameSlot == NO_NAME_SLOT || m_templateItemsNamesSlots[otherTripleItemsIdx] == itemNameSlot;
+
+    return IsTriplesItemsEqual(0) && IsTriplesItemsEqual(1) && IsTriplesItemsEqual(2)
+           && ((IsTriplesItemsNamesEqual(0) || IsTriplesItemsNamesEqual(2)) && isFirstItemNameMatched);
   };
 
   inline bool IsStructureValid()
@@ -497,17 +801,16 @@ private:
   }
 
   ScAddr const & ResolveAddr(
+      ScTemplateTriple const * templateTriple,
       ScTemplateItem const & templateItem,
-      ScAddrVector const & replacementConstruction,
-      ScTemplateSearchResult & result) const
+      ScAddrVector const & replacementConstruction) const
   {
-    auto const & GetItemAddrInReplacements = [&replacementConstruction,
-                                              &result](ScTemplateItem const & item) -> ScAddr const &
+    size_t const nameSlot = GetNameSlot(templateTriple, templateItem);
+    auto const & GetItemAddrInReplacements = [this, &replacementConstruction, nameSlot]() -> ScAddr const &
     {
-      auto const & it = result.m_templateItemsNamesToReplacementItemsPositions.find(item.m_name);
-      if (it != result.m_templateItemsNamesToReplacementItemsPositions.cend())
+      if (nameSlot != NO_NAME_SLOT && m_namesSlotsPositions[nameSlot] != NO_POSITION)
       {
-        ScAddr const & addr = replacementConstruction[it->second];
+        ScAddr const & addr = replacementConstruction[m_namesSlotsPositions[nameSlot]];
         if (addr.IsValid())
           return addr;
       }
@@ -524,13 +827,12 @@ private:
 
     case ScTemplateItem::Type::Replace:
     {
-      ScAddr const & replacementAddr = GetItemAddrInReplacements(templateItem);
+      ScAddr const & replacementAddr = GetItemAddrInReplacements();
       if (replacementAddr.IsValid())
         return replacementAddr;
 
-      auto const & addrsIt = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(templateItem.m_name);
-      if (addrsIt != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
-        return addrsIt->second;
+      if (nameSlot != NO_NAME_SLOT && m_namesSlots[nameSlot].m_hasReplacementAddr)
+        return m_namesSlots[nameSlot].m_replacementAddr;
 
       return ScAddr::Empty;
     }
@@ -539,7 +841,7 @@ private:
     {
       if (!templateItem.m_name.empty())
       {
-        return GetItemAddrInReplacements(templateItem);
+        return GetItemAddrInReplacements();
       }
       SC_FALLTHROUGH;
     }
@@ -551,28 +853,22 @@ private:
     }
   }
 
-  ScIterator3Ptr CreateIterator(
-      ScTemplateTriple const * templateTriple,
-      ScAddrVector const & replacementConstruction,
-      ScTemplateSearchResult & result)
+  ScIterator3Ptr CreateIterator(ScTemplateTriple const * templateTriple, ScAddrVector const & replacementConstruction)
   {
     ScTemplateItem const & item1 = (*templateTriple)[0];
     ScTemplateItem const & item2 = (*templateTriple)[1];
     ScTemplateItem const & item3 = (*templateTriple)[2];
 
-    ScAddr const & addr1 = ResolveAddr(item1, replacementConstruction, result);
-    ScAddr const & addr2 = ResolveAddr(item2, replacementConstruction, result);
-    ScAddr const & addr3 = ResolveAddr(item3, replacementConstruction, result);
+    ScAddr const & addr1 = ResolveAddr(templateTriple, item1, replacementConstruction);
+    ScAddr const & addr2 = ResolveAddr(templateTriple, item2, replacementConstruction);
+    ScAddr const & addr3 = ResolveAddr(templateTriple, item3, replacementConstruction);
 
-    auto const & PrepareType = [this](ScTemplateItem const & item) -> ScType
+    auto const & PrepareType = [this, templateTriple](ScTemplateItem const & item) -> ScType
     {
       ScType type = item.m_typeValue;
-      if (!item.m_name.empty())
-      {
-        auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-        if (found != m_template.m_templateItemsNamesToTypes.cend())
-          type = found->second;
-      }
+      size_t const nameSlot = GetNameSlot(templateTriple, item);
+      if (nameSlot != NO_NAME_SLOT && m_namesSlots[nameSlot].m_hasType)
+        type = m_namesSlots[nameSlot].m_type;
 
       if (type.HasConstancyFlag())
         return type.UpConstType();
@@ -610,11 +906,26 @@ private:
     return {};
   }
 
+  ScIterator3Ptr CreateValidIterator(
+      ScTemplateTriple const * templateTriple,
+      ScAddrVector const & replacementConstruction)
+  {
+    ScIterator3Ptr it = CreateIterator(templateTriple, replacementConstruction);
+    if (!it || !it->IsValid())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Fully variable triple was selected during searching by specified sc-template. It is possible that you have "
+          "incorrect sc-template or you can't find constructions in knowledge base using this sc-template. Check "
+          "sc-template.");
+
+    return it;
+  }
+
   using UsedConnectors = std::unordered_set<ScAddr, ScAddrHashFunc>;
 
   void DoIterationOnNextEqualTriples(
       ScTemplateTriples const & templateTriples,
-      std::string const & templateItemName,
+      size_t const templateItemNameSlot,
       size_t const replacementConstructionIdx,
       ScTemplateTriples const & currentIterableTemplateTriples,
       ScTemplateTriples & childrenTemplateTriples,
@@ -625,25 +936,24 @@ private:
     isLast = true;
     isFinished = true;
 
-    std::unordered_set<size_t> iteratedTemplateTriples;
+    ScTemplateSearchTriplesBitset iteratedTemplateTriples{m_template.Size()};
     for (size_t const idx : templateTriples)
     {
       ScTemplateTriple * triple = m_template.m_templateTriples[idx];
-      if (iteratedTemplateTriples.find(triple->m_index) != iteratedTemplateTriples.cend())
+      if (iteratedTemplateTriples.Contains(triple->m_index))
         continue;
 
       ScTemplateTriples equalTemplateTriples;
       for (ScTemplateTriple * otherTemplateTriple : m_template.m_templateTriples)
       {
         // check if iterable triple is equal to current, not checked and not iterable with previous
-        if (m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].find(
+        if (!m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].Contains(
                 otherTemplateTriple->m_index)
-                == m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].cend()
             && currentIterableTemplateTriples.find(idx) == currentIterableTemplateTriples.cend()
-            && IsTriplesEqual(triple, otherTemplateTriple, templateItemName))
+            && IsTriplesEqual(triple, otherTemplateTriple, templateItemNameSlot))
         {
           equalTemplateTriples.insert(otherTemplateTriple->m_index);
-          iteratedTemplateTriples.insert(otherTemplateTriple->m_index);
+          iteratedTemplateTriples.Insert(otherTemplateTriple->m_index);
         }
       }
 
@@ -657,8 +967,7 @@ private:
             equalTemplateTriples.end(),
             [this, replacementConstructionIdx](size_t const idx)
             {
-              return m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].find(idx)
-                     != m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].cend();
+              return m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].Contains(idx);
             });
 
         if (!isFinished)
@@ -679,12 +988,9 @@ private:
   {
     bool isChildFinished = false;
     bool isNoChild = false;
-    ScTemplateTriples nextTemplateTriples;
-    FindDependedTriple(item, templateTriple, nextTemplateTriples);
-
     DoIterationOnNextEqualTriples(
-        nextTemplateTriples,
-        item.m_name,
+        FindDependedTriples(item, templateTriple),
+        GetNameSlot(templateTriple, item),
         replacementConstructionIdx,
         templateTriples,
         childrenTemplateTriples,
@@ -706,24 +1012,23 @@ private:
     size_t templateTripleIdx = *templateTriples.begin();
     ScTemplateTriple * templateTriple = m_template.m_templateTriples[templateTripleIdx];
 
+    // candidates of start triple are claimed from shared state on the first level of dependence iterations
+    bool const isStartTriplePartitioned = m_sharedState != nullptr && m_iterationDepth == 0;
+    IterationDepthScope const depthScope(m_iterationDepth);
+
     bool isForLastTemplateTripleAllChildrenFinished = true;
     bool isLastTemplateTripleHasNoChildren = false;
 
-    ScIterator3Ptr it =
-        CreateIterator(templateTriple, result.m_replacementConstructions[replacementConstructionIdx], result);
-    if (!it || !it->IsValid())
-      SC_THROW_EXCEPTION(
-          utils::ExceptionInvalidState,
-          "Fully variable triple was selected during searching by specified sc-template. It is possible that you have "
-          "incorrect sc-template or you can't find constructions in knowledge base using this sc-template. Check "
-          "sc-template.");
+    ScIterator3Ptr it;
+    if (!isStartTriplePartitioned)
+      it = CreateValidIterator(templateTriple, result.m_replacementConstructions[replacementConstructionIdx]);
 
     size_t checkedCurrentResultEqualTemplateTriplesCount = 0;
 
     ScAddrVector nextResultReplacementTriples{result.m_replacementConstructions[replacementConstructionIdx]};
-    ScTemplateTriples nextCheckedTemplateTriples{
+    ScTemplateSearchTriplesBitset nextCheckedTemplateTriples{
         m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx]};
-    UsedConnectors nextUsedReplacementConnectors{
+    ScTemplateSearchConnectorsSet nextUsedReplacementConnectors{
         m_usedConnectorsInReplacementConstructions[replacementConstructionIdx]};
 
     bool isTemplateTriplesIteratorNext = false;
@@ -731,9 +1036,10 @@ private:
     do
     {
       ScReplacementTriple replacementTriple;
-      if (it->Next())
+      if (isStartTriplePartitioned ? ClaimStartCandidate(replacementTriple) : it->Next())
       {
-        replacementTriple = it->Get();
+        if (!isStartTriplePartitioned)
+          replacementTriple = it->Get();
         auto copiedTemplateTriplesIterator = templateTriplesIterator;
         if (copiedTemplateTriplesIterator != templateTriples.cend())
         {
@@ -772,8 +1078,7 @@ private:
       // check if connector is used for other equal triple
       auto & usedConnectorsInCurrentReplacementConstruction =
           m_usedConnectorsInReplacementConstructions[replacementConstructionIdx];
-      if (usedConnectorsInCurrentReplacementConstruction.find(replacementTriple[1])
-          != usedConnectorsInCurrentReplacementConstruction.cend())
+      if (usedConnectorsInCurrentReplacementConstruction.Contains(replacementTriple[1]))
         continue;
 
       // check triple elements by structure belonging or predicate callback
@@ -784,7 +1089,7 @@ private:
               && (!m_checkCallback(replacementTriple[0]) || !m_checkCallback(replacementTriple[1])
                   || !m_checkCallback(replacementTriple[2]))))
       {
-        m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].insert(replacementTriple[1]);
+        m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].Insert(replacementTriple[1]);
         continue;
       }
 
@@ -808,7 +1113,7 @@ private:
 
           result.m_replacementConstructions.emplace_back(nextResultReplacementTriples);
           m_checkedTemplateTriplesInReplacementConstructions.emplace_back(nextCheckedTemplateTriples);
-          m_usedConnectorsInReplacementConstructions.emplace_back(DEFAULT_RESULT_RESERVE_SIZE);
+          m_usedConnectorsInReplacementConstructions.emplace_back();
 
           templateTriplesIterator = templateTriples.cbegin();
         }
@@ -833,8 +1138,7 @@ private:
 
         templateTriple = m_template.m_templateTriples[templateTripleIdx];
 
-        if (checkedTemplateTriplesInCurrentReplacementConstruction.find(templateTripleIdx)
-            != checkedTemplateTriplesInCurrentReplacementConstruction.cend())
+        if (checkedTemplateTriplesInCurrentReplacementConstruction.Contains(templateTripleIdx))
           continue;
 
         ScAddrVector & replacementConstruction = result.m_replacementConstructions[replacementConstructionIdx];
@@ -843,7 +1147,7 @@ private:
         auto const & items = templateTriple->GetValues();
         for (size_t i = 0; i < items.size(); ++i)
         {
-          ScAddr const & resolvedAddr = ResolveAddr(items[i], replacementConstruction, result);
+          ScAddr const & resolvedAddr = ResolveAddr(templateTriple, items[i], replacementConstruction);
           if (resolvedAddr.IsValid() && resolvedAddr != replacementTriple[i])
           {
             isForLastTemplateTripleAllChildrenFinished = false;
@@ -896,7 +1200,7 @@ private:
           {
             for (auto const & otherTemplateTripleIdx : childrenTemplateTriples)
             {
-              m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].erase(
+              m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].Erase(
                   otherTemplateTripleIdx);
             }
             childrenTemplateTriples.clear();
@@ -912,7 +1216,7 @@ private:
             // current connector is busy for all equal triples
             childrenTemplateTriples.insert(templateTripleIdx);
             m_usedConnectorsInTemplateTriples[templateTripleIdx].insert(replacementTriple[1]);
-            m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].insert(replacementTriple[1]);
+            m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].Insert(replacementTriple[1]);
 
             break;
           }
@@ -922,7 +1226,7 @@ private:
 
       // there are no next triples for current triple, it is last
       if (isLastTemplateTripleHasNoChildren && isForLastTemplateTripleAllChildrenFinished
-          && m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].size()
+          && m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].Size()
                  == m_template.m_templateTriples.size())
       {
         if (!m_filterCallback
@@ -933,7 +1237,53 @@ private:
           AppendFoundReplacementConstruction(result, replacementConstructionIdx);
       }
     }
-    while (!isStopped);
+    while (!IsStopped());
+  }
+
+  //! Increments depth of dependence iterations while it is in scope
+  struct IterationDepthScope
+  {
+    explicit IterationDepthScope(size_t & depth)
+      : m_depth(depth)
+    {
+      ++m_depth;
+    }
+
+    ~IterationDepthScope()
+    {
+      --m_depth;
+    }
+
+    size_t & m_depth;
+  };
+
+  /*!
+   * Takes next candidate of start triple for this thread from collected ones. Threads claim chunks of candidates in
+   * increasing order, so each candidate is taken by one thread.
+   * @returns false if all candidates are taken.
+   */
+  bool ClaimStartCandidate(ScAddrTriple & candidate)
+  {
+    std::vector<ScAddrTriple> const & startCandidates = m_sharedState->m_startCandidates;
+    if (m_nextStartCandidateIdx == m_claimedStartCandidatesEndIdx)
+    {
+      size_t const chunk = m_sharedState->m_nextStartCandidatesChunk.fetch_add(1);
+      m_nextStartCandidateIdx =
+          std::min(chunk * ScTemplateSearchSharedState::START_CANDIDATES_CHUNK_SIZE, startCandidates.size());
+      m_claimedStartCandidatesEndIdx =
+          std::min(m_nextStartCandidateIdx + ScTemplateSearchSharedState::START_CANDIDATES_CHUNK_SIZE,
+                   startCandidates.size());
+      if (m_nextStartCandidateIdx == m_claimedStartCandidatesEndIdx)
+        return false;
+    }
+
+    candidate = startCandidates[m_nextStartCandidateIdx++];
+    return true;
+  }
+
+  bool IsStopped() const
+  {
+    return isStopped || (m_sharedState != nullptr && m_sharedState->m_isStopped);
   }
 
   void UpdateResult(
@@ -942,28 +1292,27 @@ private:
       ScAddrTriple const & replacementTriple,
       ScTemplateSearchResult & result)
   {
-    auto const & UpdateResultByItem =
-        [&result](ScTemplateItem const & item, ScAddr const & addr, size_t const elementNum, ScAddrVector & resultAddrs)
-    {
-      resultAddrs[elementNum] = addr;
-
-      if (item.m_name.empty())
-        return;
-
-      result.m_templateItemsNamesToReplacementItemsPositions[item.m_name] = elementNum;
-    };
-
-    m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].insert(templateTriple->m_index);
-    m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].insert(replacementTriple[1]);
+    m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].Insert(templateTriple->m_index);
+    m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].Insert(replacementTriple[1]);
 
     size_t itemIdx = templateTriple->m_index * 3;
     for (size_t i = replacementConstructionIdx; i < result.Size(); ++i)
     {
       ScAddrVector & resultAddrs = result.m_replacementConstructions[i];
+      for (size_t j = 0; j < 3; ++j)
+        resultAddrs[itemIdx + j] = replacementTriple[j];
+    }
 
-      UpdateResultByItem((*templateTriple)[0], replacementTriple[0], itemIdx, resultAddrs);
-      UpdateResultByItem((*templateTriple)[1], replacementTriple[1], itemIdx + 1, resultAddrs);
-      UpdateResultByItem((*templateTriple)[2], replacementTriple[2], itemIdx + 2, resultAddrs);
+    // positions of replacement names are changed in result only if they are changed, so names aren't hashed for each
+    // found triple
+    for (size_t j = 0; j < 3; ++j)
+    {
+      size_t const nameSlot = m_templateItemsNamesSlots[itemIdx + j];
+      if (nameSlot == NO_NAME_SLOT || m_namesSlotsPositions[nameSlot] == itemIdx + j)
+        continue;
+
+      m_namesSlotsPositions[nameSlot] = itemIdx + j;
+      result.m_templateItemsNamesToReplacementItemsPositions[m_namesSlots[nameSlot].m_name] = itemIdx + j;
     }
   };
 
@@ -972,12 +1321,12 @@ private:
       size_t const replacementConstructionIdx,
       ScAddrVector & replacementConstruction)
   {
-    m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].erase(tripleIdx);
+    m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].Erase(tripleIdx);
 
     size_t itemIdx = tripleIdx * 3;
 
     replacementConstruction[itemIdx] = ScAddr::Empty;
-    m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].erase(replacementConstruction[++itemIdx]);
+    m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].Erase(replacementConstruction[++itemIdx]);
     m_notUsedConnectorsInTemplateTriples[tripleIdx].insert(replacementConstruction[itemIdx]);
     replacementConstruction[itemIdx] = ScAddr::Empty;
     replacementConstruction[++itemIdx] = ScAddr::Empty;
@@ -985,6 +1334,17 @@ private:
 
   void AppendFoundReplacementConstruction(ScTemplateSearchResult & result, size_t & resultIdx)
   {
+    std::unique_lock<std::mutex> lock;
+    if (m_sharedState != nullptr && (m_callback || m_callbackWithRequest))
+    {
+      lock = std::unique_lock<std::mutex>(m_sharedState->m_mutex);
+      if (m_sharedState->m_isStopped)
+      {
+        isStopped = true;
+        return;
+      }
+    }
+
     if (m_callback)
     {
       m_callback(
@@ -1003,6 +1363,8 @@ private:
       case ScTemplateSearchRequest::STOP:
       {
         isStopped = true;
+        if (m_sharedState != nullptr)
+          m_sharedState->m_isStopped = true;
         break;
       }
       case ScTemplateSearchRequest::ERROR:
@@ -1043,7 +1405,15 @@ private:
     m_usedConnectorsInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
     m_usedConnectorsInReplacementConstructions.emplace_back();
     m_checkedTemplateTriplesInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
-    m_checkedTemplateTriplesInReplacementConstructions.emplace_back();
+    m_checkedTemplateTriplesInReplacementConstructions.emplace_back(m_template.Size());
+
+    m_namesSlotsPositions.assign(m_namesSlots.size(), NO_POSITION);
+    for (size_t i = 0; i < m_namesSlots.size(); ++i)
+    {
+      auto const & it = result.m_templateItemsNamesToReplacementItemsPositions.find(m_namesSlots[i].m_name);
+      if (it != result.m_templateItemsNamesToReplacementItemsPositions.cend())
+        m_namesSlotsPositions[i] = it->second;
+    }
 
     ScTemplateTriples childrenTemplateTriples;
 
@@ -1052,7 +1422,8 @@ private:
 
     auto const & startTriples = m_template.Size() == 1 ? ScTemplateTriples{m_template.m_templateTriples[0]->m_index}
                                                        : m_connectivityComponentPriorityTemplateTriples;
-    DoIterationOnNextEqualTriples(startTriples, "", 0, {}, childrenTemplateTriples, result, isFinished, isLast);
+    DoIterationOnNextEqualTriples(
+        startTriples, NO_NAME_SLOT, 0, {}, childrenTemplateTriples, result, isFinished, isLast);
   }
 
 public:
@@ -1088,17 +1459,24 @@ private:
   ScTemplate & m_template;
   ScMemoryContext & m_context;
 
-  // fields for template preprocessing
-  std::map<std::string, ScTemplateTriples> m_templateItemsNamesToDependedTemplateTriples;
+  // fields for template preprocessing, items of sc-template triples are indexed by `tripleIdx * 3 + itemIdx`
+  static constexpr size_t NO_NAME_SLOT = std::numeric_limits<size_t>::max();
+  std::vector<size_t> m_templateItemsKeys;
+  std::vector<size_t> m_templateItemsNamesSlots;
+  std::vector<ScTemplateNameSlot> m_namesSlots;
+  std::vector<ScTemplateTriples> m_templateItemsKeysToDependedTemplateTriples;
   ScTemplateTriples m_cycledTemplateTriples;
   std::vector<ScTemplateTriples> m_connectivityComponentsTemplateTriples;
   ScTemplateTriples m_connectivityComponentPriorityTemplateTriples;
 
   // fields search by template
+  static constexpr size_t NO_POSITION = std::numeric_limits<size_t>::max();
+  //! Positions of items with replacement names in found constructions, the same as in search result
+  std::vector<size_t> m_namesSlotsPositions;
   std::vector<UsedConnectors> m_notUsedConnectorsInTemplateTriples;
   std::vector<UsedConnectors> m_usedConnectorsInTemplateTriples;
-  std::vector<UsedConnectors> m_usedConnectorsInReplacementConstructions;
-  std::vector<ScTemplateTriples> m_checkedTemplateTriplesInReplacementConstructions;
+  std::vector<ScTemplateSearchConnectorsSet> m_usedConnectorsInReplacementConstructions;
+  std::vector<ScTemplateSearchTriplesBitset> m_checkedTemplateTriplesInReplacementConstructions;
 
   size_t const DEFAULT_RESULT_RESERVE_SIZE = 512;
   size_t m_resultReserveCount = 1;
@@ -1108,6 +1486,12 @@ private:
   // fields for append result handling
   bool isStopped = false;
 
+  // fields for search in parallel
+  ScTemplateSearchSharedState * m_sharedState = nullptr;
+  size_t m_iterationDepth = 0;
+  size_t m_nextStartCandidateIdx = 0;
+  size_t m_claimedStartCandidatesEndIdx = 0;
+
   ScAddr const m_structure;
   ScTemplateSearchResultCallback m_callback;
   ScTemplateSearchResultCallbackWithRequest m_callbackWithRequest;
@@ -1115,8 +1499,305 @@ private:
   ScTemplateSearchResultCheckCallback m_checkCallback;
 };
 
+/*!
+ * Searches by sc-template in several threads. Independent connectivity components of sc-template are searched
+ * concurrently and found constructions of them are joined. If sc-template is connected, then candidates of its start
+ * triple are partitioned between threads.
+ */
+class ScTemplateParallelSearch
+{
+public:
+  ScTemplateParallelSearch(ScTemplate & templ, ScMemoryContext & context, size_t threadsCount)
+    : m_template(templ)
+    , m_context(context)
+    , m_threadsCount(threadsCount)
+  {
+  }
+
+  void SetCallbackWithRequest(ScTemplateSearchResultCallbackWithRequest const & callback)
+  {
+    m_callbackWithRequest = callback;
+  }
+
+  void SetCallback(ScTemplateSearchResultCallback const & callback)
+  {
+    m_callback = callback;
+  }
+
+  void SetFilterCallback(ScTemplateSearchResultFilterCallback const & filterCallback)
+  {
+    m_filterCallback = filterCallback;
+  }
+
+  void SetCheckCallback(ScTemplateSearchResultCheckCallback const & checkCallback)
+  {
+    m_checkCallback = checkCallback;
+  }
+
+  ScTemplate::Result operator()(ScTemplateSearchResult & result)
+  {
+    result.Clear();
+    Search(&result);
+
+    result.m_context = &m_context;
+    return ScTemplate::Result(result.Size() > 0);
+  }
+
+  void operator()()
+  {
+    Search(nullptr);
+  }
+
+private:
+  void Search(ScTemplateSearchResult * result)
+  {
+    ScTemplateSearch search(m_template, m_context, ScAddr::Empty);
+    SetUpSearch(search);
+
+    std::vector<ScTemplateSearch::ScTemplateTriples> const & components = search.GetConnectivityComponents();
+    if (components.size() > 1)
+      SearchComponentsAndJoin(components, result);
+    else if (search.IsStartTriplePartitionable())
+      SearchByPartitionedStartTriple(search, result);
+    else if (result != nullptr)
+      search(*result);
+    else
+      search();
+  }
+
+  void SetUpSearch(ScTemplateSearch & search) const
+  {
+    search.SetCallback(m_callback);
+    search.SetCallbackWithRequest(m_callbackWithRequest);
+    search.SetFilterCallback(m_filterCallback);
+    search.SetCheckCallback(m_checkCallback);
+  }
+
+  //! Runs task in `count` threads, each thread has own sc-memory context of the same user
+  void RunInThreads(
+      size_t count,
+      ScTemplateSearchSharedState & sharedState,
+      std::function<void(size_t, ScMemoryContext &)> const & task)
+  {
+    ScAddr const & userAddr = m_context.GetUser();
+
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      threads.emplace_back(
+          [i, &userAddr, &sharedState, &task]()
+          {
+            ScMemoryContext context(userAddr);
+            try
+            {
+              task(i, context);
+            }
+            catch (...)
+            {
+              sharedState.SaveException(std::current_exception());
+            }
+            context.Destroy();
+          });
+    }
+
+    for (std::thread & thread : threads)
+      thread.join();
+
+    if (sharedState.m_exception)
+      std::rethrow_exception(sharedState.m_exception);
+  }
+
+  void SearchByPartitionedStartTriple(ScTemplateSearch & search, ScTemplateSearchResult * result)
+  {
+    ScTemplateSearchSharedState sharedState;
+    search.CollectStartCandidates(sharedState.m_startCandidates);
+    if (sharedState.m_startCandidates.empty())
+    {
+      if (result != nullptr)
+        result->m_templateItemsNamesToReplacementItemsPositions =
+            m_template.m_templateItemsNamesToReplacementItemsPositions;
+      return;
+    }
+
+    std::vector<ScTemplateSearchResult> threadsResults(m_threadsCount);
+
+    RunInThreads(
+        m_threadsCount,
+        sharedState,
+        [&](size_t threadIdx, ScMemoryContext & context)
+        {
+          ScTemplateSearch threadSearch(search, context);
+          threadSearch.SetSharedState(&sharedState);
+          if (result != nullptr)
+            threadSearch(threadsResults[threadIdx]);
+          else
+            threadSearch();
+        });
+
+    if (result == nullptr)
+      return;
+
+    for (ScTemplateSearchResult & threadResult : threadsResults)
+    {
+      for (ScAddrVector & replacementConstruction : threadResult.m_replacementConstructions)
+        result->m_replacementConstructions.emplace_back(std::move(replacementConstruction));
+    }
+    result->m_templateItemsNamesToReplacementItemsPositions =
+        m_template.m_templateItemsNamesToReplacementItemsPositions;
+  }
+
+  /*!
+   * Searches constructions of connectivity components in threads and joins them.
+   * @note Constructions of all components are found before they are joined, so result callbacks are called and
+   * `ScTemplateSearchRequest::STOP` is handled only after searches of all components are finished.
+   */
+  void SearchComponentsAndJoin(
+      std::vector<ScTemplateSearch::ScTemplateTriples> const & components,
+      ScTemplateSearchResult * result)
+  {
+    // triples of each component are added to own sc-template in the same order as in the whole sc-template
+    std::vector<std::vector<size_t>> componentsTriples;
+    std::vector<ScTemplate> componentsTemplates(components.size());
+    for (size_t i = 0; i < components.size(); ++i)
+    {
+      std::vector<size_t> componentTriples{components[i].cbegin(), components[i].cend()};
+      std::sort(componentTriples.begin(), componentTriples.end());
+
+      for (size_t const tripleIdx : componentTriples)
+      {
+        auto const & items = m_template.m_templateTriples[tripleIdx]->GetValues();
+        componentsTemplates[i].Triple(items[0], items[1], items[2]);
+      }
+      componentsTriples.push_back(std::move(componentTriples));
+    }
+
+    ScTemplateSearchSharedState sharedState;
+    std::vector<ScTemplateSearchResult> componentsResults(components.size());
+    std::atomic<size_t> nextComponentIdx{0};
+
+    RunInThreads(
+        std::min(m_threadsCount, components.size()),
+        sharedState,
+        [&](size_t, ScMemoryContext & context)
+        {
+          for (size_t componentIdx = nextComponentIdx++; componentIdx < components.size();
+               componentIdx = nextComponentIdx++)
+          {
+            ScTemplateSearch componentSearch(componentsTemplates[componentIdx], context, ScAddr::Empty);
+            componentSearch.SetCheckCallback(m_checkCallback);
+            componentSearch(componentsResults[componentIdx]);
+
+            // if one of components isn't found, then the whole sc-template isn't found
+            if (componentsResults[componentIdx].IsEmpty())
+              break;
+          }
+        });
+
+    JoinComponentsResults(componentsTriples, componentsResults, result);
+  }
+
+  /*!
+   * Makes constructions of the whole sc-template from all combinations of constructions found for its connectivity
+   * components. Combinations where the same sc-connector is found for several triples are skipped.
+   */
+  void JoinComponentsResults(
+      std::vector<std::vector<size_t>> const & componentsTriples,
+      std::vector<ScTemplateSearchResult> const & componentsResults,
+      ScTemplateSearchResult * result)
+  {
+    if (result != nullptr)
+      result->m_templateItemsNamesToReplacementItemsPositions =
+        m_template.m_templateItemsNamesToReplacementItemsPositions;
+
+    for (ScTemplateSearchResult const & componentResult : componentsResults)
+    {
+      if (componentResult.IsEmpty())
+        return;
+    }
+
+    std::vector<size_t> combination(componentsResults.size(), 0);
+    ScAddrVector replacementConstruction(m_template.Size() * 3);
+    std::unordered_set<ScAddr, ScAddrHashFunc> connectors;
+    while (true)
+    {
+      connectors.clear();
+      bool isConnectorRepeated = false;
+      for (size_t i = 0; i < componentsResults.size(); ++i)
+      {
+        ScAddrVector const & componentConstruction = componentsResults[i].m_replacementConstructions[combination[i]];
+        std::vector<size_t> const & componentTriples = componentsTriples[i];
+        for (size_t j = 0; j < componentTriples.size(); ++j)
+        {
+          for (size_t k = 0; k < 3; ++k)
+            replacementConstruction[componentTriples[j] * 3 + k] = componentConstruction[j * 3 + k];
+
+          isConnectorRepeated |= !connectors.insert(componentConstruction[j * 3 + 1]).second;
+        }
+      }
+
+      if (!isConnectorRepeated && AppendJoinedConstruction(replacementConstruction, result))
+        return;
+
+      // go to next combination of components constructions
+      size_t i = 0;
+      for (; i < combination.size(); ++i)
+      {
+        if (++combination[i] < componentsResults[i].Size())
+          break;
+        combination[i] = 0;
+      }
+      if (i == combination.size())
+        return;
+    }
+  }
+
+  //! Returns true if search is requested to be stopped
+  bool AppendJoinedConstruction(ScAddrVector const & replacementConstruction, ScTemplateSearchResult * result)
+  {
+    ScTemplateResultItem const item{
+        &m_context, replacementConstruction, m_template.m_templateItemsNamesToReplacementItemsPositions};
+    if (m_filterCallback && !m_filterCallback(item))
+      return false;
+
+    if (m_callback)
+      m_callback(item);
+    else if (m_callbackWithRequest)
+    {
+      switch (m_callbackWithRequest(item))
+      {
+      case ScTemplateSearchRequest::STOP:
+        return true;
+      case ScTemplateSearchRequest::ERROR:
+        SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Requested error state during search");
+      default:
+        break;
+      }
+    }
+    else if (result != nullptr)
+      result->m_replacementConstructions.push_back(replacementConstruction);
+
+    return false;
+  }
+
+  ScTemplate & m_template;
+  ScMemoryContext & m_context;
+  size_t const m_threadsCount;
+
+  ScTemplateSearchResultCallback m_callback;
+  ScTemplateSearchResultCallbackWithRequest m_callbackWithRequest;
+  ScTemplateSearchResultFilterCallback m_filterCallback;
+  ScTemplateSearchResultCheckCallback m_checkCallback;
+};
+
 ScTemplate::Result ScTemplate::Search(ScMemoryContext & ctx, ScTemplateSearchResult & result) const
 {
+  if (m_searchThreadsCount > 1)
+  {
+    ScTemplateParallelSearch search(const_cast<ScTemplate &>(*this), ctx, m_searchThreadsCount);
+    return search(result);
+  }
+
   ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
   return search(result);
 }
@@ -1127,6 +1808,16 @@ void ScTemplate::Search(
     ScTemplateSearchResultFilterCallback const & filterCallback,
     ScTemplateSearchResultCheckCallback const & checkCallback) const
 {
+  if (m_searchThreadsCount > 1)
+  {
+    ScTemplateParallelSearch search(const_cast<ScTemplate &>(*this), ctx, m_searchThreadsCount);
+    search.SetCallback(callback);
+    search.SetFilterCallback(filterCallback);
+    search.SetCheckCallback(checkCallback);
+    search();
+    return;
+  }
+
   ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
   search.SetCallback(callback);
   search.SetFilterCallback(filterCallback);
@@ -1140,6 +1831,16 @@ void ScTemplate::Search(
     ScTemplateSearchResultFilterCallback const & filterCallback,
     ScTemplateSearchResultCheckCallback const & checkCallback) const
 {
+  if (m_searchThreadsCount > 1)
+  {
+    ScTemplateParallelSearch search(const_cast<ScTemplate &>(*this), ctx, m_searchThreadsCount);
+    search.SetCallbackWithRequest(callback);
+    search.SetFilterCallback(filterCallback);
+    search.SetCheckCallback(checkCallback);
+    search();
+    return;
+  }
+
   ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
   search.SetCallbackWithRequest(callback);
   search.SetFilterCallback(filterCallback);
@@ -0,0 +1,59 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Global allocation functions of allocations benchmarks executable are replaced to count allocations. This header
+// must be included by one translation unit only and mustn't be included by other benchmarks.
+
+inline std::atomic<size_t> & GetAllocationsCounter()
+{
+  static std::atomic<size_t> counter{0};
+  return counter;
+}
+
+inline size_t GetAllocationsCount()
+{
+  return GetAllocationsCounter().load(std::memory_order_relaxed);
+}
+
+void * operator new(std::size_t size)
+{
+  GetAllocationsCounter().fetch_add(1, std::memory_order_relaxed);
+  if (void * ptr = std::malloc(size == 0 ? 1 : size))
+    return ptr;
+
+  throw std::bad_alloc();
+}
+
+void * operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
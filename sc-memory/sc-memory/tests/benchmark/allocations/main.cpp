@@ -0,0 +1,35 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http:ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http:opensource.org/licenses/MIT)
+*/
+
+// Allocations are counted by replaced global allocation functions, so these benchmarks are built to own executable
+// and other benchmarks don't pay for counting.
+
+#include "benchmark/benchmark.h"
+
+#include "template_search_allocations.hpp"
+
+#include <algorithm>
+
+template <class BMType>
+void BM_TemplateAllocations(benchmark::State & state)
+{
+  BMType test;
+  test.Initialize(state.range(0));
+  for (auto t : state)
+  {
+    if (!test.Run())
+      state.SkipWithError("Empty result");
+  }
+  state.counters["allocations_per_result"] =
+      double(test.GetSearchAllocationsCount()) / double(std::max<size_t>(test.GetFoundResultsCount(), 1));
+  test.Shutdown();
+}
+
+BENCHMARK_TEMPLATE(BM_TemplateAllocations, TestTemplateSearchComplexAllocations)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(5)->Arg(50)->Arg(500);
+
+BENCHMARK_MAIN();
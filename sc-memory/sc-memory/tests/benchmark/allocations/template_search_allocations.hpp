@@ -0,0 +1,41 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "allocations_counter.hpp"
+#include "../units/template_search_complex.hpp"
+
+class TestTemplateSearchComplexAllocations : public TestTemplateSearchComplex
+{
+public:
+  bool Run()
+  {
+    size_t const allocationsCount = GetAllocationsCount();
+
+    ScTemplateSearchResult result;
+    bool status = m_ctx->SearchByTemplate(m_templ, result);
+
+    m_allocationsCount += GetAllocationsCount() - allocationsCount;
+    m_resultsCount += result.Size();
+
+    return status;
+  }
+
+  size_t GetSearchAllocationsCount() const
+  {
+    return m_allocationsCount;
+  }
+
+  size_t GetFoundResultsCount() const
+  {
+    return m_resultsCount;
+  }
+
+private:
+  size_t m_allocationsCount = 0;
+  size_t m_resultsCount = 0;
+};
@@ -13,6 +13,7 @@
 #include "units/memory_search_link_by_content.hpp"
 #include "units/memory_erase_diff_elements.hpp"
 #include "units/memory_erase_set_elements.hpp"
+#include "units/memory_emit_events.hpp"
 
 #include "units/memory_erase_elements.hpp"
 
@@ -21,6 +22,7 @@
 #include "units/template_search_complex.hpp"
 #include "units/template_search_smoke.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 
@@ -279,6 +281,46 @@ BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestGenerateConnector)
 ->Arg(kEdgeNodesIters3)
 ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+// Contention on sc-elements locks: all threads generate sc-connectors between few sc-nodes
+int constexpr kContendedEdgeIters = 1000000;
+int constexpr kContendedEdgeNodes = 10;
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestGenerateConnector)
+->Threads(1)
+->Iterations(kContendedEdgeIters / 1)
+->Arg(kContendedEdgeNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestGenerateConnector)
+->Threads(2)
+->Iterations(kContendedEdgeIters / 2)
+->Arg(kContendedEdgeNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestGenerateConnector)
+->Threads(4)
+->Iterations(kContendedEdgeIters / 4)
+->Arg(kContendedEdgeNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestGenerateConnector)
+->Threads(8)
+->Iterations(kContendedEdgeIters / 8)
+->Arg(kContendedEdgeNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestGenerateConnector)
+->Threads(16)
+->Iterations(kContendedEdgeIters / 16)
+->Arg(kContendedEdgeNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestGenerateConnector)
+->Threads(32)
+->Iterations(kContendedEdgeIters / 32)
+->Arg(kContendedEdgeNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
 int constexpr kLinkIters = 1000000;
 
 BENCHMARK_TEMPLATE(BM_MemoryThreaded, TestGenerateLink)
@@ -373,6 +415,18 @@ BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearch)
 ->Arg(kSetPower)
 ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearch)
+->Threads(16)
+->Iterations(kSetPower * 8 / 16)
+->Arg(kSetPower)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearch)
+->Threads(32)
+->Iterations(kSetPower * 8 / 32)
+->Arg(kSetPower)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
 BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestSearchLinkByContent)
 ->Threads(1)
 ->Iterations(kSetPower)
@@ -463,6 +517,27 @@ BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEraseSetElements)
 ->Arg(kSetPower)
 ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+int constexpr kEmitEventsIters = 100000;
+int constexpr kEmitEventsSubscribers = 1000;
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEmitEventsToManySubscribers)
+->Threads(1)
+->Iterations(kEmitEventsIters)
+->Arg(kEmitEventsSubscribers)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEmitEventsToManySubscribers)
+->Threads(4)
+->Iterations(kEmitEventsIters / 4)
+->Arg(kEmitEventsSubscribers)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEmitEventsToManySubscribers)
+->Threads(8)
+->Iterations(kEmitEventsIters / 8)
+->Arg(kEmitEventsSubscribers)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
 // ------------------------------------
 template <class BMType>
 void BM_Memory(benchmark::State & state)
@@ -505,6 +580,11 @@ BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGenerateConnector)
 ->Arg(1000)
 ->Iterations(5000000);
 
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEmitEventsToManySubscribers)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1)->Arg(100)->Arg(1000)
+->Iterations(100000);
+
 BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEraseElements)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(10)->Arg(100)->Arg(1000)
@@ -0,0 +1,61 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_agent_context.hpp"
+#include "sc-memory/sc_event.hpp"
+#include "sc-memory/sc_event_subscription.hpp"
+
+// Hub sc-element with many subscribers: every generated sc-arc looks up sc-event subscriptions of the hub, and only
+// one of them is triggered by it
+class TestEmitEventsToManySubscribers : public TestMemory
+{
+public:
+  void Run()
+  {
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_hubAddr, m_nodes[random() % m_nodes.size()]);
+  }
+
+  void Setup(size_t subscribersNum) override
+  {
+    m_hubAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+    m_nodes.clear();
+    for (size_t i = 0; i < 100; ++i)
+      m_nodes.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+
+    m_agentCtx = std::make_unique<ScAgentContext>();
+    m_subscriptions.clear();
+    m_subscriptions.reserve(subscribersNum);
+    for (size_t i = 1; i < subscribersNum; ++i)
+      m_subscriptions.push_back(
+          m_agentCtx->CreateElementaryEventSubscription<ScEventBeforeEraseOutgoingArc<ScType::ConstPermPosArc>>(
+              m_hubAddr, [](ScEventBeforeEraseOutgoingArc<ScType::ConstPermPosArc> const &) {}));
+    m_subscriptions.push_back(
+        m_agentCtx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+            m_hubAddr, [](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &) {}));
+  }
+
+  void Teardown() override
+  {
+    m_subscriptions.clear();
+    m_agentCtx.reset();
+  }
+
+private:
+  static ScAddr m_hubAddr;
+  static ScAddrVector m_nodes;
+  static std::unique_ptr<ScAgentContext> m_agentCtx;
+  static std::vector<std::shared_ptr<ScEventSubscription>> m_subscriptions;
+};
+
+ScAddr TestEmitEventsToManySubscribers::m_hubAddr;
+ScAddrVector TestEmitEventsToManySubscribers::m_nodes;
+std::unique_ptr<ScAgentContext> TestEmitEventsToManySubscribers::m_agentCtx;
+std::vector<std::shared_ptr<ScEventSubscription>> TestEmitEventsToManySubscribers::m_subscriptions;
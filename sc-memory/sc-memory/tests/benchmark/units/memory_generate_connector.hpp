@@ -21,6 +21,7 @@ public:
 
   void Setup(size_t elementsNum) override
   {
+    m_nodes.clear();
     m_nodes.reserve(elementsNum);
     for (size_t i = 0; i < elementsNum; ++i)
       m_nodes.push_back(m_ctx->GenerateNode(ScType::ConstNode));
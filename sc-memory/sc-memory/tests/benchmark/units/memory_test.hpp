@@ -29,6 +29,7 @@ public:
 
   void Shutdown()
   {
+    Teardown();
     m_ctx.reset();
 
     ScMemory::Shutdown(false);
@@ -51,6 +52,8 @@ public:
 
   virtual void Setup(size_t objectsNum) {}
 
+  virtual void Teardown() {}
+
 protected:
   std::unique_ptr<ScMemoryContext> m_ctx {};
 };
@@ -7,6 +7,8 @@
 #include <sc-memory/test/sc_test.hpp>
 
 #include <filesystem>
+#include <mutex>
+#include <thread>
 
 #include <sc-memory/sc_memory.hpp>
 
@@ -14,6 +16,7 @@ extern "C"
 {
 #include <sc-store/sc_storage.h>
 #include <sc-store/sc_storage_private.h>
+#include <sc-store/sc_segment.h>
 }
 
 TEST_F(ScMemoryTest, Elements)
@@ -300,6 +303,90 @@ TEST_F(ScMemoryTest, GenerateConnectors)
   EXPECT_TRUE(ctx.CheckConnector(linkAddr, nodeAddr, ScType::ConstCommonEdge));
 }
 
+TEST_F(ScMemoryTest, GenerateElementsByBatches)
+{
+  ScMemoryContext ctx;
+
+  ScAddrVector const nodeAddrs = ctx.GenerateNodes({ScType::ConstNodeClass, ScType::ConstNode, ScType::ConstNode});
+  EXPECT_EQ(nodeAddrs.size(), 3u);
+  EXPECT_EQ(ctx.GetElementType(nodeAddrs[0]), ScType::ConstNodeClass);
+  EXPECT_EQ(ctx.GetElementType(nodeAddrs[1]), ScType::ConstNode);
+
+  ScAddrVector const linkAddrs = ctx.GenerateLinks({ScType::ConstNodeLink, ScType::ConstNodeLinkClass});
+  EXPECT_EQ(linkAddrs.size(), 2u);
+  EXPECT_EQ(ctx.GetElementType(linkAddrs[1]), ScType::ConstNodeLinkClass);
+
+  ScAddr const classAddr = nodeAddrs[0];
+  ScAddrVector const connectorAddrs = ctx.GenerateConnectors(
+      {ScType::ConstPermPosArc, ScType::ConstPermPosArc, ScType::ConstPermPosArc, ScType::ConstCommonEdge},
+      {classAddr, classAddr, classAddr, nodeAddrs[1]},
+      {nodeAddrs[1], nodeAddrs[2], linkAddrs[0], linkAddrs[1]});
+  EXPECT_EQ(connectorAddrs.size(), 4u);
+
+  EXPECT_EQ(ctx.GetElementEdgesAndOutgoingArcsCount(classAddr), 3u);
+  EXPECT_EQ(ctx.GetArcSourceElement(connectorAddrs[1]), classAddr);
+  EXPECT_EQ(ctx.GetArcTargetElement(connectorAddrs[1]), nodeAddrs[2]);
+  EXPECT_TRUE(ctx.CheckConnector(classAddr, linkAddrs[0], ScType::ConstPermPosArc));
+  EXPECT_TRUE(ctx.CheckConnector(linkAddrs[1], nodeAddrs[1], ScType::ConstCommonEdge));
+
+  EXPECT_TRUE(ctx.GenerateConnectors({}, {}, {}).empty());
+}
+
+TEST_F(ScMemoryTest, GenerateConnectorsByBatchBetweenManyElements)
+{
+  ScMemoryContext ctx;
+
+  size_t const nodesCount = 1000;
+  ScAddrVector const sourceNodeAddrs = ctx.GenerateNodes(std::vector<ScType>(nodesCount, ScType::ConstNode));
+  ScAddrVector const targetNodeAddrs = ctx.GenerateNodes(std::vector<ScType>(nodesCount, ScType::ConstNode));
+
+  // each source node is connected with each target node in the same position and with the first target node
+  std::vector<ScType> connectorTypes;
+  ScAddrVector sourceAddrs;
+  ScAddrVector targetAddrs;
+  for (size_t i = 0; i < nodesCount; ++i)
+  {
+    connectorTypes.insert(connectorTypes.end(), {ScType::ConstPermPosArc, ScType::ConstTempPosArc});
+    sourceAddrs.insert(sourceAddrs.end(), {sourceNodeAddrs[i], sourceNodeAddrs[i]});
+    targetAddrs.insert(targetAddrs.end(), {targetNodeAddrs[i], targetNodeAddrs[0]});
+  }
+
+  ScAddrVector const connectorAddrs = ctx.GenerateConnectors(connectorTypes, sourceAddrs, targetAddrs);
+  EXPECT_EQ(connectorAddrs.size(), 2 * nodesCount);
+
+  for (size_t i = 0; i < connectorAddrs.size(); ++i)
+  {
+    EXPECT_EQ(ctx.GetElementType(connectorAddrs[i]), connectorTypes[i]);
+    EXPECT_EQ(ctx.GetArcSourceElement(connectorAddrs[i]), sourceAddrs[i]);
+    EXPECT_EQ(ctx.GetArcTargetElement(connectorAddrs[i]), targetAddrs[i]);
+  }
+
+  EXPECT_EQ(ctx.GetElementEdgesAndIncomingArcsCount(targetNodeAddrs[0]), nodesCount + 1);
+  EXPECT_EQ(ctx.GetElementEdgesAndIncomingArcsCount(targetNodeAddrs[1]), 1u);
+  EXPECT_EQ(ctx.GetElementEdgesAndOutgoingArcsCount(sourceNodeAddrs[1]), 2u);
+}
+
+TEST_F(ScMemoryTest, GenerateInvalidElementsByBatches)
+{
+  ScMemoryContext ctx;
+
+  EXPECT_THROW(ctx.GenerateNodes({ScType::ConstNode, ScType::ConstPermPosArc}), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ctx.GenerateLinks({ScType::ConstNode}), utils::ExceptionInvalidParams);
+
+  ScAddr const nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+  EXPECT_THROW(
+      ctx.GenerateConnectors({ScType::ConstPermPosArc}, {nodeAddr, nodeAddr}, {nodeAddr}),
+      utils::ExceptionInvalidParams);
+  EXPECT_THROW(ctx.GenerateConnectors({ScType::ConstNode}, {nodeAddr}, {nodeAddr}), utils::ExceptionInvalidParams);
+  EXPECT_THROW(
+      ctx.GenerateConnectors(
+          {ScType::ConstPermPosArc, ScType::ConstPermPosArc}, {nodeAddr, nodeAddr}, {nodeAddr, ScAddr::Empty}),
+      utils::ExceptionInvalidParams);
+
+  // valid sc-connectors from batch with invalid ones are generated
+  EXPECT_EQ(ctx.GetElementEdgesAndOutgoingArcsCount(nodeAddr), 1u);
+}
+
 TEST_F(ScMemoryTest, EraseConnectorsBetweenTwoNodesByOneIterator)
 {
   ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
@@ -452,6 +539,147 @@ TEST_F(ScMemoryTest, EraseEdgeTargetsBetweenSomeNodesByOneIterator)
   EXPECT_FALSE(m_ctx->IsElement(nodeAddr2));
 }
 
+TEST_F(ScMemoryTest, EraseConnectorsLockedBySameMonitors)
+{
+  ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+
+  // sc-connectors and their sc-elements take more offsets than monitors of sc-segment, so some of them are locked
+  // by the same monitors
+  size_t const connectorsCount = SC_SEGMENT_ELEMENTS_MONITORS_COUNT * 2;
+  for (size_t i = 0; i < connectorsCount; ++i)
+  {
+    ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, classAddr);
+  }
+
+  size_t i = 0;
+  ScIterator3Ptr const it = m_ctx->CreateIterator3(classAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+  while (it->Next())
+  {
+    EXPECT_TRUE(m_ctx->EraseElement(it->Get(1)));
+    ++i;
+  }
+
+  EXPECT_EQ(i, connectorsCount);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(classAddr), 0u);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndIncomingArcsCount(classAddr), connectorsCount);
+}
+
+TEST_F(ScMemoryTest, IterateConnectorsWhileTheyAreErasedByThreads)
+{
+  ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+
+  // iterators hold monitor of sc-class while they acquire monitors of its sc-connectors, writers acquire the same
+  // monitors in order of their identifiers, so iterators mustn't wait for them out of this order
+  size_t const threadsCount = 4;
+  size_t const iterationsCount = 2000;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadsCount; ++i)
+  {
+    threads.emplace_back(
+        [&]()
+        {
+          ScMemoryContext ctx;
+          for (size_t j = 0; j < iterationsCount; ++j)
+          {
+            ScAddr const nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+            ScAddr const arcAddr = ctx.GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr);
+            ScAddr const edgeAddr = ctx.GenerateConnector(ScType::ConstCommonEdge, nodeAddr, classAddr);
+            EXPECT_TRUE(ctx.EraseElement(arcAddr));
+            EXPECT_TRUE(ctx.EraseElement(edgeAddr));
+          }
+        });
+    threads.emplace_back(
+        [&]()
+        {
+          ScMemoryContext ctx;
+          for (size_t j = 0; j < iterationsCount; ++j)
+          {
+            ScIterator3Ptr const outgoingIt = ctx.CreateIterator3(classAddr, ScType::Unknown, ScType::ConstNode);
+            while (outgoingIt->Next())
+              EXPECT_TRUE(outgoingIt->Get(1).IsValid());
+
+            ScIterator3Ptr const incomingIt = ctx.CreateIterator3(ScType::ConstNode, ScType::Unknown, classAddr);
+            while (incomingIt->Next())
+              EXPECT_TRUE(incomingIt->Get(1).IsValid());
+          }
+        });
+  }
+
+  for (auto & thread : threads)
+    thread.join();
+
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(classAddr), 0u);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndIncomingArcsCount(classAddr), 0u);
+}
+
+TEST_F(ScMemoryTest, GenerateNodesByThreads)
+{
+  size_t const threadsCount = 8;
+  size_t const nodesCount = SC_STORAGE_THREAD_CACHE_OFFSETS_COUNT * 10 + 1;
+
+  std::mutex mutex;
+  ScAddrUnorderedSet nodes;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadsCount; ++i)
+  {
+    threads.emplace_back(
+        [&]()
+        {
+          ScMemoryContext ctx;
+          for (size_t j = 0; j < nodesCount; ++j)
+          {
+            ScAddr const nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+            std::lock_guard<std::mutex> lock(mutex);
+            nodes.insert(nodeAddr);
+          }
+        });
+  }
+
+  for (auto & thread : threads)
+    thread.join();
+
+  EXPECT_EQ(nodes.size(), threadsCount * nodesCount);
+  for (ScAddr const & nodeAddr : nodes)
+    EXPECT_TRUE(m_ctx->IsElement(nodeAddr));
+}
+
+TEST(SmallScMemoryTest, GenerateNodesByExitedThreads)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.max_loaded_segments = 1;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+
+  // offsets cached by thread are released on its exit, so they aren't lost if thread doesn't end its process
+  size_t const threadsCount = 2 * SC_SEGMENT_ELEMENTS_COUNT / SC_STORAGE_THREAD_CACHE_OFFSETS_COUNT;
+  ScMemoryContext ctx;
+  for (size_t i = 0; i < threadsCount; ++i)
+  {
+    ScAddr nodeAddr;
+    std::thread thread(
+        [&]()
+        {
+          nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+        });
+    thread.join();
+
+    EXPECT_TRUE(ctx.IsElement(nodeAddr));
+  }
+
+  ctx.Destroy();
+  ScMemory::LogMute();
+  ScMemory::Shutdown();
+  ScMemory::LogUnmute();
+}
+
 TEST(SmallScMemoryTest, FullMemory)
 {
   sc_memory_params params;
@@ -711,21 +939,35 @@ TEST(ScMemoryDumper, DumpMemory)
 
   ScMemoryContext ctx;
   ctx.Save();
-  ctx.Destroy();
 
+  // sc-memory is dumped by period, if it changed since the last dump
   auto previousScMemorySaveTime = std::filesystem::last_write_time("repo/segments.scdb");
+  auto previousDictionarySaveTime = std::filesystem::last_write_time("repo/string_offsets_link_hashes.scdb");
+  ctx.GenerateNode(ScType::ConstNode);
   sleep(10);
   auto currentScMemorySaveTime = std::filesystem::last_write_time("repo/segments.scdb");
+  auto currentDictionarySaveTime = std::filesystem::last_write_time("repo/string_offsets_link_hashes.scdb");
   EXPECT_NE(previousScMemorySaveTime, currentScMemorySaveTime);
+  EXPECT_EQ(previousDictionarySaveTime, currentDictionarySaveTime);
   previousScMemorySaveTime = currentScMemorySaveTime;
+
+  ScAddr const linkAddr = ctx.GenerateLink();
+  ctx.SetLinkContent(linkAddr, "content");
   sleep(10);
   currentScMemorySaveTime = std::filesystem::last_write_time("repo/segments.scdb");
+  currentDictionarySaveTime = std::filesystem::last_write_time("repo/string_offsets_link_hashes.scdb");
   EXPECT_NE(previousScMemorySaveTime, currentScMemorySaveTime);
+  EXPECT_NE(previousDictionarySaveTime, currentDictionarySaveTime);
   previousScMemorySaveTime = currentScMemorySaveTime;
+  previousDictionarySaveTime = currentDictionarySaveTime;
+
   sleep(10);
   currentScMemorySaveTime = std::filesystem::last_write_time("repo/segments.scdb");
-  EXPECT_NE(previousScMemorySaveTime, currentScMemorySaveTime);
+  currentDictionarySaveTime = std::filesystem::last_write_time("repo/string_offsets_link_hashes.scdb");
+  EXPECT_EQ(previousScMemorySaveTime, currentScMemorySaveTime);
+  EXPECT_EQ(previousDictionarySaveTime, currentDictionarySaveTime);
 
+  ctx.Destroy();
   ScMemory::LogMute();
   ScMemory::Shutdown();
   ScMemory::LogUnmute();
@@ -764,3 +1006,66 @@ TEST(ScMemoryDumper, DumpMemoryStatistics)
   ScMemory::Shutdown();
   ScMemory::LogUnmute();
 }
+
+TEST(ScMemoryWriteAheadLog, RestoreNotSavedMemory)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+
+  params.wal = SC_TRUE;
+  params.wal_sync_period = 0;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+
+  ScMemoryContext ctx;
+  ctx.Save();
+
+  ScAddr const nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+  ScAddr const linkAddr = ctx.GenerateLink(ScType::ConstNodeLink);
+  EXPECT_TRUE(ctx.SetLinkContent(linkAddr, "not saved content"));
+  // big content is written into log by chunks
+  std::string const bigContent(0x30000, 'c');
+  ScAddr const bigLinkAddr = ctx.GenerateLink(ScType::ConstNodeLink);
+  EXPECT_TRUE(ctx.SetLinkContent(bigLinkAddr, bigContent));
+  ScAddr const arcAddr = ctx.GenerateConnector(ScType::ConstPermPosArc, nodeAddr, linkAddr);
+  ScAddr const erasedNodeAddr = ctx.GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(ctx.EraseElement(erasedNodeAddr));
+  ctx.Destroy();
+
+  ScMemory::LogMute();
+  ScMemory::Shutdown(false);
+  ScMemory::LogUnmute();
+
+  params.clear = SC_FALSE;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+
+  ScMemoryContext restoredCtx;
+  EXPECT_TRUE(restoredCtx.IsElement(nodeAddr));
+  EXPECT_TRUE(restoredCtx.IsElement(linkAddr));
+  EXPECT_TRUE(restoredCtx.IsElement(arcAddr));
+  EXPECT_FALSE(restoredCtx.IsElement(erasedNodeAddr));
+
+  auto const [sourceAddr, targetAddr] = restoredCtx.GetConnectorIncidentElements(arcAddr);
+  EXPECT_EQ(sourceAddr, nodeAddr);
+  EXPECT_EQ(targetAddr, linkAddr);
+
+  std::string content;
+  EXPECT_TRUE(restoredCtx.GetLinkContent(linkAddr, content));
+  EXPECT_EQ(content, "not saved content");
+  EXPECT_TRUE(restoredCtx.GetLinkContent(bigLinkAddr, content));
+  EXPECT_EQ(content, bigContent);
+  restoredCtx.Destroy();
+
+  ScMemory::LogMute();
+  ScMemory::Shutdown(false);
+  ScMemory::LogUnmute();
+}
@@ -12,7 +12,13 @@
 
 #include "event_test_utils.hpp"
 
+extern "C"
+{
+#include <sc-store/sc_storage_private.h>
+}
+
 #include <atomic>
+#include <set>
 #include <thread>
 #include <mutex>
 
@@ -87,6 +93,134 @@ TEST(ScEventQueueTest, EventsQueueDestroy)
   ScMemory::Shutdown();
 }
 
+TEST(ScEventQueueTest, EventsQueueOverflowAndStatistics)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.max_events_and_agents_threads = 2;
+  params.events_queue_size = 16;
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+
+  ScAddr const node = ctx.GenerateNode(ScType::ConstNode);
+
+  size_t const count = 1000;
+  std::atomic<size_t> processedCount = 0;
+  std::atomic<bool> isGenerated = false;
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          node,
+          [&processedCount, &isGenerated](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            // sc-events aren't processed until all of them are emitted, so queue overflows
+            while (!isGenerated)
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++processedCount;
+          });
+
+  for (size_t i = 0; i < count; ++i)
+    ctx.GenerateConnector(ScType::ConstPermPosArc, node, ctx.GenerateNode(ScType::ConstNode));
+  isGenerated = true;
+
+  ScTimer timer(10);
+  while (processedCount < count && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(processedCount.load(), count);
+
+  sc_event_emission_statistics statistics;
+  sc_event_emission_manager_get_statistics(sc_storage_get_event_emission_manager(), &statistics);
+  EXPECT_GE(statistics.processed_events_count, count);
+  EXPECT_GE(statistics.batches_count, 1u);
+  EXPECT_LE(statistics.batches_count, statistics.processed_events_count);
+  EXPECT_GE(statistics.max_queue_depth, 1u);
+  EXPECT_GT(statistics.overflowed_events_count, 0u);
+  EXPECT_GE(statistics.max_wait_time, statistics.total_wait_time / statistics.processed_events_count);
+
+  eventSubscription.reset();
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
+TEST(ScEventQueueTest, EventsBatchIsHandedBackAfterLongEvents)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.limit_max_threads_by_max_physical_cores = SC_FALSE;
+  params.max_events_and_agents_threads = 2;
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+
+  ScAddr const node = ctx.GenerateNode(ScType::ConstNode);
+  ScAddr const blockingNode = ctx.GenerateNode(ScType::ConstNode);
+  ScAddr const longNode = ctx.GenerateNode(ScType::ConstNode);
+
+  size_t const count = 64;
+  std::atomic<size_t> blockedCount = 0;
+  std::atomic<bool> isGenerated = false;
+  std::atomic<size_t> processedCount = 0;
+  std::mutex mutex;
+  std::set<std::thread::id> longEventsThreads;
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          node,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const & event)
+          {
+            if (event.GetArcTargetElement() == blockingNode)
+            {
+              // both worker threads wait, so the next sc-events are taken by them in two batches
+              ++blockedCount;
+              while (!isGenerated)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+              return;
+            }
+
+            if (event.GetArcTargetElement() == longNode)
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(20));
+              std::lock_guard<std::mutex> lock(mutex);
+              longEventsThreads.insert(std::this_thread::get_id());
+            }
+            ++processedCount;
+          });
+
+  for (size_t i = 0; i < 2; ++i)
+  {
+    ctx.GenerateConnector(ScType::ConstPermPosArc, node, blockingNode);
+    ScTimer timer(1);
+    while (blockedCount <= i && !timer.IsTimeOut())
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(blockedCount.load(), 2u);
+
+  // the first batch consists of long sc-events, the second one is processed fast
+  for (size_t i = 0; i < count / 2; ++i)
+    ctx.GenerateConnector(ScType::ConstPermPosArc, node, longNode);
+  for (size_t i = 0; i < count / 2; ++i)
+    ctx.GenerateConnector(ScType::ConstPermPosArc, node, ctx.GenerateNode(ScType::ConstNode));
+  isGenerated = true;
+
+  ScTimer timer(10);
+  while (processedCount < count && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(processedCount.load(), count);
+  // the rest of batch with long sc-events is handed back to the other worker thread, when it sleeps
+  EXPECT_EQ(longEventsThreads.size(), 2u);
+
+  eventSubscription.reset();
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
 double const kTestTimeout = 0.1;
 
 template <ScType const & subscriptionConnectorType, ScType const & eventConnectorType>
@@ -1263,6 +1397,95 @@ TEST_F(ScEventTest, PendEvents)
   EXPECT_EQ(passedCount, el_num);
 }
 
+TEST_F(ScEventTest, PendManyEventsInSeveralGuards)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_uint eventsCount(0);
+  auto eventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&eventsCount](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            eventsCount.fetch_add(1);
+          });
+
+  // Pending events don't fit into one chunk, and the second guard reuses chunks of the first one
+  size_t const arcsCount = 5000;
+  for (size_t guardsCount = 1; guardsCount <= 2; ++guardsCount)
+  {
+    {
+      ScMemoryContextEventsPendingGuard guard(*m_ctx);
+      for (size_t i = 0; i < arcsCount; ++i)
+        m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      EXPECT_EQ(eventsCount.load(), (guardsCount - 1) * arcsCount);
+    }
+
+    while (eventsCount.load() < guardsCount * arcsCount)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_EQ(eventsCount.load(), guardsCount * arcsCount);
+  }
+}
+
+TEST_F(ScEventTest, ManySubscriptionsOfDifferentEventsOnOneElement)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_uint permArcEventsCount(0);
+  std::atomic_uint tempArcEventsCount(0);
+  std::atomic_uint eraseArcEventsCount(0);
+  std::vector<std::shared_ptr<ScEventSubscription>> permArcSubscriptions;
+  std::vector<std::shared_ptr<ScEventSubscription>> otherSubscriptions;
+
+  // Subscriptions of different sc-events and sc-connector types are interleaved on one sc-element
+  size_t const subscriptionsCount = 100;
+  for (size_t i = 0; i < subscriptionsCount; ++i)
+  {
+    permArcSubscriptions.push_back(
+        m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+            nodeAddr,
+            [&permArcEventsCount](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+            {
+              permArcEventsCount.fetch_add(1);
+            }));
+    otherSubscriptions.push_back(
+        m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstTempPosArc>>(
+            nodeAddr,
+            [&tempArcEventsCount](ScEventAfterGenerateOutgoingArc<ScType::ConstTempPosArc> const &)
+            {
+              tempArcEventsCount.fetch_add(1);
+            }));
+    otherSubscriptions.push_back(
+        m_ctx->CreateElementaryEventSubscription<ScEventBeforeEraseOutgoingArc<ScType::ConstPermPosArc>>(
+            nodeAddr,
+            [&eraseArcEventsCount](ScEventBeforeEraseOutgoingArc<ScType::ConstPermPosArc> const &)
+            {
+              eraseArcEventsCount.fetch_add(1);
+            }));
+  }
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(kTestTimeout * 50);
+  while (permArcEventsCount.load() < subscriptionsCount && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(permArcEventsCount.load(), subscriptionsCount);
+
+  // Destroyed subscriptions aren't triggered, the others are still triggered
+  permArcSubscriptions.resize(subscriptionsCount / 2);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  while (permArcEventsCount.load() < subscriptionsCount * 3 / 2 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(permArcEventsCount.load(), subscriptionsCount * 3 / 2);
+  EXPECT_EQ(tempArcEventsCount.load(), 0u);
+  EXPECT_EQ(eraseArcEventsCount.load(), 0u);
+}
+
 TEST_F(ScEventTest, BlockEventsAndNotEmitAfter)
 {
   ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
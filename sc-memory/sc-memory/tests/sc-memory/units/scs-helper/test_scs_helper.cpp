@@ -696,6 +696,50 @@ TEST_F(SCsHelperTest, GenerateStructureAppendToStructure)
   );
 }
 
+TEST_F(SCsHelperTest, GenerateConnectorsInSourceOrder)
+{
+  SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
+
+  // targets are generated in reverse order of sc-connectors from source to them
+  size_t const targetsCount = 10;
+  std::string data;
+  for (size_t i = targetsCount; i > 0; --i)
+    data += "concept_targets -> target_" + std::to_string(i - 1) + ";;";
+  for (size_t i = 0; i < targetsCount; ++i)
+    data += "source -> target_" + std::to_string(i) + ";;";
+  EXPECT_TRUE(helper.GenerateBySCsText(data));
+
+  // sc-connectors are iterated from the last generated one as if they were generated one by one
+  ScAddrVector targetAddrs;
+  ScIterator3Ptr const it3 = m_ctx->CreateIterator3(
+      m_ctx->SearchElementBySystemIdentifier("source"), ScType::ConstPermPosArc, ScType::ConstNode);
+  while (it3->Next())
+    targetAddrs.push_back(it3->Get(2));
+
+  ASSERT_EQ(targetAddrs.size(), targetsCount);
+  for (size_t i = 0; i < targetsCount; ++i)
+    EXPECT_EQ(targetAddrs[i], m_ctx->SearchElementBySystemIdentifier("target_" + std::to_string(targetsCount - i - 1)));
+}
+
+TEST_F(SCsHelperTest, GenerateConnectorsInSourceOrderAppendToStructure)
+{
+  SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
+
+  ScAddr const outputStructure = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  EXPECT_TRUE(helper.GenerateBySCsText("element -> target;; source -> element;;", outputStructure));
+
+  // sc-arc from output structure to sc-element is generated after sc-connector of the first triple
+  ScAddrVector sourceAddrs;
+  ScIterator3Ptr const it3 = m_ctx->CreateIterator3(
+      ScType::Unknown, ScType::ConstPermPosArc, m_ctx->SearchElementBySystemIdentifier("element"));
+  while (it3->Next())
+    sourceAddrs.push_back(it3->Get(0));
+
+  ASSERT_EQ(sourceAddrs.size(), 2u);
+  EXPECT_EQ(sourceAddrs[0], m_ctx->SearchElementBySystemIdentifier("source"));
+  EXPECT_EQ(sourceAddrs[1], outputStructure);
+}
+
 TEST_F(SCsHelperTest, FindTriplesSmoke)
 {
   SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
@@ -6,6 +6,7 @@
 
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_structure.hpp>
+#include <sc-memory/sc_template_cache.hpp>
 
 #include "template_test_utils.hpp"
 
@@ -150,3 +151,126 @@ TEST_F(ScTemplateBuildTest, GenWithParams)
 
   EXPECT_FALSE(searchResult[0].Has(ScAddr::Empty));
 }
+
+TEST_F(ScTemplateBuildTest, BuildByTemplateCacheWithParams)
+{
+  /**
+   * class _-> _node;;
+   */
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & varNodeAddr = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const & varArcAddr = m_ctx->GenerateConnector(ScType::VarPermPosArc, classAddr, varNodeAddr);
+
+  ScStructure structure = m_ctx->GenerateStructure();
+  structure << classAddr << varNodeAddr << varArcAddr;
+
+  ScAddr const & nodeAddr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr1);
+  ScAddr const & nodeAddr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr2);
+
+  EXPECT_FALSE(ScTemplateCache::HasTemplate(structure));
+  {
+    ScTemplate templ;
+    ScTemplateCache::Build(*m_ctx, templ, structure);
+    EXPECT_TRUE(ScTemplateCache::HasTemplate(structure));
+
+    ScTemplateSearchResult searchResult;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+    EXPECT_EQ(searchResult.Size(), 2u);
+  }
+  {
+    ScTemplateParams params;
+    params.Add(varNodeAddr, nodeAddr2);
+
+    ScTemplate templ;
+    ScTemplateCache::Build(*m_ctx, templ, structure, params);
+
+    ScTemplateSearchResult searchResult;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+    EXPECT_EQ(searchResult.Size(), 1u);
+    EXPECT_EQ(searchResult[0][2], nodeAddr2);
+  }
+
+  ScTemplateCache::Invalidate(structure);
+  EXPECT_FALSE(ScTemplateCache::HasTemplate(structure));
+}
+
+TEST_F(ScTemplateBuildTest, BuildByTemplateCacheAfterStructureChanging)
+{
+  /**
+   * class _-> _node;;
+   */
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & varNodeAddr = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const & varArcAddr = m_ctx->GenerateConnector(ScType::VarPermPosArc, classAddr, varNodeAddr);
+
+  ScStructure structure = m_ctx->GenerateStructure();
+  structure << classAddr << varNodeAddr << varArcAddr;
+
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr);
+
+  {
+    ScTemplate templ;
+    ScTemplateCache::Build(*m_ctx, templ, structure);
+    ScTemplateSearchResult searchResult;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  }
+
+  /**
+   * class _-> _node;;
+   * _node _-> _other_node;;
+   */
+  ScAddr const & varOtherNodeAddr = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const & varOtherArcAddr = m_ctx->GenerateConnector(ScType::VarPermPosArc, varNodeAddr, varOtherNodeAddr);
+  ScAddr const & structureArcAddr1 = m_ctx->GenerateConnector(ScType::ConstPermPosArc, structure, varOtherNodeAddr);
+  ScAddr const & structureArcAddr2 = m_ctx->GenerateConnector(ScType::ConstPermPosArc, structure, varOtherArcAddr);
+
+  // changed sc-structure is seen by the next build without waiting for sc-events
+  {
+    ScTemplate templ;
+    ScTemplateCache::Build(*m_ctx, templ, structure);
+    EXPECT_EQ(templ.Size(), 2u);
+
+    ScTemplateSearchResult searchResult;
+    EXPECT_FALSE(m_ctx->SearchByTemplate(templ, searchResult));
+  }
+
+  m_ctx->EraseElement(structureArcAddr1);
+  m_ctx->EraseElement(structureArcAddr2);
+  m_ctx->EraseElement(varOtherArcAddr);
+
+  {
+    ScTemplate templ;
+    ScTemplateCache::Build(*m_ctx, templ, structure);
+    EXPECT_EQ(templ.Size(), 1u);
+
+    ScTemplateSearchResult searchResult;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  }
+
+  // sc-element of sc-structure is replaced by other one, sc-address of erased sc-arc can be reused
+  ScIterator3Ptr const it = m_ctx->CreateIterator3(structure, ScType::ConstPermPosArc, varArcAddr);
+  EXPECT_TRUE(it->Next());
+  m_ctx->EraseElement(it->Get(1));
+  ScAddr const & varCommonArcAddr = m_ctx->GenerateConnector(ScType::VarCommonArc, classAddr, varNodeAddr);
+  structure << varCommonArcAddr;
+
+  {
+    ScTemplate templ;
+    ScTemplateCache::Build(*m_ctx, templ, structure);
+    EXPECT_EQ(templ.Size(), 1u);
+
+    ScTemplateSearchResult searchResult;
+    EXPECT_FALSE(m_ctx->SearchByTemplate(templ, searchResult));
+  }
+
+  m_ctx->EraseElement(structure);
+  EXPECT_THROW(
+      {
+        ScTemplate templ;
+        ScTemplateCache::Build(*m_ctx, templ, structure);
+      },
+      utils::ExceptionInvalidParams);
+}
@@ -4,6 +4,9 @@
  * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
  */
 
+#include <atomic>
+#include <thread>
+
 #include <sc-memory/sc_link.hpp>
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_structure.hpp>
@@ -475,3 +478,200 @@ TEST_F(ScTemplateSearchTest, StructureElements)
   EXPECT_EQ(searchResult[0]["_target"], targetAddr);
   EXPECT_EQ(searchResult[0]["_relation"], relationAddr);
 }
+
+TEST_F(ScTemplateSearchTest, SearchFromHubAndRareClasses)
+{
+  ScAddr const & hubClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & rareClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::ConstNodeNonRole);
+
+  size_t const hubMembersCount = 500;
+  ScAddr rareMemberAddr;
+  for (size_t i = 0; i < hubMembersCount; ++i)
+  {
+    ScAddr const & memberAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, memberAddr, hubClassAddr);
+    if (i == hubMembersCount / 2)
+    {
+      rareMemberAddr = memberAddr;
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, rareClassAddr, memberAddr);
+
+      ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+      ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstCommonArc, memberAddr, linkAddr);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, relationAddr, arcAddr);
+    }
+  }
+
+  // a_a_f triple with hub class has priority over f_a_a triples, but its iterator passes all members of hub class
+  ScTemplate templ;
+  templ.Triple(ScType::VarNode >> "_member", ScType::VarPermPosArc, hubClassAddr);
+  templ.Quintuple("_member", ScType::VarCommonArc, ScType::VarNodeLink >> "_link", ScType::VarPermPosArc, relationAddr);
+  templ.Triple(rareClassAddr, ScType::VarPermPosArc, "_member");
+
+  size_t foundCount = 0;
+  size_t checkedElementsCount = 0;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&](ScTemplateSearchResultItem const & item)
+      {
+        ++foundCount;
+        EXPECT_EQ(item["_member"], rareMemberAddr);
+      },
+      {},
+      [&](ScAddr const &) -> bool
+      {
+        ++checkedElementsCount;
+        return true;
+      });
+  EXPECT_EQ(foundCount, 1u);
+
+  // search starts from the only member of rare class, so sc-elements of other members of hub class aren't checked
+  EXPECT_LT(checkedElementsCount, hubMembersCount);
+}
+
+TEST_F(ScTemplateSearchTest, SearchInParallelByPartitionedStartTriple)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::ConstNodeNonRole);
+
+  size_t const membersCount = 1000;
+  for (size_t i = 0; i < membersCount; ++i)
+  {
+    ScAddr const & memberAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, memberAddr);
+
+    ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+    ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstCommonArc, memberAddr, linkAddr);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, relationAddr, arcAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_member");
+  templ.Quintuple("_member", ScType::VarCommonArc, ScType::VarNodeLink >> "_link", ScType::VarPermPosArc, relationAddr);
+
+  ScTemplateSearchResult sequentialResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, sequentialResult));
+  EXPECT_EQ(sequentialResult.Size(), membersCount);
+
+  templ.SetSearchThreadsCount(4);
+  EXPECT_EQ(templ.GetSearchThreadsCount(), 4u);
+
+  ScTemplateSearchResult parallelResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, parallelResult));
+  EXPECT_EQ(parallelResult.Size(), membersCount);
+
+  ScAddrSet sequentialMembers;
+  sequentialResult.ForEach(
+      [&sequentialMembers](ScTemplateResultItem const & item)
+      {
+        sequentialMembers.insert(item["_member"]);
+      });
+  ScAddrSet parallelMembers;
+  parallelResult.ForEach(
+      [&parallelMembers](ScTemplateResultItem const & item)
+      {
+        parallelMembers.insert(item["_member"]);
+      });
+  EXPECT_EQ(sequentialMembers, parallelMembers);
+
+  size_t foundCount = 0;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&foundCount](ScTemplateResultItem const &)
+      {
+        ++foundCount;
+      });
+  EXPECT_EQ(foundCount, membersCount);
+
+  foundCount = 0;
+  m_ctx->SearchByTemplateInterruptibly(
+      templ,
+      [&foundCount](ScTemplateResultItem const &) -> ScTemplateSearchRequest
+      {
+        ++foundCount;
+        return ScTemplateSearchRequest::STOP;
+      });
+  EXPECT_EQ(foundCount, 1u);
+}
+
+TEST_F(ScTemplateSearchTest, SearchInParallelWhileStartCandidatesAreGenerated)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+
+  size_t const membersCount = 1000;
+  ScAddrSet members;
+  for (size_t i = 0; i < membersCount; ++i)
+  {
+    ScAddr const & memberAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, memberAddr);
+    members.insert(memberAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_member");
+  templ.SetSearchThreadsCount(4);
+
+  // new members are added to the beginning of outgoing sc-arcs list of class while threads search by sc-template
+  std::atomic<bool> isSearchFinished{false};
+  std::thread generationThread(
+      [&classAddr, &isSearchFinished]()
+      {
+        ScMemoryContext context;
+        while (!isSearchFinished)
+          context.GenerateConnector(ScType::ConstPermPosArc, classAddr, context.GenerateNode(ScType::ConstNode));
+      });
+
+  std::vector<ScAddr> foundMembers;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&foundMembers](ScTemplateResultItem const & item)
+      {
+        foundMembers.push_back(item["_member"]);
+      });
+  isSearchFinished = true;
+  generationThread.join();
+
+  ScAddrSet const foundMembersSet{foundMembers.cbegin(), foundMembers.cend()};
+  EXPECT_EQ(foundMembersSet.size(), foundMembers.size());
+  for (ScAddr const & memberAddr : members)
+    EXPECT_TRUE(foundMembersSet.count(memberAddr));
+}
+
+TEST_F(ScTemplateSearchTest, SearchInParallelByConnectivityComponents)
+{
+  ScAddr const & firstClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  for (size_t i = 0; i < 3; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, firstClassAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScAddr const & secondClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  for (size_t i = 0; i < 4; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, secondClassAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTemplate templ;
+  templ.Triple(firstClassAddr, ScType::VarPermPosArc, ScType::VarNode >> "_first_member");
+  templ.Triple(secondClassAddr, ScType::VarPermPosArc, ScType::VarNode >> "_second_member");
+  templ.SetSearchThreadsCount(2);
+
+  ScTemplateSearchResult searchResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  EXPECT_EQ(searchResult.Size(), 12u);
+
+  size_t foundCount = 0;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&foundCount](ScTemplateResultItem const &)
+      {
+        ++foundCount;
+      },
+      [&](ScTemplateResultItem const & item) -> bool
+      {
+        return m_ctx->CheckConnector(firstClassAddr, item["_first_member"], ScType::ConstPermPosArc);
+      });
+  EXPECT_EQ(foundCount, 12u);
+
+  ScAddr const & emptyClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  templ.Triple(emptyClassAddr, ScType::VarPermPosArc, ScType::VarNode >> "_empty_member");
+
+  searchResult.Clear();
+  EXPECT_FALSE(m_ctx->SearchByTemplate(templ, searchResult));
+}
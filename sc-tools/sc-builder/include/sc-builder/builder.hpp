@@ -9,6 +9,7 @@
 #include "sc-memory/sc_memory.hpp"
 
 #include <string>
+#include <vector>
 
 #include "translator.hpp"
 #include "sc_repo_path_collector.hpp"
@@ -19,10 +20,14 @@ struct BuilderParams
   std::string m_inputPath;
   //! Output directory path
   std::string m_outputPath;
+  //! Output bundle file path
+  std::string m_bundlePath;
   //! Result structure system identifier
   std::string m_resultStructureSystemIdtf;
   //! Flag to create result structure
   sc_bool m_resultStructureUpload = SC_FALSE;
+  //! Count of threads parsing sources while parsed sources are generated in memory
+  size_t m_jobsCount = 1;
 };
 
 class Builder
@@ -42,7 +47,13 @@ protected:
 
   bool BuildSources(ScRepoPathCollector::Sources const & buildSources, ScAddr const & outputStructure);
 
+  bool BuildSourcesSequentially(std::vector<std::string> const & sources, ScAddr const & outputStructure);
+
+  bool BuildSourcesByJobs(std::vector<std::string> const & sources, ScAddr const & outputStructure);
+
   bool ProcessFile(std::string const & filename, ScAddr const & outputStructure);
 
+  std::shared_ptr<Translator> GetTranslator(std::string const & fileName) const;
+
   void DumpStatistics();
 };
@@ -10,6 +10,11 @@
 
 #include <sc-memory/sc_addr.hpp>
 
+namespace scs
+{
+class Parser;
+}
+
 class Translator
 {
 public:
@@ -35,6 +40,22 @@ public:
   //! Implementation of translate
   virtual bool TranslateImpl(Params const & params) = 0;
 
+  /*! Parse specified file without access to memory. It can be called from several threads at once
+   * @param params Input parameters
+   * @param parser Parser to store parsed file
+   */
+  void Parse(Params const & params, scs::Parser & parser) const;
+
+  /*! Generate file parsed by `Parse` into memory
+   * @param params Input parameters
+   * @param parser Parser with parsed file
+   * @return If file generated without any errors, then returns true; otherwise returns false.
+   */
+  virtual bool GenerateByParsedSCs(Params const & params, scs::Parser const & parser) = 0;
+
+  //! Returns SCs text of specified file
+  virtual std::string GetSCsText(Params const & params) const = 0;
+
   static void Clean(ScMemoryContext & ctx);
 
 protected:
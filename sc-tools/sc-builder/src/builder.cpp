@@ -8,6 +8,14 @@
 
 #include <memory>
 #include <fstream>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include <libxml2/libxml/parser.h>
+
+#include <sc-memory/scs/scs_parser.hpp>
 
 #include "scs_translator.hpp"
 #include "gwf_translator.hpp"
@@ -18,6 +26,9 @@ bool Builder::Run(BuilderParams const & params, sc_memory_params const & memoryP
 {
   m_params = params;
 
+  // libxml2 is initialized once before GWF sources are parsed by several jobs and is cleaned up after all of them
+  xmlInitParser();
+
   if (!ScMemory::Initialize(memoryParams))
     SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Error while sc-memory initialize");
 
@@ -40,6 +51,17 @@ bool Builder::Run(BuilderParams const & params, sc_memory_params const & memoryP
 
   m_ctx.reset();
   ScMemory::Shutdown(SC_TRUE);
+  xmlCleanupParser();
+
+  if (status && !m_params.m_bundlePath.empty())
+  {
+    ScConsole::PrintLine() << ScConsole::Color::Blue << "Write bundle " << m_params.m_bundlePath << "... ";
+    if (!ScMemory::WriteBundle(memoryParams, m_params.m_bundlePath))
+    {
+      ScConsole::PrintLine() << ScConsole::Color::Red << "Can't write bundle " << m_params.m_bundlePath;
+      return false;
+    }
+  }
 
   return status;
 }
@@ -49,13 +71,31 @@ bool Builder::BuildSources(ScRepoPathCollector::Sources const & buildSources, Sc
   ScMemoryContextEventsBlockingGuard guard{*m_ctx};
   m_translators = {{"scs", std::make_shared<SCsTranslator>(*m_ctx)}, {"gwf", std::make_shared<GWFTranslator>(*m_ctx)}};
 
+  // sources are built in the same order on each run
+  std::vector<std::string> sources{buildSources.cbegin(), buildSources.cend()};
+  std::sort(sources.begin(), sources.end());
+
+  bool const status = m_params.m_jobsCount > 1 ? BuildSourcesByJobs(sources, outputStructure)
+                                               : BuildSourcesSequentially(sources, outputStructure);
+
+  ScConsole::PrintLine() << ScConsole::Color::Green << "Clean state...";
+  Translator::Clean(*m_ctx);
+
+  if (status)
+    DumpStatistics();
+
+  return status;
+}
+
+bool Builder::BuildSourcesSequentially(std::vector<std::string> const & sources, ScAddr const & outputStructure)
+{
   // process founded files
   bool status = true;
 
   size_t done = 0;
-  for (auto const & fileName : buildSources)
+  for (auto const & fileName : sources)
   {
-    ScConsole::Print() << ScConsole::Color::LightBlue << "[" << (++done) << "/" << buildSources.size() << "]: ";
+    ScConsole::Print() << ScConsole::Color::LightBlue << "[" << (++done) << "/" << sources.size() << "]: ";
     ScConsole::Print() << ScConsole::Color::Grey << fileName << " - ";
 
     try
@@ -73,11 +113,135 @@ bool Builder::BuildSources(ScRepoPathCollector::Sources const & buildSources, Sc
     }
   }
 
-  ScConsole::PrintLine() << ScConsole::Color::Green << "Clean state...";
-  Translator::Clean(*m_ctx);
+  return status;
+}
 
-  if (status)
-    DumpStatistics();
+bool Builder::BuildSourcesByJobs(std::vector<std::string> const & sources, ScAddr const & outputStructure)
+{
+  struct ParsedSource
+  {
+    bool m_isParsed = false;
+    std::unique_ptr<scs::Parser> m_parser;
+    std::string m_error;
+  };
+
+  // Sources are parsed by jobs in any order, but they are generated in memory by this thread in order of sources.
+  // Jobs don't parse sources too far ahead of generated ones to not keep all parsed sources in memory.
+  size_t const sourcesCount = sources.size();
+  size_t const maxParsedAheadCount = m_params.m_jobsCount * 4;
+  std::vector<ParsedSource> parsedSources(sourcesCount);
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  size_t nextSourceIdx = 0;
+  size_t generatedSourcesCount = 0;
+  bool isStopped = false;
+
+  auto const & ParseSources = [&]()
+  {
+    while (true)
+    {
+      size_t sourceIdx;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(
+            lock,
+            [&]()
+            {
+              return isStopped || nextSourceIdx == sourcesCount
+                     || nextSourceIdx < generatedSourcesCount + maxParsedAheadCount;
+            });
+        if (isStopped || nextSourceIdx == sourcesCount)
+          return;
+
+        sourceIdx = nextSourceIdx++;
+      }
+
+      Translator::Params translateParams;
+      translateParams.m_fileName = sources[sourceIdx];
+      translateParams.m_outputStructure = outputStructure;
+
+      auto parser = std::make_unique<scs::Parser>();
+      std::string error;
+      try
+      {
+        GetTranslator(translateParams.m_fileName)->Parse(translateParams, *parser);
+      }
+      catch (utils::ScException const & e)
+      {
+        error = e.Message();
+      }
+      catch (std::exception const & e)
+      {
+        error = e.what();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        ParsedSource & parsedSource = parsedSources[sourceIdx];
+        parsedSource.m_isParsed = true;
+        parsedSource.m_parser = std::move(parser);
+        parsedSource.m_error = error;
+      }
+      condition.notify_all();
+    }
+  };
+
+  std::vector<std::thread> jobs;
+  for (size_t i = 0; i < std::min(m_params.m_jobsCount, sourcesCount); ++i)
+    jobs.emplace_back(ParseSources);
+
+  bool status = true;
+  for (size_t sourceIdx = 0; sourceIdx < sourcesCount; ++sourceIdx)
+  {
+    std::string const & fileName = sources[sourceIdx];
+    ScConsole::Print() << ScConsole::Color::LightBlue << "[" << (sourceIdx + 1) << "/" << sourcesCount << "]: ";
+    ScConsole::Print() << ScConsole::Color::Grey << fileName << " - ";
+
+    ParsedSource parsedSource;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(
+          lock,
+          [&]()
+          {
+            return parsedSources[sourceIdx].m_isParsed;
+          });
+      parsedSource = std::move(parsedSources[sourceIdx]);
+    }
+
+    try
+    {
+      if (!parsedSource.m_error.empty())
+        SC_THROW_EXCEPTION(utils::ExceptionParseError, parsedSource.m_error);
+
+      Translator::Params translateParams;
+      translateParams.m_fileName = fileName;
+      translateParams.m_outputStructure = outputStructure;
+      GetTranslator(fileName)->GenerateByParsedSCs(translateParams, *parsedSource.m_parser);
+
+      ScConsole::PrintLine() << ScConsole::Color::Green << "ok";
+    }
+    catch (utils::ScException const & e)
+    {
+      ScConsole::PrintLine() << ScConsole::Color::Red << "failed";
+      ScConsole::PrintLine() << ScConsole::Color::Red << e.Message();
+      status = false;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++generatedSourcesCount;
+      isStopped = !status;
+    }
+    condition.notify_all();
+
+    if (!status)
+      break;
+  }
+
+  for (auto & job : jobs)
+    job.join();
 
   return status;
 }
@@ -110,13 +274,18 @@ bool Builder::ProcessFile(std::string const & fileName, ScAddr const & outputStr
   translateParams.m_fileName = fileName;
   translateParams.m_outputStructure = outputStructure;
 
+  return GetTranslator(fileName)->Translate(translateParams);
+}
+
+std::shared_ptr<Translator> Builder::GetTranslator(std::string const & fileName) const
+{
   std::string const & fileExt = m_collector.GetFileExtension(fileName);
   auto const & it = m_translators.find(fileExt);
   if (it == m_translators.cend())
     SC_THROW_EXCEPTION(
         utils::ExceptionInvalidState, "Not found translators for sources with extension `" << fileExt << "`.");
 
-  return it->second->Translate(translateParams);
+  return it->second;
 }
 
 void Builder::DumpStatistics()
@@ -23,8 +23,6 @@ void XmlCharDeleter::operator()(xmlChar * ptr) const
 
 void GWFParser::Parse(std::string const & xmlStr, SCgElements & elements)
 {
-  xmlInitParser();
-
   auto xmlTree = std::unique_ptr<xmlDoc, decltype(&xmlFreeDoc)>(
       xmlReadMemory(xmlStr.c_str(), xmlStr.size(), "noname.xml", nullptr, 0), xmlFreeDoc);
   if (xmlTree == nullptr)
@@ -49,7 +47,6 @@ void GWFParser::Parse(std::string const & xmlStr, SCgElements & elements)
     return;
 
   ProcessStaticSector(staticSector, elements);
-  xmlCleanupParser();
 }
 
 void GWFParser::ProcessStaticSector(xmlNodePtr staticSector, SCgElements & elementsWithoutParents)
@@ -38,6 +38,16 @@ bool GWFTranslator::TranslateImpl(Params const & params)
   return status;
 }
 
+bool GWFTranslator::GenerateByParsedSCs(Params const & params, scs::Parser const & parser)
+{
+  return m_scsTranslator.GenerateByParsedSCs(params, parser);
+}
+
+std::string GWFTranslator::GetSCsText(Params const & params) const
+{
+  return TranslateXMLFileContentToSCs(params.m_fileName);
+}
+
 std::string GWFTranslator::TranslateXMLFileContentToSCs(std::string const & filename)
 {
   std::string const & gwfText = GetXMLFileContent(filename);
@@ -46,8 +56,6 @@ std::string GWFTranslator::TranslateXMLFileContentToSCs(std::string const & file
 
 std::string GWFTranslator::GetXMLFileContent(std::string const & fileName)
 {
-  xmlInitParser();
-
   xmlDocPtr const & document = xmlReadFile(fileName.c_str(), nullptr, 0);
   if (document == nullptr)
     SC_THROW_EXCEPTION(
@@ -61,7 +69,6 @@ std::string GWFTranslator::GetXMLFileContent(std::string const & fileName)
 
   xmlFree(xmlBuffer);
   xmlFreeDoc(document);
-  xmlCleanupParser();
 
   return xmlString;
 }
@@ -22,6 +22,11 @@ public:
 
   bool TranslateImpl(Params const & params) override;
 
+  bool GenerateByParsedSCs(Params const & params, scs::Parser const & parser) override;
+
+  //! Translates GWF file into SCs text in memory without writing it to file
+  std::string GetSCsText(Params const & params) const override;
+
   static std::string TranslateXMLFileContentToSCs(std::string const & filename);
 
 protected:
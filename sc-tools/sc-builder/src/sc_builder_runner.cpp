@@ -43,6 +43,14 @@ void PrintHelpMessage(std::string const & binaryName)
       << "Additional Options:\n"
       << "  --clear                                  Run sc-builder in a mode that overwrites existing knowledge base "
          "binaries.\n"
+      << "  --jobs|-j <count>                        Specify the count of threads parsing knowledge base sources. "
+         "Sources are generated in memory\n"
+         "                                           in the same order regardless of this count. The default value "
+         "is 1.\n"
+      << "  --bundle|-b <file>                       Specify the path to the file where the bundle of built knowledge "
+         "base binaries will be written.\n"
+         "                                           The bundle can be provided to sc-machine via --bundle|-b option "
+         "instead of knowledge base binaries directory.\n"
       << "  --version                                Display the version of " << binaryName << ".\n"
       << "  --help                                   Display this help message.\n";
 }
@@ -72,6 +80,22 @@ try
   if (options.Has({"output", "o"}))
     params.m_outputPath = options[{"output", "o"}].second;
 
+  if (options.Has({"jobs", "j"}))
+  {
+    std::string const & jobsCountValue = options[{"jobs", "j"}].second;
+    int32_t jobsCount;
+    if (!utils::StringUtils::ParseNumber(jobsCountValue, jobsCount) || jobsCount <= 0)
+    {
+      std::cout << "Error: Count of jobs `" << jobsCountValue << "` is invalid. It should be a positive number.\n"
+                << "For more information, run with --help.\n";
+      return EXIT_FAILURE;
+    }
+    params.m_jobsCount = jobsCount;
+  }
+
+  if (options.Has({"bundle", "b"}))
+    params.m_bundlePath = options[{"bundle", "b"}].second;
+
   std::string configPath;
   if (options.Has({"config", "c"}))
     configPath = options[{"config", "c"}].second;
@@ -164,6 +188,8 @@ try
   formedMemoryParams.dump_memory = SC_FALSE;
   formedMemoryParams.dump_memory_statistics = SC_FALSE;
   formedMemoryParams.user_mode = SC_FALSE;
+  // knowledge base is built from sources, but not from bundle
+  formedMemoryParams.bundle = nullptr;
 
   Builder builder;
   return builder.Run(params, formedMemoryParams) ? EXIT_SUCCESS : EXIT_FAILURE;
@@ -80,3 +80,20 @@ bool SCsTranslator::TranslateImpl(Params const & params)
 
   return true;
 }
+
+bool SCsTranslator::GenerateByParsedSCs(Params const & params, scs::Parser const & parser)
+{
+  SCsHelper scs(m_ctx, std::make_shared<impl::FileProvider>(params.m_fileName));
+
+  if (!scs.GenerateByParsedSCs(parser, params.m_outputStructure))
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, scs.GetLastError());
+
+  return true;
+}
+
+std::string SCsTranslator::GetSCsText(Params const & params) const
+{
+  std::string data;
+  GetFileContent(params.m_fileName, data);
+  return data;
+}
@@ -15,4 +15,8 @@ public:
   ~SCsTranslator() override = default;
 
   bool TranslateImpl(Params const & params) override;
+
+  bool GenerateByParsedSCs(Params const & params, scs::Parser const & parser) override;
+
+  std::string GetSCsText(Params const & params) const override;
 };
@@ -9,6 +9,8 @@
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_keynodes.hpp>
 
+#include <sc-memory/scs/scs_parser.hpp>
+
 Translator::Translator(ScMemoryContext & ctx)
   : m_ctx(ctx)
 {
@@ -19,6 +21,13 @@ bool Translator::Translate(Params const & params)
   return TranslateImpl(params);
 }
 
+void Translator::Parse(Params const & params, scs::Parser & parser) const
+{
+  std::string const & scsText = GetSCsText(params);
+  if (!parser.Parse(scsText))
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, parser.GetParseError());
+}
+
 void Translator::GetFileContent(std::string const & fileName, std::string & outContent)
 {
   std::ifstream ifs(fileName);
@@ -6,6 +6,9 @@
 
 #include "builder_test.hpp"
 
+#include <functional>
+#include <set>
+
 #include <sc-builder/builder.hpp>
 
 #include <sc-config/sc_options.hpp>
@@ -29,6 +32,36 @@ TEST(ScBuilder, Run)
   EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
 }
 
+TEST(ScBuilder, RunWithJobs)
+{
+  sc_uint32 const argsNumber = 8;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "--jobs",
+      "4",
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+}
+
+TEST(ScBuilder, RunWithInvalidJobs)
+{
+  sc_uint32 const argsNumber = 8;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "-j",
+      "0",
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_FAILURE);
+}
+
 TEST(ScBuilder, RunWithOptionsFromBuilderGroup)
 {
   std::string const & configPath = ScBuilderTest::SC_BUILDER_CONFIGS + "/used-builder-group.ini";
@@ -289,3 +322,145 @@ TEST(ScBuilder, BuilderConfig)
   delete context;
   ScMemory::Shutdown(SC_FALSE);
 }
+
+TEST(ScBuilder, BuildByJobsAsSequentially)
+{
+  // sc-elements are described by their system identifiers, contents or types, sc-connectors are described by their
+  // incident sc-elements, so descriptions don't depend on sc-addresses
+  std::function<std::string(ScMemoryContext &, ScAddr const &)> const DescribeElement =
+      [&DescribeElement](ScMemoryContext & context, ScAddr const & addr) -> std::string
+  {
+    ScType const & type = context.GetElementType(addr);
+    if (type.IsConnector())
+    {
+      auto const [sourceAddr, targetAddr] = context.GetConnectorIncidentElements(addr);
+      return "(" + DescribeElement(context, sourceAddr) + " " + std::string(type) + " "
+             + DescribeElement(context, targetAddr) + ")";
+    }
+
+    std::string const & systemIdentifier = context.GetElementSystemIdentifier(addr);
+    if (!systemIdentifier.empty())
+      return systemIdentifier;
+
+    std::string content;
+    if (type.IsLink() && context.GetLinkContent(addr, content))
+      return std::string(type) + "[" + content + "]";
+
+    return std::string(type);
+  };
+
+  auto const & BuildAndDescribeConnectors = [&DescribeElement](size_t jobsCount)
+  {
+    ScOptions options{1, nullptr};
+
+    BuilderParams builderParams;
+    builderParams.m_inputPath = ScBuilderTest::SC_BUILDER_REPO_PATH;
+    builderParams.m_outputPath = ScBuilderTest::SC_BUILDER_KB_BIN;
+    builderParams.m_jobsCount = jobsCount;
+
+    ScParams memoryParams{options, {}};
+    memoryParams.Insert({"storage", ScBuilderTest::SC_BUILDER_KB_BIN});
+    memoryParams.Insert({"clear", {}});
+    ScConfig configFile{ScBuilderTest::SC_BUILDER_INI, {"storage"}};
+    ScMemoryConfig memoryConfig{configFile, memoryParams};
+
+    Builder builder;
+    EXPECT_TRUE(builder.Run(builderParams, memoryConfig.GetParams()));
+
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+    params.dump_memory = SC_FALSE;
+    params.dump_memory_statistics = SC_FALSE;
+    params.storage = ScBuilderTest::SC_BUILDER_KB_BIN.c_str();
+
+    ScMemory::LogMute();
+    ScMemory::Initialize(params);
+    std::multiset<std::string> connectorDescriptions;
+    {
+      ScMemoryContext context;
+      ScMemoryContext::ScMemoryStatistics const statistics = context.CalculateStatistics();
+      size_t const elementsCount = statistics.m_nodesNum + statistics.m_linksNum + statistics.m_connectorsNum;
+
+      size_t foundElementsCount = 0;
+      for (sc_addr addr = {1, 1}; foundElementsCount < elementsCount; ++addr.seg)
+      {
+        size_t const previousFoundElementsCount = foundElementsCount;
+        for (addr.offset = 1; addr.offset < SC_SEGMENT_ELEMENTS_COUNT; ++addr.offset)
+        {
+          if (!context.IsElement(addr))
+            continue;
+
+          ++foundElementsCount;
+          if (context.GetElementType(addr).IsConnector())
+            connectorDescriptions.insert(DescribeElement(context, addr));
+        }
+
+        if (foundElementsCount == previousFoundElementsCount)
+          break;
+      }
+      EXPECT_EQ(foundElementsCount, elementsCount);
+    }
+    ScMemory::Shutdown(SC_FALSE);
+    ScMemory::LogUnmute();
+
+    return connectorDescriptions;
+  };
+
+  std::multiset<std::string> const sequentialConnectorDescriptions = BuildAndDescribeConnectors(1);
+  std::multiset<std::string> const parallelConnectorDescriptions = BuildAndDescribeConnectors(4);
+
+  EXPECT_FALSE(sequentialConnectorDescriptions.empty());
+  EXPECT_EQ(sequentialConnectorDescriptions, parallelConnectorDescriptions);
+}
+
+TEST(ScBuilder, BuildBundleAndInitializeByIt)
+{
+  std::string const & bundlePath = ScBuilderTest::SC_BUILDER_KB_BIN + ".bundle";
+  std::string const & storagePath = ScBuilderTest::SC_BUILDER_KB_BIN + "-from-bundle";
+
+  sc_uint32 const argsNumber = 8;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "--bundle",
+      bundlePath.c_str(),
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+
+  auto const & CalculateStatistics = [](sc_memory_params const & params)
+  {
+    ScMemory::LogMute();
+    EXPECT_TRUE(ScMemory::Initialize(params));
+    ScMemoryContext::ScMemoryStatistics statistics;
+    {
+      ScMemoryContext context;
+      statistics = context.CalculateStatistics();
+    }
+    ScMemory::Shutdown(SC_FALSE);
+    ScMemory::LogUnmute();
+
+    return statistics;
+  };
+
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.dump_memory = SC_FALSE;
+  params.dump_memory_statistics = SC_FALSE;
+  params.storage = ScBuilderTest::SC_BUILDER_KB_BIN.c_str();
+  ScMemoryContext::ScMemoryStatistics const builtStatistics = CalculateStatistics(params);
+
+  params.storage = storagePath.c_str();
+  params.bundle = bundlePath.c_str();
+  params.clear = SC_TRUE;
+  ScMemoryContext::ScMemoryStatistics const bundledStatistics = CalculateStatistics(params);
+
+  EXPECT_EQ(builtStatistics.m_nodesNum, bundledStatistics.m_nodesNum);
+  EXPECT_EQ(builtStatistics.m_linksNum, bundledStatistics.m_linksNum);
+  EXPECT_EQ(builtStatistics.m_connectorsNum, bundledStatistics.m_connectorsNum);
+
+  std::filesystem::remove_all(storagePath);
+  std::filesystem::remove(bundlePath);
+}
@@ -137,6 +137,7 @@ sc_memory_params ScMemoryConfig::GetParams()
   }
   else
     m_memoryParams.storage = GetStringByKey("storage");
+  m_memoryParams.bundle = GetStringByKey("bundle");
 
   if (HasKey("extensions_path"))
   {
@@ -167,6 +168,8 @@ sc_memory_params ScMemoryConfig::GetParams()
       GetBoolByKey("limit_max_threads_by_max_physical_cores", DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES);
   m_memoryParams.max_events_and_agents_threads =
       GetIntByKey("max_events_and_agents_threads", DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS);
+  m_memoryParams.events_queue_size = GetIntByKey("events_queue_size", DEFAULT_EVENTS_QUEUE_SIZE);
+  m_memoryParams.events_threads_affinity = GetBoolByKey("events_threads_affinity", DEFAULT_EVENTS_THREADS_AFFINITY);
 
   m_memoryParams.dump_memory = GetBoolByKey("dump_memory", DEFAULT_DUMP_MEMORY);
   if (HasKey("save_period"))
@@ -189,6 +192,9 @@ sc_memory_params ScMemoryConfig::GetParams()
   m_memoryParams.dump_memory_statistics_period =
       GetIntByKey("dump_memory_statistics_period", DEFAULT_DUMP_MEMORY_STATISTICS_PERIOD);
 
+  m_memoryParams.wal = GetBoolByKey("wal", DEFAULT_WAL);
+  m_memoryParams.wal_sync_period = GetIntByKey("wal_sync_period", DEFAULT_WAL_SYNC_PERIOD);
+
   m_memoryParams.log_type = GetStringByKey("log_type", DEFAULT_LOG_TYPE);
   m_memoryParams.log_file = GetStringByKey("log_file", DEFAULT_LOG_FILE);
   m_memoryParams.log_level = GetStringByKey("log_level", DEFAULT_LOG_LEVEL);
@@ -204,6 +210,7 @@ sc_memory_params ScMemoryConfig::GetParams()
       GetIntByKey("max_searchable_string_size", DEFAULT_MAX_SEARCHABLE_STRING_SIZE);
   m_memoryParams.term_separators = GetStringByKey("term_separators", DEFAULT_TERM_SEPARATORS);
   m_memoryParams.search_by_substring = GetBoolByKey("search_by_substring", DEFAULT_SEARCH_BY_SUBSTRING);
+  m_memoryParams.link_contents_cache_size = GetIntByKey("link_contents_cache_size", DEFAULT_LINK_CONTENTS_CACHE_SIZE);
 
   return m_memoryParams;
 }
@@ -43,6 +43,10 @@ void PrintHelpMessage(std::string const & binaryName)
          "[sc-memory] group of the configuration file specified with --config|-c.\n"
          "                                          If both options are provided, the value from --extensions|-e takes "
          "precedence.\n"
+      << "  --bundle|-b <file>                      Provide a path to knowledge base bundle written by sc-builder. "
+         "It is extracted into knowledge base binaries directory, if this directory is empty.\n"
+         "                                          This path can also be provided via the `bundle` option in the "
+         "[sc-memory] group of the configuration file specified with --config|-c.\n"
       << "  --clear                                 Run sc-memory in the mode when it overwrites "
          "existing knowledge base binaries.\n"
       << "  --verbose|-v                            Shutdown sc-memory without dumping its state into knowledge base "
@@ -79,8 +83,8 @@ try
 
   ScMemory::ms_configPath = configPath;
 
-  ScConfig config{configPath, {"extensions", "repo_path", "storage", "log_file"}};
-  ScParams memoryParams{options, {{"extensions", "e"}, {"storage", "s"}, {"clear"}}};
+  ScConfig config{configPath, {"extensions", "repo_path", "storage", "bundle", "log_file"}};
+  ScParams memoryParams{options, {{"extensions", "e"}, {"storage", "s"}, {"bundle", "b"}, {"clear"}}};
   ScMemoryConfig memoryConfig{config, memoryParams};
 
   if (!memoryConfig.HasKey("storage") && !memoryConfig.HasKey("repo_path"))
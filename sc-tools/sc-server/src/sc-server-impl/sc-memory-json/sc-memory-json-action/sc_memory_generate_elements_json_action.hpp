@@ -50,6 +50,8 @@ public:
         auto const & content = atom["content"];
         if (content.is_string())
           link.Set(content.get<std::string>());
+        else if (content.is_binary())
+          link.Set(std::string(content.get_binary().cbegin(), content.get_binary().cend()));
         else if (content.is_number_integer())
           link.Set(content.get<sc_int>());
         else if (content.is_number_float())
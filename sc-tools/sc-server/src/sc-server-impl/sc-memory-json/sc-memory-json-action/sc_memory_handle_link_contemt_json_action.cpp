@@ -133,6 +133,13 @@ ScMemoryJsonPayload ScMemoryHandleLinkContentJsonAction::SetLinkContent(
   auto const & data = parameters[LINK_CONTENT];
   if (contentType == STRING_CONTENT_TYPE || contentType == "binary")
   {
+    // Binary messages can contain content as bytes
+    if (data.is_binary())
+    {
+      result = link.Set(std::string(data.get_binary().cbegin(), data.get_binary().cend()));
+      return result;
+    }
+
     if (!data.is_string())
     {
       error = {
@@ -234,6 +241,8 @@ ScMemoryJsonPayload ScMemoryHandleLinkContentJsonAction::SearchLinksByContent(
   auto const & data = parameters[LINK_CONTENT];
   if (data.is_string())
     linkSet = context->SearchLinksByContent(data.get<std::string>());
+  else if (data.is_binary())
+    linkSet = context->SearchLinksByContent(std::string(data.get_binary().cbegin(), data.get_binary().cend()));
   else if (data.is_number_integer())
     linkSet = context->SearchLinksByContent(std::to_string(data.get<sc_int>()));
   else if (data.is_number_float())
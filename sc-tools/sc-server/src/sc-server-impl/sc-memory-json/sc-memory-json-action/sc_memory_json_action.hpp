@@ -7,6 +7,7 @@
 #pragma once
 
 #include "sc-server-impl/sc-memory-json/sc_memory_json_payload.hpp"
+#include "sc-server-impl/sc_server_defines.hpp"
 
 class ScAgentContext;
 
@@ -18,5 +19,15 @@ public:
       ScMemoryJsonPayload requestPayload,
       ScMemoryJsonPayload & errorsPayload) = 0;
 
+  //! Completes action which state is kept between requests of session
+  virtual ScMemoryJsonPayload CompleteInSession(
+      ScServerSessionId const &,
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload)
+  {
+    return Complete(context, std::move(requestPayload), errorsPayload);
+  }
+
   virtual ~ScMemoryJsonAction() = default;
 };
@@ -28,6 +28,7 @@ void ScMemoryJsonActionsHandler::InitializeActionClasses()
       {"check_elements", new ScMemoryCheckElementsJsonAction()},
       {"delete_elements", new ScMemoryEraseElementsJsonAction()},
       {"search_template", new ScMemoryTemplateSearchJsonAction()},
+      {"search_template_page", new ScMemoryTemplateSearchPageJsonAction()},
       {"generate_template", new ScMemoryTemplateGenerateJsonAction()},
       {"content", new ScMemoryHandleLinkContentJsonAction()},
   };
@@ -43,7 +44,7 @@ void ScMemoryJsonActionsHandler::ClearActionClasses()
 }
 
 ScMemoryJsonPayload ScMemoryJsonActionsHandler::HandleRequestPayload(
-    ScServerSessionId const &,
+    ScServerSessionId const & sessionId,
     std::string const & requestType,
     ScMemoryJsonPayload const & requestPayload,
     ScMemoryJsonPayload & errorsPayload,
@@ -63,7 +64,7 @@ ScMemoryJsonPayload ScMemoryJsonActionsHandler::HandleRequestPayload(
   }
 
   auto * action = it->second;
-  responsePayload = action->Complete(m_context, requestPayload, errorsPayload);
+  responsePayload = action->CompleteInSession(sessionId, m_context, requestPayload, errorsPayload);
 
   status = errorsPayload.empty();
   return responsePayload;
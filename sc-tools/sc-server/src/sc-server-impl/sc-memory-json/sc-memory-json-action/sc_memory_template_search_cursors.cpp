@@ -0,0 +1,249 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_memory_template_search_cursors.hpp"
+
+#include <sc-memory/sc_agent_context.hpp>
+
+ScMemoryTemplateSearchCursor::ScMemoryTemplateSearchCursor(ScAddr const & userAddr, std::unique_ptr<ScTemplate> templ)
+  : m_template(std::move(templ))
+{
+  m_thread = std::thread(
+      [this, userAddr]()
+      {
+        Search(userAddr);
+      });
+}
+
+ScMemoryTemplateSearchCursor::~ScMemoryTemplateSearchCursor()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isClosed = true;
+  }
+  m_condition.notify_all();
+  m_thread.join();
+}
+
+ScMemoryJsonPayload ScMemoryTemplateSearchCursor::NextPage(size_t pageSize, bool & isFinished)
+{
+  std::lock_guard<std::mutex> pagesLock(m_pagesMutex);
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_pageSize = pageSize;
+  m_condition.notify_all();
+  m_condition.wait(
+      lock,
+      [this]
+      {
+        return m_page.size() == m_pageSize || m_isFinished;
+      });
+
+  if (m_exception)
+    std::rethrow_exception(m_exception);
+
+  ScMemoryJsonPayload page = ScMemoryJsonPayload::array();
+  page.swap(m_page);
+  m_pageSize = 0;
+  isFinished = m_isFinished;
+  return page;
+}
+
+ScMemoryJsonPayload ScMemoryTemplateSearchCursor::GetAliases()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_aliases;
+}
+
+void ScMemoryTemplateSearchCursor::Search(ScAddr const & userAddr)
+{
+  ScAgentContext context(userAddr);
+  try
+  {
+    context.SearchByTemplateInterruptibly(
+        *m_template,
+        [this](ScTemplateResultItem const & item) -> ScTemplateSearchRequest
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          // search waits here until the next page is requested
+          m_condition.wait(
+              lock,
+              [this]
+              {
+                return m_page.size() < m_pageSize || m_isClosed;
+              });
+          if (m_isClosed)
+            return ScTemplateSearchRequest::STOP;
+
+          if (m_aliases.empty())
+            m_aliases = item.GetReplacements();
+
+          std::vector<size_t> hashes;
+          hashes.reserve(item.Size());
+          for (ScAddr const & addr : item)
+            hashes.push_back(addr.Hash());
+          m_page.push_back(std::move(hashes));
+
+          if (m_page.size() == m_pageSize)
+            m_condition.notify_all();
+          return ScTemplateSearchRequest::CONTINUE;
+        },
+        {},
+        [this](ScAddr const &) -> bool
+        {
+          // search is interrupted while it is looking for the next sc-construction
+          if (m_isClosed)
+            SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Sc-template search cursor is closed.");
+          return true;
+        });
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isClosed)
+      m_exception = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isFinished = true;
+  }
+  m_condition.notify_all();
+  context.Destroy();
+}
+
+ScMemoryTemplateSearchCursorsManager * ScMemoryTemplateSearchCursorsManager::GetInstance()
+{
+  static ScMemoryTemplateSearchCursorsManager instance;
+  return &instance;
+}
+
+size_t ScMemoryTemplateSearchCursorsManager::Reserve(ScServerSessionId const & sessionId)
+{
+  // idle cursors are destroyed after lock is released, because they wait for their search threads
+  std::vector<ScMemoryTemplateSearchCursorPtr> idleCursors;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const now = std::chrono::steady_clock::now();
+  RemoveIdleCursors(now, idleCursors);
+
+  ScMemoryTemplateSearchCursors & cursors = m_sessionsCursors[sessionId];
+  if (cursors.size() >= MAX_SESSION_CURSORS_COUNT)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to open sc-template search cursor because session has " << MAX_SESSION_CURSORS_COUNT
+                                                                          << " opened cursors.");
+
+  size_t const cursorId = m_nextCursorId++;
+  cursors.insert({cursorId, {nullptr, now}});
+  return cursorId;
+}
+
+void ScMemoryTemplateSearchCursorsManager::Set(
+    ScServerSessionId const & sessionId,
+    size_t cursorId,
+    std::shared_ptr<ScMemoryTemplateSearchCursor> const & cursor)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const & sessionIt = m_sessionsCursors.find(sessionId);
+  if (sessionIt == m_sessionsCursors.cend())
+    return;
+
+  auto const & it = sessionIt->second.find(cursorId);
+  if (it == sessionIt->second.cend())
+    return;
+
+  it->second = {cursor, std::chrono::steady_clock::now()};
+}
+
+std::shared_ptr<ScMemoryTemplateSearchCursor> ScMemoryTemplateSearchCursorsManager::Get(
+    ScServerSessionId const & sessionId,
+    size_t cursorId)
+{
+  std::vector<ScMemoryTemplateSearchCursorPtr> idleCursors;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const now = std::chrono::steady_clock::now();
+  RemoveIdleCursors(now, idleCursors);
+
+  auto const & sessionIt = m_sessionsCursors.find(sessionId);
+  if (sessionIt == m_sessionsCursors.cend())
+    return nullptr;
+
+  auto const & it = sessionIt->second.find(cursorId);
+  if (it == sessionIt->second.cend() || it->second.m_cursor == nullptr)
+    return nullptr;
+
+  it->second.m_lastAccessTime = now;
+  return it->second.m_cursor;
+}
+
+void ScMemoryTemplateSearchCursorsManager::RemoveIdleCursors(
+    std::chrono::steady_clock::time_point const & now,
+    std::vector<ScMemoryTemplateSearchCursorPtr> & idleCursors)
+{
+  for (auto sessionIt = m_sessionsCursors.begin(); sessionIt != m_sessionsCursors.end();)
+  {
+    ScMemoryTemplateSearchCursors & cursors = sessionIt->second;
+    for (auto it = cursors.begin(); it != cursors.end();)
+    {
+      if (now - it->second.m_lastAccessTime < CURSOR_IDLE_TIMEOUT)
+      {
+        ++it;
+        continue;
+      }
+
+      idleCursors.push_back(std::move(it->second.m_cursor));
+      it = cursors.erase(it);
+    }
+
+    if (cursors.empty())
+      sessionIt = m_sessionsCursors.erase(sessionIt);
+    else
+      ++sessionIt;
+  }
+}
+
+void ScMemoryTemplateSearchCursorsManager::Remove(ScServerSessionId const & sessionId, size_t cursorId)
+{
+  // cursor is destroyed without lock, because it waits for its search thread
+  std::shared_ptr<ScMemoryTemplateSearchCursor> cursor;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const & sessionIt = m_sessionsCursors.find(sessionId);
+    if (sessionIt == m_sessionsCursors.cend())
+      return;
+
+    auto const & it = sessionIt->second.find(cursorId);
+    if (it == sessionIt->second.cend())
+      return;
+
+    cursor = it->second.m_cursor;
+    sessionIt->second.erase(it);
+  }
+}
+
+void ScMemoryTemplateSearchCursorsManager::RemoveSessionCursors(ScServerSessionId const & sessionId)
+{
+  ScMemoryTemplateSearchCursors cursors;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const & sessionIt = m_sessionsCursors.find(sessionId);
+    if (sessionIt == m_sessionsCursors.cend())
+      return;
+
+    cursors.swap(sessionIt->second);
+    m_sessionsCursors.erase(sessionIt);
+  }
+}
+
+void ScMemoryTemplateSearchCursorsManager::Clear()
+{
+  std::map<ScServerSessionId, ScMemoryTemplateSearchCursors, std::owner_less<ScServerSessionId>> sessionsCursors;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    sessionsCursors.swap(m_sessionsCursors);
+  }
+}
@@ -0,0 +1,128 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sc-memory/sc_template.hpp>
+
+#include "sc-server-impl/sc-memory-json/sc_memory_json_payload.hpp"
+#include "sc-server-impl/sc_server_defines.hpp"
+
+/*!
+ * Iterates sc-constructions found by sc-template page by page. Search runs in own thread by interruptible sc-template
+ * search and waits in its callback until the next page is requested, so only one page of found sc-constructions is
+ * stored in memory. If cursor is closed while search is looking for the next sc-construction, then search is
+ * interrupted by its check callback, so closing of cursor doesn't wait for the next found sc-construction.
+ */
+class ScMemoryTemplateSearchCursor
+{
+public:
+  ScMemoryTemplateSearchCursor(ScAddr const & userAddr, std::unique_ptr<ScTemplate> templ);
+
+  ~ScMemoryTemplateSearchCursor();
+
+  /*!
+   * Waits until `pageSize` next sc-constructions are found or search is finished.
+   * @param pageSize Count of sc-constructions to find.
+   * @param isFinished Set to true if there are no more sc-constructions.
+   * @returns Arrays of hashes of found sc-constructions elements.
+   */
+  ScMemoryJsonPayload NextPage(size_t pageSize, bool & isFinished);
+
+  //! Returns positions of sc-template items names in found sc-constructions
+  ScMemoryJsonPayload GetAliases();
+
+private:
+  void Search(ScAddr const & userAddr);
+
+  std::unique_ptr<ScTemplate> m_template;
+
+  //! Serializes requests of pages
+  std::mutex m_pagesMutex;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  ScMemoryJsonPayload m_page = ScMemoryJsonPayload::array();
+  size_t m_pageSize = 0;
+  ScMemoryJsonPayload m_aliases = ScMemoryJsonPayload::object();
+  bool m_isFinished = false;
+  //! Is changed under `m_mutex`, but is read by check callback of search without it
+  std::atomic<bool> m_isClosed{false};
+  std::exception_ptr m_exception;
+
+  std::thread m_thread;
+};
+
+/*!
+ * Stores sc-template search cursors of sc-server sessions. Cursors of session are closed when it is disconnected.
+ * Cursors which pages aren't requested during `CURSOR_IDLE_TIMEOUT` are closed when cursors are added or got.
+ */
+class ScMemoryTemplateSearchCursorsManager
+{
+public:
+  //! Maximum count of opened cursors of one session, each cursor keeps a thread
+  static size_t constexpr MAX_SESSION_CURSORS_COUNT = 16;
+  //! Time after the last request of cursor page after which cursor is closed
+  static std::chrono::seconds constexpr CURSOR_IDLE_TIMEOUT{300};
+
+  static ScMemoryTemplateSearchCursorsManager * GetInstance();
+
+  /*!
+   * Reserves identifier of cursor of session before cursor is created, so search thread of cursor isn't started if
+   * session has maximum count of opened cursors. Reserved identifier is counted as opened cursor until it is removed.
+   * @returns Identifier of cursor.
+   * @throws utils::ExceptionInvalidState if session has maximum count of opened cursors.
+   */
+  size_t Reserve(ScServerSessionId const & sessionId);
+
+  //! Sets cursor with reserved identifier, cursor isn't set if reserved identifier is already removed
+  void Set(
+      ScServerSessionId const & sessionId,
+      size_t cursorId,
+      std::shared_ptr<ScMemoryTemplateSearchCursor> const & cursor);
+
+  //! Returns cursor of session or nullptr if there is no such cursor or it isn't set yet, cursor isn't closed by
+  //! timeout after it
+  std::shared_ptr<ScMemoryTemplateSearchCursor> Get(ScServerSessionId const & sessionId, size_t cursorId);
+
+  void Remove(ScServerSessionId const & sessionId, size_t cursorId);
+
+  void RemoveSessionCursors(ScServerSessionId const & sessionId);
+
+  void Clear();
+
+private:
+  using ScMemoryTemplateSearchCursorPtr = std::shared_ptr<ScMemoryTemplateSearchCursor>;
+
+  struct ScMemoryTemplateSearchCursorInfo
+  {
+    ScMemoryTemplateSearchCursorPtr m_cursor;
+    std::chrono::steady_clock::time_point m_lastAccessTime;
+  };
+
+  using ScMemoryTemplateSearchCursors = std::unordered_map<size_t, ScMemoryTemplateSearchCursorInfo>;
+
+  //! Moves cursors that aren't accessed during idle timeout to `idleCursors`, they must be destroyed without lock
+  void RemoveIdleCursors(
+      std::chrono::steady_clock::time_point const & now,
+      std::vector<ScMemoryTemplateSearchCursorPtr> & idleCursors);
+
+  std::mutex m_mutex;
+  std::map<ScServerSessionId, ScMemoryTemplateSearchCursors, std::owner_less<ScServerSessionId>> m_sessionsCursors;
+  size_t m_nextCursorId = 0;
+
+  ScMemoryTemplateSearchCursorsManager() = default;
+};
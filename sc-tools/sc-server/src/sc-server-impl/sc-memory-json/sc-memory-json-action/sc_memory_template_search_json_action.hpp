@@ -7,6 +7,7 @@
 #pragma once
 
 #include "sc_memory_make_template_json_action.hpp"
+#include "sc_memory_template_search_cursors.hpp"
 
 class ScMemoryTemplateSearchJsonAction : public ScMemoryMakeTemplateJsonAction
 {
@@ -36,4 +37,58 @@ public:
     delete pair.first;
     return resultPayload;
   }
+
+  /*!
+   * If request has `page_size`, then opens cursor of sc-template search and returns the first page of found
+   * sc-constructions with cursor identifier. Next pages are requested by `search_template_page` requests.
+   */
+  ScMemoryJsonPayload CompleteInSession(
+      ScServerSessionId const & sessionId,
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    if (!requestPayload.is_object() || !requestPayload.contains("page_size"))
+      return Complete(context, std::move(requestPayload), errorsPayload);
+
+    auto const pageSize = requestPayload["page_size"].get<size_t>();
+    if (pageSize == 0)
+    {
+      errorsPayload = "Page size of sc-template search must be greater than 0.";
+      return {};
+    }
+
+    // cursor identifier is reserved before search thread is started, so exceeded count of session cursors is
+    // rejected before the first page is searched
+    ScMemoryTemplateSearchCursorsManager * manager = ScMemoryTemplateSearchCursorsManager::GetInstance();
+    size_t const cursorId = manager->Reserve(sessionId);
+
+    std::shared_ptr<ScMemoryTemplateSearchCursor> cursor;
+    bool isFinished = false;
+    ScMemoryJsonPayload page;
+    try
+    {
+      auto const & pair = GetTemplate(context, requestPayload);
+      cursor =
+          std::make_shared<ScMemoryTemplateSearchCursor>(context->GetUser(), std::unique_ptr<ScTemplate>(pair.first));
+      page = cursor->NextPage(pageSize, isFinished);
+    }
+    catch (...)
+    {
+      manager->Remove(sessionId, cursorId);
+      throw;
+    }
+
+    ScMemoryJsonPayload responsePayload = {
+        {"aliases", cursor->GetAliases()}, {"addrs", page}, {"finished", isFinished}};
+    if (isFinished)
+      manager->Remove(sessionId, cursorId);
+    else
+    {
+      manager->Set(sessionId, cursorId, cursor);
+      responsePayload["cursor"] = cursorId;
+    }
+
+    return responsePayload;
+  }
 };
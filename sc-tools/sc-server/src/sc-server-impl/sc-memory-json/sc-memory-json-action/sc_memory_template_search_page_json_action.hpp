@@ -0,0 +1,72 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+#include "sc_memory_template_search_cursors.hpp"
+
+/*!
+ * Returns next page of sc-constructions found by cursor of sc-template search opened by `search_template` request
+ * with `page_size`. If request has `close`, then cursor is closed without searching more sc-constructions.
+ */
+class ScMemoryTemplateSearchPageJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(ScAgentContext *, ScMemoryJsonPayload, ScMemoryJsonPayload & errorsPayload) override
+  {
+    errorsPayload = "Pages of sc-template search can be requested in session only.";
+    return {};
+  }
+
+  ScMemoryJsonPayload CompleteInSession(
+      ScServerSessionId const & sessionId,
+      ScAgentContext *,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    ScMemoryTemplateSearchCursorsManager * manager = ScMemoryTemplateSearchCursorsManager::GetInstance();
+    auto const cursorId = requestPayload["cursor"].get<size_t>();
+
+    if (requestPayload.contains("close") && requestPayload["close"].get<bool>())
+    {
+      manager->Remove(sessionId, cursorId);
+      return {{"cursor", cursorId}, {"addrs", ScMemoryJsonPayload::array()}, {"finished", true}};
+    }
+
+    std::shared_ptr<ScMemoryTemplateSearchCursor> const & cursor = manager->Get(sessionId, cursorId);
+    if (cursor == nullptr)
+    {
+      errorsPayload = "Cursor of sc-template search `" + std::to_string(cursorId) + "` is not opened in session.";
+      return {};
+    }
+
+    auto const pageSize = requestPayload["page_size"].get<size_t>();
+    if (pageSize == 0)
+    {
+      errorsPayload = "Page size of sc-template search must be greater than 0.";
+      return {};
+    }
+
+    bool isFinished = false;
+    ScMemoryJsonPayload page;
+    try
+    {
+      page = cursor->NextPage(pageSize, isFinished);
+    }
+    catch (...)
+    {
+      // search of cursor is finished by error, so cursor can't return next pages
+      manager->Remove(sessionId, cursorId);
+      throw;
+    }
+
+    if (isFinished)
+      manager->Remove(sessionId, cursorId);
+
+    return {{"cursor", cursorId}, {"addrs", page}, {"finished", isFinished}};
+  }
+};
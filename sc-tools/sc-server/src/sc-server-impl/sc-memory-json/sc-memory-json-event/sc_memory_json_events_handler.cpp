@@ -58,8 +58,11 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleGenerate(
     ScMemoryJsonPayload const & message,
     ScMemoryJsonPayload & errorsPayload)
 {
-  auto const & onEmitEvent =
-      [](ScServer * server, size_t id, ScServerSessionId const & handle, ScElementaryEvent const & event)
+  auto const & onEmitEvent = [](ScServer * server,
+                                size_t id,
+                                ScServerSessionId const & handle,
+                                ScServerMessageType messageType,
+                                ScElementaryEvent const & event)
   {
     auto const & [sourceAddr, connectorAddr, targetAddr] = event.GetTriple();
 
@@ -70,10 +73,10 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleGenerate(
 
     ScMemoryJsonPayload const & responseTextJson =
         ScMemoryJsonHandler::FormResponseMessage(id, isEvent, status, errorsPayload, responsePayload);
-    std::string const responseText = responseTextJson.dump();
+    std::string const responseText = ScMemoryJsonPayloadCodec::Encode(responseTextJson, messageType);
 
     if (server != nullptr)
-      server->OnEvent(handle, responseText);
+      server->OnEvent(handle, responseText, messageType);
   };
 
   ScMemoryJsonPayload responsePayload;
@@ -87,9 +90,13 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleGenerate(
       eventClass = it->second;
 
     ScAddr const & eventClassAddr = m_context->SearchElementBySystemIdentifier(eventClass);
+    size_t const subscriptionId = m_manager->Reserve();
     auto const & subscription = m_context->CreateElementaryEventSubscription(
-        eventClassAddr, subscriptionElementAddr, bind(onEmitEvent, m_server, m_manager->Next(), sessionId, ::_1));
-    responsePayload.push_back(m_manager->Add(subscription));
+        eventClassAddr,
+        subscriptionElementAddr,
+        bind(onEmitEvent, m_server, subscriptionId, sessionId, m_messageType, ::_1));
+    m_manager->Add(subscriptionId, subscription);
+    responsePayload.push_back(subscriptionId);
   }
 
   return responsePayload;
@@ -6,4 +6,31 @@
 
 #include "sc_memory_json_events_manager.hpp"
 
-ScMemoryJsonEventsManager * ScMemoryJsonEventsManager::m_instance = nullptr;
+ScMemoryJsonEventsManager * ScMemoryJsonEventsManager::GetInstance()
+{
+  static ScMemoryJsonEventsManager instance;
+  return &instance;
+}
+
+size_t ScMemoryJsonEventsManager::Reserve()
+{
+  return m_nextId.fetch_add(1);
+}
+
+void ScMemoryJsonEventsManager::Add(size_t id, ScEventSubscriptionPtr const & subscription)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.insert({id, subscription});
+}
+
+ScEventSubscriptionPtr ScMemoryJsonEventsManager::Remove(size_t id)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const & it = m_events.find(id);
+  if (it == m_events.end())
+    return nullptr;
+
+  ScEventSubscriptionPtr subscription = it->second;
+  m_events.erase(it);
+  return subscription;
+}
@@ -6,57 +6,37 @@
 
 #pragma once
 
-#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 
 #include <sc-memory/sc_event_subscription.hpp>
 
+/*!
+ * Stores sc-event subscriptions of sc-server sessions by their identifiers. Sessions are handled by several actions
+ * threads, so subscriptions are added and removed concurrently.
+ */
 class ScMemoryJsonEventsManager
 {
 public:
-  static ScMemoryJsonEventsManager * GetInstance()
-  {
-    if (m_instance == nullptr)
-      m_instance = new ScMemoryJsonEventsManager();
-
-    return m_instance;
-  }
-
-  size_t Add(ScEventSubscriptionPtr const & event)
-  {
-    m_events.insert({counter, event});
-    return counter++;
-  }
-
-  size_t Next() const
-  {
-    return counter;
-  }
-
-  ScEventSubscriptionPtr Remove(size_t index)
-  {
-    auto const & it = m_events.find(index);
-    if (it != m_events.end())
-    {
-      auto const & pair = m_events.find(index);
-      auto e = pair->second;
-      m_events.erase(index);
-      return e;
-    }
-
-    return nullptr;
-  }
-
-  ~ScMemoryJsonEventsManager()
-  {
-    m_events.clear();
-
-    delete m_instance;
-  }
+  static ScMemoryJsonEventsManager * GetInstance();
+
+  /*!
+   * Reserves identifier for new sc-event subscription. Identifier is reserved before subscription is created, because
+   * callback of subscription sends identifier with emitted sc-events.
+   */
+  size_t Reserve();
+
+  //! Adds sc-event subscription by identifier reserved for it
+  void Add(size_t id, ScEventSubscriptionPtr const & subscription);
+
+  //! Removes sc-event subscription, it must be destroyed by caller after manager is unlocked
+  ScEventSubscriptionPtr Remove(size_t id);
 
 private:
-  static ScMemoryJsonEventsManager * m_instance;
+  std::mutex m_mutex;
   std::unordered_map<size_t, ScEventSubscriptionPtr> m_events;
-  size_t counter = 0;
+  std::atomic<size_t> m_nextId{0};
 
   ScMemoryJsonEventsManager() = default;
 };
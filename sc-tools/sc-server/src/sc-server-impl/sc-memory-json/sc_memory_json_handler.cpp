@@ -8,23 +8,42 @@
 
 std::string ScMemoryJsonHandler::Handle(ScServerSessionId const & sessionId, std::string const & requestMessage)
 {
-  std::vector<ScMemoryJsonPayload> requestData = ParseRequestMessage(requestMessage);
+  return Handle(sessionId, requestMessage, ScServerMessageType::text);
+}
+
+std::string ScMemoryJsonHandler::Handle(
+    ScServerSessionId const & sessionId,
+    std::string const & requestMessage,
+    ScServerMessageType messageType)
+{
+  messageType = ScMemoryJsonPayloadCodec::GetResponseMessageType(messageType);
+  ScMemoryJsonPayload const & requestJson = ScMemoryJsonPayloadCodec::Decode(requestMessage, messageType);
+  return ScMemoryJsonPayloadCodec::Encode(Handle(sessionId, requestJson, messageType), messageType);
+}
+
+ScMemoryJsonPayload ScMemoryJsonHandler::Handle(
+    ScServerSessionId const & sessionId,
+    ScMemoryJsonPayload const & requestJson,
+    ScServerMessageType messageType)
+{
+  m_messageType = ScMemoryJsonPayloadCodec::GetResponseMessageType(messageType);
+
+  std::vector<ScMemoryJsonPayload> requestData = ParseRequestMessage(requestJson);
   if (requestData.empty())
-    return ScMemoryJsonPayload("Invalid request message").dump();
+    return ScMemoryJsonPayload("Invalid request message");
 
   std::string const & requestType = requestData.at(0).get<std::string>();
   ScMemoryJsonPayload const & requestPayload = requestData.at(1);
   size_t const & requestId = requestData.at(2).get<size_t>();
 
-  return ResponseRequestMessage(sessionId, requestId, requestType, requestPayload).dump();
+  return ResponseRequestMessage(sessionId, requestId, requestType, requestPayload);
 }
 
-std::vector<ScMemoryJsonPayload> ScMemoryJsonHandler::ParseRequestMessage(std::string const & requestMessage)
+std::vector<ScMemoryJsonPayload> ScMemoryJsonHandler::ParseRequestMessage(ScMemoryJsonPayload const & messageJson)
 {
   std::vector<ScMemoryJsonPayload> requestData;
 
-  ScMemoryJsonPayload const & messageJson = JsonifyRequestMessage(requestMessage);
-  if (messageJson.is_null())
+  if (messageJson.is_discarded() || !messageJson.is_object())
     return requestData;
 
   if (!messageJson.contains("payload"))
@@ -38,12 +57,6 @@ std::vector<ScMemoryJsonPayload> ScMemoryJsonHandler::ParseRequestMessage(std::s
   return requestData;
 }
 
-ScMemoryJsonPayload ScMemoryJsonHandler::JsonifyRequestMessage(std::string const & requestMessage)
-{
-  return ScMemoryJsonPayload::accept(requestMessage) ? ScMemoryJsonPayload::parse(requestMessage)
-                                                     : ScMemoryJsonPayload();
-}
-
 ScMemoryJsonPayload ScMemoryJsonHandler::ResponseRequestMessage(
     ScServerSessionId const & sessionId,
     size_t const requestId,
@@ -18,6 +18,7 @@ class ScMemoryJsonHandler
 public:
   explicit ScMemoryJsonHandler(ScServer * server)
     : m_server(server)
+    , m_messageType(ScServerMessageType::text)
   {
   }
 
@@ -25,12 +26,22 @@ public:
 
   virtual std::string Handle(ScServerSessionId const & sessionId, std::string const & requestMessage);
 
+  std::string Handle(
+      ScServerSessionId const & sessionId,
+      std::string const & requestMessage,
+      ScServerMessageType messageType);
+
+  ScMemoryJsonPayload Handle(
+      ScServerSessionId const & sessionId,
+      ScMemoryJsonPayload const & requestJson,
+      ScServerMessageType messageType);
+
 protected:
   ScServer * m_server;
+  // Type of websocket frame of handled message, it is used to send responses and sc-events subscribed by this message
+  ScServerMessageType m_messageType;
 
-  std::vector<ScMemoryJsonPayload> ParseRequestMessage(std::string const & requestMessage);
-
-  ScMemoryJsonPayload JsonifyRequestMessage(std::string const & requestMessage);
+  std::vector<ScMemoryJsonPayload> ParseRequestMessage(ScMemoryJsonPayload const & messageJson);
 
   virtual ScMemoryJsonPayload ResponseRequestMessage(
       ScServerSessionId const & sessionId,
@@ -8,4 +8,56 @@
 
 #include <nlohmann/json.hpp>
 
+#include "sc-server-impl/sc_server_defines.hpp"
+
 using ScMemoryJsonPayload = nlohmann::json;
+
+/*!
+ * @class ScMemoryJsonPayloadCodec
+ * @brief Converts messages of sc-server to payloads and back.
+ *
+ * Text messages contain JSON text. Binary messages contain the same payloads encoded by MessagePack, so sc-addresses,
+ * sc-types and contents of sc-links are passed without conversion to text. Responses to a message and sc-events
+ * subscribed by it are sent in format of this message.
+ */
+class ScMemoryJsonPayloadCodec
+{
+public:
+  /*!
+   * @brief Decodes payload from message.
+   * @param message A message text or bytes.
+   * @param messageType A type of websocket frame of message.
+   * @return Decoded payload or discarded payload if message is invalid.
+   */
+  static ScMemoryJsonPayload Decode(std::string const & message, ScServerMessageType messageType)
+  {
+    if (messageType == ScServerMessageType::binary)
+      return ScMemoryJsonPayload::from_msgpack(message, true, false);
+
+    return ScMemoryJsonPayload::parse(message, nullptr, false);
+  }
+
+  /*!
+   * @brief Encodes payload to message.
+   * @param payload A payload to encode.
+   * @param messageType A type of websocket frame of message.
+   * @return A message text or bytes.
+   */
+  static std::string Encode(ScMemoryJsonPayload const & payload, ScServerMessageType messageType)
+  {
+    if (messageType == ScServerMessageType::binary)
+    {
+      std::string message;
+      ScMemoryJsonPayload::to_msgpack(payload, message);
+      return message;
+    }
+
+    return payload.dump();
+  }
+
+  //! Returns type of websocket frame used to send responses to message of specified type.
+  static ScServerMessageType GetResponseMessageType(ScServerMessageType messageType)
+  {
+    return messageType == ScServerMessageType::binary ? ScServerMessageType::binary : ScServerMessageType::text;
+  }
+};
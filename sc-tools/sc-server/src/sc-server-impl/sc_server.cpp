@@ -6,13 +6,17 @@
 
 #include "sc_server.hpp"
 
+#include <algorithm>
+
 #include <websocketpp/config/asio_no_tls.hpp>
 
 #include <sc-memory/sc_keynodes.hpp>
 
-ScServer::ScServer(std::string hostName, size_t port)
+ScServer::ScServer(std::string hostName, size_t port, size_t actionsThreadsCount, size_t ioThreadsCount)
   : m_hostName(std::move(hostName))
   , m_port(port)
+  , m_actionsThreadsCount(std::max(actionsThreadsCount, (size_t)1))
+  , m_ioThreadsCount(std::max(ioThreadsCount, (size_t)1))
   , m_logger(nullptr)
 {
   m_instance = new ScServerCore();
@@ -23,6 +27,9 @@ ScServer::ScServer(std::string hostName, size_t port)
     LogMessage(ScServerErrorLevel::info, "Socket data:");
     LogMessage(ScServerErrorLevel::info, "\tHost name: " + m_hostName);
     LogMessage(ScServerErrorLevel::info, "\tPort: " + std::to_string(m_port));
+    LogMessage(ScServerErrorLevel::info, "Threads data:");
+    LogMessage(ScServerErrorLevel::info, "\tActions threads: " + std::to_string(m_actionsThreadsCount));
+    LogMessage(ScServerErrorLevel::info, "\tInput-output threads: " + std::to_string(m_ioThreadsCount));
   }
 
   m_connections = new ScServerSessionContexts();
@@ -42,10 +49,14 @@ void ScServer::Run()
   m_instance->start_accept();
 
   LogMessage(ScServerErrorLevel::info, "Start actions processing");
-  m_actionsThread = std::thread(&ScServer::EmitActions, &*this);
+  for (size_t i = 0; i < m_actionsThreadsCount; ++i)
+    m_actionsThreads.emplace_back(&ScServer::EmitActions, &*this);
 
   LogMessage(ScServerErrorLevel::info, "Start input-output processing");
-  m_ioThread = std::thread(&ScServerCore::run, &*m_instance);
+  // Handlers of one connection are called sequentially by websocketpp, so several run loops only process different
+  // connections concurrently
+  for (size_t i = 0; i < m_ioThreadsCount; ++i)
+    m_ioThreads.emplace_back(&ScServerCore::run, &*m_instance);
 
   LogMessage(ScServerErrorLevel::info, "All inner processes started");
   LogMessage(ScServerErrorLevel::info, "Sc-server run");
@@ -62,13 +73,15 @@ void ScServer::Stop()
 
   AfterInitialize();
 
-  if (m_actionsThread.joinable())
+  if (!m_actionsThreads.empty())
   {
     LogMessage(ScServerErrorLevel::info, "Stop actions processing");
-    m_actionsThread.join();
+    for (std::thread & actionsThread : m_actionsThreads)
+      actionsThread.join();
+    m_actionsThreads.clear();
   }
 
-  if (m_ioThread.joinable())
+  if (!m_ioThreads.empty())
   {
     LogMessage(ScServerErrorLevel::info, "Stop input-output processing");
 
@@ -85,7 +98,9 @@ void ScServer::Stop()
     }
 
     m_instance->stop();
-    m_ioThread.join();
+    for (std::thread & ioThread : m_ioThreads)
+      ioThread.join();
+    m_ioThreads.clear();
   }
 
   LogMessage(ScServerErrorLevel::info, "All inner processes stopped");
@@ -186,6 +201,22 @@ void ScServer::CloseConnection(
   m_instance->close(sessionId, code, reason);
 }
 
+void ScServer::PauseReading(ScServerSessionId const & sessionId)
+{
+  ScServerErrorCode errorCode;
+  m_instance->pause_reading(sessionId, errorCode);
+  if (errorCode)
+    LogMessage(ScServerErrorLevel::debug, "Unable to pause reading: " + errorCode.message());
+}
+
+void ScServer::ResumeReading(ScServerSessionId const & sessionId)
+{
+  ScServerErrorCode errorCode;
+  m_instance->resume_reading(sessionId, errorCode);
+  if (errorCode)
+    LogMessage(ScServerErrorLevel::debug, "Unable to resume reading: " + errorCode.message());
+}
+
 ScServer::~ScServer()
 {
   Shutdown();
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <utility>
+#include <vector>
 
 #include <sc-memory/sc_memory.hpp>
 
@@ -21,7 +22,7 @@ using ScServerLock = std::lock_guard<ScServerMutex>;
 class ScServer
 {
 public:
-  explicit ScServer(std::string hostName, size_t port);
+  explicit ScServer(std::string hostName, size_t port, size_t actionsThreadsCount = 1, size_t ioThreadsCount = 1);
 
   void Run();
 
@@ -55,7 +56,11 @@ public:
 
   void CloseConnection(ScServerSessionId const & sessionId, ScServerCloseCode code, std::string const & reason);
 
-  virtual void OnEvent(ScServerSessionId const & sessionId, std::string const & msg) = 0;
+  void PauseReading(ScServerSessionId const & sessionId);
+
+  void ResumeReading(ScServerSessionId const & sessionId);
+
+  virtual void OnEvent(ScServerSessionId const & sessionId, std::string const & msg, ScServerMessageType type) = 0;
 
   virtual ~ScServer();
 
@@ -63,6 +68,8 @@ protected:
   std::atomic<sc_bool> m_isServerRun = SC_FALSE;
   std::string m_hostName;
   ScServerPort m_port;
+  size_t m_actionsThreadsCount;
+  size_t m_ioThreadsCount;
 
   ScServerLogger * m_logger;
   ScServerCore * m_instance;
@@ -80,6 +87,6 @@ protected:
   virtual void OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg) = 0;
 
 private:
-  std::thread m_ioThread;
-  std::thread m_actionsThread;
+  std::vector<std::thread> m_ioThreads;
+  std::vector<std::thread> m_actionsThreads;
 };
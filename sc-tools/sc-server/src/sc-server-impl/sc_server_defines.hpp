@@ -172,6 +172,7 @@ using ScServerMessageType = websocketpp::frame::opcode::value;
 using ScServerCloseCode = websocketpp::close::status::value;
 
 using ScServerException = websocketpp::exception;
+using ScServerErrorCode = websocketpp::lib::error_code;
 
 using websocketpp::lib::bind;
 using websocketpp::lib::placeholders::_1;
@@ -10,6 +10,7 @@
 
 #include "sc_server_action.hpp"
 #include "sc_server.hpp"
+#include "sc-memory-json/sc-memory-json-action/sc_memory_template_search_cursors.hpp"
 
 class ScServerDisconnectAction : public ScServerAction
 {
@@ -22,6 +23,7 @@ public:
 
   void Emit() override
   {
+    ScMemoryTemplateSearchCursorsManager::GetInstance()->RemoveSessionCursors(m_sessionId);
     delete m_server->PopSessionContext(m_sessionId);
   }
 
@@ -15,17 +15,22 @@
 class ScServerEventCallbackAction : public ScServerAction
 {
 public:
-  ScServerEventCallbackAction(ScServer * server, ScServerSessionId sessionId, std::string msg)
+  ScServerEventCallbackAction(
+      ScServer * server,
+      ScServerSessionId sessionId,
+      std::string msg,
+      ScServerMessageType type = ScServerMessageType::text)
     : ScServerAction(std::move(sessionId))
     , m_server(server)
     , m_msg(std::move(msg))
+    , m_type(type)
   {
   }
 
   void Emit() override
   {
     if (m_server != nullptr)
-      m_server->Send(m_sessionId, m_msg, ScServerMessageType::text);
+      m_server->Send(m_sessionId, m_msg, m_type);
   }
 
   ~ScServerEventCallbackAction() override = default;
@@ -33,4 +38,5 @@ public:
 protected:
   ScServer * m_server;
   std::string m_msg;
+  ScServerMessageType m_type;
 };
@@ -13,11 +13,33 @@ extern "C"
 #include <sc-store/sc_storage.h>
 }
 
-ScServerImpl::ScServerImpl(std::string const & host, ScServerPort port, sc_bool parallelActions)
-  : ScServer(host, port)
+namespace
+{
+size_t GetActionsThreadsCount(sc_bool parallelActions, size_t actionsThreadsCount)
+{
+  if (parallelActions == SC_FALSE)
+    return 1;
+
+  if (actionsThreadsCount == 0)
+    actionsThreadsCount = std::thread::hardware_concurrency();
+  return actionsThreadsCount == 0 ? 1 : actionsThreadsCount;
+}
+}  // namespace
+
+ScServerImpl::ScServerImpl(
+    std::string const & host,
+    ScServerPort port,
+    sc_bool parallelActions,
+    size_t actionsThreadsCount,
+    size_t ioThreadsCount,
+    size_t maxSessionPendingActionsCount,
+    size_t maxPendingActionsCount)
+  : ScServer(host, port, GetActionsThreadsCount(parallelActions, actionsThreadsCount), ioThreadsCount)
   , m_parallelActions(parallelActions)
+  , m_maxSessionPendingActionsCount(maxSessionPendingActionsCount)
+  , m_maxPendingActionsCount(maxPendingActionsCount)
   , m_actionsRun(SC_TRUE)
-  , m_actions(new ScServerActions())
+  , m_pendingActionsCount(0)
 {
   ScMemoryJsonActionsHandler::InitializeActionClasses();
 }
@@ -31,116 +53,182 @@ void ScServerImpl::Initialize()
 
 void ScServerImpl::AfterInitialize()
 {
-  while (m_actions->empty() == SC_FALSE)
-    ;
+  {
+    ScServerUniqueLock actionLock(m_actionMutex);
+    m_actionsEmittedCond.wait(
+        actionLock,
+        [this]
+        {
+          return m_pendingActionsCount == 0;
+        });
 
-  m_actionsRun = SC_FALSE;
-  m_actionCond.notify_one();
+    m_actionsRun = SC_FALSE;
+  }
+  m_actionCond.notify_all();
 }
 
 void ScServerImpl::EmitActions()
 {
-  while (m_actionsRun == SC_TRUE)
+  ScServerUniqueLock actionLock(m_actionMutex);
+  while (true)
   {
-    ScServerUniqueLock actionLock(m_actionMutex);
-
     m_actionCond.wait(
         actionLock,
         [this]
         {
-          return !m_actions->empty() || !m_actionsRun;
+          return !m_readySessions.empty() || !m_actionsRun;
         });
 
     if (m_actionsRun == SC_FALSE)
       break;
 
-    ScServerAction * action = m_actions->front();
-    m_actions->pop();
+    ScServerSessionId const sessionId = m_readySessions.front();
+    m_readySessions.pop();
+
+    // Session stays scheduled while its action is emitting, so other actions threads don't take its next actions
+    auto const & it = m_sessionsActions.find(sessionId);
+    ScServerSessionActions & sessionActions = it->second;
+    ScServerAction * action = sessionActions.m_actions.front();
+    sessionActions.m_actions.pop();
 
     actionLock.unlock();
+    EmitAction(action);
+    actionLock.lock();
 
-    try
+    --m_pendingActionsCount;
+    if (!sessionActions.m_actions.empty())
+      m_readySessions.push(sessionId);
+    else if (sessionActions.m_isClosed == SC_TRUE)
     {
-      action->Emit();
+      m_pausedSessions.erase(sessionId);
+      m_sessionsActions.erase(it);
     }
-    catch (std::exception const & e)
+    else
+      sessionActions.m_isScheduled = SC_FALSE;
+
+    ResumeSessionsReading();
+
+    if (m_pendingActionsCount == 0)
+      m_actionsEmittedCond.notify_all();
+  }
+}
+
+void ScServerImpl::EmitAction(ScServerAction * action)
+{
+  // TODO(NikitaZotov): sc-server should not know about it
+  sc_storage_start_new_process();
+
+  try
+  {
+    action->Emit();
+  }
+  catch (std::exception const & e)
+  {
+    LogMessage(ScServerErrorLevel::error, e.what());
+  }
+  delete action;
+
+  sc_storage_end_new_process();
+}
+
+void ScServerImpl::PushAction(
+    ScServerSessionId const & sessionId,
+    ScServerSessionActions & sessionActions,
+    ScServerAction * action)
+{
+  sessionActions.m_actions.push(action);
+  ++m_pendingActionsCount;
+
+  if (sessionActions.m_isScheduled == SC_TRUE)
+    return;
+
+  sessionActions.m_isScheduled = SC_TRUE;
+  m_readySessions.push(sessionId);
+  m_actionCond.notify_one();
+}
+
+void ScServerImpl::ResumeSessionsReading()
+{
+  if (m_pausedSessions.empty() || m_pendingActionsCount > m_maxPendingActionsCount / 2)
+    return;
+
+  for (auto it = m_pausedSessions.begin(); it != m_pausedSessions.end();)
+  {
+    if (m_sessionsActions.at(*it).m_actions.size() > m_maxSessionPendingActionsCount / 2)
     {
-      LogMessage(ScServerErrorLevel::error, e.what());
+      ++it;
+      continue;
     }
-    delete action;
+
+    // Reading is resumed asynchronously by input-output thread, so it doesn't call handlers of sc-server here
+    ResumeReading(*it);
+    it = m_pausedSessions.erase(it);
   }
 }
 
 sc_bool ScServerImpl::IsWorkable()
 {
-  return m_actions->empty() == SC_FALSE;
+  ScServerLock actionLock(m_actionMutex);
+  return m_pendingActionsCount != 0;
 }
 
 void ScServerImpl::OnOpen(ScServerSessionId const & sessionId)
 {
-  auto * action = new ScServerConnectAction(this, sessionId);
-  {
-    ScServerLock connectionLock(m_connectionMutex);
-    ScServerLock actionLock(m_actionMutex);
-    m_actions->push(action);
-  }
-  m_actionCond.notify_one();
+  ScServerLock actionLock(m_actionMutex);
+  PushAction(sessionId, m_sessionsActions[sessionId], new ScServerConnectAction(this, sessionId));
 }
 
 void ScServerImpl::OnClose(ScServerSessionId const & sessionId)
 {
-  auto * action = new ScServerDisconnectAction(this, sessionId);
-  {
-    ScServerLock connectionLock(m_connectionMutex);
-    ScServerLock actionLock(m_actionMutex);
-    m_actions->push(action);
-  }
-  m_actionCond.notify_one();
+  ScServerLock actionLock(m_actionMutex);
+  auto const & it = m_sessionsActions.find(sessionId);
+  if (it == m_sessionsActions.cend() || it->second.m_isClosed == SC_TRUE)
+    return;
+
+  it->second.m_isClosed = SC_TRUE;
+  PushAction(sessionId, it->second, new ScServerDisconnectAction(this, sessionId));
 }
 
 void ScServerImpl::OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg)
 {
-  ScServerLock connectionLock(m_connectionMutex);
-  if (!IsSessionValid(sessionId))
+  ScServerLock actionLock(m_actionMutex);
+  auto const & it = m_sessionsActions.find(sessionId);
+  if (it == m_sessionsActions.cend() || it->second.m_isClosed == SC_TRUE)
     return;
 
-  auto * action = new ScServerMessageAction(this, sessionId, msg);
+  ScServerSessionActions & sessionActions = it->second;
+  PushAction(sessionId, sessionActions, new ScServerMessageAction(this, sessionId, msg));
 
-  if (m_parallelActions == SC_FALSE)
-  {
-    {
-      ScServerLock actionLock(m_actionMutex);
-      m_actions->push(action);
-    }
-    m_actionCond.notify_one();
-  }
-  else
-  {
-    // TODO(NikitaZotov): sc-server should not know about it
-    sc_storage_start_new_process();
-
-    action->Emit();
-    delete action;
+  if (sessionActions.m_actions.size() < m_maxSessionPendingActionsCount
+      && m_pendingActionsCount < m_maxPendingActionsCount)
+    return;
 
-    sc_storage_end_new_process();
-  }
+  // Message handler is called by input-output thread of this session, so reading is paused before the next message
+  if (m_pausedSessions.insert(sessionId).second)
+    PauseReading(sessionId);
 }
 
-void ScServerImpl::OnEvent(ScServerSessionId const & sessionId, std::string const & msg)
+void ScServerImpl::OnEvent(ScServerSessionId const & sessionId, std::string const & msg, ScServerMessageType type)
 {
-  ScServerLock connectionLock(m_connectionMutex);
-  if (!IsSessionValid(sessionId))
+  ScServerLock actionLock(m_actionMutex);
+  auto const & it = m_sessionsActions.find(sessionId);
+  if (it == m_sessionsActions.cend() || it->second.m_isClosed == SC_TRUE)
     return;
 
-  {
-    ScServerLock actionLock(m_actionMutex);
-    m_actions->push(new ScServerEventCallbackAction(this, sessionId, msg));
-  }
-  m_actionCond.notify_one();
+  PushAction(sessionId, it->second, new ScServerEventCallbackAction(this, sessionId, msg, type));
 }
 
 ScServerImpl::~ScServerImpl()
 {
+  for (auto & [sessionId, sessionActions] : m_sessionsActions)
+  {
+    while (!sessionActions.m_actions.empty())
+    {
+      delete sessionActions.m_actions.front();
+      sessionActions.m_actions.pop();
+    }
+  }
+
+  ScMemoryTemplateSearchCursorsManager::GetInstance()->Clear();
   ScMemoryJsonActionsHandler::ClearActionClasses();
-  delete m_actions;
 }
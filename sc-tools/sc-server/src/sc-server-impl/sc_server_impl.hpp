@@ -13,10 +13,53 @@ using ScServerCondVar = std::condition_variable;
 
 using ScServerActions = std::queue<ScServerAction *>;
 
+/*!
+ * @brief Pending actions of one session. They are emitted in order of their receiving by one actions thread at a time.
+ */
+struct ScServerSessionActions
+{
+  ScServerActions m_actions;
+  // Session is in queue of ready sessions, or its action is emitting now
+  sc_bool m_isScheduled = SC_FALSE;
+  // Disconnect action is pushed, so no more actions are accepted for session
+  sc_bool m_isClosed = SC_FALSE;
+};
+
+using ScServerSessionsActions = std::map<ScServerSessionId, ScServerSessionActions, std::owner_less<ScServerSessionId>>;
+using ScServerReadySessions = std::queue<ScServerSessionId>;
+using ScServerSessions = std::set<ScServerSessionId, std::owner_less<ScServerSessionId>>;
+
 class ScServerImpl : public ScServer
 {
 public:
-  explicit ScServerImpl(std::string const & host, ScServerPort port, sc_bool parallelActions);
+  static size_t constexpr DEFAULT_MAX_SESSION_PENDING_ACTIONS_COUNT = 64;
+  static size_t constexpr DEFAULT_MAX_PENDING_ACTIONS_COUNT = 4096;
+
+  /*!
+   * @brief Creates sc-server.
+   *
+   * Actions of one session are emitted in order of receiving their messages, actions of different sessions are emitted
+   * concurrently. When a session has `maxSessionPendingActionsCount` pending actions or all sessions have
+   * `maxPendingActionsCount` pending actions, sc-server stops reading messages of this session until half of them are
+   * emitted.
+   *
+   * @param host A host name of sc-server.
+   * @param port A port of sc-server.
+   * @param parallelActions If SC_FALSE, then all actions are emitted sequentially by one thread.
+   * @param actionsThreadsCount A number of threads emitting actions. If it is 0, then number of hardware threads is
+   * used.
+   * @param ioThreadsCount A number of threads running input-output loop of sc-server.
+   * @param maxSessionPendingActionsCount A maximum number of pending actions of one session.
+   * @param maxPendingActionsCount A maximum number of pending actions of all sessions.
+   */
+  explicit ScServerImpl(
+      std::string const & host,
+      ScServerPort port,
+      sc_bool parallelActions,
+      size_t actionsThreadsCount = 0,
+      size_t ioThreadsCount = 1,
+      size_t maxSessionPendingActionsCount = DEFAULT_MAX_SESSION_PENDING_ACTIONS_COUNT,
+      size_t maxPendingActionsCount = DEFAULT_MAX_PENDING_ACTIONS_COUNT);
 
   void EmitActions() override;
 
@@ -26,12 +69,17 @@ public:
 
 protected:
   ScServerMutex m_actionMutex;
-  ScServerMutex m_connectionMutex;
   ScServerCondVar m_actionCond;
+  ScServerCondVar m_actionsEmittedCond;
   sc_bool m_parallelActions;
+  size_t m_maxSessionPendingActionsCount;
+  size_t m_maxPendingActionsCount;
 
   std::atomic<sc_bool> m_actionsRun;
-  ScServerActions * m_actions;
+  ScServerSessionsActions m_sessionsActions;
+  ScServerReadySessions m_readySessions;
+  size_t m_pendingActionsCount;
+  ScServerSessions m_pausedSessions;
 
   void Initialize() override;
 
@@ -43,5 +91,14 @@ protected:
 
   void OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg) override;
 
-  void OnEvent(ScServerSessionId const & sessionId, std::string const & msg) override;
+  void OnEvent(ScServerSessionId const & sessionId, std::string const & msg, ScServerMessageType type) override;
+
+  void PushAction(
+      ScServerSessionId const & sessionId,
+      ScServerSessionActions & sessionActions,
+      ScServerAction * action);
+
+  void EmitAction(ScServerAction * action);
+
+  void ResumeSessionsReading();
 };
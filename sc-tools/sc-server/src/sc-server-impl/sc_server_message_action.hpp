@@ -25,15 +25,22 @@ public:
     : ScServerAction(sessionId)
     , m_server(server)
     , m_msg(std::move(msg))
+    , m_messageType(ScServerMessageType::text)
+    , m_actionsHandler(nullptr)
+    , m_eventsHandler(nullptr)
   {
-    ScAgentContext * sessionCtx = m_server->GetSessionContext(sessionId);
-    m_actionsHandler = new ScMemoryJsonActionsHandler(server, sessionCtx);
-    m_eventsHandler = new ScMemoryJsonEventsHandler(server, sessionCtx);
   }
 
   void HandleEmit()
   {
-    std::string const & messageType = GetMessageType(m_msg);
+    // Session context is generated by connect action of this session, that is emitted before this action
+    ScAgentContext * sessionCtx = m_server->GetSessionContext(m_sessionId);
+    m_actionsHandler = new ScMemoryJsonActionsHandler(m_server, sessionCtx);
+    m_eventsHandler = new ScMemoryJsonEventsHandler(m_server, sessionCtx);
+
+    m_messageType = ScMemoryJsonPayloadCodec::GetResponseMessageType(m_msg->get_opcode());
+    m_request = ScMemoryJsonPayloadCodec::Decode(m_msg->get_payload(), m_messageType);
+    std::string const & messageType = GetMessageType(m_request);
 
     if (IsHealthCheck(messageType))
       OnHealthCheck(m_sessionId, m_msg);
@@ -63,20 +70,22 @@ public:
 
   void OnAction(ScServerSessionId const & sessionId, ScServerMessage const & msg)
   {
-    m_server->LogMessage(ScServerErrorLevel::debug, "[request] " + msg->get_payload());
-    auto const & responseText = m_actionsHandler->Handle(sessionId, msg->get_payload());
+    m_server->LogMessage(ScServerErrorLevel::debug, "[request] " + GetLogText(msg->get_payload()));
+    auto const & responseText = ScMemoryJsonPayloadCodec::Encode(
+        m_actionsHandler->Handle(sessionId, m_request, m_messageType), m_messageType);
 
-    m_server->LogMessage(ScServerErrorLevel::debug, "[response] " + responseText);
-    m_server->Send(sessionId, responseText, ScServerMessageType::text);
+    m_server->LogMessage(ScServerErrorLevel::debug, "[response] " + GetLogText(responseText));
+    m_server->Send(sessionId, responseText, m_messageType);
   }
 
   void OnEvent(ScServerSessionId const & sessionId, ScServerMessage const & msg)
   {
-    m_server->LogMessage(ScServerErrorLevel::debug, "[event] " + msg->get_payload());
-    auto const & responseText = m_eventsHandler->Handle(sessionId, msg->get_payload());
+    m_server->LogMessage(ScServerErrorLevel::debug, "[event] " + GetLogText(msg->get_payload()));
+    auto const & responseText = ScMemoryJsonPayloadCodec::Encode(
+        m_eventsHandler->Handle(sessionId, m_request, m_messageType), m_messageType);
 
-    m_server->LogMessage(ScServerErrorLevel::debug, "[event response] " + responseText);
-    m_server->Send(sessionId, responseText, ScServerMessageType::text);
+    m_server->LogMessage(ScServerErrorLevel::debug, "[event response] " + GetLogText(responseText));
+    m_server->Send(sessionId, responseText, m_messageType);
   }
 
   void OnHealthCheck(ScServerSessionId const & sessionId, ScServerMessage const &)
@@ -101,7 +110,7 @@ public:
       m_server->LogMessage(ScServerErrorLevel::info, "I've died...");
     }
 
-    m_server->Send(sessionId, response.dump(), ScServerMessageType::text);
+    m_server->Send(sessionId, ScMemoryJsonPayloadCodec::Encode(response, m_messageType), m_messageType);
     m_server->CloseConnection(sessionId, websocketpp::close::status::normal, "Status checked");
   }
 
@@ -110,7 +119,7 @@ public:
     ScAddr const & userAddr = m_server->GetSessionContext(sessionId)->GetUser();
     ScMemoryJsonPayload response{{"connection_id", (sc_uint64)sessionId.lock().get()}, {"user_addr", userAddr.Hash()}};
 
-    m_server->Send(sessionId, response.dump(), ScServerMessageType::text);
+    m_server->Send(sessionId, ScMemoryJsonPayloadCodec::Encode(response, m_messageType), m_messageType);
   }
 
   ~ScServerMessageAction() override
@@ -122,21 +131,29 @@ public:
 protected:
   ScServer * m_server;
   ScServerMessage m_msg;
+  ScServerMessageType m_messageType;
+  // Message payload is decoded once and passed to handlers
+  ScMemoryJsonPayload m_request;
 
   ScMemoryJsonHandler * m_actionsHandler;
   ScMemoryJsonHandler * m_eventsHandler;
 
-  static std::string GetMessageType(ScServerMessage const & msg)
+  static std::string GetMessageType(ScMemoryJsonPayload const & request)
   {
-    if (ScMemoryJsonPayload::accept(msg->get_payload()))
-    {
-      ScMemoryJsonPayload const & payload = ScMemoryJsonPayload::parse(msg->get_payload());
-      return payload.contains("type") ? payload["type"].get<std::string>() : "";
-    }
+    if (request.is_object() && request.contains("type") && request["type"].is_string())
+      return request["type"].get<std::string>();
 
     return "";
   }
 
+  std::string GetLogText(std::string const & message) const
+  {
+    if (m_messageType == ScServerMessageType::binary)
+      return "<" + std::to_string(message.size()) + " bytes of MessagePack>";
+
+    return message;
+  }
+
   static sc_bool IsEvent(std::string const & messageType)
   {
     return messageType == "events";
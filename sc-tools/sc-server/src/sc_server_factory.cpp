@@ -12,8 +12,21 @@ std::shared_ptr<ScServer> ScServerFactory::ConfigureScServer(ScParams const & se
   sc_bool parallelActions = SC_TRUE;
   if (serverParams.Has("parallel_actions"))
     parallelActions = serverParams.Get<std::string>("parallel_actions") == "true";
+  size_t const actionsThreadsCount = serverParams.Get<size_t>("actions_threads", 0);
+  size_t const ioThreadsCount = serverParams.Get<size_t>("io_threads", 1);
+  size_t const maxSessionPendingActionsCount = serverParams.Get<size_t>(
+      "max_session_pending_actions", ScServerImpl::DEFAULT_MAX_SESSION_PENDING_ACTIONS_COUNT);
+  size_t const maxPendingActionsCount =
+      serverParams.Get<size_t>("max_pending_actions", ScServerImpl::DEFAULT_MAX_PENDING_ACTIONS_COUNT);
+
   std::unique_ptr<ScServer> server = std::unique_ptr<ScServer>(new ScServerImpl(
-      serverParams.Get<std::string>("host", "127.0.0.1"), serverParams.Get("port", 8090), parallelActions));
+      serverParams.Get<std::string>("host", "127.0.0.1"),
+      serverParams.Get("port", 8090),
+      parallelActions,
+      actionsThreadsCount,
+      ioThreadsCount,
+      maxSessionPendingActionsCount,
+      maxPendingActionsCount));
 
   return server;
 }
@@ -18,7 +18,7 @@ class ScClient
 {
 public:
   ScClient()
-    : m_instance(ScClientCore()), m_isNewMessage(SC_FALSE)
+    : m_instance(ScClientCore()), m_isNewMessage(SC_FALSE), m_currentMessageType(ScServerMessageType::text)
   {
     Initialize();
   }
@@ -49,19 +49,23 @@ public:
     m_thread.join();
   }
 
-  sc_bool Send(std::string const & msg)
+  sc_bool Send(std::string const & msg, ScServerMessageType type = ScServerMessageType::text)
   {
     std::this_thread::sleep_for(std::chrono::milliseconds(400));
 
     ScClientErrorCode code;
-    m_instance.send(m_connection, msg, ScServerMessageType::text, code);
+    m_instance.send(m_connection, msg, type, code);
 
     return !code;
   }
 
   void OnMessage(ScServerSessionId const &, ScServerMessage const & msg)
   {
-    m_currentPayload = ScMemoryJsonPayload::parse(msg->get_payload());
+    m_currentMessageType = msg->get_opcode() == ScServerMessageType::binary ? ScServerMessageType::binary
+                                                                            : ScServerMessageType::text;
+    m_currentPayload = m_currentMessageType == ScServerMessageType::binary
+                           ? ScMemoryJsonPayload::from_msgpack(msg->get_payload())
+                           : ScMemoryJsonPayload::parse(msg->get_payload());
     m_isNewMessage = SC_TRUE;
   }
 
@@ -76,6 +80,12 @@ public:
     return m_currentPayload;
   }
 
+  //! Returns type of websocket frame of the last received message.
+  ScServerMessageType GetResponseMessageType() const
+  {
+    return m_currentMessageType;
+  }
+
   ~ScClient() = default;
 
 private:
@@ -85,6 +95,7 @@ private:
 
   sc_bool m_isNewMessage;
   ScMemoryJsonPayload m_currentPayload;
+  ScServerMessageType m_currentMessageType;
 
   void Initialize()
   {
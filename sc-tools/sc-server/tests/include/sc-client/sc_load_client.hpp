@@ -0,0 +1,144 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <chrono>
+#include <queue>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "sc-server-impl/sc_server_defines.hpp"
+
+#include "sc_client_defines.hpp"
+
+/*!
+ * @brief Websocket client sending requests to sc-server without delays. It keeps a specified number of requests
+ * waiting for responses and measures latency of each request.
+ */
+class ScLoadClient
+{
+public:
+  using ScLoadClock = std::chrono::steady_clock;
+
+  /*!
+   * @param request A request text. Its `id` field is replaced by number of request.
+   * @param requestsCount A number of requests to send.
+   * @param pipelineDepth A maximum number of requests waiting for responses.
+   * @param messageType A type of websocket frames of requests: JSON text or MessagePack bytes.
+   */
+  ScLoadClient(
+      std::string const & request,
+      size_t requestsCount,
+      size_t pipelineDepth = 1,
+      ScServerMessageType messageType = ScServerMessageType::text)
+    : m_request(nlohmann::json::parse(request))
+    , m_requestsCount(requestsCount)
+    , m_pipelineDepth(std::max(pipelineDepth, (size_t)1))
+    , m_messageType(messageType)
+    , m_sentRequestsCount(0)
+  {
+    m_instance.clear_access_channels(ScServerErrorLevel::all);
+    m_instance.clear_error_channels(ScServerErrorLevel::all);
+
+    m_instance.init_asio();
+
+    m_instance.set_open_handler(bind(&ScLoadClient::OnOpen, this, ::_1));
+    m_instance.set_message_handler(bind(&ScLoadClient::OnMessage, this, ::_1, ::_2));
+  }
+
+  /*!
+   * @brief Connects to sc-server, sends all requests and waits for all responses.
+   * @param uri An URI of sc-server.
+   * @return SC_TRUE if all responses are received, otherwise SC_FALSE.
+   */
+  sc_bool Run(std::string const & uri)
+  {
+    ScClientErrorCode code;
+    ScClientConnection const & connection = m_instance.get_connection(uri, code);
+    if (code)
+      return SC_FALSE;
+
+    m_instance.connect(connection);
+    m_instance.run();
+
+    return m_responsesIds.size() == m_requestsCount;
+  }
+
+  //! Returns latencies of requests in microseconds in order of receiving their responses.
+  std::vector<double> const & GetLatencies() const
+  {
+    return m_latencies;
+  }
+
+  //! Returns ids of responses in order of their receiving.
+  std::vector<size_t> const & GetResponsesIds() const
+  {
+    return m_responsesIds;
+  }
+
+private:
+  ScClientCore m_instance;
+
+  nlohmann::json m_request;
+  size_t m_requestsCount;
+  size_t m_pipelineDepth;
+  ScServerMessageType m_messageType;
+  size_t m_sentRequestsCount;
+
+  // Responses of one connection are sent by sc-server in order of requests
+  std::queue<ScLoadClock::time_point> m_sendTimes;
+  std::vector<double> m_latencies;
+  std::vector<size_t> m_responsesIds;
+
+  void SendRequest(ScServerSessionId const & sessionId)
+  {
+    m_request["id"] = ++m_sentRequestsCount;
+    m_sendTimes.push(ScLoadClock::now());
+
+    std::string message;
+    if (m_messageType == ScServerMessageType::binary)
+      nlohmann::json::to_msgpack(m_request, message);
+    else
+      message = m_request.dump();
+
+    ScClientErrorCode code;
+    m_instance.send(sessionId, message, m_messageType, code);
+  }
+
+  void OnOpen(ScServerSessionId const & sessionId)
+  {
+    while (m_sentRequestsCount < std::min(m_pipelineDepth, m_requestsCount))
+      SendRequest(sessionId);
+
+    if (m_requestsCount == 0)
+      Close(sessionId);
+  }
+
+  void OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg)
+  {
+    std::chrono::duration<double, std::micro> const latency = ScLoadClock::now() - m_sendTimes.front();
+    m_sendTimes.pop();
+    m_latencies.push_back(latency.count());
+
+    nlohmann::json const & response = msg->get_opcode() == ScServerMessageType::binary
+                                          ? nlohmann::json::from_msgpack(msg->get_payload())
+                                          : nlohmann::json::parse(msg->get_payload());
+    m_responsesIds.push_back(response.contains("id") ? response["id"].get<size_t>() : 0);
+
+    if (m_sentRequestsCount < m_requestsCount)
+      SendRequest(sessionId);
+    else if (m_sendTimes.empty())
+      Close(sessionId);
+  }
+
+  void Close(ScServerSessionId const & sessionId)
+  {
+    ScClientErrorCode code;
+    m_instance.close(sessionId, websocketpp::close::status::normal, "", code);
+  }
+};
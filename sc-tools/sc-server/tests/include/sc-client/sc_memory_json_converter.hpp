@@ -24,4 +24,17 @@ public:
 
     return output.dump();
   }
+
+  //! Forms message encoded by MessagePack to send it in binary websocket frame.
+  static std::string FromBinary(size_t messageId, std::string type, ScMemoryJsonPayload const & payload)
+  {
+    ScMemoryJsonPayload output;
+    output["id"] = messageId;
+    output["type"] = type;
+    output["payload"] = payload;
+
+    std::string message;
+    ScMemoryJsonPayload::to_msgpack(output, message);
+    return message;
+  }
 };
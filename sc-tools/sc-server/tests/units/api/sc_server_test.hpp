@@ -51,7 +51,10 @@ protected:
     std::filesystem::remove_all(SC_SERVER_KB_BIN);
   }
 
-  void Initialize(sc_bool parallel_actions)
+  void Initialize(
+      sc_bool parallel_actions,
+      size_t maxSessionPendingActionsCount = ScServerImpl::DEFAULT_MAX_SESSION_PENDING_ACTIONS_COUNT,
+      size_t maxPendingActionsCount = ScServerImpl::DEFAULT_MAX_PENDING_ACTIONS_COUNT)
   {
     sc_memory_params params;
     sc_memory_params_clear(&params);
@@ -64,7 +67,8 @@ protected:
 
     ScMemory::LogMute();
     ScMemory::Initialize(params);
-    m_server = std::make_unique<ScServerImpl>("127.0.0.1", 8898, parallel_actions);
+    m_server = std::make_unique<ScServerImpl>(
+        "127.0.0.1", 8898, parallel_actions, 0, 1, maxSessionPendingActionsCount, maxPendingActionsCount);
     m_server->ClearChannels();
     m_server->Run();
     ScMemory::LogUnmute();
@@ -93,3 +97,13 @@ protected:
     m_ctx = std::make_unique<ScAgentContext>();
   }
 };
+
+class ScServerTestWithPendingActionsLimits : public ScServerTest
+{
+protected:
+  void SetUp() override
+  {
+    Initialize(SC_TRUE, 2, 4);
+    m_ctx = std::make_unique<ScAgentContext>();
+  }
+};
@@ -17,6 +17,8 @@ extern "C"
 
 #include "sc-client/sc_memory_json_converter.hpp"
 
+#include "sc-server-impl/sc-memory-json/sc-memory-json-action/sc_memory_template_search_cursors.hpp"
+
 TEST_F(ScServerTest, GenerateElements)
 {
   ScClient client;
@@ -1527,6 +1529,191 @@ TEST_F(ScServerTest, SearchTemplateByAddr)
   client.Stop();
 }
 
+TEST_F(ScServerTest, SearchTemplateByPages)
+{
+  ScAddr const & setAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  for (size_t i = 0; i < 5; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, setAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = ScMemoryJsonPayload::array({
+      {
+          {
+              {"type", "addr"},
+              {"value", setAddr.Hash()},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarPermPosArc},
+              {"alias", "_arc"},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarNode},
+              {"alias", "_element"},
+          },
+      },
+  });
+  payload["params"] = ScMemoryJsonPayload::object();
+  payload["page_size"] = 2;
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "search_template", payload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 2u);
+  EXPECT_FALSE(response["payload"]["finished"].get<bool>());
+  EXPECT_EQ(response["payload"]["aliases"]["_element"].get<size_t>(), 2u);
+  auto const cursorId = response["payload"]["cursor"].get<size_t>();
+
+  std::unordered_set<size_t> elements;
+  auto const & AddElements = [&elements](ScMemoryJsonPayload const & addrs)
+  {
+    for (auto const & addrsItem : addrs)
+    {
+      EXPECT_TRUE(addrsItem[0].get<size_t>() != 0);
+      elements.insert(addrsItem[2].get<size_t>());
+    }
+  };
+  AddElements(response["payload"]["addrs"]);
+
+  ScMemoryJsonPayload pagePayload = {{"cursor", cursorId}, {"page_size", 2}};
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "search_template_page", pagePayload)));
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 2u);
+  EXPECT_FALSE(response["payload"]["finished"].get<bool>());
+  AddElements(response["payload"]["addrs"]);
+
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(2, "search_template_page", pagePayload)));
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+  EXPECT_TRUE(response["payload"]["finished"].get<bool>());
+  AddElements(response["payload"]["addrs"]);
+  EXPECT_EQ(elements.size(), 5u);
+
+  // cursor is closed when search is finished
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(3, "search_template_page", pagePayload)));
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, CloseTemplateSearchCursor)
+{
+  ScAddr const & setAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  for (size_t i = 0; i < 5; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, setAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = ScMemoryJsonPayload::array({
+      {
+          {
+              {"type", "addr"},
+              {"value", setAddr.Hash()},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarPermPosArc},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarNode},
+          },
+      },
+  });
+  payload["params"] = ScMemoryJsonPayload::object();
+  payload["page_size"] = 1;
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "search_template", payload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+  auto const cursorId = response["payload"]["cursor"].get<size_t>();
+
+  ScMemoryJsonPayload closePayload = {{"cursor", cursorId}, {"close", true}};
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "search_template_page", closePayload)));
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["payload"]["finished"].get<bool>());
+
+  ScMemoryJsonPayload pagePayload = {{"cursor", cursorId}, {"page_size", 1}};
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(2, "search_template_page", pagePayload)));
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, OpenTemplateSearchCursorsMoreThanMaximum)
+{
+  ScAddr const & setAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  for (size_t i = 0; i < 2; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, setAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = ScMemoryJsonPayload::array({
+      {
+          {
+              {"type", "addr"},
+              {"value", setAddr.Hash()},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarPermPosArc},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarNode},
+          },
+      },
+  });
+  payload["params"] = ScMemoryJsonPayload::object();
+  payload["page_size"] = 1;
+
+  size_t cursorId = 0;
+  size_t const maxCursorsCount = ScMemoryTemplateSearchCursorsManager::MAX_SESSION_CURSORS_COUNT;
+  for (size_t i = 0; i < maxCursorsCount; ++i)
+  {
+    EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(i, "search_template", payload)));
+    auto const & response = client.GetResponseMessage();
+    EXPECT_TRUE(response["status"].get<sc_bool>());
+    EXPECT_FALSE(response["payload"]["finished"].get<bool>());
+    cursorId = response["payload"]["cursor"].get<size_t>();
+  }
+
+  // cursor isn't opened, when session has maximum count of opened cursors
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(maxCursorsCount, "search_template", payload)));
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+
+  ScMemoryJsonPayload closePayload = {{"cursor", cursorId}, {"close", true}};
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(maxCursorsCount + 1, "search_template_page", closePayload)));
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(maxCursorsCount + 2, "search_template", payload)));
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["payload"]["finished"].get<bool>());
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, GenerateTemplate)
 {
   ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
@@ -1833,3 +2020,219 @@ TEST_F(ScServerTest, UnknownJson)
 
   client.Stop();
 }
+
+TEST_F(ScServerTest, GenerateElementsInBinaryMessage)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const content = std::string("binary\0content", 14);
+  std::string const payloadString = ScMemoryJsonConverter::FromBinary(
+      0,
+      "create_elements",
+      ScMemoryJsonPayload::array({
+          {
+              {"el", "node"},
+              {"type", sc_type_node | sc_type_const},
+          },
+          {
+              {"el", "link"},
+              {"type", sc_type_const_node_link},
+              {"content", ScMemoryJsonPayload::binary({content.cbegin(), content.cend()})},
+          },
+      }));
+  EXPECT_TRUE(client.Send(payloadString, ScServerMessageType::binary));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_EQ(client.GetResponseMessageType(), ScServerMessageType::binary);
+  EXPECT_FALSE(response.is_null());
+  auto const & responsePayload = response["payload"];
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  ScAddr const & nodeAddr = ScAddr(responsePayload[0].get<size_t>());
+  EXPECT_TRUE(m_ctx->GetElementType(nodeAddr).IsNode());
+  ScAddr const & linkAddr = ScAddr(responsePayload[1].get<size_t>());
+  EXPECT_TRUE(m_ctx->GetElementType(linkAddr).IsLink());
+
+  std::string linkContent;
+  EXPECT_TRUE(m_ctx->GetLinkContent(linkAddr, linkContent));
+  EXPECT_EQ(linkContent, content);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, HandleContentInBinaryMessage)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & link = m_ctx->GenerateLink();
+  std::string const content = "some binary content";
+
+  std::string const payloadString = ScMemoryJsonConverter::FromBinary(
+      0,
+      "content",
+      ScMemoryJsonPayload::array({
+          {
+              {"command", "set"},
+              {"type", "binary"},
+              {"data", ScMemoryJsonPayload::binary({content.cbegin(), content.cend()})},
+              {"addr", link.Hash()},
+          },
+          {
+              {"command", "get"},
+              {"addr", link.Hash()},
+          },
+          {
+              {"command", "find"},
+              {"data", ScMemoryJsonPayload::binary({content.cbegin(), content.cend()})},
+          },
+      }));
+  EXPECT_TRUE(client.Send(payloadString, ScServerMessageType::binary));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_EQ(client.GetResponseMessageType(), ScServerMessageType::binary);
+  auto const & responsePayload = response["payload"];
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  EXPECT_TRUE(responsePayload[0].get<sc_bool>());
+  EXPECT_EQ(responsePayload[1]["value"].get<std::string>(), content);
+  auto const links = responsePayload[2].get<std::vector<size_t>>();
+  EXPECT_TRUE(std::find(links.cbegin(), links.cend(), link.Hash()) != links.cend());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, HandleEventsInBinaryMessage)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::string const payloadString = ScMemoryJsonConverter::FromBinary(
+      0,
+      "events",
+      ScMemoryJsonPayload::object({{
+          "create",
+          ScMemoryJsonPayload::array({
+              {
+                  {"type", "sc_event_after_generate_outgoing_arc"},
+                  {"addr", addr1.Hash()},
+              },
+          }),
+      }}));
+  EXPECT_TRUE(client.Send(payloadString, ScServerMessageType::binary));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_EQ(client.GetResponseMessageType(), ScServerMessageType::binary);
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["event"].get<sc_bool>());
+
+  ScAddr const & addr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & connectorAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, addr2);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+  response = client.GetResponseMessage();
+  EXPECT_EQ(client.GetResponseMessageType(), ScServerMessageType::binary);
+  EXPECT_TRUE(response["event"].get<sc_bool>());
+
+  auto const & responsePayload = response["payload"];
+  EXPECT_EQ(responsePayload[0].get<uint64_t>(), addr1.Hash());
+  EXPECT_EQ(responsePayload[1].get<uint64_t>(), connectorAddr.Hash());
+  EXPECT_EQ(responsePayload[2].get<uint64_t>(), addr2.Hash());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, HandleEventsOfSessionsInParallel)
+{
+  size_t const clientsCount = 16;
+  std::vector<std::unique_ptr<ScClient>> clients;
+  std::vector<ScAddr> nodes;
+  for (size_t i = 0; i < clientsCount; ++i)
+  {
+    clients.push_back(std::make_unique<ScClient>());
+    EXPECT_TRUE(clients.back()->Connect(m_server->GetUri()));
+    clients.back()->Run();
+    nodes.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+  }
+
+  // sc-events of different sessions are subscribed by different actions threads concurrently
+  std::vector<size_t> subscriptionsIds(clientsCount);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < clientsCount; ++i)
+  {
+    threads.emplace_back(
+        [&, i]()
+        {
+          std::string const payloadString = ScMemoryJsonConverter::From(
+              0,
+              "events",
+              ScMemoryJsonPayload::object({{
+                  "create",
+                  ScMemoryJsonPayload::array({
+                      {
+                          {"type", "sc_event_after_generate_outgoing_arc"},
+                          {"addr", nodes[i].Hash()},
+                      },
+                  }),
+              }}));
+          EXPECT_TRUE(clients[i]->Send(payloadString));
+
+          auto const response = clients[i]->GetResponseMessage();
+          EXPECT_TRUE(response["status"].get<sc_bool>());
+          subscriptionsIds[i] = response["payload"][0].get<size_t>();
+        });
+  }
+  for (std::thread & thread : threads)
+    thread.join();
+
+  std::unordered_set<size_t> const uniqueSubscriptionsIds{subscriptionsIds.cbegin(), subscriptionsIds.cend()};
+  EXPECT_EQ(uniqueSubscriptionsIds.size(), clientsCount);
+
+  for (ScAddr const & nodeAddr : nodes)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  // each sc-event is sent with identifier of subscription returned to its session
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+  for (size_t i = 0; i < clientsCount; ++i)
+  {
+    auto const response = clients[i]->GetResponseMessage();
+    EXPECT_TRUE(response["event"].get<sc_bool>());
+    EXPECT_EQ(response["id"].get<size_t>(), subscriptionsIds[i]);
+    EXPECT_EQ(response["payload"][0].get<uint64_t>(), nodes[i].Hash());
+  }
+
+  ScMemoryJsonPayload deletePayload = ScMemoryJsonPayload::array();
+  for (size_t const subscriptionId : subscriptionsIds)
+    deletePayload.push_back(subscriptionId);
+  EXPECT_TRUE(clients[0]->Send(
+      ScMemoryJsonConverter::From(1, "events", ScMemoryJsonPayload::object({{"delete", deletePayload}}))));
+  auto const response = clients[0]->GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  for (auto const & client : clients)
+    client->Stop();
+}
+
+TEST_F(ScServerTest, UnknownBinaryMessage)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = "\xc1";
+  EXPECT_TRUE(client.Send(payloadString, ScServerMessageType::binary));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_EQ(client.GetResponseMessageType(), ScServerMessageType::binary);
+  EXPECT_TRUE(response.is_string());
+
+  client.Stop();
+}
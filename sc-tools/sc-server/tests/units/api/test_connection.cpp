@@ -11,6 +11,7 @@
 #include <sc-config/sc_memory_config.hpp>
 
 #include "sc-client/sc_client.hpp"
+#include "sc-client/sc_load_client.hpp"
 
 #include "sc_server_module.hpp"
 
@@ -112,6 +113,51 @@ TEST_F(ScServerTestWithoutParallelMode, HealthcheckOK)
   client.Stop();
 }
 
+void TEST_PIPELINED_REQUESTS(std::unique_ptr<ScServer> const & server, size_t const clientsCount)
+{
+  size_t const REQUESTS_COUNT = 50;
+  size_t const PIPELINE_DEPTH = 10;
+  std::string const request = R"({"id": 0, "type": "check_elements", "payload": [1]})";
+
+  std::vector<std::unique_ptr<ScLoadClient>> clients;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < clientsCount; ++i)
+  {
+    clients.push_back(std::make_unique<ScLoadClient>(request, REQUESTS_COUNT, PIPELINE_DEPTH));
+    threads.emplace_back(
+        [&server, client = clients.back().get()]()
+        {
+          EXPECT_TRUE(client->Run(server->GetUri()));
+        });
+  }
+
+  for (std::thread & thread : threads)
+    thread.join();
+
+  for (auto const & client : clients)
+  {
+    std::vector<size_t> const & responsesIds = client->GetResponsesIds();
+    EXPECT_EQ(responsesIds.size(), REQUESTS_COUNT);
+    for (size_t i = 0; i < responsesIds.size(); ++i)
+      EXPECT_EQ(responsesIds[i], i + 1);
+  }
+}
+
+TEST_F(ScServerTest, PipelinedRequestsOrder)
+{
+  TEST_PIPELINED_REQUESTS(m_server, 8);
+}
+
+TEST_F(ScServerTestWithoutParallelMode, PipelinedRequestsOrder)
+{
+  TEST_PIPELINED_REQUESTS(m_server, 8);
+}
+
+TEST_F(ScServerTestWithPendingActionsLimits, PipelinedRequestsOrder)
+{
+  TEST_PIPELINED_REQUESTS(m_server, 8);
+}
+
 void TEST_N_CONNECTIONS(std::unique_ptr<ScServer> const & server, size_t const amount)
 {
   size_t const CONNECTIONS = amount;
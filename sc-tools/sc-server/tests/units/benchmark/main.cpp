@@ -12,6 +12,7 @@
 #include "units/sc_server_generate_link.hpp"
 #include "units/sc_server_erase_elements.hpp"
 #include "units/sc_server_search_template.hpp"
+#include "units/sc_server_load.hpp"
 
 #include <atomic>
 
@@ -184,4 +185,51 @@ BENCHMARK_TEMPLATE(BM_ServerRanged, TestEraseElements)->Unit(benchmark::TimeUnit
 
 BENCHMARK_TEMPLATE(BM_ServerRanged, TestSearchTemplate)->Unit(benchmark::TimeUnit::kMicrosecond)->Iterations(1000);
 
+// ------------------------------------
+size_t constexpr kLoadRequestsPerClient = 200;
+size_t constexpr kLoadPipelineDepth = 4;
+
+template <ScServerMessageType messageType>
+void BM_ServerLoad(benchmark::State & state)
+{
+  auto const clientsCount = (size_t)state.range(0);
+
+  TestScServerLoad test;
+  test.Initialize(50);
+
+  std::vector<double> latencies;
+  for (auto _ : state)
+  {
+    std::vector<double> const iterationLatencies =
+        test.Run(clientsCount, kLoadRequestsPerClient, kLoadPipelineDepth, messageType);
+    latencies.insert(latencies.end(), iterationLatencies.cbegin(), iterationLatencies.cend());
+  }
+
+  test.WaitServer();
+
+  state.counters["throughput"] = benchmark::Counter((double)latencies.size(), benchmark::Counter::kIsRate);
+  state.counters["p50_latency_us"] = TestScServerLoad::GetPercentile(latencies, 0.5);
+  state.counters["p99_latency_us"] = TestScServerLoad::GetPercentile(latencies, 0.99);
+
+  test.Shutdown();
+}
+
+BENCHMARK_TEMPLATE(BM_ServerLoad, ScServerMessageType::text)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->Arg(128)
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_ServerLoad, ScServerMessageType::binary)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->Arg(128)
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_server_test.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include "sc-client/sc_load_client.hpp"
+#include "sc-client/sc_memory_json_converter.hpp"
+
+class TestScServerLoad : public TestScServer
+{
+public:
+  /*!
+   * @brief Runs clients concurrently, each of them sends `requestsCount` requests keeping `pipelineDepth` of them
+   * waiting for responses.
+   * @return Latencies of all received responses in microseconds.
+   */
+  std::vector<double> Run(
+      size_t clientsCount,
+      size_t requestsCount,
+      size_t pipelineDepth,
+      ScServerMessageType messageType = ScServerMessageType::text)
+  {
+    std::vector<std::unique_ptr<ScLoadClient>> clients;
+    clients.reserve(clientsCount);
+    for (size_t i = 0; i < clientsCount; ++i)
+      clients.push_back(std::make_unique<ScLoadClient>(GetRequest(), requestsCount, pipelineDepth, messageType));
+
+    std::vector<std::thread> threads;
+    threads.reserve(clientsCount);
+    for (auto const & client : clients)
+      threads.emplace_back(
+          [this, &client]()
+          {
+            client->Run(m_server->GetUri());
+          });
+
+    for (std::thread & thread : threads)
+      thread.join();
+
+    std::vector<double> latencies;
+    for (auto const & client : clients)
+      latencies.insert(latencies.end(), client->GetLatencies().cbegin(), client->GetLatencies().cend());
+    return latencies;
+  }
+
+  static double GetPercentile(std::vector<double> & values, double percentile)
+  {
+    if (values.empty())
+      return 0;
+
+    size_t const index = std::min(values.size() - 1, (size_t)(percentile * (double)values.size()));
+    std::nth_element(values.begin(), values.begin() + (long)index, values.end());
+    return values[index];
+  }
+
+  void Setup(size_t connectorsNum) override
+  {
+    size_t const nodesNum = 10;
+    m_nodes.reserve(nodesNum);
+    for (size_t i = 0; i < nodesNum; ++i)
+      m_nodes.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+
+    for (size_t i = 0; i < connectorsNum; ++i)
+      m_ctx->GenerateConnector(
+          ScType::ConstPermPosArc, m_nodes[random() % m_nodes.size()], m_nodes[random() % m_nodes.size()]);
+  }
+
+private:
+  ScAddrVector m_nodes;
+
+  std::string GetRequest()
+  {
+    return ScMemoryJsonConverter::From(
+        0,
+        "search_template",
+        ScMemoryJsonPayload::array({
+            {
+                {
+                    {"type", "addr"},
+                    {"value", m_nodes[random() % m_nodes.size()].Hash()},
+                    {"alias", "_src"},
+                },
+                {
+                    {"type", "type"},
+                    {"value", sc_type_var_perm_pos_arc | sc_type_var},
+                    {"alias", "_connector1"},
+                },
+                {
+                    {"type", "type"},
+                    {"value", sc_type_node | sc_type_var},
+                    {"alias", "_trg"},
+                },
+            },
+        }));
+  }
+};